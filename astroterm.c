@@ -1,13 +1,26 @@
+#include "src/arena.c"
 #include "src/astro.c"
 #include "src/bit.c"
+#include "src/canvas.c"
 #include "src/city.c"
+#include "src/city_hash.c"
 #include "src/coord.c"
 #include "src/core.c"
 #include "src/core_position.c"
+#include "src/ephemeris.c"
+#include "src/events.c"
 #include "src/core_render.c"
 #include "src/drawing.c"
+#include "src/export.c"
+#include "src/frame_stats.c"
 #include "src/main.c"
+#include "src/minor_bodies.c"
+#include "src/observers.c"
 #include "src/parse_BSC5.c"
+#include "src/pool.c"
+#include "src/recording.c"
+#include "src/redraw.c"
+#include "src/star_buffer.c"
 #include "src/stopwatch.c"
 #include "src/strptime.c"
 #include "src/term.c"
@@ -0,0 +1,115 @@
+#include "bench.h"
+
+#include "stopwatch.h"
+#include "version.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+volatile double bench_sink;
+
+// Time `ops` operations in nanoseconds, or return false if the clock failed
+static bool time_ops(BenchFunc func, void *context, long ops, unsigned long long *nsec)
+{
+    struct SwTimestamp begin, end;
+    if (sw_gettime(&begin) != 0)
+    {
+        return false;
+    }
+
+    func(context, ops);
+
+    if (sw_gettime(&end) != 0)
+    {
+        return false;
+    }
+    return sw_timediff_nsec(end, begin, nsec) == 0;
+}
+
+static int compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+bool bench_run(const char *name, BenchFunc func, void *context, long items, struct BenchResult *result)
+{
+    // Double the operations per repetition until a repetition is long enough
+    // to time accurately, and keep running until the warmup period has passed
+    long ops = 1;
+    unsigned long long warmup = 0;
+    while (true)
+    {
+        unsigned long long nsec;
+        if (!time_ops(func, context, ops, &nsec))
+        {
+            printf("ERROR: Unable to read the clock for benchmark %s\n", name);
+            return false;
+        }
+        warmup += nsec;
+
+        if (nsec < BENCH_REP_NSEC)
+        {
+            ops *= 2;
+        }
+        else if (warmup >= BENCH_WARMUP_NSEC)
+        {
+            break;
+        }
+    }
+
+    double per_op[BENCH_REPETITIONS];
+    for (int i = 0; i < BENCH_REPETITIONS; ++i)
+    {
+        unsigned long long nsec;
+        if (!time_ops(func, context, ops, &nsec))
+        {
+            printf("ERROR: Unable to read the clock for benchmark %s\n", name);
+            return false;
+        }
+        per_op[i] = (double)nsec / ops;
+    }
+
+    qsort(per_op, BENCH_REPETITIONS, sizeof(double), compare_doubles);
+
+    *result = (struct BenchResult){
+        .name = name,
+        .items = items,
+        .ops_per_rep = ops,
+        .repetitions = BENCH_REPETITIONS,
+        .median_ns = per_op[BENCH_REPETITIONS / 2],
+        .p99_ns = per_op[(BENCH_REPETITIONS * 99 + 99) / 100 - 1],
+        .min_ns = per_op[0],
+    };
+
+    return true;
+}
+
+void bench_print_table(const struct BenchResult *results, int num_results, FILE *stream)
+{
+    fprintf(stream, "%-30s %8s %14s %14s %14s %14s\n", "benchmark", "items", "median (ns)", "p99 (ns)", "min (ns)",
+            "ns/item");
+    for (int i = 0; i < num_results; ++i)
+    {
+        const struct BenchResult *r = &results[i];
+        fprintf(stream, "%-30s %8ld %14.1f %14.1f %14.1f %14.2f\n", r->name, r->items, r->median_ns, r->p99_ns,
+                r->min_ns, r->median_ns / r->items);
+    }
+}
+
+void bench_print_json(const struct BenchResult *results, int num_results, FILE *stream)
+{
+    fprintf(stream, "{\n  \"version\": \"%s\",\n  \"benchmarks\": [\n", PROJ_VERSION);
+    for (int i = 0; i < num_results; ++i)
+    {
+        const struct BenchResult *r = &results[i];
+        fprintf(stream,
+                "    {\"name\": \"%s\", \"items\": %ld, \"ops_per_rep\": %ld, \"repetitions\": %d, "
+                "\"median_ns\": %.3f, \"p99_ns\": %.3f, \"min_ns\": %.3f}%s\n",
+                r->name, r->items, r->ops_per_rep, r->repetitions, r->median_ns, r->p99_ns, r->min_ns,
+                i + 1 < num_results ? "," : "");
+    }
+    fprintf(stream, "  ]\n}\n");
+}
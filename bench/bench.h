@@ -0,0 +1,53 @@
+/* Minimal microbenchmark harness
+ *
+ * Each benchmark is warmed up while the number of operations per repetition
+ * is calibrated so that a repetition takes about BENCH_REP_NSEC. The time per
+ * operation of every repetition is then recorded and summarized by its median
+ * and 99th percentile, which are less sensitive to scheduling noise than the
+ * mean.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#define BENCH_WARMUP_NSEC 20000000ULL
+#define BENCH_REP_NSEC 1000000ULL
+#define BENCH_REPETITIONS 101
+
+/* Run `ops` operations of a benchmark
+ */
+typedef void (*BenchFunc)(void *context, long ops);
+
+struct BenchResult
+{
+    const char *name;
+    long items;       // Items processed per operation, e.g. stars per update
+    long ops_per_rep; // Operations timed together in one repetition
+    int repetitions;
+    double median_ns; // Time per operation
+    double p99_ns;
+    double min_ns;
+};
+
+/* Results of benchmark functions should be accumulated here so that the
+ * compiler cannot discard the work
+ */
+extern volatile double bench_sink;
+
+/* Warm up, calibrate and time a benchmark. Returns false if the clock could not
+ * be read
+ */
+bool bench_run(const char *name, BenchFunc func, void *context, long items, struct BenchResult *result);
+
+/* Print results as an aligned table
+ */
+void bench_print_table(const struct BenchResult *results, int num_results, FILE *stream);
+
+/* Print results as JSON, for tracking regressions between releases
+ */
+void bench_print_json(const struct BenchResult *results, int num_results, FILE *stream);
+
+#endif // BENCH_H
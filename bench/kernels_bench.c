@@ -0,0 +1,449 @@
+/* Microbenchmarks of the per-frame kernels and the startup parsers.
+ *
+ * Usage: kernels_bench [--json] [NAME]...
+ *
+ * Only benchmarks whose name contains one of the NAMEs are run. With --json,
+ * results are printed as JSON instead of a table.
+ */
+
+#include "bsc5.h"
+#include "bsc5_constellations.h"
+#include "bench/bench.c"
+#include "data/keplerian_elements.c"
+#include "src/arena.c"
+#include "src/astro.c"
+#include "src/bit.c"
+#include "src/canvas.c"
+#include "src/city.c"
+#include "src/city_hash.c"
+#include "src/coord.c"
+#include "src/core.c"
+#include "src/core_position.c"
+#include "src/core_render.c"
+#include "src/ephemeris.c"
+#include "src/drawing.c"
+#include "src/export.c"
+#include "src/minor_bodies.c"
+#include "src/observers.c"
+#include "src/parse_BSC5.c"
+#include "src/pool.c"
+#include "src/stopwatch.c"
+#include "src/strptime.c"
+#include "src/term.c"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Inputs are cycled through so that each operation sees different values
+#define NUM_INPUTS 1024
+
+#define CANVAS_HEIGHT 40
+#define CANVAS_WIDTH 80
+
+// Size of an MPCORB.DAT with numbered asteroids only, roughly
+#define NUM_MINOR_BODIES 100000
+
+static unsigned long long rng_state = 0x2545F4914F6CDD1DULL;
+
+static double random_unit(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (rng_state >> 11) * (1.0 / 9007199254740992.0);
+}
+
+struct Inputs
+{
+    double julian_date[NUM_INPUTS];
+    double right_ascension[NUM_INPUTS];
+    double declination[NUM_INPUTS];
+    double azimuth[NUM_INPUTS];
+    double altitude[NUM_INPUTS];
+    double r[NUM_INPUTS];
+    double xh[NUM_INPUTS], yh[NUM_INPUTS], zh[NUM_INPUTS]; // Directions of azimuth and altitude
+    int ya[NUM_INPUTS], xa[NUM_INPUTS], yb[NUM_INPUTS], xb[NUM_INPUTS];
+
+    struct Star *star_table;
+    unsigned int num_stars;
+    struct ConstellTable constell_table;
+    struct StarCell *star_cells;
+    struct Conf config;
+    struct Planet *planet_table;
+    struct Ephemeris ephemeris;
+    double frame_date;
+    struct MinorBodies minor_bodies;
+    struct Observers observers;
+    double *observed; // Azimuth and altitude for each observer
+    struct Canvas canvas;
+};
+
+static void fill_inputs(struct Inputs *in)
+{
+    for (int i = 0; i < NUM_INPUTS; ++i)
+    {
+        in->julian_date[i] = 2451545.0 + 36525.0 * random_unit();
+        in->right_ascension[i] = 2 * M_PI * random_unit();
+        in->declination[i] = asin(2 * random_unit() - 1);
+        in->azimuth[i] = 2 * M_PI * random_unit();
+        in->altitude[i] = M_PI / 2 * random_unit();
+        in->r[i] = random_unit();
+        horizontal_spherical_to_rectangular(in->azimuth[i], in->altitude[i], &in->xh[i], &in->yh[i], &in->zh[i]);
+        in->ya[i] = (int)(CANVAS_HEIGHT * random_unit());
+        in->xa[i] = (int)(CANVAS_WIDTH * random_unit());
+        in->yb[i] = (int)(CANVAS_HEIGHT * random_unit());
+        in->xb[i] = (int)(CANVAS_WIDTH * random_unit());
+    }
+}
+
+static void bench_update_star_positions(void *context, long ops)
+{
+    struct Inputs *in = context;
+    for (long i = 0; i < ops; ++i)
+    {
+        update_star_positions(in->star_table, in->num_stars, in->julian_date[i % NUM_INPUTS], 0.7, -1.2);
+    }
+    bench_sink += in->star_table[0].base.altitude;
+}
+
+static void bench_update_planet_positions(void *context, long ops)
+{
+    struct Inputs *in = context;
+    for (long i = 0; i < ops; ++i)
+    {
+        update_planet_positions(in->planet_table, in->julian_date[i % NUM_INPUTS], 0.7, -1.2);
+    }
+    bench_sink += in->planet_table[SUN].base.altitude;
+}
+
+// Frames a minute apart, as in the render loop at normal speed
+static void bench_update_planet_positions_cached(void *context, long ops)
+{
+    struct Inputs *in = context;
+    for (long i = 0; i < ops; ++i)
+    {
+        update_planet_positions_cached(&in->ephemeris, in->planet_table, in->frame_date, 0.7, -1.2);
+        in->frame_date += 1.0 / 1440.0;
+    }
+    bench_sink += in->planet_table[SUN].base.altitude;
+}
+
+// Main belt orbits, all propagated as if the threshold were unlimited
+static bool fill_minor_bodies(struct MinorBodies *bodies)
+{
+    struct MinorBody *elements = calloc(NUM_MINOR_BODIES, sizeof(struct MinorBody));
+    if (elements == NULL)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < NUM_MINOR_BODIES; ++i)
+    {
+        elements[i] = (struct MinorBody){
+            .epoch = 2460200.5,
+            .mean_anomaly = 360.0 * random_unit(),
+            .semi_major = 2.1 + 1.2 * random_unit(),
+            .eccentricity = 0.3 * random_unit(),
+            .inclination = 30.0 * random_unit(),
+            .arg_perihelion = 360.0 * random_unit(),
+            .node = 360.0 * random_unit(),
+            .abs_magnitude = (float)(10.0 + 8.0 * random_unit()),
+            .slope = 0.15f,
+        };
+        elements[i].mean_motion = GAUSSIAN_MEAN_MOTION / pow(elements[i].semi_major, 1.5);
+    }
+
+    bool s = generate_minor_bodies(bodies, elements, NUM_MINOR_BODIES);
+    free(elements);
+    return s;
+}
+
+static void bench_update_minor_bodies(void *context, long ops)
+{
+    struct Inputs *in = context;
+    for (long i = 0; i < ops; ++i)
+    {
+        update_minor_bodies(&in->minor_bodies, in->planet_table, in->julian_date[i % NUM_INPUTS], 0.7, -1.2);
+    }
+    bench_sink += in->minor_bodies.num_visible;
+}
+
+static void bench_calc_moon_geo_ICRF(void *context, long ops)
+{
+    struct Inputs *in = context;
+    double sum = 0.0;
+    for (long i = 0; i < ops; ++i)
+    {
+        double x, y, z;
+        calc_moon_geo_ICRF(&moon_elements, &moon_rates, in->julian_date[i % NUM_INPUTS], &x, &y, &z);
+        sum += x + y + z;
+    }
+    bench_sink += sum;
+}
+
+static void bench_equatorial_to_horizontal(void *context, long ops)
+{
+    struct Inputs *in = context;
+    double sum = 0.0;
+    for (long i = 0; i < ops; ++i)
+    {
+        int j = i % NUM_INPUTS;
+        double azimuth, altitude;
+        equatorial_to_horizontal(in->right_ascension[j], in->declination[j], in->azimuth[j], 0.7, -1.2, &azimuth, &altitude);
+        sum += azimuth + altitude;
+    }
+    bench_sink += sum;
+}
+
+static void bench_project_stereographic_north(void *context, long ops)
+{
+    struct Inputs *in = context;
+    double sum = 0.0;
+    for (long i = 0; i < ops; ++i)
+    {
+        int j = i % NUM_INPUTS;
+        double r, theta;
+        project_stereographic_north(1.0, M_PI / 2 - in->altitude[j], in->azimuth[j], &r, &theta);
+        sum += r + theta;
+    }
+    bench_sink += sum;
+}
+
+static void bench_polar_to_win(void *context, long ops)
+{
+    struct Inputs *in = context;
+    long sum = 0;
+    for (long i = 0; i < ops; ++i)
+    {
+        int j = i % NUM_INPUTS;
+        int row, col;
+        polar_to_win(in->r[j], in->azimuth[j], CANVAS_HEIGHT, CANVAS_WIDTH, &row, &col);
+        sum += row + col;
+    }
+    bench_sink += sum;
+}
+
+static void bench_project_horizontal_to_win(void *context, long ops)
+{
+    struct Inputs *in = context;
+    struct StereoProjection projection;
+    init_stereo_projection(&projection, CANVAS_HEIGHT, CANVAS_WIDTH);
+
+    long sum = 0;
+    for (long i = 0; i < ops; ++i)
+    {
+        int j = i % NUM_INPUTS;
+        int row = 0, col = 0;
+        project_horizontal_to_win(&projection, in->xh[j], in->yh[j], in->zh[j], &row, &col);
+        sum += row + col;
+    }
+    bench_sink += sum;
+}
+
+static void bench_draw_line_ASCII(void *context, long ops)
+{
+    struct Inputs *in = context;
+    for (long i = 0; i < ops; ++i)
+    {
+        int j = i % NUM_INPUTS;
+        draw_line_ASCII(&in->canvas, in->ya[j], in->xa[j], in->yb[j], in->xb[j]);
+    }
+    bench_sink += in->canvas.cells[0].codepoint;
+}
+
+static void bench_draw_line_smooth(void *context, long ops)
+{
+    struct Inputs *in = context;
+    for (long i = 0; i < ops; ++i)
+    {
+        int j = i % NUM_INPUTS;
+        draw_line_smooth(&in->canvas, in->ya[j], in->xa[j], in->yb[j], in->xb[j]);
+    }
+    bench_sink += in->canvas.cells[0].codepoint;
+}
+
+// Every figure of the sky at one time, between the cells of its stars
+static void bench_render_constells(void *context, long ops)
+{
+    struct Inputs *in = context;
+    for (long i = 0; i < ops; ++i)
+    {
+        render_constells(&in->canvas, &in->config, &in->constell_table, in->star_table, in->star_cells);
+    }
+    bench_sink += in->canvas.cells[0].codepoint;
+}
+
+// Stars drawn once so that figures have cells to join
+static bool fill_star_cells(struct Inputs *in, struct Arena *arena)
+{
+    int *num_by_mag;
+    if (!star_numbers_by_magnitude(arena, &num_by_mag, in->star_table, in->num_stars) ||
+        !create_star_cells(arena, &in->star_cells, in->num_stars))
+    {
+        return false;
+    }
+
+    in->config = (struct Conf){.threshold = INFINITY, .label_thresh = -INFINITY};
+    update_star_positions(in->star_table, in->num_stars, 2459146.0, 0.7, -1.2);
+    render_stars_stereo(&in->canvas, &in->config, in->star_table, in->num_stars, num_by_mag, in->star_cells);
+    set_constell_threshold(&in->constell_table, in->star_table, in->num_stars, INFINITY);
+    return true;
+}
+
+static void bench_parse_entries(void *context, long ops)
+{
+    for (long i = 0; i < ops; ++i)
+    {
+        struct Entry *entries;
+        unsigned int num_entries;
+        if (parse_entries(bsc5, bsc5_len, &entries, &num_entries))
+        {
+            bench_sink += entries[num_entries - 1].MAG;
+            free(entries);
+        }
+    }
+}
+
+static void bench_get_city(void *context, long ops)
+{
+    // A mix of cities early and late in the list, and one that is missing
+    static const char *names[] = {"Tunis", "Boston", "Tokyo", "Zurich", "Atlantis"};
+    const int num_names = sizeof(names) / sizeof(names[0]);
+
+    for (long i = 0; i < ops; ++i)
+    {
+        const CityData *city = get_city(names[i % num_names]);
+        if (city != NULL)
+        {
+            bench_sink += city->latitude;
+        }
+    }
+}
+
+static void bench_observe_object(void *context, long ops)
+{
+    struct Inputs *in = context;
+    int n = in->observers.num_observers;
+    for (long i = 0; i < ops; ++i)
+    {
+        // Any angle serves as the sidereal time
+        int k = i % NUM_INPUTS;
+        observe_object(&in->observers, 0, n, in->right_ascension[k], in->declination[k], in->azimuth[k],
+                       in->observed, in->observed + n);
+        bench_sink += in->observed[n];
+    }
+}
+
+struct Benchmark
+{
+    const char *name;
+    BenchFunc func;
+    long items;
+};
+
+int main(int argc, char *argv[])
+{
+    bool json = false;
+    const char **filters = calloc(argc, sizeof(const char *));
+    int num_filters = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--json") == 0)
+        {
+            json = true;
+        }
+        else
+        {
+            filters[num_filters++] = argv[i];
+        }
+    }
+
+    struct Inputs *in = calloc(1, sizeof(struct Inputs));
+    fill_inputs(in);
+
+    struct Catalog catalog;
+    struct Arena arena;
+    bool s = true;
+    s = s && open_catalog(&catalog, bsc5, bsc5_len);
+    s = s && arena_create(&arena, star_tables_arena_size(catalog.num_entries) + star_sort_arena_size(catalog.num_entries) +
+                                      constell_table_arena_size(bsc5_constellations, bsc5_constellations_len) +
+                                      ARENA_SIZE(catalog.num_entries * sizeof(struct StarCell)));
+    in->num_stars = catalog.num_entries;
+    s = s && generate_star_table(&arena, &in->star_table, in->num_stars, &catalog, NULL, INFINITY);
+    s = s && generate_planet_table(&arena, &in->planet_table, planet_elements, planet_rates, planet_extras);
+    s = s && generate_constell_table(&arena, bsc5_constellations, bsc5_constellations_len, &in->constell_table);
+    s = s && create_cell_canvas(&in->canvas, CANVAS_HEIGHT, CANVAS_WIDTH);
+    s = s && fill_star_cells(in, &arena);
+    s = s && fill_minor_bodies(&in->minor_bodies);
+    s = s && load_city_observers(&in->observers);
+    s = s && (in->observed = malloc(2 * in->observers.num_observers * sizeof(double))) != NULL;
+    init_ephemeris(&in->ephemeris);
+    in->frame_date = 2459146.0;
+    if (!s)
+    {
+        return EXIT_FAILURE;
+    }
+
+    const struct Benchmark benchmarks[] = {
+        {"update_star_positions", bench_update_star_positions, in->num_stars},
+        {"update_planet_positions", bench_update_planet_positions, NUM_PLANETS},
+        {"update_planet_positions_cached", bench_update_planet_positions_cached, NUM_PLANETS},
+        {"update_minor_bodies", bench_update_minor_bodies, NUM_MINOR_BODIES},
+        {"calc_moon_geo_ICRF", bench_calc_moon_geo_ICRF, 1},
+        {"equatorial_to_horizontal", bench_equatorial_to_horizontal, 1},
+        {"project_stereographic_north", bench_project_stereographic_north, 1},
+        {"polar_to_win", bench_polar_to_win, 1},
+        {"project_horizontal_to_win", bench_project_horizontal_to_win, 1},
+        {"draw_line_ASCII", bench_draw_line_ASCII, 1},
+        {"draw_line_smooth", bench_draw_line_smooth, 1},
+        {"render_constells", bench_render_constells, 1},
+        {"parse_entries", bench_parse_entries, catalog.num_entries},
+        {"get_city", bench_get_city, 1},
+        {"observe_object", bench_observe_object, in->observers.num_observers},
+    };
+    const int num_benchmarks = sizeof(benchmarks) / sizeof(benchmarks[0]);
+
+    struct BenchResult results[sizeof(benchmarks) / sizeof(benchmarks[0])];
+    int num_results = 0;
+
+    for (int i = 0; i < num_benchmarks; ++i)
+    {
+        bool selected = num_filters == 0;
+        for (int f = 0; f < num_filters; ++f)
+        {
+            selected = selected || strstr(benchmarks[i].name, filters[f]) != NULL;
+        }
+
+        if (selected)
+        {
+            s = s && bench_run(benchmarks[i].name, benchmarks[i].func, in, benchmarks[i].items, &results[num_results++]);
+        }
+    }
+
+    if (s)
+    {
+        if (json)
+        {
+            bench_print_json(results, num_results, stdout);
+        }
+        else
+        {
+            bench_print_table(results, num_results, stdout);
+        }
+    }
+
+    close_catalog(&catalog);
+    free_canvas(&in->canvas);
+    free_minor_bodies(&in->minor_bodies);
+    free_observers(&in->observers);
+    free(in->observed);
+    arena_destroy(&arena);
+    free(in);
+    free(filters);
+
+    return s ? EXIT_SUCCESS : EXIT_FAILURE;
+}
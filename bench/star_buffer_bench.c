@@ -0,0 +1,129 @@
+/* Per-frame cost of the star position update versus catalog size, with and
+ * without culling tiles below the horizon. Catalogs are random stars spread
+ * uniformly over the sky.
+ */
+
+#include "src/arena.c"
+#include "src/astro.c"
+#include "src/bit.c"
+#include "src/coord.c"
+#include "src/core.c"
+#include "src/parse_BSC5.c"
+#include "src/pool.c"
+#include "src/star_buffer.c"
+#include "src/stopwatch.c"
+#include "src/strptime.c"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MIN_FRAMES 20
+#define MIN_USEC 200000
+
+static unsigned long long rng_state = 0x2545F4914F6CDD1DULL;
+
+static double random_unit(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (rng_state >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static struct Star *random_stars(int num_stars)
+{
+    struct Star *star_table = calloc(num_stars, sizeof(struct Star));
+    for (int i = 0; i < num_stars; ++i)
+    {
+        star_table[i].catalog_number = i + 1;
+        star_table[i].right_ascension = 2 * M_PI * random_unit();
+        star_table[i].declination = asin(2 * random_unit() - 1);
+        star_table[i].ra_motion = 1E-8 * (random_unit() - 0.5);
+        star_table[i].dec_motion = 1E-8 * (random_unit() - 0.5);
+        star_table[i].magnitude = (float)(-1.5 + 14.0 * random_unit());
+    }
+    return star_table;
+}
+
+// Every tile active, as before the sky was tiled
+static void update_without_culling(struct StarBuffer *buffer, struct Star *star_table, double julian_date)
+{
+    struct StarFrame frame;
+    init_frame(&frame, buffer, julian_date, 0.7, -1.2);
+    transform_stars(&frame, 0, buffer->num_stars);
+    convert_stars(buffer, star_table, 0, buffer->num_stars);
+}
+
+static void update_with_culling(struct StarBuffer *buffer, struct Star *star_table, double julian_date)
+{
+    update_star_buffer(buffer, julian_date, 0.7, -1.2);
+    star_buffer_to_table(buffer, star_table);
+}
+
+// Average frame time in nanoseconds, advancing the clock a minute per frame
+static double time_frames(void (*update)(struct StarBuffer *, struct Star *, double), struct StarBuffer *buffer,
+                          struct Star *star_table)
+{
+    double julian_date = 2459146.0;
+
+    // Warm up caches and the culling state
+    update(buffer, star_table, julian_date);
+
+    struct SwTimestamp begin, end;
+    unsigned long long usec = 0;
+    int frames = 0;
+
+    sw_gettime(&begin);
+    while (frames < MIN_FRAMES || usec < MIN_USEC)
+    {
+        julian_date += 1.0 / 1440.0;
+        update(buffer, star_table, julian_date);
+        frames++;
+
+        sw_gettime(&end);
+        sw_timediff_usec(end, begin, &usec);
+    }
+
+    return 1E3 * (double)usec / frames;
+}
+
+int main(void)
+{
+    printf("%10s %10s %14s %14s %10s %8s\n", "stars", "threshold", "all (ns)", "culled (ns)", "speedup", "culled");
+
+    const float thresholds[] = {100.0f, 6.0f};
+
+    for (int num_stars = 1000; num_stars <= 1000000; num_stars *= 10)
+    {
+        struct Star *star_table = random_stars(num_stars);
+        int *num_by_mag;
+        struct StarBuffer buffer;
+        struct Arena arena;
+        arena_create(&arena, star_sort_arena_size(num_stars) + star_buffer_arena_size(num_stars, 0));
+        star_numbers_by_magnitude(&arena, &num_by_mag, star_table, num_stars);
+        generate_star_buffer(&arena, &buffer, star_table, num_by_mag, num_stars);
+
+        for (size_t t = 0; t < sizeof(thresholds) / sizeof(thresholds[0]); ++t)
+        {
+            set_star_buffer_threshold(&buffer, thresholds[t]);
+
+            double all = time_frames(update_without_culling, &buffer, star_table);
+            double culled = time_frames(update_with_culling, &buffer, star_table);
+
+            int num_culled = 0;
+            for (int i = 0; i < NUM_STAR_TILES; ++i)
+            {
+                num_culled += buffer.tiles[i].culled;
+            }
+
+            printf("%10d %10.1f %14.0f %14.0f %9.2fx %7.0f%%\n", num_stars, thresholds[t], all, culled, all / culled,
+                   100.0 * num_culled / NUM_STAR_TILES);
+        }
+
+        arena_destroy(&arena);
+        free(star_table);
+    }
+
+    return 0;
+}
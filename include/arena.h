@@ -0,0 +1,56 @@
+/* Arena for the tables built at startup. One block is allocated up front,
+ * sized with the *_arena_size functions of the modules that allocate from it,
+ * and tables are carved from it in order. Nothing is freed on its own: the
+ * whole arena is freed at once.
+ *
+ * Temporary buffers, such as sort keys, are taken from the top of the arena
+ * and given back with arena_release once they are no longer needed.
+ *
+ * The arena counts its allocations so that tests can check that startup makes
+ * a fixed number of them whatever the size of the catalog.
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Every allocation starts on a multiple of this many bytes
+#define ARENA_ALIGNMENT 64
+
+// Space taken by an allocation of `size` bytes, for sizing arenas
+#define ARENA_SIZE(size) (((size_t)(size) + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT * ARENA_ALIGNMENT)
+
+struct Arena
+{
+    void *block; // As allocated
+    char *base;  // Aligned start of the block
+    size_t capacity;
+    size_t used;
+
+    // Allocations made and bytes asked for since the arena was created,
+    // including released ones
+    size_t num_allocs;
+    size_t num_bytes;
+};
+
+/* Allocate an arena of `capacity` bytes. Returns false upon memory allocation
+ * error
+ */
+bool arena_create(struct Arena *arena, size_t capacity);
+
+/* Free the arena and everything allocated from it
+ */
+void arena_destroy(struct Arena *arena);
+
+/* Allocate `size` bytes, aligned to ARENA_ALIGNMENT. The memory is not
+ * cleared. Returns NULL when the arena is full
+ */
+void *arena_alloc(struct Arena *arena, size_t size);
+
+/* Free everything allocated since `mark`, a value of arena->used
+ */
+void arena_release(struct Arena *arena, size_t mark);
+
+#endif // ARENA_H
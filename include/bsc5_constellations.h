@@ -0,0 +1,598 @@
+unsigned char bsc5_constellations[] = {
+  0x41, 0x71, 0x6c, 0x20, 0x38, 0x20, 0x37, 0x36, 0x30, 0x32, 0x20, 0x37,
+  0x35, 0x35, 0x37, 0x20, 0x37, 0x35, 0x35, 0x37, 0x20, 0x37, 0x35, 0x32,
+  0x35, 0x20, 0x37, 0x35, 0x35, 0x37, 0x20, 0x37, 0x33, 0x37, 0x37, 0x20,
+  0x37, 0x33, 0x37, 0x37, 0x20, 0x37, 0x35, 0x37, 0x30, 0x20, 0x37, 0x37,
+  0x31, 0x30, 0x20, 0x37, 0x35, 0x37, 0x30, 0x20, 0x37, 0x33, 0x37, 0x37,
+  0x20, 0x37, 0x32, 0x33, 0x35, 0x20, 0x37, 0x32, 0x33, 0x35, 0x20, 0x37,
+  0x31, 0x37, 0x36, 0x20, 0x37, 0x33, 0x37, 0x37, 0x20, 0x37, 0x32, 0x33,
+  0x36, 0x0a, 0x41, 0x6e, 0x64, 0x20, 0x35, 0x20, 0x31, 0x35, 0x20, 0x31,
+  0x36, 0x35, 0x20, 0x31, 0x36, 0x35, 0x20, 0x33, 0x33, 0x37, 0x20, 0x36,
+  0x30, 0x33, 0x20, 0x33, 0x33, 0x37, 0x20, 0x33, 0x33, 0x37, 0x20, 0x32,
+  0x36, 0x39, 0x20, 0x32, 0x36, 0x39, 0x20, 0x32, 0x32, 0x36, 0x0a, 0x53,
+  0x63, 0x6c, 0x20, 0x33, 0x20, 0x38, 0x39, 0x33, 0x37, 0x20, 0x32, 0x38,
+  0x30, 0x20, 0x32, 0x38, 0x30, 0x20, 0x38, 0x38, 0x36, 0x33, 0x20, 0x38,
+  0x38, 0x36, 0x33, 0x20, 0x38, 0x39, 0x33, 0x37, 0x0a, 0x41, 0x72, 0x61,
+  0x20, 0x37, 0x20, 0x36, 0x37, 0x34, 0x33, 0x20, 0x36, 0x35, 0x31, 0x30,
+  0x20, 0x36, 0x35, 0x31, 0x30, 0x20, 0x36, 0x32, 0x38, 0x35, 0x20, 0x36,
+  0x32, 0x38, 0x35, 0x20, 0x36, 0x32, 0x32, 0x39, 0x20, 0x36, 0x32, 0x32,
+  0x39, 0x20, 0x36, 0x35, 0x30, 0x30, 0x20, 0x36, 0x35, 0x30, 0x30, 0x20,
+  0x36, 0x34, 0x36, 0x32, 0x20, 0x36, 0x34, 0x36, 0x32, 0x20, 0x36, 0x34,
+  0x36, 0x31, 0x20, 0x36, 0x34, 0x36, 0x31, 0x20, 0x36, 0x37, 0x34, 0x33,
+  0x0a, 0x4c, 0x69, 0x62, 0x20, 0x35, 0x20, 0x35, 0x39, 0x30, 0x38, 0x20,
+  0x35, 0x37, 0x38, 0x37, 0x20, 0x35, 0x37, 0x38, 0x37, 0x20, 0x35, 0x36,
+  0x38, 0x35, 0x20, 0x35, 0x36, 0x38, 0x35, 0x20, 0x35, 0x35, 0x33, 0x31,
+  0x20, 0x35, 0x35, 0x33, 0x31, 0x20, 0x35, 0x36, 0x30, 0x33, 0x20, 0x35,
+  0x36, 0x30, 0x33, 0x20, 0x35, 0x37, 0x38, 0x37, 0x0a, 0x43, 0x65, 0x74,
+  0x20, 0x32, 0x30, 0x20, 0x36, 0x34, 0x39, 0x20, 0x37, 0x31, 0x38, 0x20,
+  0x35, 0x30, 0x39, 0x20, 0x31, 0x38, 0x38, 0x20, 0x31, 0x38, 0x38, 0x20,
+  0x37, 0x34, 0x20, 0x31, 0x38, 0x38, 0x20, 0x33, 0x33, 0x34, 0x20, 0x33,
+  0x33, 0x34, 0x20, 0x34, 0x30, 0x32, 0x20, 0x34, 0x30, 0x32, 0x20, 0x35,
+  0x33, 0x39, 0x20, 0x35, 0x33, 0x39, 0x20, 0x37, 0x30, 0x38, 0x20, 0x37,
+  0x30, 0x38, 0x20, 0x37, 0x38, 0x31, 0x20, 0x37, 0x38, 0x31, 0x20, 0x38,
+  0x31, 0x31, 0x20, 0x38, 0x31, 0x31, 0x20, 0x37, 0x34, 0x30, 0x20, 0x37,
+  0x34, 0x30, 0x20, 0x35, 0x30, 0x39, 0x20, 0x36, 0x38, 0x31, 0x20, 0x37,
+  0x38, 0x31, 0x20, 0x36, 0x38, 0x31, 0x20, 0x37, 0x37, 0x39, 0x20, 0x37,
+  0x37, 0x39, 0x20, 0x38, 0x30, 0x34, 0x20, 0x38, 0x30, 0x34, 0x20, 0x39,
+  0x31, 0x31, 0x20, 0x39, 0x31, 0x31, 0x20, 0x38, 0x39, 0x36, 0x20, 0x38,
+  0x39, 0x36, 0x20, 0x38, 0x31, 0x33, 0x20, 0x38, 0x31, 0x33, 0x20, 0x37,
+  0x31, 0x38, 0x20, 0x37, 0x31, 0x38, 0x20, 0x37, 0x35, 0x34, 0x20, 0x37,
+  0x35, 0x34, 0x20, 0x38, 0x30, 0x34, 0x0a, 0x41, 0x72, 0x69, 0x20, 0x33,
+  0x20, 0x38, 0x33, 0x38, 0x20, 0x36, 0x31, 0x37, 0x20, 0x36, 0x31, 0x37,
+  0x20, 0x35, 0x35, 0x33, 0x20, 0x35, 0x35, 0x33, 0x20, 0x35, 0x34, 0x36,
+  0x0a, 0x53, 0x63, 0x74, 0x20, 0x35, 0x20, 0x37, 0x30, 0x36, 0x33, 0x20,
+  0x37, 0x30, 0x36, 0x36, 0x20, 0x37, 0x30, 0x36, 0x36, 0x20, 0x37, 0x31,
+  0x31, 0x39, 0x20, 0x37, 0x31, 0x31, 0x39, 0x20, 0x36, 0x39, 0x33, 0x30,
+  0x20, 0x36, 0x39, 0x33, 0x30, 0x20, 0x36, 0x39, 0x37, 0x33, 0x20, 0x36,
+  0x39, 0x37, 0x33, 0x20, 0x37, 0x30, 0x36, 0x33, 0x0a, 0x50, 0x79, 0x78,
+  0x20, 0x32, 0x20, 0x33, 0x34, 0x33, 0x38, 0x20, 0x33, 0x34, 0x36, 0x38,
+  0x20, 0x33, 0x34, 0x36, 0x38, 0x20, 0x33, 0x35, 0x31, 0x38, 0x0a, 0x42,
+  0x6f, 0x6f, 0x20, 0x39, 0x20, 0x35, 0x34, 0x37, 0x37, 0x20, 0x35, 0x33,
+  0x34, 0x30, 0x20, 0x35, 0x33, 0x34, 0x30, 0x20, 0x35, 0x35, 0x30, 0x35,
+  0x20, 0x35, 0x35, 0x30, 0x35, 0x20, 0x35, 0x36, 0x38, 0x31, 0x20, 0x35,
+  0x36, 0x38, 0x31, 0x20, 0x35, 0x36, 0x30, 0x32, 0x20, 0x35, 0x36, 0x30,
+  0x32, 0x20, 0x35, 0x34, 0x33, 0x35, 0x20, 0x35, 0x34, 0x33, 0x35, 0x20,
+  0x35, 0x34, 0x32, 0x39, 0x20, 0x35, 0x34, 0x32, 0x39, 0x20, 0x35, 0x33,
+  0x34, 0x30, 0x20, 0x35, 0x33, 0x34, 0x30, 0x20, 0x35, 0x32, 0x33, 0x35,
+  0x20, 0x35, 0x32, 0x33, 0x35, 0x20, 0x35, 0x32, 0x30, 0x30, 0x0a, 0x43,
+  0x61, 0x65, 0x20, 0x32, 0x20, 0x31, 0x34, 0x34, 0x33, 0x20, 0x31, 0x35,
+  0x30, 0x32, 0x20, 0x31, 0x35, 0x30, 0x32, 0x20, 0x31, 0x35, 0x30, 0x33,
+  0x0a, 0x43, 0x68, 0x61, 0x20, 0x32, 0x20, 0x33, 0x33, 0x31, 0x38, 0x20,
+  0x34, 0x31, 0x37, 0x34, 0x20, 0x34, 0x31, 0x37, 0x34, 0x20, 0x34, 0x36,
+  0x37, 0x34, 0x0a, 0x43, 0x6e, 0x63, 0x20, 0x35, 0x20, 0x33, 0x34, 0x37,
+  0x35, 0x20, 0x33, 0x34, 0x34, 0x39, 0x20, 0x33, 0x34, 0x34, 0x39, 0x20,
+  0x33, 0x32, 0x36, 0x32, 0x20, 0x33, 0x34, 0x34, 0x39, 0x20, 0x33, 0x34,
+  0x36, 0x31, 0x20, 0x33, 0x34, 0x36, 0x31, 0x20, 0x33, 0x32, 0x34, 0x39,
+  0x20, 0x33, 0x34, 0x36, 0x31, 0x20, 0x33, 0x35, 0x37, 0x32, 0x0a, 0x43,
+  0x61, 0x70, 0x20, 0x39, 0x20, 0x37, 0x37, 0x35, 0x34, 0x20, 0x37, 0x37,
+  0x37, 0x36, 0x20, 0x37, 0x37, 0x37, 0x36, 0x20, 0x38, 0x30, 0x37, 0x35,
+  0x20, 0x38, 0x30, 0x37, 0x35, 0x20, 0x38, 0x31, 0x36, 0x37, 0x20, 0x38,
+  0x31, 0x36, 0x37, 0x20, 0x38, 0x32, 0x37, 0x38, 0x20, 0x38, 0x32, 0x37,
+  0x38, 0x20, 0x38, 0x33, 0x32, 0x32, 0x20, 0x38, 0x31, 0x36, 0x37, 0x20,
+  0x38, 0x32, 0x30, 0x34, 0x20, 0x38, 0x32, 0x30, 0x34, 0x20, 0x38, 0x30,
+  0x37, 0x35, 0x20, 0x37, 0x37, 0x37, 0x36, 0x20, 0x37, 0x39, 0x33, 0x36,
+  0x20, 0x38, 0x30, 0x37, 0x35, 0x20, 0x37, 0x39, 0x38, 0x30, 0x0a, 0x43,
+  0x61, 0x72, 0x20, 0x31, 0x34, 0x20, 0x33, 0x36, 0x38, 0x35, 0x20, 0x34,
+  0x30, 0x33, 0x37, 0x20, 0x34, 0x30, 0x33, 0x37, 0x20, 0x34, 0x31, 0x39,
+  0x39, 0x20, 0x34, 0x31, 0x39, 0x39, 0x20, 0x34, 0x32, 0x30, 0x30, 0x20,
+  0x34, 0x32, 0x30, 0x30, 0x20, 0x34, 0x33, 0x33, 0x37, 0x20, 0x34, 0x33,
+  0x33, 0x37, 0x20, 0x34, 0x32, 0x35, 0x37, 0x20, 0x34, 0x32, 0x35, 0x37,
+  0x20, 0x34, 0x31, 0x31, 0x34, 0x20, 0x34, 0x31, 0x31, 0x34, 0x20, 0x34,
+  0x30, 0x35, 0x30, 0x20, 0x34, 0x30, 0x35, 0x30, 0x20, 0x33, 0x36, 0x39,
+  0x39, 0x20, 0x33, 0x34, 0x35, 0x37, 0x20, 0x33, 0x33, 0x30, 0x37, 0x20,
+  0x33, 0x33, 0x30, 0x37, 0x20, 0x32, 0x33, 0x32, 0x36, 0x20, 0x33, 0x36,
+  0x35, 0x39, 0x20, 0x33, 0x36, 0x39, 0x39, 0x20, 0x33, 0x36, 0x35, 0x39,
+  0x20, 0x33, 0x34, 0x35, 0x37, 0x20, 0x32, 0x33, 0x32, 0x36, 0x20, 0x32,
+  0x34, 0x35, 0x31, 0x20, 0x33, 0x33, 0x30, 0x37, 0x20, 0x33, 0x31, 0x36,
+  0x35, 0x0a, 0x43, 0x61, 0x73, 0x20, 0x34, 0x20, 0x35, 0x34, 0x32, 0x20,
+  0x34, 0x30, 0x33, 0x20, 0x34, 0x30, 0x33, 0x20, 0x32, 0x36, 0x34, 0x20,
+  0x32, 0x36, 0x34, 0x20, 0x31, 0x36, 0x38, 0x20, 0x31, 0x36, 0x38, 0x20,
+  0x32, 0x31, 0x0a, 0x43, 0x65, 0x6e, 0x20, 0x31, 0x36, 0x20, 0x35, 0x34,
+  0x35, 0x39, 0x20, 0x35, 0x32, 0x36, 0x37, 0x20, 0x35, 0x32, 0x36, 0x37,
+  0x20, 0x35, 0x31, 0x33, 0x32, 0x20, 0x35, 0x31, 0x33, 0x32, 0x20, 0x35,
+  0x32, 0x33, 0x31, 0x20, 0x35, 0x32, 0x33, 0x31, 0x20, 0x35, 0x32, 0x34,
+  0x39, 0x20, 0x35, 0x32, 0x34, 0x39, 0x20, 0x35, 0x31, 0x39, 0x33, 0x20,
+  0x35, 0x31, 0x39, 0x33, 0x20, 0x35, 0x31, 0x39, 0x30, 0x20, 0x35, 0x31,
+  0x39, 0x30, 0x20, 0x35, 0x30, 0x38, 0x39, 0x20, 0x35, 0x30, 0x38, 0x39,
+  0x20, 0x35, 0x30, 0x32, 0x38, 0x20, 0x35, 0x31, 0x39, 0x30, 0x20, 0x35,
+  0x32, 0x38, 0x38, 0x20, 0x35, 0x31, 0x39, 0x33, 0x20, 0x35, 0x34, 0x34,
+  0x30, 0x20, 0x35, 0x34, 0x34, 0x30, 0x20, 0x35, 0x35, 0x37, 0x36, 0x20,
+  0x35, 0x32, 0x33, 0x31, 0x20, 0x34, 0x38, 0x31, 0x39, 0x20, 0x34, 0x38,
+  0x31, 0x39, 0x20, 0x34, 0x37, 0x34, 0x33, 0x20, 0x34, 0x37, 0x34, 0x33,
+  0x20, 0x34, 0x36, 0x32, 0x31, 0x20, 0x34, 0x36, 0x32, 0x31, 0x20, 0x34,
+  0x34, 0x36, 0x30, 0x20, 0x34, 0x34, 0x36, 0x30, 0x20, 0x34, 0x34, 0x36,
+  0x37, 0x0a, 0x43, 0x65, 0x70, 0x20, 0x36, 0x20, 0x38, 0x34, 0x36, 0x35,
+  0x20, 0x38, 0x36, 0x39, 0x34, 0x20, 0x38, 0x36, 0x39, 0x34, 0x20, 0x38,
+  0x32, 0x33, 0x38, 0x20, 0x38, 0x32, 0x33, 0x38, 0x20, 0x38, 0x31, 0x36,
+  0x32, 0x20, 0x38, 0x31, 0x36, 0x32, 0x20, 0x38, 0x34, 0x36, 0x35, 0x20,
+  0x38, 0x36, 0x39, 0x34, 0x20, 0x38, 0x39, 0x37, 0x34, 0x20, 0x38, 0x39,
+  0x37, 0x34, 0x20, 0x38, 0x32, 0x33, 0x38, 0x0a, 0x43, 0x6f, 0x6d, 0x20,
+  0x32, 0x20, 0x34, 0x39, 0x36, 0x38, 0x20, 0x34, 0x39, 0x38, 0x33, 0x20,
+  0x34, 0x39, 0x38, 0x33, 0x20, 0x34, 0x37, 0x33, 0x37, 0x0a, 0x43, 0x56,
+  0x6e, 0x20, 0x31, 0x20, 0x34, 0x37, 0x38, 0x35, 0x20, 0x34, 0x39, 0x31,
+  0x35, 0x0a, 0x41, 0x75, 0x72, 0x20, 0x36, 0x20, 0x32, 0x30, 0x39, 0x35,
+  0x20, 0x32, 0x30, 0x38, 0x38, 0x20, 0x32, 0x30, 0x38, 0x38, 0x20, 0x31,
+  0x37, 0x30, 0x38, 0x20, 0x31, 0x37, 0x30, 0x38, 0x20, 0x31, 0x36, 0x31,
+  0x32, 0x20, 0x31, 0x36, 0x31, 0x32, 0x20, 0x31, 0x35, 0x37, 0x37, 0x20,
+  0x31, 0x37, 0x39, 0x31, 0x20, 0x31, 0x35, 0x37, 0x37, 0x20, 0x31, 0x37,
+  0x39, 0x31, 0x20, 0x32, 0x30, 0x39, 0x35, 0x0a, 0x43, 0x6f, 0x6c, 0x20,
+  0x36, 0x20, 0x32, 0x32, 0x39, 0x36, 0x20, 0x32, 0x32, 0x35, 0x36, 0x20,
+  0x32, 0x32, 0x35, 0x36, 0x20, 0x32, 0x31, 0x30, 0x36, 0x20, 0x32, 0x31,
+  0x30, 0x36, 0x20, 0x32, 0x30, 0x34, 0x30, 0x20, 0x32, 0x30, 0x34, 0x30,
+  0x20, 0x32, 0x31, 0x32, 0x30, 0x20, 0x32, 0x30, 0x34, 0x30, 0x20, 0x31,
+  0x39, 0x35, 0x36, 0x20, 0x31, 0x39, 0x35, 0x36, 0x20, 0x31, 0x38, 0x36,
+  0x32, 0x0a, 0x43, 0x69, 0x72, 0x20, 0x32, 0x20, 0x35, 0x34, 0x36, 0x33,
+  0x20, 0x35, 0x37, 0x30, 0x34, 0x20, 0x35, 0x34, 0x36, 0x33, 0x20, 0x35,
+  0x36, 0x37, 0x30, 0x0a, 0x43, 0x72, 0x74, 0x20, 0x39, 0x20, 0x34, 0x32,
+  0x38, 0x37, 0x20, 0x34, 0x33, 0x34, 0x33, 0x20, 0x34, 0x33, 0x34, 0x33,
+  0x20, 0x34, 0x34, 0x30, 0x35, 0x20, 0x34, 0x34, 0x30, 0x35, 0x20, 0x34,
+  0x33, 0x38, 0x32, 0x20, 0x34, 0x33, 0x38, 0x32, 0x20, 0x34, 0x32, 0x38,
+  0x37, 0x20, 0x34, 0x33, 0x38, 0x32, 0x20, 0x34, 0x34, 0x30, 0x32, 0x20,
+  0x34, 0x34, 0x30, 0x32, 0x20, 0x34, 0x34, 0x36, 0x38, 0x20, 0x34, 0x34,
+  0x36, 0x38, 0x20, 0x34, 0x35, 0x36, 0x37, 0x20, 0x34, 0x35, 0x36, 0x37,
+  0x20, 0x34, 0x35, 0x31, 0x34, 0x20, 0x34, 0x35, 0x31, 0x34, 0x20, 0x34,
+  0x34, 0x30, 0x35, 0x0a, 0x43, 0x72, 0x41, 0x20, 0x39, 0x20, 0x37, 0x30,
+  0x32, 0x31, 0x20, 0x37, 0x31, 0x32, 0x39, 0x20, 0x37, 0x31, 0x32, 0x39,
+  0x20, 0x37, 0x31, 0x35, 0x32, 0x20, 0x37, 0x31, 0x35, 0x32, 0x20, 0x37,
+  0x32, 0x32, 0x36, 0x20, 0x37, 0x32, 0x32, 0x36, 0x20, 0x37, 0x32, 0x35,
+  0x34, 0x20, 0x37, 0x32, 0x35, 0x34, 0x20, 0x37, 0x32, 0x35, 0x39, 0x20,
+  0x37, 0x32, 0x35, 0x39, 0x20, 0x37, 0x32, 0x34, 0x32, 0x20, 0x37, 0x32,
+  0x34, 0x32, 0x20, 0x37, 0x31, 0x38, 0x38, 0x20, 0x37, 0x31, 0x38, 0x38,
+  0x20, 0x37, 0x31, 0x32, 0x32, 0x20, 0x37, 0x30, 0x32, 0x31, 0x20, 0x36,
+  0x39, 0x34, 0x32, 0x0a, 0x43, 0x72, 0x42, 0x20, 0x36, 0x20, 0x35, 0x37,
+  0x37, 0x38, 0x20, 0x35, 0x37, 0x34, 0x37, 0x20, 0x35, 0x37, 0x34, 0x37,
+  0x20, 0x35, 0x37, 0x39, 0x33, 0x20, 0x35, 0x37, 0x39, 0x33, 0x20, 0x35,
+  0x38, 0x34, 0x39, 0x20, 0x35, 0x38, 0x34, 0x39, 0x20, 0x35, 0x38, 0x38,
+  0x39, 0x20, 0x35, 0x38, 0x38, 0x39, 0x20, 0x35, 0x39, 0x34, 0x37, 0x20,
+  0x35, 0x39, 0x34, 0x37, 0x20, 0x35, 0x39, 0x37, 0x31, 0x0a, 0x43, 0x72,
+  0x76, 0x20, 0x36, 0x20, 0x34, 0x37, 0x37, 0x35, 0x20, 0x34, 0x37, 0x35,
+  0x37, 0x20, 0x34, 0x37, 0x35, 0x37, 0x20, 0x34, 0x36, 0x36, 0x32, 0x20,
+  0x34, 0x36, 0x36, 0x32, 0x20, 0x34, 0x36, 0x33, 0x30, 0x20, 0x34, 0x36,
+  0x33, 0x30, 0x20, 0x34, 0x36, 0x32, 0x33, 0x20, 0x34, 0x36, 0x33, 0x30,
+  0x20, 0x34, 0x37, 0x38, 0x36, 0x20, 0x34, 0x37, 0x38, 0x36, 0x20, 0x34,
+  0x37, 0x35, 0x37, 0x0a, 0x43, 0x72, 0x75, 0x20, 0x32, 0x20, 0x34, 0x37,
+  0x36, 0x33, 0x20, 0x34, 0x37, 0x33, 0x30, 0x20, 0x34, 0x38, 0x35, 0x33,
+  0x20, 0x34, 0x36, 0x35, 0x36, 0x0a, 0x43, 0x79, 0x67, 0x20, 0x39, 0x20,
+  0x37, 0x33, 0x32, 0x38, 0x20, 0x37, 0x34, 0x32, 0x30, 0x20, 0x37, 0x34,
+  0x32, 0x30, 0x20, 0x37, 0x35, 0x32, 0x38, 0x20, 0x37, 0x35, 0x32, 0x38,
+  0x20, 0x37, 0x37, 0x39, 0x36, 0x20, 0x37, 0x37, 0x39, 0x36, 0x20, 0x37,
+  0x39, 0x32, 0x34, 0x20, 0x37, 0x37, 0x39, 0x36, 0x20, 0x37, 0x39, 0x34,
+  0x39, 0x20, 0x37, 0x39, 0x34, 0x39, 0x20, 0x38, 0x31, 0x31, 0x35, 0x20,
+  0x38, 0x31, 0x31, 0x35, 0x20, 0x38, 0x33, 0x30, 0x39, 0x20, 0x37, 0x37,
+  0x39, 0x36, 0x20, 0x37, 0x36, 0x31, 0x35, 0x20, 0x37, 0x36, 0x31, 0x35,
+  0x20, 0x37, 0x34, 0x31, 0x37, 0x0a, 0x44, 0x65, 0x6c, 0x20, 0x35, 0x20,
+  0x37, 0x38, 0x35, 0x32, 0x20, 0x37, 0x38, 0x38, 0x32, 0x20, 0x37, 0x38,
+  0x38, 0x32, 0x20, 0x37, 0x39, 0x30, 0x36, 0x20, 0x37, 0x39, 0x30, 0x36,
+  0x20, 0x37, 0x39, 0x34, 0x38, 0x20, 0x37, 0x39, 0x34, 0x38, 0x20, 0x37,
+  0x39, 0x32, 0x38, 0x20, 0x37, 0x39, 0x32, 0x38, 0x20, 0x37, 0x38, 0x38,
+  0x32, 0x0a, 0x44, 0x6f, 0x72, 0x20, 0x35, 0x20, 0x32, 0x30, 0x31, 0x35,
+  0x20, 0x32, 0x31, 0x30, 0x32, 0x20, 0x32, 0x31, 0x30, 0x32, 0x20, 0x31,
+  0x39, 0x32, 0x32, 0x20, 0x31, 0x39, 0x32, 0x32, 0x20, 0x32, 0x30, 0x31,
+  0x35, 0x20, 0x31, 0x39, 0x32, 0x32, 0x20, 0x31, 0x34, 0x36, 0x35, 0x20,
+  0x31, 0x34, 0x36, 0x35, 0x20, 0x31, 0x33, 0x33, 0x38, 0x0a, 0x44, 0x72,
+  0x61, 0x20, 0x31, 0x35, 0x20, 0x36, 0x36, 0x38, 0x38, 0x20, 0x36, 0x37,
+  0x30, 0x35, 0x20, 0x36, 0x37, 0x30, 0x35, 0x20, 0x36, 0x35, 0x33, 0x36,
+  0x20, 0x36, 0x35, 0x33, 0x36, 0x20, 0x36, 0x35, 0x35, 0x35, 0x20, 0x36,
+  0x35, 0x35, 0x35, 0x20, 0x36, 0x36, 0x38, 0x38, 0x20, 0x36, 0x36, 0x38,
+  0x38, 0x20, 0x37, 0x33, 0x31, 0x30, 0x20, 0x37, 0x33, 0x31, 0x30, 0x20,
+  0x37, 0x35, 0x38, 0x32, 0x20, 0x37, 0x35, 0x38, 0x32, 0x20, 0x37, 0x33,
+  0x35, 0x32, 0x20, 0x37, 0x33, 0x35, 0x32, 0x20, 0x36, 0x39, 0x32, 0x37,
+  0x20, 0x36, 0x39, 0x32, 0x37, 0x20, 0x36, 0x33, 0x39, 0x36, 0x20, 0x36,
+  0x33, 0x39, 0x36, 0x20, 0x36, 0x31, 0x33, 0x32, 0x20, 0x36, 0x31, 0x33,
+  0x32, 0x20, 0x35, 0x39, 0x38, 0x36, 0x20, 0x35, 0x39, 0x38, 0x36, 0x20,
+  0x35, 0x37, 0x34, 0x34, 0x20, 0x35, 0x37, 0x34, 0x34, 0x20, 0x35, 0x32,
+  0x39, 0x31, 0x20, 0x35, 0x32, 0x39, 0x31, 0x20, 0x34, 0x37, 0x38, 0x37,
+  0x20, 0x34, 0x37, 0x38, 0x37, 0x20, 0x34, 0x34, 0x33, 0x34, 0x0a, 0x4e,
+  0x6f, 0x72, 0x20, 0x35, 0x20, 0x36, 0x30, 0x32, 0x34, 0x20, 0x36, 0x30,
+  0x37, 0x32, 0x20, 0x36, 0x30, 0x37, 0x32, 0x20, 0x36, 0x31, 0x31, 0x35,
+  0x20, 0x36, 0x31, 0x31, 0x35, 0x20, 0x35, 0x39, 0x36, 0x32, 0x20, 0x35,
+  0x39, 0x36, 0x32, 0x20, 0x36, 0x30, 0x37, 0x32, 0x20, 0x35, 0x39, 0x36,
+  0x32, 0x20, 0x36, 0x30, 0x32, 0x34, 0x0a, 0x45, 0x72, 0x69, 0x20, 0x32,
+  0x37, 0x20, 0x34, 0x37, 0x32, 0x20, 0x35, 0x36, 0x36, 0x20, 0x35, 0x36,
+  0x36, 0x20, 0x36, 0x37, 0x34, 0x20, 0x36, 0x37, 0x34, 0x20, 0x37, 0x32,
+  0x31, 0x20, 0x37, 0x32, 0x31, 0x20, 0x37, 0x38, 0x39, 0x20, 0x37, 0x38,
+  0x39, 0x20, 0x37, 0x39, 0x34, 0x20, 0x37, 0x39, 0x34, 0x20, 0x38, 0x39,
+  0x37, 0x20, 0x38, 0x39, 0x37, 0x20, 0x31, 0x30, 0x30, 0x38, 0x20, 0x31,
+  0x30, 0x30, 0x38, 0x20, 0x31, 0x31, 0x38, 0x39, 0x20, 0x31, 0x31, 0x38,
+  0x39, 0x20, 0x31, 0x31, 0x39, 0x35, 0x20, 0x31, 0x31, 0x39, 0x35, 0x20,
+  0x31, 0x33, 0x34, 0x37, 0x20, 0x31, 0x33, 0x34, 0x37, 0x20, 0x31, 0x33,
+  0x39, 0x33, 0x20, 0x31, 0x33, 0x39, 0x33, 0x20, 0x31, 0x34, 0x36, 0x34,
+  0x20, 0x31, 0x34, 0x36, 0x34, 0x20, 0x31, 0x31, 0x37, 0x33, 0x20, 0x31,
+  0x31, 0x37, 0x33, 0x20, 0x31, 0x30, 0x38, 0x38, 0x20, 0x31, 0x30, 0x38,
+  0x38, 0x20, 0x31, 0x30, 0x30, 0x33, 0x20, 0x31, 0x30, 0x30, 0x33, 0x20,
+  0x39, 0x31, 0x39, 0x20, 0x39, 0x31, 0x39, 0x20, 0x38, 0x31, 0x38, 0x20,
+  0x38, 0x31, 0x38, 0x20, 0x38, 0x37, 0x34, 0x20, 0x38, 0x37, 0x34, 0x20,
+  0x39, 0x38, 0x34, 0x20, 0x39, 0x38, 0x34, 0x20, 0x31, 0x30, 0x38, 0x34,
+  0x20, 0x31, 0x30, 0x38, 0x34, 0x20, 0x31, 0x31, 0x33, 0x36, 0x20, 0x31,
+  0x31, 0x33, 0x36, 0x20, 0x31, 0x34, 0x36, 0x33, 0x20, 0x31, 0x34, 0x36,
+  0x33, 0x20, 0x31, 0x35, 0x32, 0x30, 0x20, 0x31, 0x35, 0x32, 0x30, 0x20,
+  0x31, 0x35, 0x36, 0x30, 0x20, 0x31, 0x35, 0x36, 0x30, 0x20, 0x31, 0x36,
+  0x36, 0x36, 0x20, 0x31, 0x36, 0x36, 0x36, 0x20, 0x31, 0x36, 0x37, 0x39,
+  0x20, 0x31, 0x36, 0x37, 0x39, 0x20, 0x31, 0x34, 0x38, 0x31, 0x0a, 0x53,
+  0x67, 0x65, 0x20, 0x34, 0x20, 0x37, 0x34, 0x38, 0x38, 0x20, 0x37, 0x35,
+  0x33, 0x36, 0x20, 0x37, 0x35, 0x33, 0x36, 0x20, 0x37, 0x34, 0x37, 0x39,
+  0x20, 0x37, 0x35, 0x33, 0x36, 0x20, 0x37, 0x36, 0x33, 0x35, 0x20, 0x37,
+  0x36, 0x33, 0x35, 0x20, 0x37, 0x36, 0x37, 0x39, 0x0a, 0x46, 0x6f, 0x72,
+  0x20, 0x31, 0x20, 0x38, 0x34, 0x31, 0x20, 0x39, 0x36, 0x33, 0x0a, 0x47,
+  0x65, 0x6d, 0x20, 0x31, 0x36, 0x20, 0x32, 0x34, 0x32, 0x31, 0x20, 0x32,
+  0x36, 0x35, 0x30, 0x20, 0x32, 0x36, 0x35, 0x30, 0x20, 0x32, 0x37, 0x37,
+  0x37, 0x20, 0x32, 0x37, 0x37, 0x37, 0x20, 0x32, 0x37, 0x36, 0x33, 0x20,
+  0x32, 0x37, 0x36, 0x33, 0x20, 0x32, 0x34, 0x38, 0x34, 0x20, 0x32, 0x37,
+  0x37, 0x37, 0x20, 0x32, 0x39, 0x30, 0x35, 0x20, 0x32, 0x39, 0x30, 0x35,
+  0x20, 0x32, 0x39, 0x38, 0x35, 0x20, 0x32, 0x39, 0x30, 0x35, 0x20, 0x32,
+  0x39, 0x39, 0x30, 0x20, 0x32, 0x39, 0x30, 0x35, 0x20, 0x32, 0x38, 0x32,
+  0x31, 0x20, 0x32, 0x38, 0x32, 0x31, 0x20, 0x32, 0x36, 0x39, 0x37, 0x20,
+  0x32, 0x36, 0x39, 0x37, 0x20, 0x32, 0x38, 0x39, 0x31, 0x20, 0x32, 0x36,
+  0x39, 0x37, 0x20, 0x32, 0x35, 0x34, 0x30, 0x20, 0x32, 0x36, 0x39, 0x37,
+  0x20, 0x32, 0x34, 0x37, 0x33, 0x20, 0x32, 0x34, 0x37, 0x33, 0x20, 0x32,
+  0x33, 0x34, 0x33, 0x20, 0x32, 0x34, 0x37, 0x33, 0x20, 0x32, 0x32, 0x38,
+  0x36, 0x20, 0x32, 0x32, 0x38, 0x36, 0x20, 0x32, 0x32, 0x31, 0x36, 0x20,
+  0x32, 0x32, 0x31, 0x36, 0x20, 0x32, 0x31, 0x33, 0x34, 0x0a, 0x43, 0x61,
+  0x6d, 0x20, 0x35, 0x20, 0x31, 0x30, 0x33, 0x35, 0x20, 0x31, 0x32, 0x30,
+  0x34, 0x20, 0x31, 0x32, 0x30, 0x34, 0x20, 0x31, 0x35, 0x34, 0x32, 0x20,
+  0x31, 0x30, 0x33, 0x35, 0x20, 0x31, 0x31, 0x34, 0x38, 0x20, 0x31, 0x31,
+  0x34, 0x38, 0x20, 0x31, 0x35, 0x34, 0x32, 0x20, 0x31, 0x31, 0x34, 0x38,
+  0x20, 0x31, 0x36, 0x38, 0x36, 0x0a, 0x43, 0x4d, 0x61, 0x20, 0x31, 0x37,
+  0x20, 0x32, 0x35, 0x37, 0x34, 0x20, 0x32, 0x36, 0x35, 0x37, 0x20, 0x32,
+  0x36, 0x35, 0x37, 0x20, 0x32, 0x35, 0x39, 0x36, 0x20, 0x32, 0x35, 0x39,
+  0x36, 0x20, 0x32, 0x34, 0x39, 0x31, 0x20, 0x32, 0x34, 0x39, 0x31, 0x20,
+  0x32, 0x36, 0x35, 0x33, 0x20, 0x32, 0x36, 0x35, 0x33, 0x20, 0x32, 0x36,
+  0x39, 0x33, 0x20, 0x32, 0x36, 0x39, 0x33, 0x20, 0x32, 0x37, 0x34, 0x39,
+  0x20, 0x32, 0x37, 0x34, 0x39, 0x20, 0x32, 0x38, 0x32, 0x37, 0x20, 0x32,
+  0x36, 0x31, 0x38, 0x20, 0x32, 0x36, 0x34, 0x36, 0x20, 0x32, 0x36, 0x34,
+  0x36, 0x20, 0x32, 0x36, 0x39, 0x33, 0x20, 0x32, 0x36, 0x34, 0x36, 0x20,
+  0x32, 0x35, 0x38, 0x33, 0x20, 0x32, 0x35, 0x38, 0x33, 0x20, 0x32, 0x34,
+  0x32, 0x39, 0x20, 0x32, 0x34, 0x32, 0x39, 0x20, 0x32, 0x34, 0x31, 0x34,
+  0x20, 0x32, 0x34, 0x32, 0x39, 0x20, 0x32, 0x32, 0x39, 0x34, 0x20, 0x32,
+  0x34, 0x32, 0x39, 0x20, 0x32, 0x34, 0x39, 0x31, 0x20, 0x32, 0x36, 0x31,
+  0x38, 0x20, 0x32, 0x35, 0x33, 0x38, 0x20, 0x32, 0x32, 0x38, 0x32, 0x20,
+  0x32, 0x36, 0x31, 0x38, 0x20, 0x32, 0x35, 0x39, 0x36, 0x20, 0x32, 0x35,
+  0x37, 0x34, 0x0a, 0x55, 0x4d, 0x61, 0x20, 0x31, 0x39, 0x20, 0x35, 0x31,
+  0x39, 0x31, 0x20, 0x35, 0x30, 0x35, 0x34, 0x20, 0x35, 0x30, 0x35, 0x34,
+  0x20, 0x34, 0x39, 0x30, 0x35, 0x20, 0x34, 0x39, 0x30, 0x35, 0x20, 0x34,
+  0x36, 0x36, 0x30, 0x20, 0x34, 0x36, 0x36, 0x30, 0x20, 0x34, 0x33, 0x30,
+  0x31, 0x20, 0x34, 0x33, 0x30, 0x31, 0x20, 0x34, 0x32, 0x39, 0x35, 0x20,
+  0x34, 0x32, 0x39, 0x35, 0x20, 0x34, 0x35, 0x35, 0x34, 0x20, 0x34, 0x35,
+  0x35, 0x34, 0x20, 0x34, 0x36, 0x36, 0x30, 0x20, 0x34, 0x35, 0x35, 0x34,
+  0x20, 0x34, 0x35, 0x31, 0x38, 0x20, 0x34, 0x35, 0x31, 0x38, 0x20, 0x34,
+  0x33, 0x33, 0x35, 0x20, 0x34, 0x33, 0x33, 0x35, 0x20, 0x34, 0x30, 0x33,
+  0x33, 0x20, 0x34, 0x33, 0x33, 0x35, 0x20, 0x34, 0x30, 0x36, 0x39, 0x20,
+  0x34, 0x32, 0x39, 0x35, 0x20, 0x33, 0x38, 0x39, 0x34, 0x20, 0x33, 0x38,
+  0x39, 0x34, 0x20, 0x33, 0x37, 0x37, 0x35, 0x20, 0x33, 0x37, 0x37, 0x35,
+  0x20, 0x33, 0x35, 0x39, 0x34, 0x20, 0x33, 0x37, 0x37, 0x35, 0x20, 0x33,
+  0x35, 0x36, 0x39, 0x20, 0x33, 0x38, 0x39, 0x34, 0x20, 0x33, 0x38, 0x38,
+  0x38, 0x20, 0x33, 0x38, 0x38, 0x38, 0x20, 0x33, 0x33, 0x32, 0x33, 0x20,
+  0x33, 0x33, 0x32, 0x33, 0x20, 0x33, 0x37, 0x35, 0x37, 0x20, 0x33, 0x37,
+  0x35, 0x37, 0x20, 0x34, 0x33, 0x30, 0x31, 0x0a, 0x47, 0x72, 0x75, 0x20,
+  0x39, 0x20, 0x38, 0x37, 0x38, 0x37, 0x20, 0x38, 0x35, 0x35, 0x36, 0x20,
+  0x38, 0x35, 0x35, 0x36, 0x20, 0x38, 0x34, 0x32, 0x35, 0x20, 0x38, 0x34,
+  0x32, 0x35, 0x20, 0x38, 0x36, 0x33, 0x36, 0x20, 0x38, 0x36, 0x33, 0x36,
+  0x20, 0x38, 0x38, 0x32, 0x30, 0x20, 0x38, 0x38, 0x32, 0x30, 0x20, 0x38,
+  0x37, 0x38, 0x37, 0x20, 0x38, 0x36, 0x33, 0x36, 0x20, 0x38, 0x37, 0x34,
+  0x37, 0x20, 0x38, 0x36, 0x33, 0x36, 0x20, 0x38, 0x36, 0x37, 0x35, 0x20,
+  0x38, 0x34, 0x32, 0x35, 0x20, 0x38, 0x34, 0x31, 0x31, 0x20, 0x38, 0x34,
+  0x31, 0x31, 0x20, 0x38, 0x33, 0x35, 0x33, 0x0a, 0x48, 0x65, 0x72, 0x20,
+  0x31, 0x38, 0x20, 0x36, 0x35, 0x38, 0x38, 0x20, 0x36, 0x36, 0x39, 0x35,
+  0x20, 0x36, 0x36, 0x39, 0x35, 0x20, 0x36, 0x34, 0x38, 0x34, 0x20, 0x36,
+  0x34, 0x38, 0x34, 0x20, 0x36, 0x34, 0x33, 0x36, 0x20, 0x36, 0x34, 0x33,
+  0x36, 0x20, 0x36, 0x34, 0x31, 0x38, 0x20, 0x36, 0x34, 0x31, 0x38, 0x20,
+  0x36, 0x32, 0x32, 0x30, 0x20, 0x36, 0x32, 0x32, 0x30, 0x20, 0x36, 0x31,
+  0x36, 0x38, 0x20, 0x36, 0x31, 0x36, 0x38, 0x20, 0x36, 0x30, 0x39, 0x32,
+  0x20, 0x36, 0x30, 0x39, 0x32, 0x20, 0x35, 0x39, 0x31, 0x34, 0x20, 0x36,
+  0x32, 0x32, 0x30, 0x20, 0x36, 0x32, 0x31, 0x32, 0x20, 0x36, 0x32, 0x31,
+  0x32, 0x20, 0x36, 0x31, 0x34, 0x38, 0x20, 0x36, 0x31, 0x34, 0x38, 0x20,
+  0x36, 0x30, 0x39, 0x35, 0x20, 0x36, 0x32, 0x31, 0x32, 0x20, 0x36, 0x33,
+  0x32, 0x34, 0x20, 0x36, 0x33, 0x32, 0x34, 0x20, 0x36, 0x35, 0x32, 0x36,
+  0x20, 0x36, 0x35, 0x32, 0x36, 0x20, 0x36, 0x34, 0x31, 0x30, 0x20, 0x36,
+  0x36, 0x32, 0x33, 0x20, 0x36, 0x37, 0x30, 0x33, 0x20, 0x36, 0x37, 0x30,
+  0x33, 0x20, 0x36, 0x37, 0x37, 0x39, 0x20, 0x36, 0x33, 0x32, 0x34, 0x20,
+  0x36, 0x34, 0x31, 0x38, 0x20, 0x36, 0x36, 0x32, 0x33, 0x20, 0x36, 0x35,
+  0x32, 0x36, 0x0a, 0x48, 0x6f, 0x72, 0x20, 0x32, 0x20, 0x31, 0x33, 0x32,
+  0x36, 0x20, 0x38, 0x30, 0x32, 0x20, 0x38, 0x30, 0x32, 0x20, 0x39, 0x33,
+  0x34, 0x0a, 0x48, 0x79, 0x61, 0x20, 0x31, 0x38, 0x20, 0x33, 0x34, 0x35,
+  0x34, 0x20, 0x33, 0x34, 0x31, 0x38, 0x20, 0x33, 0x34, 0x31, 0x38, 0x20,
+  0x33, 0x34, 0x31, 0x30, 0x20, 0x33, 0x34, 0x31, 0x30, 0x20, 0x33, 0x34,
+  0x38, 0x32, 0x20, 0x33, 0x34, 0x38, 0x32, 0x20, 0x33, 0x34, 0x39, 0x32,
+  0x20, 0x33, 0x34, 0x39, 0x32, 0x20, 0x33, 0x34, 0x35, 0x34, 0x20, 0x33,
+  0x34, 0x39, 0x32, 0x20, 0x33, 0x35, 0x34, 0x37, 0x20, 0x33, 0x35, 0x34,
+  0x37, 0x20, 0x33, 0x36, 0x36, 0x35, 0x20, 0x33, 0x36, 0x36, 0x35, 0x20,
+  0x33, 0x37, 0x38, 0x37, 0x20, 0x33, 0x37, 0x38, 0x37, 0x20, 0x33, 0x37,
+  0x35, 0x39, 0x20, 0x33, 0x37, 0x35, 0x39, 0x20, 0x33, 0x37, 0x34, 0x38,
+  0x20, 0x33, 0x37, 0x34, 0x38, 0x20, 0x33, 0x39, 0x30, 0x33, 0x20, 0x33,
+  0x39, 0x30, 0x33, 0x20, 0x33, 0x39, 0x39, 0x34, 0x20, 0x33, 0x39, 0x39,
+  0x34, 0x20, 0x34, 0x30, 0x39, 0x34, 0x20, 0x34, 0x30, 0x39, 0x34, 0x20,
+  0x34, 0x32, 0x33, 0x32, 0x20, 0x34, 0x32, 0x33, 0x32, 0x20, 0x34, 0x34,
+  0x35, 0x30, 0x20, 0x34, 0x34, 0x35, 0x30, 0x20, 0x34, 0x35, 0x35, 0x32,
+  0x20, 0x34, 0x35, 0x35, 0x32, 0x20, 0x34, 0x39, 0x35, 0x38, 0x20, 0x34,
+  0x39, 0x35, 0x38, 0x20, 0x35, 0x30, 0x32, 0x30, 0x0a, 0x48, 0x79, 0x69,
+  0x20, 0x34, 0x20, 0x39, 0x38, 0x20, 0x31, 0x32, 0x30, 0x38, 0x20, 0x31,
+  0x32, 0x30, 0x38, 0x20, 0x38, 0x30, 0x36, 0x20, 0x38, 0x30, 0x36, 0x20,
+  0x37, 0x30, 0x35, 0x20, 0x37, 0x30, 0x35, 0x20, 0x35, 0x39, 0x31, 0x0a,
+  0x49, 0x6e, 0x64, 0x20, 0x33, 0x20, 0x38, 0x31, 0x34, 0x30, 0x20, 0x37,
+  0x38, 0x36, 0x39, 0x20, 0x37, 0x38, 0x36, 0x39, 0x20, 0x37, 0x39, 0x38,
+  0x36, 0x20, 0x37, 0x39, 0x38, 0x36, 0x20, 0x38, 0x31, 0x34, 0x30, 0x0a,
+  0x4c, 0x61, 0x63, 0x20, 0x36, 0x20, 0x38, 0x34, 0x39, 0x38, 0x20, 0x38,
+  0x35, 0x37, 0x39, 0x20, 0x38, 0x35, 0x37, 0x39, 0x20, 0x38, 0x35, 0x37,
+  0x32, 0x20, 0x38, 0x35, 0x37, 0x32, 0x20, 0x38, 0x35, 0x34, 0x31, 0x20,
+  0x38, 0x35, 0x34, 0x31, 0x20, 0x38, 0x35, 0x33, 0x38, 0x20, 0x38, 0x35,
+  0x33, 0x38, 0x20, 0x38, 0x35, 0x38, 0x35, 0x20, 0x38, 0x35, 0x38, 0x35,
+  0x20, 0x38, 0x35, 0x37, 0x32, 0x0a, 0x4d, 0x6f, 0x6e, 0x20, 0x36, 0x20,
+  0x32, 0x32, 0x32, 0x37, 0x20, 0x32, 0x33, 0x35, 0x36, 0x20, 0x32, 0x33,
+  0x35, 0x36, 0x20, 0x32, 0x37, 0x31, 0x34, 0x20, 0x32, 0x37, 0x31, 0x34,
+  0x20, 0x32, 0x32, 0x39, 0x38, 0x20, 0x32, 0x32, 0x39, 0x38, 0x20, 0x32,
+  0x31, 0x37, 0x34, 0x20, 0x32, 0x37, 0x31, 0x34, 0x20, 0x33, 0x31, 0x38,
+  0x38, 0x20, 0x33, 0x31, 0x38, 0x38, 0x20, 0x32, 0x39, 0x37, 0x30, 0x0a,
+  0x4c, 0x65, 0x70, 0x20, 0x31, 0x34, 0x20, 0x32, 0x31, 0x35, 0x35, 0x20,
+  0x32, 0x30, 0x38, 0x35, 0x20, 0x32, 0x30, 0x38, 0x35, 0x20, 0x31, 0x39,
+  0x39, 0x38, 0x20, 0x31, 0x39, 0x39, 0x38, 0x20, 0x31, 0x38, 0x36, 0x35,
+  0x20, 0x31, 0x38, 0x36, 0x35, 0x20, 0x31, 0x37, 0x30, 0x32, 0x20, 0x31,
+  0x38, 0x36, 0x35, 0x20, 0x32, 0x30, 0x33, 0x35, 0x20, 0x32, 0x30, 0x33,
+  0x35, 0x20, 0x31, 0x39, 0x38, 0x33, 0x20, 0x31, 0x39, 0x38, 0x33, 0x20,
+  0x31, 0x38, 0x32, 0x39, 0x20, 0x31, 0x38, 0x32, 0x39, 0x20, 0x31, 0x36,
+  0x35, 0x34, 0x20, 0x31, 0x38, 0x36, 0x35, 0x20, 0x31, 0x38, 0x32, 0x39,
+  0x20, 0x31, 0x37, 0x30, 0x32, 0x20, 0x31, 0x37, 0x35, 0x36, 0x20, 0x31,
+  0x37, 0x30, 0x32, 0x20, 0x31, 0x37, 0x30, 0x35, 0x20, 0x31, 0x36, 0x35,
+  0x34, 0x20, 0x31, 0x37, 0x30, 0x32, 0x20, 0x31, 0x37, 0x30, 0x35, 0x20,
+  0x31, 0x36, 0x39, 0x36, 0x20, 0x31, 0x37, 0x35, 0x36, 0x20, 0x31, 0x37,
+  0x35, 0x37, 0x0a, 0x4c, 0x65, 0x6f, 0x20, 0x31, 0x30, 0x20, 0x34, 0x35,
+  0x33, 0x34, 0x20, 0x34, 0x33, 0x35, 0x39, 0x20, 0x34, 0x33, 0x35, 0x39,
+  0x20, 0x33, 0x39, 0x38, 0x32, 0x20, 0x33, 0x39, 0x38, 0x32, 0x20, 0x33,
+  0x39, 0x37, 0x35, 0x20, 0x33, 0x39, 0x37, 0x35, 0x20, 0x34, 0x30, 0x35,
+  0x37, 0x20, 0x34, 0x30, 0x35, 0x37, 0x20, 0x34, 0x33, 0x35, 0x37, 0x20,
+  0x34, 0x33, 0x35, 0x37, 0x20, 0x34, 0x35, 0x33, 0x34, 0x20, 0x34, 0x30,
+  0x35, 0x37, 0x20, 0x34, 0x30, 0x33, 0x31, 0x20, 0x34, 0x30, 0x33, 0x31,
+  0x20, 0x33, 0x39, 0x30, 0x35, 0x20, 0x33, 0x39, 0x30, 0x35, 0x20, 0x33,
+  0x38, 0x37, 0x33, 0x20, 0x34, 0x33, 0x35, 0x37, 0x20, 0x34, 0x33, 0x35,
+  0x39, 0x0a, 0x4c, 0x75, 0x70, 0x20, 0x31, 0x33, 0x20, 0x35, 0x38, 0x38,
+  0x33, 0x20, 0x35, 0x39, 0x39, 0x31, 0x20, 0x35, 0x39, 0x39, 0x31, 0x20,
+  0x35, 0x39, 0x34, 0x38, 0x20, 0x35, 0x39, 0x34, 0x38, 0x20, 0x35, 0x38,
+  0x38, 0x33, 0x20, 0x35, 0x39, 0x34, 0x38, 0x20, 0x35, 0x37, 0x37, 0x36,
+  0x20, 0x35, 0x37, 0x37, 0x36, 0x20, 0x35, 0x36, 0x39, 0x35, 0x20, 0x35,
+  0x36, 0x39, 0x35, 0x20, 0x35, 0x37, 0x30, 0x35, 0x20, 0x35, 0x36, 0x39,
+  0x35, 0x20, 0x35, 0x35, 0x37, 0x31, 0x20, 0x35, 0x37, 0x37, 0x36, 0x20,
+  0x35, 0x37, 0x39, 0x37, 0x20, 0x35, 0x37, 0x39, 0x37, 0x20, 0x35, 0x36,
+  0x34, 0x39, 0x20, 0x35, 0x36, 0x34, 0x39, 0x20, 0x35, 0x34, 0x36, 0x39,
+  0x20, 0x35, 0x36, 0x34, 0x39, 0x20, 0x35, 0x34, 0x35, 0x33, 0x20, 0x35,
+  0x34, 0x36, 0x39, 0x20, 0x35, 0x33, 0x39, 0x36, 0x20, 0x35, 0x34, 0x36,
+  0x39, 0x20, 0x35, 0x35, 0x37, 0x31, 0x0a, 0x4c, 0x79, 0x6e, 0x20, 0x37,
+  0x20, 0x33, 0x37, 0x30, 0x35, 0x20, 0x33, 0x36, 0x39, 0x30, 0x20, 0x33,
+  0x36, 0x39, 0x30, 0x20, 0x33, 0x36, 0x31, 0x32, 0x20, 0x33, 0x36, 0x31,
+  0x32, 0x20, 0x33, 0x35, 0x37, 0x39, 0x20, 0x33, 0x35, 0x37, 0x39, 0x20,
+  0x33, 0x32, 0x37, 0x35, 0x20, 0x33, 0x32, 0x37, 0x35, 0x20, 0x32, 0x38,
+  0x31, 0x38, 0x20, 0x32, 0x38, 0x31, 0x38, 0x20, 0x32, 0x35, 0x36, 0x30,
+  0x20, 0x32, 0x35, 0x36, 0x30, 0x20, 0x32, 0x32, 0x33, 0x38, 0x0a, 0x4c,
+  0x79, 0x72, 0x20, 0x35, 0x20, 0x37, 0x30, 0x30, 0x31, 0x20, 0x37, 0x30,
+  0x35, 0x36, 0x20, 0x37, 0x30, 0x35, 0x36, 0x20, 0x37, 0x31, 0x30, 0x36,
+  0x20, 0x37, 0x31, 0x30, 0x36, 0x20, 0x37, 0x31, 0x37, 0x38, 0x20, 0x37,
+  0x31, 0x37, 0x38, 0x20, 0x37, 0x31, 0x33, 0x39, 0x20, 0x37, 0x31, 0x33,
+  0x39, 0x20, 0x37, 0x30, 0x35, 0x36, 0x0a, 0x41, 0x6e, 0x74, 0x20, 0x31,
+  0x20, 0x34, 0x31, 0x30, 0x34, 0x20, 0x33, 0x39, 0x34, 0x37, 0x0a, 0x4d,
+  0x69, 0x63, 0x20, 0x32, 0x20, 0x38, 0x31, 0x33, 0x35, 0x20, 0x38, 0x30,
+  0x33, 0x39, 0x20, 0x38, 0x30, 0x33, 0x39, 0x20, 0x37, 0x39, 0x36, 0x35,
+  0x0a, 0x4d, 0x75, 0x73, 0x20, 0x34, 0x20, 0x34, 0x38, 0x34, 0x34, 0x20,
+  0x34, 0x35, 0x32, 0x30, 0x20, 0x34, 0x35, 0x32, 0x30, 0x20, 0x34, 0x37,
+  0x37, 0x33, 0x20, 0x34, 0x37, 0x37, 0x33, 0x20, 0x34, 0x37, 0x39, 0x38,
+  0x20, 0x34, 0x37, 0x39, 0x38, 0x20, 0x34, 0x38, 0x34, 0x34, 0x0a, 0x4f,
+  0x63, 0x74, 0x20, 0x33, 0x20, 0x38, 0x32, 0x35, 0x34, 0x20, 0x38, 0x36,
+  0x33, 0x30, 0x20, 0x38, 0x36, 0x33, 0x30, 0x20, 0x35, 0x33, 0x33, 0x39,
+  0x20, 0x35, 0x33, 0x33, 0x39, 0x20, 0x38, 0x32, 0x35, 0x34, 0x0a, 0x41,
+  0x70, 0x73, 0x20, 0x32, 0x20, 0x35, 0x34, 0x37, 0x30, 0x20, 0x36, 0x31,
+  0x30, 0x32, 0x20, 0x36, 0x31, 0x30, 0x32, 0x20, 0x36, 0x31, 0x36, 0x33,
+  0x0a, 0x4f, 0x70, 0x68, 0x20, 0x37, 0x20, 0x36, 0x35, 0x35, 0x36, 0x20,
+  0x36, 0x36, 0x30, 0x33, 0x20, 0x36, 0x33, 0x37, 0x38, 0x20, 0x36, 0x36,
+  0x30, 0x33, 0x20, 0x36, 0x35, 0x35, 0x36, 0x20, 0x36, 0x32, 0x39, 0x39,
+  0x20, 0x36, 0x32, 0x39, 0x39, 0x20, 0x36, 0x30, 0x37, 0x35, 0x20, 0x36,
+  0x30, 0x37, 0x35, 0x20, 0x36, 0x31, 0x37, 0x35, 0x20, 0x36, 0x31, 0x37,
+  0x35, 0x20, 0x36, 0x33, 0x37, 0x38, 0x20, 0x36, 0x33, 0x37, 0x38, 0x20,
+  0x36, 0x35, 0x31, 0x39, 0x0a, 0x4f, 0x72, 0x69, 0x20, 0x32, 0x33, 0x20,
+  0x31, 0x39, 0x34, 0x38, 0x20, 0x31, 0x39, 0x30, 0x33, 0x20, 0x31, 0x39,
+  0x30, 0x33, 0x20, 0x31, 0x38, 0x35, 0x32, 0x20, 0x32, 0x31, 0x39, 0x38,
+  0x20, 0x32, 0x31, 0x39, 0x39, 0x20, 0x32, 0x31, 0x39, 0x38, 0x20, 0x32,
+  0x31, 0x33, 0x35, 0x20, 0x32, 0x31, 0x33, 0x35, 0x20, 0x32, 0x30, 0x34,
+  0x37, 0x20, 0x32, 0x31, 0x39, 0x39, 0x20, 0x32, 0x31, 0x35, 0x39, 0x20,
+  0x32, 0x31, 0x35, 0x39, 0x20, 0x32, 0x30, 0x34, 0x37, 0x20, 0x32, 0x31,
+  0x39, 0x39, 0x20, 0x32, 0x31, 0x32, 0x34, 0x20, 0x32, 0x31, 0x32, 0x34,
+  0x20, 0x32, 0x30, 0x36, 0x31, 0x20, 0x32, 0x30, 0x36, 0x31, 0x20, 0x31,
+  0x39, 0x34, 0x38, 0x20, 0x31, 0x39, 0x34, 0x38, 0x20, 0x32, 0x30, 0x30,
+  0x34, 0x20, 0x32, 0x30, 0x30, 0x34, 0x20, 0x31, 0x37, 0x31, 0x33, 0x20,
+  0x31, 0x37, 0x31, 0x33, 0x20, 0x31, 0x38, 0x35, 0x32, 0x20, 0x31, 0x38,
+  0x35, 0x32, 0x20, 0x31, 0x37, 0x39, 0x30, 0x20, 0x31, 0x37, 0x39, 0x30,
+  0x20, 0x31, 0x38, 0x37, 0x39, 0x20, 0x31, 0x38, 0x37, 0x39, 0x20, 0x32,
+  0x30, 0x36, 0x31, 0x20, 0x31, 0x37, 0x39, 0x30, 0x20, 0x31, 0x35, 0x34,
+  0x33, 0x20, 0x31, 0x35, 0x34, 0x33, 0x20, 0x31, 0x35, 0x35, 0x32, 0x20,
+  0x31, 0x35, 0x35, 0x32, 0x20, 0x31, 0x35, 0x36, 0x32, 0x20, 0x31, 0x35,
+  0x36, 0x32, 0x20, 0x31, 0x36, 0x30, 0x31, 0x20, 0x31, 0x35, 0x34, 0x33,
+  0x20, 0x31, 0x35, 0x34, 0x34, 0x20, 0x31, 0x35, 0x34, 0x34, 0x20, 0x31,
+  0x35, 0x37, 0x30, 0x20, 0x32, 0x31, 0x35, 0x39, 0x20, 0x32, 0x31, 0x32,
+  0x34, 0x0a, 0x50, 0x61, 0x76, 0x20, 0x31, 0x33, 0x20, 0x37, 0x37, 0x39,
+  0x30, 0x20, 0x38, 0x31, 0x38, 0x31, 0x20, 0x38, 0x31, 0x38, 0x31, 0x20,
+  0x37, 0x39, 0x31, 0x33, 0x20, 0x37, 0x39, 0x31, 0x33, 0x20, 0x37, 0x36,
+  0x36, 0x35, 0x20, 0x37, 0x36, 0x36, 0x35, 0x20, 0x37, 0x37, 0x39, 0x30,
+  0x20, 0x37, 0x36, 0x36, 0x35, 0x20, 0x37, 0x35, 0x39, 0x30, 0x20, 0x37,
+  0x35, 0x39, 0x30, 0x20, 0x36, 0x39, 0x38, 0x32, 0x20, 0x36, 0x39, 0x38,
+  0x32, 0x20, 0x37, 0x31, 0x30, 0x37, 0x20, 0x37, 0x31, 0x30, 0x37, 0x20,
+  0x37, 0x36, 0x36, 0x35, 0x20, 0x37, 0x31, 0x30, 0x37, 0x20, 0x37, 0x30,
+  0x37, 0x34, 0x20, 0x37, 0x30, 0x37, 0x34, 0x20, 0x36, 0x38, 0x35, 0x35,
+  0x20, 0x36, 0x38, 0x35, 0x35, 0x20, 0x36, 0x37, 0x34, 0x35, 0x20, 0x36,
+  0x37, 0x34, 0x35, 0x20, 0x37, 0x30, 0x37, 0x34, 0x20, 0x36, 0x37, 0x34,
+  0x35, 0x20, 0x36, 0x35, 0x38, 0x32, 0x0a, 0x50, 0x65, 0x67, 0x20, 0x31,
+  0x34, 0x20, 0x33, 0x39, 0x20, 0x38, 0x37, 0x38, 0x31, 0x20, 0x38, 0x37,
+  0x37, 0x35, 0x20, 0x38, 0x36, 0x35, 0x30, 0x20, 0x38, 0x36, 0x35, 0x30,
+  0x20, 0x38, 0x34, 0x34, 0x39, 0x20, 0x38, 0x37, 0x37, 0x35, 0x20, 0x38,
+  0x36, 0x38, 0x34, 0x20, 0x38, 0x36, 0x38, 0x34, 0x20, 0x38, 0x36, 0x36,
+  0x37, 0x20, 0x38, 0x36, 0x36, 0x37, 0x20, 0x38, 0x34, 0x33, 0x30, 0x20,
+  0x38, 0x34, 0x33, 0x30, 0x20, 0x38, 0x33, 0x31, 0x35, 0x20, 0x38, 0x37,
+  0x38, 0x31, 0x20, 0x38, 0x36, 0x36, 0x35, 0x20, 0x38, 0x36, 0x36, 0x35,
+  0x20, 0x38, 0x36, 0x33, 0x34, 0x20, 0x38, 0x36, 0x33, 0x34, 0x20, 0x38,
+  0x34, 0x35, 0x30, 0x20, 0x38, 0x34, 0x35, 0x30, 0x20, 0x38, 0x33, 0x30,
+  0x38, 0x20, 0x31, 0x35, 0x20, 0x38, 0x37, 0x37, 0x35, 0x20, 0x31, 0x35,
+  0x20, 0x33, 0x39, 0x20, 0x38, 0x37, 0x37, 0x35, 0x20, 0x38, 0x37, 0x38,
+  0x31, 0x0a, 0x50, 0x69, 0x63, 0x20, 0x32, 0x20, 0x32, 0x35, 0x35, 0x30,
+  0x20, 0x32, 0x30, 0x34, 0x32, 0x20, 0x32, 0x30, 0x34, 0x32, 0x20, 0x32,
+  0x30, 0x32, 0x30, 0x0a, 0x50, 0x65, 0x72, 0x20, 0x31, 0x30, 0x20, 0x31,
+  0x31, 0x33, 0x31, 0x20, 0x31, 0x32, 0x30, 0x33, 0x20, 0x31, 0x32, 0x30,
+  0x33, 0x20, 0x31, 0x32, 0x32, 0x38, 0x20, 0x31, 0x32, 0x32, 0x38, 0x20,
+  0x31, 0x32, 0x32, 0x30, 0x20, 0x31, 0x32, 0x32, 0x30, 0x20, 0x31, 0x31,
+  0x32, 0x32, 0x20, 0x31, 0x31, 0x32, 0x32, 0x20, 0x31, 0x30, 0x31, 0x37,
+  0x20, 0x31, 0x30, 0x31, 0x37, 0x20, 0x39, 0x31, 0x35, 0x20, 0x39, 0x31,
+  0x35, 0x20, 0x38, 0x33, 0x34, 0x20, 0x31, 0x30, 0x31, 0x37, 0x20, 0x39,
+  0x33, 0x36, 0x20, 0x39, 0x33, 0x36, 0x20, 0x39, 0x32, 0x31, 0x20, 0x39,
+  0x32, 0x31, 0x20, 0x38, 0x34, 0x30, 0x0a, 0x45, 0x71, 0x75, 0x20, 0x34,
+  0x20, 0x38, 0x30, 0x39, 0x37, 0x20, 0x38, 0x31, 0x32, 0x33, 0x20, 0x38,
+  0x31, 0x32, 0x33, 0x20, 0x38, 0x31, 0x37, 0x38, 0x20, 0x38, 0x31, 0x37,
+  0x38, 0x20, 0x38, 0x31, 0x33, 0x31, 0x20, 0x38, 0x31, 0x33, 0x31, 0x20,
+  0x38, 0x30, 0x39, 0x37, 0x0a, 0x43, 0x4d, 0x69, 0x20, 0x31, 0x20, 0x32,
+  0x39, 0x34, 0x33, 0x20, 0x32, 0x38, 0x34, 0x35, 0x0a, 0x4c, 0x4d, 0x69,
+  0x20, 0x34, 0x20, 0x34, 0x32, 0x34, 0x37, 0x20, 0x34, 0x31, 0x30, 0x30,
+  0x20, 0x34, 0x31, 0x30, 0x30, 0x20, 0x33, 0x39, 0x37, 0x34, 0x20, 0x33,
+  0x39, 0x37, 0x34, 0x20, 0x33, 0x38, 0x30, 0x30, 0x20, 0x33, 0x39, 0x37,
+  0x34, 0x20, 0x34, 0x32, 0x34, 0x37, 0x0a, 0x56, 0x75, 0x6c, 0x20, 0x31,
+  0x20, 0x37, 0x34, 0x30, 0x35, 0x20, 0x37, 0x36, 0x35, 0x33, 0x0a, 0x55,
+  0x4d, 0x69, 0x20, 0x37, 0x20, 0x30, 0x34, 0x32, 0x34, 0x20, 0x36, 0x37,
+  0x38, 0x39, 0x20, 0x36, 0x37, 0x38, 0x39, 0x20, 0x36, 0x33, 0x32, 0x32,
+  0x20, 0x36, 0x33, 0x32, 0x32, 0x20, 0x35, 0x39, 0x30, 0x33, 0x20, 0x35,
+  0x39, 0x30, 0x33, 0x20, 0x36, 0x31, 0x31, 0x36, 0x20, 0x36, 0x31, 0x31,
+  0x36, 0x20, 0x35, 0x37, 0x33, 0x35, 0x20, 0x35, 0x37, 0x33, 0x35, 0x20,
+  0x35, 0x35, 0x36, 0x33, 0x20, 0x35, 0x35, 0x36, 0x33, 0x20, 0x35, 0x39,
+  0x30, 0x33, 0x0a, 0x50, 0x68, 0x65, 0x20, 0x31, 0x31, 0x20, 0x33, 0x33,
+  0x38, 0x20, 0x33, 0x32, 0x32, 0x20, 0x33, 0x32, 0x32, 0x20, 0x31, 0x30,
+  0x30, 0x20, 0x31, 0x30, 0x30, 0x20, 0x33, 0x33, 0x38, 0x20, 0x33, 0x32,
+  0x32, 0x20, 0x34, 0x34, 0x30, 0x20, 0x34, 0x34, 0x30, 0x20, 0x35, 0x35,
+  0x35, 0x20, 0x35, 0x35, 0x35, 0x20, 0x33, 0x32, 0x32, 0x20, 0x33, 0x32,
+  0x32, 0x20, 0x34, 0x32, 0x39, 0x20, 0x34, 0x32, 0x39, 0x20, 0x31, 0x30,
+  0x30, 0x20, 0x31, 0x30, 0x30, 0x20, 0x39, 0x39, 0x20, 0x39, 0x39, 0x20,
+  0x32, 0x35, 0x20, 0x32, 0x35, 0x20, 0x31, 0x30, 0x30, 0x0a, 0x50, 0x73,
+  0x63, 0x20, 0x31, 0x39, 0x20, 0x32, 0x39, 0x31, 0x20, 0x33, 0x36, 0x30,
+  0x20, 0x32, 0x39, 0x31, 0x20, 0x33, 0x38, 0x33, 0x20, 0x33, 0x38, 0x33,
+  0x20, 0x33, 0x36, 0x30, 0x20, 0x33, 0x36, 0x30, 0x20, 0x34, 0x33, 0x37,
+  0x20, 0x34, 0x33, 0x37, 0x20, 0x35, 0x31, 0x30, 0x20, 0x35, 0x31, 0x30,
+  0x20, 0x35, 0x39, 0x35, 0x20, 0x35, 0x39, 0x35, 0x20, 0x35, 0x34, 0x39,
+  0x20, 0x35, 0x34, 0x39, 0x20, 0x34, 0x38, 0x39, 0x20, 0x34, 0x38, 0x39,
+  0x20, 0x34, 0x33, 0x34, 0x20, 0x34, 0x33, 0x34, 0x20, 0x32, 0x39, 0x34,
+  0x20, 0x32, 0x39, 0x34, 0x20, 0x32, 0x32, 0x31, 0x20, 0x32, 0x32, 0x31,
+  0x20, 0x38, 0x30, 0x20, 0x38, 0x30, 0x20, 0x39, 0x30, 0x37, 0x32, 0x20,
+  0x39, 0x30, 0x37, 0x32, 0x20, 0x38, 0x39, 0x36, 0x39, 0x20, 0x38, 0x39,
+  0x36, 0x39, 0x20, 0x38, 0x39, 0x38, 0x34, 0x20, 0x38, 0x39, 0x38, 0x34,
+  0x20, 0x38, 0x39, 0x31, 0x31, 0x20, 0x38, 0x39, 0x31, 0x31, 0x20, 0x38,
+  0x38, 0x35, 0x32, 0x20, 0x38, 0x38, 0x35, 0x32, 0x20, 0x38, 0x39, 0x31,
+  0x36, 0x20, 0x38, 0x39, 0x31, 0x36, 0x20, 0x38, 0x39, 0x36, 0x39, 0x0a,
+  0x50, 0x73, 0x41, 0x20, 0x36, 0x20, 0x38, 0x37, 0x32, 0x38, 0x20, 0x38,
+  0x36, 0x32, 0x38, 0x20, 0x38, 0x36, 0x32, 0x38, 0x20, 0x38, 0x33, 0x38,
+  0x36, 0x20, 0x38, 0x33, 0x38, 0x36, 0x20, 0x38, 0x33, 0x32, 0x36, 0x20,
+  0x38, 0x33, 0x32, 0x36, 0x20, 0x38, 0x34, 0x34, 0x37, 0x20, 0x38, 0x34,
+  0x34, 0x37, 0x20, 0x38, 0x35, 0x37, 0x36, 0x20, 0x38, 0x35, 0x37, 0x36,
+  0x20, 0x38, 0x37, 0x32, 0x30, 0x0a, 0x56, 0x6f, 0x6c, 0x20, 0x37, 0x20,
+  0x33, 0x30, 0x32, 0x34, 0x20, 0x32, 0x37, 0x33, 0x36, 0x20, 0x32, 0x37,
+  0x33, 0x36, 0x20, 0x33, 0x32, 0x32, 0x33, 0x20, 0x33, 0x32, 0x32, 0x33,
+  0x20, 0x33, 0x30, 0x32, 0x34, 0x20, 0x33, 0x32, 0x32, 0x33, 0x20, 0x32,
+  0x38, 0x30, 0x33, 0x20, 0x33, 0x32, 0x32, 0x33, 0x20, 0x33, 0x33, 0x34,
+  0x37, 0x20, 0x33, 0x33, 0x34, 0x37, 0x20, 0x33, 0x36, 0x31, 0x35, 0x20,
+  0x33, 0x36, 0x31, 0x35, 0x20, 0x33, 0x32, 0x32, 0x33, 0x0a, 0x50, 0x75,
+  0x70, 0x20, 0x37, 0x20, 0x33, 0x31, 0x38, 0x35, 0x20, 0x33, 0x30, 0x34,
+  0x33, 0x20, 0x33, 0x30, 0x34, 0x33, 0x20, 0x32, 0x37, 0x37, 0x33, 0x20,
+  0x32, 0x37, 0x37, 0x33, 0x20, 0x32, 0x34, 0x35, 0x31, 0x20, 0x32, 0x34,
+  0x35, 0x31, 0x20, 0x32, 0x35, 0x35, 0x33, 0x20, 0x32, 0x35, 0x35, 0x33,
+  0x20, 0x32, 0x38, 0x37, 0x38, 0x20, 0x32, 0x38, 0x37, 0x38, 0x20, 0x33,
+  0x31, 0x36, 0x35, 0x20, 0x33, 0x31, 0x36, 0x35, 0x20, 0x33, 0x31, 0x38,
+  0x35, 0x0a, 0x52, 0x65, 0x74, 0x20, 0x34, 0x20, 0x31, 0x33, 0x33, 0x36,
+  0x20, 0x31, 0x33, 0x35, 0x35, 0x20, 0x31, 0x33, 0x35, 0x35, 0x20, 0x31,
+  0x32, 0x34, 0x37, 0x20, 0x31, 0x32, 0x34, 0x37, 0x20, 0x31, 0x31, 0x37,
+  0x35, 0x20, 0x31, 0x31, 0x37, 0x35, 0x20, 0x31, 0x33, 0x33, 0x36, 0x0a,
+  0x53, 0x67, 0x72, 0x20, 0x32, 0x34, 0x20, 0x36, 0x38, 0x35, 0x39, 0x20,
+  0x36, 0x39, 0x31, 0x33, 0x20, 0x36, 0x38, 0x33, 0x32, 0x20, 0x36, 0x38,
+  0x37, 0x39, 0x20, 0x36, 0x38, 0x37, 0x39, 0x20, 0x36, 0x37, 0x34, 0x36,
+  0x20, 0x36, 0x37, 0x34, 0x36, 0x20, 0x36, 0x36, 0x31, 0x36, 0x20, 0x36,
+  0x37, 0x34, 0x36, 0x20, 0x36, 0x38, 0x35, 0x39, 0x20, 0x36, 0x38, 0x35,
+  0x39, 0x20, 0x36, 0x38, 0x37, 0x39, 0x20, 0x36, 0x38, 0x37, 0x39, 0x20,
+  0x37, 0x31, 0x39, 0x34, 0x20, 0x37, 0x31, 0x39, 0x34, 0x20, 0x37, 0x30,
+  0x33, 0x39, 0x20, 0x37, 0x30, 0x33, 0x39, 0x20, 0x36, 0x38, 0x35, 0x39,
+  0x20, 0x37, 0x30, 0x33, 0x39, 0x20, 0x36, 0x39, 0x31, 0x33, 0x20, 0x36,
+  0x39, 0x31, 0x33, 0x20, 0x36, 0x38, 0x31, 0x32, 0x20, 0x37, 0x31, 0x39,
+  0x34, 0x20, 0x37, 0x32, 0x33, 0x34, 0x20, 0x37, 0x32, 0x33, 0x34, 0x20,
+  0x37, 0x31, 0x32, 0x31, 0x20, 0x37, 0x31, 0x32, 0x31, 0x20, 0x37, 0x30,
+  0x33, 0x39, 0x20, 0x37, 0x31, 0x32, 0x31, 0x20, 0x37, 0x31, 0x35, 0x30,
+  0x20, 0x37, 0x31, 0x35, 0x30, 0x20, 0x37, 0x32, 0x31, 0x37, 0x20, 0x37,
+  0x32, 0x31, 0x37, 0x20, 0x37, 0x33, 0x30, 0x34, 0x20, 0x37, 0x33, 0x30,
+  0x34, 0x20, 0x37, 0x33, 0x34, 0x30, 0x20, 0x37, 0x32, 0x33, 0x34, 0x20,
+  0x37, 0x34, 0x33, 0x31, 0x20, 0x37, 0x34, 0x33, 0x31, 0x20, 0x37, 0x36,
+  0x35, 0x30, 0x20, 0x37, 0x36, 0x35, 0x30, 0x20, 0x37, 0x36, 0x32, 0x33,
+  0x20, 0x37, 0x36, 0x32, 0x33, 0x20, 0x37, 0x35, 0x38, 0x31, 0x20, 0x37,
+  0x35, 0x38, 0x31, 0x20, 0x37, 0x33, 0x34, 0x38, 0x20, 0x37, 0x35, 0x38,
+  0x31, 0x20, 0x37, 0x33, 0x34, 0x33, 0x0a, 0x53, 0x63, 0x6f, 0x20, 0x31,
+  0x32, 0x20, 0x36, 0x35, 0x32, 0x37, 0x20, 0x36, 0x35, 0x38, 0x30, 0x20,
+  0x36, 0x35, 0x38, 0x30, 0x20, 0x36, 0x36, 0x31, 0x35, 0x20, 0x36, 0x36,
+  0x31, 0x35, 0x20, 0x36, 0x35, 0x35, 0x33, 0x20, 0x36, 0x35, 0x35, 0x33,
+  0x20, 0x36, 0x33, 0x38, 0x30, 0x20, 0x36, 0x33, 0x38, 0x30, 0x20, 0x36,
+  0x32, 0x36, 0x32, 0x20, 0x36, 0x32, 0x36, 0x32, 0x20, 0x36, 0x32, 0x34,
+  0x37, 0x20, 0x36, 0x32, 0x34, 0x37, 0x20, 0x36, 0x32, 0x34, 0x31, 0x20,
+  0x36, 0x32, 0x34, 0x31, 0x20, 0x36, 0x31, 0x36, 0x35, 0x20, 0x36, 0x31,
+  0x36, 0x35, 0x20, 0x36, 0x31, 0x33, 0x34, 0x20, 0x36, 0x31, 0x33, 0x34,
+  0x20, 0x35, 0x39, 0x35, 0x33, 0x20, 0x36, 0x31, 0x33, 0x34, 0x20, 0x35,
+  0x39, 0x34, 0x34, 0x20, 0x36, 0x31, 0x33, 0x34, 0x20, 0x35, 0x39, 0x38,
+  0x34, 0x0a, 0x53, 0x65, 0x72, 0x20, 0x31, 0x31, 0x20, 0x35, 0x38, 0x38,
+  0x31, 0x20, 0x35, 0x38, 0x39, 0x32, 0x20, 0x35, 0x38, 0x39, 0x32, 0x20,
+  0x35, 0x38, 0x35, 0x34, 0x20, 0x35, 0x38, 0x35, 0x34, 0x20, 0x35, 0x37,
+  0x38, 0x38, 0x20, 0x35, 0x37, 0x38, 0x38, 0x20, 0x35, 0x38, 0x36, 0x37,
+  0x20, 0x35, 0x38, 0x36, 0x37, 0x20, 0x35, 0x39, 0x33, 0x33, 0x20, 0x35,
+  0x39, 0x33, 0x33, 0x20, 0x35, 0x38, 0x37, 0x39, 0x20, 0x35, 0x38, 0x37,
+  0x39, 0x20, 0x35, 0x38, 0x36, 0x37, 0x20, 0x37, 0x31, 0x34, 0x31, 0x20,
+  0x36, 0x38, 0x36, 0x39, 0x20, 0x36, 0x38, 0x36, 0x39, 0x20, 0x36, 0x35,
+  0x38, 0x31, 0x20, 0x36, 0x35, 0x38, 0x31, 0x20, 0x36, 0x35, 0x36, 0x31,
+  0x20, 0x36, 0x35, 0x36, 0x31, 0x20, 0x36, 0x34, 0x34, 0x36, 0x0a, 0x53,
+  0x65, 0x78, 0x20, 0x31, 0x20, 0x34, 0x31, 0x31, 0x39, 0x20, 0x33, 0x39,
+  0x38, 0x31, 0x0a, 0x4d, 0x65, 0x6e, 0x20, 0x31, 0x20, 0x31, 0x39, 0x35,
+  0x33, 0x20, 0x31, 0x35, 0x34, 0x31, 0x0a, 0x54, 0x61, 0x75, 0x20, 0x31,
+  0x32, 0x20, 0x31, 0x37, 0x39, 0x31, 0x20, 0x31, 0x34, 0x39, 0x37, 0x20,
+  0x31, 0x34, 0x39, 0x37, 0x20, 0x31, 0x34, 0x30, 0x39, 0x20, 0x31, 0x34,
+  0x35, 0x37, 0x20, 0x31, 0x39, 0x31, 0x30, 0x20, 0x31, 0x33, 0x34, 0x36,
+  0x20, 0x31, 0x33, 0x37, 0x33, 0x20, 0x31, 0x33, 0x34, 0x36, 0x20, 0x31,
+  0x32, 0x33, 0x39, 0x20, 0x31, 0x32, 0x33, 0x39, 0x20, 0x31, 0x30, 0x33,
+  0x30, 0x20, 0x31, 0x34, 0x35, 0x37, 0x20, 0x31, 0x34, 0x30, 0x39, 0x20,
+  0x31, 0x34, 0x35, 0x37, 0x20, 0x31, 0x34, 0x31, 0x32, 0x20, 0x31, 0x34,
+  0x31, 0x32, 0x20, 0x31, 0x33, 0x34, 0x36, 0x20, 0x31, 0x34, 0x30, 0x39,
+  0x20, 0x31, 0x33, 0x38, 0x39, 0x20, 0x31, 0x33, 0x38, 0x39, 0x20, 0x31,
+  0x33, 0x37, 0x33, 0x20, 0x31, 0x33, 0x37, 0x33, 0x20, 0x31, 0x31, 0x37,
+  0x38, 0x0a, 0x54, 0x65, 0x6c, 0x20, 0x31, 0x20, 0x36, 0x39, 0x30, 0x35,
+  0x20, 0x36, 0x38, 0x39, 0x37, 0x0a, 0x54, 0x75, 0x63, 0x20, 0x33, 0x20,
+  0x38, 0x35, 0x30, 0x32, 0x20, 0x38, 0x38, 0x34, 0x38, 0x20, 0x38, 0x38,
+  0x34, 0x38, 0x20, 0x37, 0x37, 0x20, 0x38, 0x38, 0x34, 0x38, 0x20, 0x31,
+  0x32, 0x36, 0x0a, 0x54, 0x72, 0x69, 0x20, 0x33, 0x20, 0x36, 0x36, 0x34,
+  0x20, 0x36, 0x32, 0x32, 0x20, 0x36, 0x32, 0x32, 0x20, 0x35, 0x34, 0x34,
+  0x20, 0x35, 0x34, 0x34, 0x20, 0x36, 0x36, 0x34, 0x0a, 0x54, 0x72, 0x41,
+  0x20, 0x33, 0x20, 0x36, 0x32, 0x31, 0x37, 0x20, 0x35, 0x36, 0x37, 0x31,
+  0x20, 0x35, 0x36, 0x37, 0x31, 0x20, 0x35, 0x38, 0x39, 0x37, 0x20, 0x35,
+  0x38, 0x39, 0x37, 0x20, 0x36, 0x32, 0x31, 0x37, 0x0a, 0x41, 0x71, 0x72,
+  0x20, 0x31, 0x34, 0x20, 0x38, 0x32, 0x33, 0x32, 0x20, 0x38, 0x34, 0x31,
+  0x34, 0x20, 0x38, 0x34, 0x31, 0x34, 0x20, 0x38, 0x35, 0x31, 0x38, 0x20,
+  0x38, 0x35, 0x31, 0x38, 0x20, 0x38, 0x35, 0x35, 0x38, 0x20, 0x38, 0x35,
+  0x35, 0x38, 0x20, 0x38, 0x35, 0x39, 0x37, 0x20, 0x38, 0x35, 0x39, 0x37,
+  0x20, 0x38, 0x36, 0x39, 0x38, 0x20, 0x38, 0x36, 0x39, 0x38, 0x20, 0x38,
+  0x38, 0x34, 0x31, 0x20, 0x38, 0x38, 0x34, 0x31, 0x20, 0x38, 0x38, 0x39,
+  0x32, 0x20, 0x38, 0x34, 0x31, 0x34, 0x20, 0x38, 0x34, 0x39, 0x39, 0x20,
+  0x38, 0x34, 0x39, 0x39, 0x20, 0x38, 0x34, 0x31, 0x38, 0x20, 0x38, 0x34,
+  0x39, 0x39, 0x20, 0x38, 0x35, 0x37, 0x33, 0x20, 0x38, 0x35, 0x37, 0x33,
+  0x20, 0x38, 0x36, 0x37, 0x39, 0x20, 0x38, 0x36, 0x37, 0x39, 0x20, 0x38,
+  0x37, 0x30, 0x39, 0x20, 0x38, 0x37, 0x30, 0x39, 0x20, 0x38, 0x38, 0x31,
+  0x32, 0x20, 0x37, 0x39, 0x35, 0x30, 0x20, 0x38, 0x32, 0x33, 0x32, 0x0a,
+  0x56, 0x69, 0x72, 0x20, 0x31, 0x32, 0x20, 0x34, 0x35, 0x31, 0x37, 0x20,
+  0x34, 0x36, 0x38, 0x39, 0x20, 0x34, 0x36, 0x38, 0x39, 0x20, 0x34, 0x38,
+  0x32, 0x35, 0x20, 0x34, 0x38, 0x32, 0x35, 0x20, 0x35, 0x30, 0x35, 0x36,
+  0x20, 0x35, 0x30, 0x35, 0x36, 0x20, 0x35, 0x33, 0x31, 0x35, 0x20, 0x35,
+  0x33, 0x31, 0x35, 0x20, 0x35, 0x33, 0x33, 0x38, 0x20, 0x35, 0x33, 0x33,
+  0x38, 0x20, 0x35, 0x34, 0x38, 0x37, 0x20, 0x35, 0x30, 0x35, 0x36, 0x20,
+  0x35, 0x31, 0x30, 0x37, 0x20, 0x35, 0x31, 0x30, 0x37, 0x20, 0x35, 0x32,
+  0x36, 0x34, 0x20, 0x35, 0x32, 0x36, 0x34, 0x20, 0x35, 0x35, 0x31, 0x31,
+  0x20, 0x35, 0x31, 0x30, 0x37, 0x20, 0x34, 0x39, 0x31, 0x30, 0x20, 0x34,
+  0x39, 0x31, 0x30, 0x20, 0x34, 0x39, 0x33, 0x32, 0x20, 0x34, 0x39, 0x31,
+  0x30, 0x20, 0x34, 0x38, 0x32, 0x35, 0x0a, 0x56, 0x65, 0x6c, 0x20, 0x31,
+  0x30, 0x20, 0x33, 0x32, 0x30, 0x37, 0x20, 0x33, 0x34, 0x34, 0x37, 0x20,
+  0x33, 0x34, 0x34, 0x37, 0x20, 0x33, 0x34, 0x38, 0x35, 0x20, 0x33, 0x34,
+  0x38, 0x35, 0x20, 0x33, 0x37, 0x33, 0x34, 0x20, 0x33, 0x37, 0x33, 0x34,
+  0x20, 0x33, 0x39, 0x34, 0x30, 0x20, 0x33, 0x39, 0x34, 0x30, 0x20, 0x34,
+  0x32, 0x31, 0x36, 0x20, 0x34, 0x32, 0x31, 0x36, 0x20, 0x34, 0x31, 0x36,
+  0x37, 0x20, 0x34, 0x31, 0x36, 0x37, 0x20, 0x34, 0x30, 0x32, 0x33, 0x20,
+  0x34, 0x30, 0x32, 0x33, 0x20, 0x33, 0x37, 0x38, 0x36, 0x20, 0x33, 0x37,
+  0x38, 0x36, 0x20, 0x33, 0x36, 0x33, 0x34, 0x20, 0x33, 0x36, 0x33, 0x34,
+  0x20, 0x33, 0x32, 0x30, 0x37, 0x0a
+};
+unsigned int bsc5_constellations_len = 7134;
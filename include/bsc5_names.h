@@ -0,0 +1,366 @@
+unsigned char bsc5_names[] = {
+  0x30, 0x38, 0x39, 0x37, 0x2c, 0x41, 0x63, 0x61, 0x6d, 0x61, 0x72, 0x0a,
+  0x30, 0x34, 0x37, 0x32, 0x2c, 0x41, 0x63, 0x68, 0x65, 0x72, 0x6e, 0x61,
+  0x72, 0x0a, 0x30, 0x32, 0x31, 0x39, 0x2c, 0x41, 0x63, 0x68, 0x69, 0x72,
+  0x64, 0x0a, 0x35, 0x39, 0x38, 0x34, 0x2c, 0x41, 0x63, 0x72, 0x61, 0x62,
+  0x0a, 0x34, 0x37, 0x33, 0x30, 0x2c, 0x41, 0x63, 0x72, 0x75, 0x78, 0x0a,
+  0x33, 0x35, 0x37, 0x32, 0x2c, 0x41, 0x63, 0x75, 0x62, 0x65, 0x6e, 0x73,
+  0x0a, 0x34, 0x30, 0x33, 0x31, 0x2c, 0x41, 0x64, 0x68, 0x61, 0x66, 0x65,
+  0x72, 0x61, 0x0a, 0x32, 0x36, 0x31, 0x38, 0x2c, 0x41, 0x64, 0x68, 0x61,
+  0x72, 0x61, 0x0a, 0x30, 0x33, 0x39, 0x30, 0x2c, 0x41, 0x64, 0x68, 0x69,
+  0x6c, 0x0a, 0x31, 0x34, 0x30, 0x39, 0x2c, 0x41, 0x69, 0x6e, 0x0a, 0x37,
+  0x31, 0x31, 0x36, 0x2c, 0x41, 0x69, 0x6e, 0x61, 0x6c, 0x72, 0x61, 0x6d,
+  0x69, 0x0a, 0x37, 0x32, 0x39, 0x38, 0x2c, 0x41, 0x6c, 0x61, 0x64, 0x66,
+  0x61, 0x72, 0x0a, 0x37, 0x32, 0x36, 0x34, 0x2c, 0x41, 0x6c, 0x62, 0x61,
+  0x6c, 0x64, 0x61, 0x68, 0x0a, 0x37, 0x39, 0x35, 0x30, 0x2c, 0x41, 0x6c,
+  0x62, 0x61, 0x6c, 0x69, 0x0a, 0x37, 0x34, 0x31, 0x37, 0x2c, 0x41, 0x6c,
+  0x62, 0x69, 0x72, 0x65, 0x6f, 0x0a, 0x34, 0x36, 0x32, 0x33, 0x2c, 0x41,
+  0x6c, 0x63, 0x68, 0x69, 0x62, 0x61, 0x0a, 0x35, 0x30, 0x36, 0x32, 0x2c,
+  0x41, 0x6c, 0x63, 0x6f, 0x72, 0x0a, 0x31, 0x31, 0x36, 0x35, 0x2c, 0x41,
+  0x6c, 0x63, 0x79, 0x6f, 0x6e, 0x65, 0x0a, 0x31, 0x34, 0x35, 0x37, 0x2c,
+  0x41, 0x6c, 0x64, 0x65, 0x62, 0x61, 0x72, 0x61, 0x6e, 0x0a, 0x38, 0x31,
+  0x36, 0x32, 0x2c, 0x41, 0x6c, 0x64, 0x65, 0x72, 0x61, 0x6d, 0x69, 0x6e,
+  0x0a, 0x38, 0x33, 0x35, 0x33, 0x2c, 0x41, 0x6c, 0x64, 0x68, 0x61, 0x6e,
+  0x61, 0x62, 0x0a, 0x36, 0x33, 0x39, 0x36, 0x2c, 0x41, 0x6c, 0x64, 0x68,
+  0x69, 0x62, 0x61, 0x68, 0x0a, 0x37, 0x38, 0x35, 0x32, 0x2c, 0x41, 0x6c,
+  0x64, 0x75, 0x6c, 0x66, 0x69, 0x6e, 0x0a, 0x38, 0x32, 0x33, 0x38, 0x2c,
+  0x41, 0x6c, 0x66, 0x69, 0x72, 0x6b, 0x0a, 0x37, 0x37, 0x35, 0x34, 0x2c,
+  0x41, 0x6c, 0x67, 0x65, 0x64, 0x69, 0x0a, 0x30, 0x30, 0x33, 0x39, 0x2c,
+  0x41, 0x6c, 0x67, 0x65, 0x6e, 0x69, 0x62, 0x0a, 0x34, 0x30, 0x35, 0x37,
+  0x2c, 0x41, 0x6c, 0x67, 0x69, 0x65, 0x62, 0x61, 0x0a, 0x30, 0x39, 0x33,
+  0x36, 0x2c, 0x41, 0x6c, 0x67, 0x6f, 0x6c, 0x0a, 0x34, 0x37, 0x35, 0x37,
+  0x2c, 0x41, 0x6c, 0x67, 0x6f, 0x72, 0x61, 0x62, 0x0a, 0x32, 0x34, 0x32,
+  0x31, 0x2c, 0x41, 0x6c, 0x68, 0x65, 0x6e, 0x61, 0x0a, 0x34, 0x39, 0x30,
+  0x35, 0x2c, 0x41, 0x6c, 0x69, 0x6f, 0x74, 0x68, 0x0a, 0x37, 0x39, 0x34,
+  0x39, 0x2c, 0x41, 0x6c, 0x6a, 0x61, 0x6e, 0x61, 0x68, 0x0a, 0x35, 0x31,
+  0x39, 0x31, 0x2c, 0x41, 0x6c, 0x6b, 0x61, 0x69, 0x64, 0x0a, 0x35, 0x37,
+  0x33, 0x33, 0x2c, 0x41, 0x6c, 0x6b, 0x61, 0x6c, 0x75, 0x72, 0x6f, 0x70,
+  0x73, 0x0a, 0x33, 0x35, 0x39, 0x34, 0x2c, 0x41, 0x6c, 0x6b, 0x61, 0x70,
+  0x68, 0x72, 0x61, 0x68, 0x0a, 0x38, 0x39, 0x30, 0x35, 0x2c, 0x41, 0x6c,
+  0x6b, 0x61, 0x72, 0x61, 0x62, 0x0a, 0x34, 0x32, 0x38, 0x37, 0x2c, 0x41,
+  0x6c, 0x6b, 0x65, 0x73, 0x0a, 0x31, 0x36, 0x30, 0x35, 0x2c, 0x41, 0x6c,
+  0x6d, 0x61, 0x61, 0x7a, 0x0a, 0x30, 0x36, 0x30, 0x33, 0x2c, 0x41, 0x6c,
+  0x6d, 0x61, 0x63, 0x68, 0x0a, 0x38, 0x34, 0x32, 0x35, 0x2c, 0x41, 0x6c,
+  0x6e, 0x61, 0x69, 0x72, 0x0a, 0x36, 0x37, 0x34, 0x36, 0x2c, 0x41, 0x6c,
+  0x6e, 0x61, 0x73, 0x6c, 0x0a, 0x31, 0x39, 0x30, 0x33, 0x2c, 0x41, 0x6c,
+  0x6e, 0x69, 0x6c, 0x61, 0x6d, 0x0a, 0x31, 0x39, 0x34, 0x38, 0x2c, 0x41,
+  0x6c, 0x6e, 0x69, 0x74, 0x61, 0x6b, 0x0a, 0x36, 0x30, 0x38, 0x34, 0x2c,
+  0x41, 0x6c, 0x6e, 0x69, 0x79, 0x61, 0x74, 0x0a, 0x33, 0x37, 0x34, 0x38,
+  0x2c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x72, 0x64, 0x0a, 0x35, 0x37, 0x39,
+  0x33, 0x2c, 0x41, 0x6c, 0x70, 0x68, 0x65, 0x63, 0x63, 0x61, 0x0a, 0x30,
+  0x30, 0x31, 0x35, 0x2c, 0x41, 0x6c, 0x70, 0x68, 0x65, 0x72, 0x61, 0x74,
+  0x7a, 0x0a, 0x30, 0x34, 0x33, 0x37, 0x2c, 0x41, 0x6c, 0x70, 0x68, 0x65,
+  0x72, 0x67, 0x0a, 0x36, 0x33, 0x37, 0x30, 0x2c, 0x41, 0x6c, 0x72, 0x61,
+  0x6b, 0x69, 0x73, 0x0a, 0x30, 0x35, 0x39, 0x36, 0x2c, 0x41, 0x6c, 0x72,
+  0x65, 0x73, 0x63, 0x68, 0x61, 0x0a, 0x36, 0x36, 0x31, 0x38, 0x2c, 0x41,
+  0x6c, 0x72, 0x75, 0x62, 0x61, 0x0a, 0x37, 0x34, 0x36, 0x32, 0x2c, 0x41,
+  0x6c, 0x73, 0x61, 0x66, 0x69, 0x0a, 0x33, 0x32, 0x37, 0x35, 0x2c, 0x41,
+  0x6c, 0x73, 0x63, 0x69, 0x61, 0x75, 0x6b, 0x61, 0x74, 0x0a, 0x33, 0x34,
+  0x38, 0x35, 0x2c, 0x41, 0x6c, 0x73, 0x65, 0x70, 0x68, 0x69, 0x6e, 0x61,
+  0x0a, 0x37, 0x36, 0x30, 0x32, 0x2c, 0x41, 0x6c, 0x73, 0x68, 0x61, 0x69,
+  0x6e, 0x0a, 0x37, 0x37, 0x37, 0x33, 0x2c, 0x41, 0x6c, 0x73, 0x68, 0x61,
+  0x74, 0x0a, 0x37, 0x35, 0x35, 0x37, 0x2c, 0x41, 0x6c, 0x74, 0x61, 0x69,
+  0x72, 0x0a, 0x37, 0x33, 0x31, 0x30, 0x2c, 0x41, 0x6c, 0x74, 0x61, 0x69,
+  0x73, 0x0a, 0x33, 0x37, 0x37, 0x33, 0x2c, 0x41, 0x6c, 0x74, 0x65, 0x72,
+  0x66, 0x0a, 0x32, 0x38, 0x32, 0x37, 0x2c, 0x41, 0x6c, 0x75, 0x64, 0x72,
+  0x61, 0x0a, 0x34, 0x33, 0x37, 0x35, 0x2c, 0x41, 0x6c, 0x75, 0x6c, 0x61,
+  0x20, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x73, 0x0a, 0x34,
+  0x33, 0x37, 0x37, 0x2c, 0x41, 0x6c, 0x75, 0x6c, 0x61, 0x20, 0x42, 0x6f,
+  0x72, 0x65, 0x61, 0x6c, 0x69, 0x73, 0x0a, 0x37, 0x31, 0x34, 0x31, 0x2c,
+  0x41, 0x6c, 0x79, 0x61, 0x0a, 0x32, 0x34, 0x38, 0x34, 0x2c, 0x41, 0x6c,
+  0x7a, 0x69, 0x72, 0x72, 0x0a, 0x38, 0x34, 0x39, 0x39, 0x2c, 0x41, 0x6e,
+  0x63, 0x68, 0x61, 0x0a, 0x30, 0x38, 0x35, 0x30, 0x2c, 0x41, 0x6e, 0x67,
+  0x65, 0x74, 0x65, 0x6e, 0x61, 0x72, 0x0a, 0x30, 0x30, 0x39, 0x39, 0x2c,
+  0x41, 0x6e, 0x6b, 0x61, 0x61, 0x0a, 0x37, 0x34, 0x30, 0x35, 0x2c, 0x41,
+  0x6e, 0x73, 0x65, 0x72, 0x0a, 0x36, 0x31, 0x33, 0x34, 0x2c, 0x41, 0x6e,
+  0x74, 0x61, 0x72, 0x65, 0x73, 0x0a, 0x35, 0x33, 0x34, 0x30, 0x2c, 0x41,
+  0x72, 0x63, 0x74, 0x75, 0x72, 0x75, 0x73, 0x0a, 0x37, 0x33, 0x34, 0x33,
+  0x2c, 0x41, 0x72, 0x6b, 0x61, 0x62, 0x20, 0x50, 0x6f, 0x73, 0x74, 0x65,
+  0x72, 0x69, 0x6f, 0x72, 0x0a, 0x37, 0x33, 0x33, 0x37, 0x2c, 0x41, 0x72,
+  0x6b, 0x61, 0x62, 0x20, 0x50, 0x72, 0x69, 0x6f, 0x72, 0x0a, 0x31, 0x38,
+  0x36, 0x35, 0x2c, 0x41, 0x72, 0x6e, 0x65, 0x62, 0x0a, 0x37, 0x31, 0x39,
+  0x34, 0x2c, 0x41, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x0a, 0x33, 0x34,
+  0x36, 0x31, 0x2c, 0x41, 0x73, 0x65, 0x6c, 0x6c, 0x75, 0x73, 0x20, 0x41,
+  0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x73, 0x0a, 0x33, 0x34, 0x34,
+  0x39, 0x2c, 0x41, 0x73, 0x65, 0x6c, 0x6c, 0x75, 0x73, 0x20, 0x42, 0x6f,
+  0x72, 0x65, 0x61, 0x6c, 0x69, 0x73, 0x0a, 0x33, 0x34, 0x38, 0x32, 0x2c,
+  0x41, 0x73, 0x68, 0x6c, 0x65, 0x73, 0x68, 0x61, 0x0a, 0x33, 0x36, 0x39,
+  0x39, 0x2c, 0x41, 0x73, 0x70, 0x69, 0x64, 0x69, 0x73, 0x6b, 0x65, 0x0a,
+  0x31, 0x31, 0x35, 0x31, 0x2c, 0x41, 0x73, 0x74, 0x65, 0x72, 0x6f, 0x70,
+  0x65, 0x0a, 0x36, 0x31, 0x33, 0x32, 0x2c, 0x41, 0x74, 0x68, 0x65, 0x62,
+  0x79, 0x6e, 0x65, 0x0a, 0x31, 0x31, 0x33, 0x31, 0x2c, 0x41, 0x74, 0x69,
+  0x6b, 0x0a, 0x31, 0x31, 0x37, 0x38, 0x2c, 0x41, 0x74, 0x6c, 0x61, 0x73,
+  0x0a, 0x36, 0x32, 0x31, 0x37, 0x2c, 0x41, 0x74, 0x72, 0x69, 0x61, 0x0a,
+  0x33, 0x33, 0x30, 0x37, 0x2c, 0x41, 0x76, 0x69, 0x6f, 0x72, 0x0a, 0x38,
+  0x33, 0x30, 0x31, 0x2c, 0x41, 0x7a, 0x65, 0x6c, 0x66, 0x61, 0x66, 0x61,
+  0x67, 0x65, 0x0a, 0x30, 0x38, 0x37, 0x34, 0x2c, 0x41, 0x7a, 0x68, 0x61,
+  0x0a, 0x33, 0x30, 0x34, 0x35, 0x2c, 0x41, 0x7a, 0x6d, 0x69, 0x64, 0x69,
+  0x0a, 0x30, 0x35, 0x33, 0x39, 0x2c, 0x42, 0x61, 0x74, 0x65, 0x6e, 0x20,
+  0x4b, 0x61, 0x69, 0x74, 0x6f, 0x73, 0x0a, 0x31, 0x33, 0x39, 0x33, 0x2c,
+  0x42, 0x65, 0x65, 0x6d, 0x69, 0x6d, 0x0a, 0x31, 0x32, 0x39, 0x38, 0x2c,
+  0x42, 0x65, 0x69, 0x64, 0x0a, 0x31, 0x37, 0x39, 0x30, 0x2c, 0x42, 0x65,
+  0x6c, 0x6c, 0x61, 0x74, 0x72, 0x69, 0x78, 0x0a, 0x32, 0x30, 0x36, 0x31,
+  0x2c, 0x42, 0x65, 0x74, 0x65, 0x6c, 0x67, 0x65, 0x75, 0x73, 0x65, 0x0a,
+  0x30, 0x38, 0x33, 0x38, 0x2c, 0x42, 0x68, 0x61, 0x72, 0x61, 0x6e, 0x69,
+  0x0a, 0x38, 0x34, 0x35, 0x30, 0x2c, 0x42, 0x69, 0x68, 0x61, 0x6d, 0x0a,
+  0x30, 0x39, 0x35, 0x31, 0x2c, 0x42, 0x6f, 0x74, 0x65, 0x69, 0x6e, 0x0a,
+  0x35, 0x36, 0x30, 0x33, 0x2c, 0x42, 0x72, 0x61, 0x63, 0x68, 0x69, 0x75,
+  0x6d, 0x0a, 0x38, 0x32, 0x36, 0x34, 0x2c, 0x42, 0x75, 0x6e, 0x64, 0x61,
+  0x0a, 0x32, 0x33, 0x32, 0x36, 0x2c, 0x43, 0x61, 0x6e, 0x6f, 0x70, 0x75,
+  0x73, 0x0a, 0x31, 0x37, 0x30, 0x38, 0x2c, 0x43, 0x61, 0x70, 0x65, 0x6c,
+  0x6c, 0x61, 0x0a, 0x30, 0x30, 0x32, 0x31, 0x2c, 0x43, 0x61, 0x70, 0x68,
+  0x0a, 0x32, 0x38, 0x39, 0x31, 0x2c, 0x43, 0x61, 0x73, 0x74, 0x6f, 0x72,
+  0x0a, 0x30, 0x32, 0x36, 0x35, 0x2c, 0x43, 0x61, 0x73, 0x74, 0x75, 0x6c,
+  0x61, 0x0a, 0x36, 0x36, 0x30, 0x33, 0x2c, 0x43, 0x65, 0x62, 0x61, 0x6c,
+  0x72, 0x61, 0x69, 0x0a, 0x31, 0x31, 0x34, 0x30, 0x2c, 0x43, 0x65, 0x6c,
+  0x61, 0x65, 0x6e, 0x6f, 0x0a, 0x36, 0x35, 0x38, 0x35, 0x2c, 0x43, 0x65,
+  0x72, 0x76, 0x61, 0x6e, 0x74, 0x65, 0x73, 0x0a, 0x34, 0x32, 0x37, 0x37,
+  0x2c, 0x43, 0x68, 0x61, 0x6c, 0x61, 0x77, 0x61, 0x6e, 0x0a, 0x31, 0x34,
+  0x31, 0x32, 0x2c, 0x43, 0x68, 0x61, 0x6d, 0x75, 0x6b, 0x75, 0x79, 0x0a,
+  0x34, 0x37, 0x38, 0x35, 0x2c, 0x43, 0x68, 0x61, 0x72, 0x61, 0x0a, 0x34,
+  0x33, 0x35, 0x39, 0x2c, 0x43, 0x68, 0x65, 0x72, 0x74, 0x61, 0x6e, 0x0a,
+  0x33, 0x35, 0x32, 0x32, 0x2c, 0x43, 0x6f, 0x70, 0x65, 0x72, 0x6e, 0x69,
+  0x63, 0x75, 0x73, 0x0a, 0x34, 0x39, 0x31, 0x35, 0x2c, 0x43, 0x6f, 0x72,
+  0x20, 0x43, 0x61, 0x72, 0x6f, 0x6c, 0x69, 0x0a, 0x36, 0x31, 0x31, 0x37,
+  0x2c, 0x43, 0x75, 0x6a, 0x61, 0x6d, 0x0a, 0x31, 0x36, 0x36, 0x36, 0x2c,
+  0x43, 0x75, 0x72, 0x73, 0x61, 0x0a, 0x37, 0x37, 0x37, 0x36, 0x2c, 0x44,
+  0x61, 0x62, 0x69, 0x68, 0x0a, 0x30, 0x39, 0x36, 0x33, 0x2c, 0x44, 0x61,
+  0x6c, 0x69, 0x6d, 0x0a, 0x37, 0x39, 0x32, 0x34, 0x2c, 0x44, 0x65, 0x6e,
+  0x65, 0x62, 0x0a, 0x38, 0x33, 0x32, 0x32, 0x2c, 0x44, 0x65, 0x6e, 0x65,
+  0x62, 0x20, 0x41, 0x6c, 0x67, 0x65, 0x64, 0x69, 0x0a, 0x34, 0x35, 0x33,
+  0x34, 0x2c, 0x44, 0x65, 0x6e, 0x65, 0x62, 0x6f, 0x6c, 0x61, 0x0a, 0x34,
+  0x39, 0x36, 0x38, 0x2c, 0x44, 0x69, 0x61, 0x64, 0x65, 0x6d, 0x0a, 0x30,
+  0x31, 0x38, 0x38, 0x2c, 0x44, 0x69, 0x70, 0x68, 0x64, 0x61, 0x0a, 0x35,
+  0x39, 0x35, 0x33, 0x2c, 0x44, 0x73, 0x63, 0x68, 0x75, 0x62, 0x62, 0x61,
+  0x0a, 0x34, 0x33, 0x30, 0x31, 0x2c, 0x44, 0x75, 0x62, 0x68, 0x65, 0x0a,
+  0x36, 0x36, 0x33, 0x36, 0x2c, 0x44, 0x7a, 0x69, 0x62, 0x61, 0x6e, 0x0a,
+  0x35, 0x37, 0x34, 0x34, 0x2c, 0x45, 0x64, 0x61, 0x73, 0x69, 0x63, 0x68,
+  0x0a, 0x31, 0x31, 0x34, 0x32, 0x2c, 0x45, 0x6c, 0x65, 0x63, 0x74, 0x72,
+  0x61, 0x0a, 0x35, 0x34, 0x30, 0x39, 0x2c, 0x45, 0x6c, 0x67, 0x61, 0x66,
+  0x61, 0x72, 0x0a, 0x32, 0x31, 0x37, 0x37, 0x2c, 0x45, 0x6c, 0x6b, 0x75,
+  0x72, 0x75, 0x64, 0x0a, 0x31, 0x37, 0x39, 0x31, 0x2c, 0x45, 0x6c, 0x6e,
+  0x61, 0x74, 0x68, 0x0a, 0x36, 0x37, 0x30, 0x35, 0x2c, 0x45, 0x6c, 0x74,
+  0x61, 0x6e, 0x69, 0x6e, 0x0a, 0x38, 0x33, 0x30, 0x38, 0x2c, 0x45, 0x6e,
+  0x69, 0x66, 0x0a, 0x38, 0x39, 0x37, 0x34, 0x2c, 0x45, 0x72, 0x72, 0x61,
+  0x69, 0x0a, 0x36, 0x39, 0x34, 0x35, 0x2c, 0x46, 0x61, 0x66, 0x6e, 0x69,
+  0x72, 0x0a, 0x35, 0x39, 0x34, 0x34, 0x2c, 0x46, 0x61, 0x6e, 0x67, 0x0a,
+  0x37, 0x35, 0x32, 0x38, 0x2c, 0x46, 0x61, 0x77, 0x61, 0x72, 0x69, 0x73,
+  0x0a, 0x33, 0x39, 0x32, 0x33, 0x2c, 0x46, 0x65, 0x6c, 0x69, 0x73, 0x0a,
+  0x38, 0x37, 0x32, 0x38, 0x2c, 0x46, 0x6f, 0x6d, 0x61, 0x6c, 0x68, 0x61,
+  0x75, 0x74, 0x0a, 0x30, 0x31, 0x35, 0x33, 0x2c, 0x46, 0x75, 0x6c, 0x75,
+  0x0a, 0x38, 0x37, 0x37, 0x33, 0x2c, 0x46, 0x75, 0x6d, 0x61, 0x6c, 0x73,
+  0x61, 0x6d, 0x61, 0x6b, 0x61, 0x68, 0x0a, 0x32, 0x32, 0x38, 0x32, 0x2c,
+  0x46, 0x75, 0x72, 0x75, 0x64, 0x0a, 0x36, 0x36, 0x33, 0x30, 0x2c, 0x46,
+  0x75, 0x79, 0x75, 0x65, 0x0a, 0x34, 0x37, 0x36, 0x33, 0x2c, 0x47, 0x61,
+  0x63, 0x72, 0x75, 0x78, 0x0a, 0x34, 0x34, 0x33, 0x34, 0x2c, 0x47, 0x69,
+  0x61, 0x75, 0x73, 0x61, 0x72, 0x0a, 0x34, 0x36, 0x36, 0x32, 0x2c, 0x47,
+  0x69, 0x65, 0x6e, 0x61, 0x68, 0x0a, 0x34, 0x37, 0x30, 0x30, 0x2c, 0x47,
+  0x69, 0x6e, 0x61, 0x6e, 0x0a, 0x32, 0x38, 0x34, 0x35, 0x2c, 0x47, 0x6f,
+  0x6d, 0x65, 0x69, 0x73, 0x61, 0x0a, 0x36, 0x36, 0x38, 0x38, 0x2c, 0x47,
+  0x72, 0x75, 0x6d, 0x69, 0x75, 0x6d, 0x0a, 0x35, 0x38, 0x37, 0x39, 0x2c,
+  0x47, 0x75, 0x64, 0x6a, 0x61, 0x0a, 0x36, 0x34, 0x30, 0x32, 0x2c, 0x47,
+  0x75, 0x6e, 0x69, 0x69, 0x62, 0x75, 0x75, 0x0a, 0x35, 0x32, 0x36, 0x37,
+  0x2c, 0x48, 0x61, 0x64, 0x61, 0x72, 0x0a, 0x31, 0x36, 0x34, 0x31, 0x2c,
+  0x48, 0x61, 0x65, 0x64, 0x75, 0x73, 0x0a, 0x30, 0x36, 0x31, 0x37, 0x2c,
+  0x48, 0x61, 0x6d, 0x61, 0x6c, 0x0a, 0x31, 0x35, 0x37, 0x37, 0x2c, 0x48,
+  0x61, 0x73, 0x73, 0x61, 0x6c, 0x65, 0x68, 0x0a, 0x31, 0x38, 0x39, 0x39,
+  0x2c, 0x48, 0x61, 0x74, 0x79, 0x73, 0x61, 0x0a, 0x38, 0x37, 0x32, 0x39,
+  0x2c, 0x48, 0x65, 0x6c, 0x76, 0x65, 0x74, 0x69, 0x6f, 0x73, 0x0a, 0x35,
+  0x31, 0x30, 0x37, 0x2c, 0x48, 0x65, 0x7a, 0x65, 0x0a, 0x38, 0x36, 0x33,
+  0x34, 0x2c, 0x48, 0x6f, 0x6d, 0x61, 0x6d, 0x0a, 0x35, 0x39, 0x32, 0x38,
+  0x2c, 0x49, 0x6b, 0x6c, 0x69, 0x6c, 0x0a, 0x34, 0x36, 0x35, 0x36, 0x2c,
+  0x49, 0x6d, 0x61, 0x69, 0x0a, 0x33, 0x37, 0x34, 0x33, 0x2c, 0x49, 0x6e,
+  0x74, 0x65, 0x72, 0x63, 0x72, 0x75, 0x73, 0x0a, 0x35, 0x35, 0x30, 0x36,
+  0x2c, 0x49, 0x7a, 0x61, 0x72, 0x0a, 0x36, 0x30, 0x32, 0x37, 0x2c, 0x4a,
+  0x61, 0x62, 0x62, 0x61, 0x68, 0x0a, 0x32, 0x39, 0x33, 0x30, 0x2c, 0x4a,
+  0x69, 0x73, 0x68, 0x75, 0x69, 0x0a, 0x30, 0x38, 0x30, 0x34, 0x2c, 0x4b,
+  0x61, 0x66, 0x66, 0x61, 0x6c, 0x6a, 0x69, 0x64, 0x68, 0x6d, 0x61, 0x0a,
+  0x35, 0x33, 0x31, 0x35, 0x2c, 0x4b, 0x61, 0x6e, 0x67, 0x0a, 0x36, 0x38,
+  0x37, 0x39, 0x2c, 0x4b, 0x61, 0x75, 0x73, 0x20, 0x41, 0x75, 0x73, 0x74,
+  0x72, 0x61, 0x6c, 0x69, 0x73, 0x0a, 0x36, 0x39, 0x31, 0x33, 0x2c, 0x4b,
+  0x61, 0x75, 0x73, 0x20, 0x42, 0x6f, 0x72, 0x65, 0x61, 0x6c, 0x69, 0x73,
+  0x0a, 0x36, 0x38, 0x35, 0x39, 0x2c, 0x4b, 0x61, 0x75, 0x73, 0x20, 0x4d,
+  0x65, 0x64, 0x69, 0x61, 0x0a, 0x31, 0x33, 0x32, 0x35, 0x2c, 0x4b, 0x65,
+  0x69, 0x64, 0x0a, 0x35, 0x33, 0x35, 0x39, 0x2c, 0x4b, 0x68, 0x61, 0x6d,
+  0x62, 0x61, 0x6c, 0x69, 0x61, 0x0a, 0x38, 0x31, 0x33, 0x31, 0x2c, 0x4b,
+  0x69, 0x74, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x0a, 0x35, 0x35, 0x36, 0x33,
+  0x2c, 0x4b, 0x6f, 0x63, 0x68, 0x61, 0x62, 0x0a, 0x36, 0x31, 0x34, 0x38,
+  0x2c, 0x4b, 0x6f, 0x72, 0x6e, 0x65, 0x70, 0x68, 0x6f, 0x72, 0x6f, 0x73,
+  0x0a, 0x34, 0x37, 0x38, 0x36, 0x2c, 0x4b, 0x72, 0x61, 0x7a, 0x0a, 0x38,
+  0x34, 0x31, 0x37, 0x2c, 0x4b, 0x75, 0x72, 0x68, 0x61, 0x68, 0x0a, 0x34,
+  0x38, 0x34, 0x36, 0x2c, 0x4c, 0x61, 0x20, 0x53, 0x75, 0x70, 0x65, 0x72,
+  0x62, 0x61, 0x0a, 0x36, 0x32, 0x34, 0x31, 0x2c, 0x4c, 0x61, 0x72, 0x61,
+  0x77, 0x61, 0x67, 0x0a, 0x36, 0x35, 0x30, 0x38, 0x2c, 0x4c, 0x65, 0x73,
+  0x61, 0x74, 0x68, 0x0a, 0x37, 0x35, 0x39, 0x35, 0x2c, 0x4c, 0x69, 0x62,
+  0x65, 0x72, 0x74, 0x61, 0x73, 0x0a, 0x30, 0x38, 0x32, 0x34, 0x2c, 0x4c,
+  0x69, 0x6c, 0x69, 0x69, 0x20, 0x42, 0x6f, 0x72, 0x65, 0x61, 0x0a, 0x36,
+  0x35, 0x32, 0x36, 0x2c, 0x4d, 0x61, 0x61, 0x73, 0x79, 0x6d, 0x0a, 0x32,
+  0x30, 0x39, 0x35, 0x2c, 0x4d, 0x61, 0x68, 0x61, 0x73, 0x69, 0x6d, 0x0a,
+  0x31, 0x31, 0x34, 0x39, 0x2c, 0x4d, 0x61, 0x69, 0x61, 0x0a, 0x36, 0x31,
+  0x34, 0x39, 0x2c, 0x4d, 0x61, 0x72, 0x66, 0x69, 0x6b, 0x0a, 0x38, 0x37,
+  0x38, 0x31, 0x2c, 0x4d, 0x61, 0x72, 0x6b, 0x61, 0x62, 0x0a, 0x33, 0x37,
+  0x33, 0x34, 0x2c, 0x4d, 0x61, 0x72, 0x6b, 0x65, 0x62, 0x0a, 0x36, 0x30,
+  0x30, 0x38, 0x2c, 0x4d, 0x61, 0x72, 0x73, 0x69, 0x63, 0x0a, 0x38, 0x36,
+  0x35, 0x30, 0x2c, 0x4d, 0x61, 0x74, 0x61, 0x72, 0x0a, 0x32, 0x34, 0x37,
+  0x33, 0x2c, 0x4d, 0x65, 0x62, 0x73, 0x75, 0x74, 0x61, 0x0a, 0x34, 0x36,
+  0x36, 0x30, 0x2c, 0x4d, 0x65, 0x67, 0x72, 0x65, 0x7a, 0x0a, 0x31, 0x38,
+  0x37, 0x39, 0x2c, 0x4d, 0x65, 0x69, 0x73, 0x73, 0x61, 0x0a, 0x32, 0x36,
+  0x35, 0x30, 0x2c, 0x4d, 0x65, 0x6b, 0x62, 0x75, 0x64, 0x61, 0x0a, 0x33,
+  0x34, 0x32, 0x39, 0x2c, 0x4d, 0x65, 0x6c, 0x65, 0x70, 0x68, 0x0a, 0x32,
+  0x30, 0x38, 0x38, 0x2c, 0x4d, 0x65, 0x6e, 0x6b, 0x61, 0x6c, 0x69, 0x6e,
+  0x61, 0x6e, 0x0a, 0x30, 0x39, 0x31, 0x31, 0x2c, 0x4d, 0x65, 0x6e, 0x6b,
+  0x61, 0x72, 0x0a, 0x35, 0x32, 0x38, 0x38, 0x2c, 0x4d, 0x65, 0x6e, 0x6b,
+  0x65, 0x6e, 0x74, 0x0a, 0x31, 0x32, 0x32, 0x38, 0x2c, 0x4d, 0x65, 0x6e,
+  0x6b, 0x69, 0x62, 0x0a, 0x34, 0x32, 0x39, 0x35, 0x2c, 0x4d, 0x65, 0x72,
+  0x61, 0x6b, 0x0a, 0x35, 0x35, 0x33, 0x33, 0x2c, 0x4d, 0x65, 0x72, 0x67,
+  0x61, 0x0a, 0x37, 0x32, 0x35, 0x34, 0x2c, 0x4d, 0x65, 0x72, 0x69, 0x64,
+  0x69, 0x61, 0x6e, 0x61, 0x0a, 0x31, 0x31, 0x35, 0x36, 0x2c, 0x4d, 0x65,
+  0x72, 0x6f, 0x70, 0x65, 0x0a, 0x30, 0x35, 0x34, 0x36, 0x2c, 0x4d, 0x65,
+  0x73, 0x61, 0x72, 0x74, 0x68, 0x69, 0x6d, 0x0a, 0x33, 0x36, 0x38, 0x35,
+  0x2c, 0x4d, 0x69, 0x61, 0x70, 0x6c, 0x61, 0x63, 0x69, 0x64, 0x75, 0x73,
+  0x0a, 0x34, 0x38, 0x35, 0x33, 0x2c, 0x4d, 0x69, 0x6d, 0x6f, 0x73, 0x61,
+  0x0a, 0x33, 0x34, 0x31, 0x38, 0x2c, 0x4d, 0x69, 0x6e, 0x63, 0x68, 0x69,
+  0x72, 0x0a, 0x34, 0x39, 0x31, 0x30, 0x2c, 0x4d, 0x69, 0x6e, 0x65, 0x6c,
+  0x61, 0x75, 0x76, 0x61, 0x0a, 0x31, 0x38, 0x35, 0x32, 0x2c, 0x4d, 0x69,
+  0x6e, 0x74, 0x61, 0x6b, 0x61, 0x0a, 0x30, 0x36, 0x38, 0x31, 0x2c, 0x4d,
+  0x69, 0x72, 0x61, 0x0a, 0x30, 0x33, 0x33, 0x37, 0x2c, 0x4d, 0x69, 0x72,
+  0x61, 0x63, 0x68, 0x0a, 0x30, 0x38, 0x33, 0x34, 0x2c, 0x4d, 0x69, 0x72,
+  0x61, 0x6d, 0x0a, 0x31, 0x30, 0x31, 0x37, 0x2c, 0x4d, 0x69, 0x72, 0x66,
+  0x61, 0x6b, 0x0a, 0x32, 0x32, 0x39, 0x34, 0x2c, 0x4d, 0x69, 0x72, 0x7a,
+  0x61, 0x6d, 0x0a, 0x30, 0x39, 0x34, 0x31, 0x2c, 0x4d, 0x69, 0x73, 0x61,
+  0x6d, 0x0a, 0x35, 0x30, 0x35, 0x34, 0x2c, 0x4d, 0x69, 0x7a, 0x61, 0x72,
+  0x0a, 0x30, 0x35, 0x34, 0x34, 0x2c, 0x4d, 0x6f, 0x74, 0x68, 0x61, 0x6c,
+  0x6c, 0x61, 0x68, 0x0a, 0x32, 0x36, 0x35, 0x37, 0x2c, 0x4d, 0x75, 0x6c,
+  0x69, 0x70, 0x68, 0x65, 0x69, 0x6e, 0x0a, 0x35, 0x32, 0x33, 0x35, 0x2c,
+  0x4d, 0x75, 0x70, 0x68, 0x72, 0x69, 0x64, 0x0a, 0x33, 0x33, 0x32, 0x33,
+  0x2c, 0x4d, 0x75, 0x73, 0x63, 0x69, 0x64, 0x61, 0x0a, 0x38, 0x30, 0x33,
+  0x30, 0x2c, 0x4d, 0x75, 0x73, 0x69, 0x63, 0x61, 0x0a, 0x33, 0x36, 0x32,
+  0x37, 0x2c, 0x4e, 0x61, 0x68, 0x6e, 0x0a, 0x33, 0x31, 0x36, 0x35, 0x2c,
+  0x4e, 0x61, 0x6f, 0x73, 0x0a, 0x38, 0x32, 0x37, 0x38, 0x2c, 0x4e, 0x61,
+  0x73, 0x68, 0x69, 0x72, 0x61, 0x0a, 0x35, 0x36, 0x30, 0x32, 0x2c, 0x4e,
+  0x65, 0x6b, 0x6b, 0x61, 0x72, 0x0a, 0x30, 0x34, 0x36, 0x34, 0x2c, 0x4e,
+  0x65, 0x6d, 0x62, 0x75, 0x73, 0x0a, 0x31, 0x38, 0x32, 0x39, 0x2c, 0x4e,
+  0x69, 0x68, 0x61, 0x6c, 0x0a, 0x37, 0x31, 0x32, 0x31, 0x2c, 0x4e, 0x75,
+  0x6e, 0x6b, 0x69, 0x0a, 0x35, 0x37, 0x34, 0x37, 0x2c, 0x4e, 0x75, 0x73,
+  0x61, 0x6b, 0x61, 0x6e, 0x0a, 0x37, 0x32, 0x33, 0x35, 0x2c, 0x4f, 0x6b,
+  0x61, 0x62, 0x0a, 0x36, 0x31, 0x36, 0x35, 0x2c, 0x50, 0x61, 0x69, 0x6b,
+  0x61, 0x75, 0x68, 0x61, 0x6c, 0x65, 0x0a, 0x37, 0x37, 0x39, 0x30, 0x2c,
+  0x50, 0x65, 0x61, 0x63, 0x6f, 0x63, 0x6b, 0x0a, 0x31, 0x39, 0x35, 0x36,
+  0x2c, 0x50, 0x68, 0x61, 0x63, 0x74, 0x0a, 0x34, 0x35, 0x35, 0x34, 0x2c,
+  0x50, 0x68, 0x65, 0x63, 0x64, 0x61, 0x0a, 0x35, 0x37, 0x33, 0x35, 0x2c,
+  0x50, 0x68, 0x65, 0x72, 0x6b, 0x61, 0x64, 0x0a, 0x33, 0x32, 0x36, 0x38,
+  0x2c, 0x50, 0x69, 0x61, 0x75, 0x74, 0x6f, 0x73, 0x0a, 0x36, 0x32, 0x35,
+  0x32, 0x2c, 0x50, 0x69, 0x70, 0x69, 0x72, 0x69, 0x6d, 0x61, 0x0a, 0x31,
+  0x31, 0x38, 0x30, 0x2c, 0x50, 0x6c, 0x65, 0x69, 0x6f, 0x6e, 0x65, 0x0a,
+  0x30, 0x34, 0x32, 0x34, 0x2c, 0x50, 0x6f, 0x6c, 0x61, 0x72, 0x69, 0x73,
+  0x0a, 0x37, 0x32, 0x32, 0x38, 0x2c, 0x50, 0x6f, 0x6c, 0x61, 0x72, 0x69,
+  0x73, 0x20, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x73, 0x0a,
+  0x36, 0x38, 0x31, 0x32, 0x2c, 0x50, 0x6f, 0x6c, 0x69, 0x73, 0x0a, 0x32,
+  0x39, 0x39, 0x30, 0x2c, 0x50, 0x6f, 0x6c, 0x6c, 0x75, 0x78, 0x0a, 0x34,
+  0x38, 0x32, 0x35, 0x2c, 0x50, 0x6f, 0x72, 0x72, 0x69, 0x6d, 0x61, 0x0a,
+  0x34, 0x32, 0x34, 0x37, 0x2c, 0x50, 0x72, 0x61, 0x65, 0x63, 0x69, 0x70,
+  0x75, 0x61, 0x0a, 0x31, 0x33, 0x34, 0x36, 0x2c, 0x50, 0x72, 0x69, 0x6d,
+  0x61, 0x20, 0x48, 0x79, 0x61, 0x64, 0x75, 0x6d, 0x0a, 0x32, 0x39, 0x34,
+  0x33, 0x2c, 0x50, 0x72, 0x6f, 0x63, 0x79, 0x6f, 0x6e, 0x0a, 0x32, 0x32,
+  0x31, 0x36, 0x2c, 0x50, 0x72, 0x6f, 0x70, 0x75, 0x73, 0x0a, 0x31, 0x30,
+  0x38, 0x34, 0x2c, 0x52, 0x61, 0x6e, 0x0a, 0x31, 0x31, 0x33, 0x36, 0x2c,
+  0x52, 0x61, 0x6e, 0x61, 0x0a, 0x33, 0x39, 0x30, 0x35, 0x2c, 0x52, 0x61,
+  0x73, 0x61, 0x6c, 0x61, 0x73, 0x0a, 0x36, 0x34, 0x30, 0x36, 0x2c, 0x52,
+  0x61, 0x73, 0x61, 0x6c, 0x67, 0x65, 0x74, 0x68, 0x69, 0x0a, 0x36, 0x35,
+  0x35, 0x36, 0x2c, 0x52, 0x61, 0x73, 0x61, 0x6c, 0x68, 0x61, 0x67, 0x75,
+  0x65, 0x0a, 0x36, 0x35, 0x33, 0x36, 0x2c, 0x52, 0x61, 0x73, 0x74, 0x61,
+  0x62, 0x61, 0x6e, 0x0a, 0x33, 0x39, 0x38, 0x32, 0x2c, 0x52, 0x65, 0x67,
+  0x75, 0x6c, 0x75, 0x73, 0x0a, 0x30, 0x33, 0x36, 0x31, 0x2c, 0x52, 0x65,
+  0x76, 0x61, 0x74, 0x69, 0x0a, 0x31, 0x37, 0x31, 0x33, 0x2c, 0x52, 0x69,
+  0x67, 0x65, 0x6c, 0x0a, 0x35, 0x34, 0x35, 0x39, 0x2c, 0x52, 0x69, 0x67,
+  0x69, 0x6c, 0x20, 0x4b, 0x65, 0x6e, 0x74, 0x61, 0x75, 0x72, 0x75, 0x73,
+  0x0a, 0x37, 0x38, 0x38, 0x32, 0x2c, 0x52, 0x6f, 0x74, 0x61, 0x6e, 0x65,
+  0x76, 0x0a, 0x30, 0x34, 0x30, 0x33, 0x2c, 0x52, 0x75, 0x63, 0x68, 0x62,
+  0x61, 0x68, 0x0a, 0x37, 0x33, 0x34, 0x38, 0x2c, 0x52, 0x75, 0x6b, 0x62,
+  0x61, 0x74, 0x0a, 0x36, 0x33, 0x37, 0x38, 0x2c, 0x53, 0x61, 0x62, 0x69,
+  0x6b, 0x0a, 0x31, 0x36, 0x31, 0x32, 0x2c, 0x53, 0x61, 0x63, 0x6c, 0x61,
+  0x74, 0x65, 0x6e, 0x69, 0x0a, 0x38, 0x35, 0x31, 0x38, 0x2c, 0x53, 0x61,
+  0x64, 0x61, 0x63, 0x68, 0x62, 0x69, 0x61, 0x0a, 0x38, 0x36, 0x38, 0x34,
+  0x2c, 0x53, 0x61, 0x64, 0x61, 0x6c, 0x62, 0x61, 0x72, 0x69, 0x0a, 0x38,
+  0x34, 0x31, 0x34, 0x2c, 0x53, 0x61, 0x64, 0x61, 0x6c, 0x6d, 0x65, 0x6c,
+  0x69, 0x6b, 0x0a, 0x38, 0x32, 0x33, 0x32, 0x2c, 0x53, 0x61, 0x64, 0x61,
+  0x6c, 0x73, 0x75, 0x75, 0x64, 0x0a, 0x37, 0x37, 0x39, 0x36, 0x2c, 0x53,
+  0x61, 0x64, 0x72, 0x0a, 0x32, 0x30, 0x30, 0x34, 0x2c, 0x53, 0x61, 0x69,
+  0x70, 0x68, 0x0a, 0x38, 0x38, 0x38, 0x30, 0x2c, 0x53, 0x61, 0x6c, 0x6d,
+  0x0a, 0x36, 0x35, 0x35, 0x33, 0x2c, 0x53, 0x61, 0x72, 0x67, 0x61, 0x73,
+  0x0a, 0x36, 0x34, 0x31, 0x30, 0x2c, 0x53, 0x61, 0x72, 0x69, 0x6e, 0x0a,
+  0x31, 0x34, 0x38, 0x31, 0x2c, 0x53, 0x63, 0x65, 0x70, 0x74, 0x72, 0x75,
+  0x6d, 0x0a, 0x38, 0x37, 0x37, 0x35, 0x2c, 0x53, 0x63, 0x68, 0x65, 0x61,
+  0x74, 0x0a, 0x30, 0x31, 0x36, 0x38, 0x2c, 0x53, 0x63, 0x68, 0x65, 0x64,
+  0x61, 0x72, 0x0a, 0x31, 0x33, 0x37, 0x33, 0x2c, 0x53, 0x65, 0x63, 0x75,
+  0x6e, 0x64, 0x61, 0x20, 0x48, 0x79, 0x61, 0x64, 0x75, 0x6d, 0x0a, 0x30,
+  0x35, 0x34, 0x32, 0x2c, 0x53, 0x65, 0x67, 0x69, 0x6e, 0x0a, 0x35, 0x34,
+  0x33, 0x35, 0x2c, 0x53, 0x65, 0x67, 0x69, 0x6e, 0x75, 0x73, 0x0a, 0x37,
+  0x34, 0x37, 0x39, 0x2c, 0x53, 0x68, 0x61, 0x6d, 0x0a, 0x36, 0x35, 0x32,
+  0x37, 0x2c, 0x53, 0x68, 0x61, 0x75, 0x6c, 0x61, 0x0a, 0x37, 0x31, 0x30,
+  0x36, 0x2c, 0x53, 0x68, 0x65, 0x6c, 0x69, 0x61, 0x6b, 0x0a, 0x30, 0x35,
+  0x35, 0x33, 0x2c, 0x53, 0x68, 0x65, 0x72, 0x61, 0x74, 0x61, 0x6e, 0x0a,
+  0x32, 0x34, 0x39, 0x31, 0x2c, 0x53, 0x69, 0x72, 0x69, 0x75, 0x73, 0x0a,
+  0x38, 0x36, 0x31, 0x30, 0x2c, 0x53, 0x69, 0x74, 0x75, 0x6c, 0x61, 0x0a,
+  0x38, 0x37, 0x30, 0x39, 0x2c, 0x53, 0x6b, 0x61, 0x74, 0x0a, 0x35, 0x30,
+  0x35, 0x36, 0x2c, 0x53, 0x70, 0x69, 0x63, 0x61, 0x0a, 0x37, 0x39, 0x30,
+  0x36, 0x2c, 0x53, 0x75, 0x61, 0x6c, 0x6f, 0x63, 0x69, 0x6e, 0x0a, 0x33,
+  0x38, 0x35, 0x32, 0x2c, 0x53, 0x75, 0x62, 0x72, 0x61, 0x0a, 0x33, 0x36,
+  0x33, 0x34, 0x2c, 0x53, 0x75, 0x68, 0x61, 0x69, 0x6c, 0x0a, 0x37, 0x31,
+  0x37, 0x38, 0x2c, 0x53, 0x75, 0x6c, 0x61, 0x66, 0x61, 0x74, 0x0a, 0x35,
+  0x33, 0x33, 0x38, 0x2c, 0x53, 0x79, 0x72, 0x6d, 0x61, 0x0a, 0x31, 0x35,
+  0x34, 0x33, 0x2c, 0x54, 0x61, 0x62, 0x69, 0x74, 0x0a, 0x34, 0x35, 0x31,
+  0x38, 0x2c, 0x54, 0x61, 0x69, 0x79, 0x61, 0x6e, 0x67, 0x73, 0x68, 0x6f,
+  0x75, 0x0a, 0x34, 0x39, 0x31, 0x36, 0x2c, 0x54, 0x61, 0x69, 0x79, 0x69,
+  0x0a, 0x33, 0x35, 0x36, 0x39, 0x2c, 0x54, 0x61, 0x6c, 0x69, 0x74, 0x68,
+  0x61, 0x0a, 0x34, 0x30, 0x36, 0x39, 0x2c, 0x54, 0x61, 0x6e, 0x69, 0x61,
+  0x20, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x73, 0x0a, 0x34,
+  0x30, 0x33, 0x33, 0x2c, 0x54, 0x61, 0x6e, 0x69, 0x61, 0x20, 0x42, 0x6f,
+  0x72, 0x65, 0x61, 0x6c, 0x69, 0x73, 0x0a, 0x37, 0x35, 0x32, 0x35, 0x2c,
+  0x54, 0x61, 0x72, 0x61, 0x7a, 0x65, 0x64, 0x0a, 0x33, 0x32, 0x34, 0x39,
+  0x2c, 0x54, 0x61, 0x72, 0x66, 0x0a, 0x31, 0x31, 0x34, 0x35, 0x2c, 0x54,
+  0x61, 0x79, 0x67, 0x65, 0x74, 0x61, 0x0a, 0x33, 0x32, 0x30, 0x38, 0x2c,
+  0x54, 0x65, 0x67, 0x6d, 0x69, 0x6e, 0x65, 0x0a, 0x32, 0x32, 0x38, 0x36,
+  0x2c, 0x54, 0x65, 0x6a, 0x61, 0x74, 0x0a, 0x37, 0x35, 0x39, 0x37, 0x2c,
+  0x54, 0x65, 0x72, 0x65, 0x62, 0x65, 0x6c, 0x6c, 0x75, 0x6d, 0x0a, 0x31,
+  0x34, 0x36, 0x34, 0x2c, 0x54, 0x68, 0x65, 0x65, 0x6d, 0x69, 0x6e, 0x0a,
+  0x35, 0x32, 0x39, 0x31, 0x2c, 0x54, 0x68, 0x75, 0x62, 0x61, 0x6e, 0x0a,
+  0x38, 0x36, 0x33, 0x36, 0x2c, 0x54, 0x69, 0x61, 0x6b, 0x69, 0x0a, 0x31,
+  0x39, 0x31, 0x30, 0x2c, 0x54, 0x69, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x6e,
+  0x0a, 0x34, 0x38, 0x36, 0x33, 0x2c, 0x54, 0x69, 0x61, 0x6e, 0x79, 0x69,
+  0x0a, 0x30, 0x34, 0x35, 0x38, 0x2c, 0x54, 0x69, 0x74, 0x61, 0x77, 0x69,
+  0x6e, 0x0a, 0x35, 0x34, 0x36, 0x30, 0x2c, 0x54, 0x6f, 0x6c, 0x69, 0x6d,
+  0x61, 0x6e, 0x0a, 0x34, 0x36, 0x30, 0x39, 0x2c, 0x54, 0x6f, 0x6e, 0x61,
+  0x74, 0x69, 0x75, 0x68, 0x0a, 0x30, 0x35, 0x31, 0x30, 0x2c, 0x54, 0x6f,
+  0x72, 0x63, 0x75, 0x6c, 0x61, 0x72, 0x0a, 0x33, 0x31, 0x38, 0x35, 0x2c,
+  0x54, 0x75, 0x72, 0x65, 0x69, 0x73, 0x0a, 0x33, 0x38, 0x34, 0x35, 0x2c,
+  0x55, 0x6b, 0x64, 0x61, 0x68, 0x0a, 0x35, 0x38, 0x35, 0x34, 0x2c, 0x55,
+  0x6e, 0x75, 0x6b, 0x61, 0x6c, 0x68, 0x61, 0x69, 0x0a, 0x32, 0x36, 0x34,
+  0x36, 0x2c, 0x55, 0x6e, 0x75, 0x72, 0x67, 0x75, 0x6e, 0x69, 0x74, 0x65,
+  0x0a, 0x37, 0x30, 0x30, 0x31, 0x2c, 0x56, 0x65, 0x67, 0x61, 0x0a, 0x38,
+  0x39, 0x33, 0x30, 0x2c, 0x56, 0x65, 0x72, 0x69, 0x74, 0x61, 0x74, 0x65,
+  0x0a, 0x34, 0x39, 0x33, 0x32, 0x2c, 0x56, 0x69, 0x6e, 0x64, 0x65, 0x6d,
+  0x69, 0x61, 0x74, 0x72, 0x69, 0x78, 0x0a, 0x32, 0x37, 0x37, 0x37, 0x2c,
+  0x57, 0x61, 0x73, 0x61, 0x74, 0x0a, 0x32, 0x30, 0x34, 0x30, 0x2c, 0x57,
+  0x61, 0x7a, 0x6e, 0x0a, 0x32, 0x36, 0x39, 0x33, 0x2c, 0x57, 0x65, 0x7a,
+  0x65, 0x6e, 0x0a, 0x30, 0x33, 0x33, 0x38, 0x2c, 0x57, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x0a, 0x36, 0x32, 0x34, 0x37, 0x2c, 0x58, 0x61, 0x6d, 0x69,
+  0x64, 0x69, 0x6d, 0x75, 0x72, 0x61, 0x0a, 0x35, 0x33, 0x35, 0x31, 0x2c,
+  0x58, 0x75, 0x61, 0x6e, 0x67, 0x65, 0x0a, 0x36, 0x30, 0x37, 0x35, 0x2c,
+  0x59, 0x65, 0x64, 0x20, 0x50, 0x6f, 0x73, 0x74, 0x65, 0x72, 0x69, 0x6f,
+  0x72, 0x0a, 0x36, 0x30, 0x35, 0x36, 0x2c, 0x59, 0x65, 0x64, 0x20, 0x50,
+  0x72, 0x69, 0x6f, 0x72, 0x0a, 0x36, 0x37, 0x38, 0x39, 0x2c, 0x59, 0x69,
+  0x6c, 0x64, 0x75, 0x6e, 0x0a, 0x34, 0x36, 0x38, 0x39, 0x2c, 0x5a, 0x61,
+  0x6e, 0x69, 0x61, 0x68, 0x0a, 0x31, 0x32, 0x33, 0x31, 0x2c, 0x5a, 0x61,
+  0x75, 0x72, 0x61, 0x6b, 0x0a, 0x34, 0x35, 0x34, 0x30, 0x2c, 0x5a, 0x61,
+  0x76, 0x69, 0x6a, 0x61, 0x76, 0x61, 0x0a, 0x33, 0x39, 0x30, 0x33, 0x2c,
+  0x5a, 0x68, 0x61, 0x6e, 0x67, 0x0a, 0x30, 0x39, 0x38, 0x34, 0x2c, 0x5a,
+  0x69, 0x62, 0x61, 0x6c, 0x0a, 0x34, 0x33, 0x35, 0x37, 0x2c, 0x5a, 0x6f,
+  0x73, 0x6d, 0x61, 0x0a, 0x35, 0x35, 0x33, 0x31, 0x2c, 0x5a, 0x75, 0x62,
+  0x65, 0x6e, 0x65, 0x6c, 0x67, 0x65, 0x6e, 0x75, 0x62, 0x69, 0x0a, 0x35,
+  0x37, 0x38, 0x37, 0x2c, 0x5a, 0x75, 0x62, 0x65, 0x6e, 0x65, 0x6c, 0x68,
+  0x61, 0x6b, 0x72, 0x61, 0x62, 0x69, 0x0a, 0x35, 0x36, 0x38, 0x35, 0x2c,
+  0x5a, 0x75, 0x62, 0x65, 0x6e, 0x65, 0x73, 0x63, 0x68, 0x61, 0x6d, 0x61,
+  0x6c, 0x69
+};
+unsigned int bsc5_names_len = 4346;
@@ -0,0 +1,92 @@
+/* Render target for the drawing and rendering functions. A canvas is an
+ * in-memory grid of cells that needs no terminal at all, e.g. for batch
+ * rendering or benchmarks.
+ *
+ * Coordinates are rows and columns, as with ncurses. Drawing outside of a
+ * canvas is ignored.
+ *
+ * A canvas can also be kept as a copy of what a window shows, so a frame drawn
+ * in memory is presented by drawing only the cells that changed.
+ */
+
+#ifndef CANVAS_H
+#define CANVAS_H
+
+#include <curses.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Codepoint of the right half of a double width character
+#define CELL_CONTINUATION 0xFFFFFFFF
+
+struct Cell
+{
+    uint32_t codepoint;
+    short color_pair;   // 0 indicates no color pair
+    uint16_t variation; // Variation selector following the codepoint, 0 if none
+};
+
+struct Canvas
+{
+    int height;
+    int width;
+    struct Cell *cells;
+    short color_pair; // Color pair applied to cells drawn next
+};
+
+/* Create a blank canvas. This function allocates memory which must be
+ * freed with free_canvas. Returns false upon memory allocation error
+ */
+bool create_cell_canvas(struct Canvas *canvas, int height, int width);
+
+void free_canvas(struct Canvas *canvas);
+
+void canvas_size(const struct Canvas *canvas, int *height, int *width);
+
+void canvas_erase(struct Canvas *canvas);
+
+void canvas_color_on(struct Canvas *canvas, int color_pair);
+
+void canvas_color_off(struct Canvas *canvas, int color_pair);
+
+void canvas_add_ch(struct Canvas *canvas, int y, int x, char ch);
+
+/* Add a UTF-8 string starting at (y, x)
+ */
+void canvas_add_str(struct Canvas *canvas, int y, int x, const char *str);
+
+/* Add a UTF-8 string, but truncate text that does not fit on the line instead
+ * of having it wrap
+ */
+void canvas_add_str_truncate(struct Canvas *canvas, int y, int x, const char *str);
+
+/* Add the same UTF-8 character to `length` cells of row y, starting at (y, x).
+ * The character must be one cell wide
+ */
+void canvas_add_run(struct Canvas *canvas, int y, int x, int length, const char *str);
+
+/* Cell at (y, x) of an in-memory canvas, or NULL if out of bounds
+ */
+const struct Cell *canvas_cell(const struct Canvas *canvas, int y, int x);
+
+/* Draw the cells of an in-memory canvas that differ from `shown` onto a window
+ * and copy them to `shown`, which must be the same size and hold what the
+ * window shows. `win` may be NULL to only compare. Returns the number of cells
+ * that differed
+ */
+int present_canvas(const struct Canvas *canvas, struct Canvas *shown, WINDOW *win);
+
+/* Write an in-memory canvas as UTF-8 text, one line per row. With `color`,
+ * color pairs are written as ANSI escape sequences using the same colors as
+ * ncurses_init. Returns false on a write error
+ */
+bool write_canvas(const struct Canvas *canvas, FILE *stream, bool color);
+
+/* Write frame `frame` of a headless session to `path`, or stdout if it is
+ * NULL. A %d in the path is replaced by the frame number, otherwise frames
+ * after the first are appended. Prints a message and returns false upon error
+ */
+bool write_canvas_frame(const struct Canvas *canvas, const char *path, bool color, int frame);
+
+#endif // CANVAS_H
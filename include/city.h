@@ -8,12 +8,16 @@ typedef struct
     float longitude;
 } CityData;
 
-/* Attempt to get the coordinates of a city by name. Returns NULL if not found.
+/* Attempt to get the coordinates of a city by name. Names are matched ignoring
+ * case and surrounding whitespace, and of cities sharing a name the most
+ * populous is returned. The result points into a static table and must not be
+ * freed. Returns NULL if not found.
  */
-CityData *get_city(const char *name);
+const CityData *get_city(const char *name);
 
-/* Free memory used by CityData struct.
+/* Get every city of the static table, in no particular order. The number of
+ * cities is stored in num_cities
  */
-void free_city(CityData *city);
+const CityData *get_cities(int *num_cities);
 
 #endif // CITY_H
@@ -0,0 +1,24 @@
+/* Name normalization and hashing shared by the city lookup and the build-time
+ * generator of its index (scripts/city_index.c)
+ */
+
+#ifndef CITY_HASH_H
+#define CITY_HASH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Longest normalized city name, including the terminator
+#define MAX_CITY_NAME 128
+
+/* Trim surrounding whitespace and lowercase ASCII letters. Returns false if the
+ * result does not fit in `size` bytes
+ */
+bool normalize_city_name(const char *name, char *normalized, size_t size);
+
+/* Seeded hash of a normalized city name
+ */
+uint32_t hash_city_name(const char *normalized, uint32_t seed);
+
+#endif // CITY_HASH_H
@@ -0,0 +1,2770 @@
+/* Generated by scripts/city_index.c from data/cities.csv. Do not edit
+ */
+
+#define CITY_INDEX_BUCKETS 676
+#define CITY_INDEX_SLOTS 2702
+
+static const uint32_t city_seeds[CITY_INDEX_BUCKETS] = {
+    6, 91, 1, 6, 7, 3, 95, 5, 12, 85, 1, 1,
+    15, 31, 13, 7, 2, 85, 69, 1, 13, 10, 9, 4,
+    7, 230, 98, 17, 3, 5, 112, 7, 1, 318, 43, 11,
+    1, 4, 109, 3, 4, 251, 91, 5, 51, 48, 294, 6,
+    10, 3, 33, 14, 36, 98, 24, 0, 45, 6, 41, 2,
+    61, 3, 20, 2, 2, 0, 14, 19, 7, 174, 4, 13,
+    200, 13, 61, 5, 4, 33, 4, 13, 6, 112, 1, 1,
+    1, 70, 1, 27, 133, 279, 13, 13, 32, 95, 140, 93,
+    76, 3, 17, 42, 110, 83, 108, 35, 7, 53, 7, 8,
+    8, 99, 53, 38, 2, 4, 9, 3, 213, 29, 35, 19,
+    4, 3, 48, 76, 4, 14, 126, 254, 3, 2, 93, 1,
+    321, 70, 583, 4, 107, 83, 14, 5, 40, 1, 1, 75,
+    28, 26, 2, 2, 120, 33, 53, 1, 37, 83, 40, 14,
+    5, 8, 67, 25, 0, 59, 39, 15, 20, 1, 8, 1,
+    291, 176, 72, 32, 0, 7, 115, 190, 8, 176, 20, 13,
+    6, 1, 27, 26, 6, 55, 10, 181, 72, 46, 55, 8,
+    8, 7, 7, 23, 42, 107, 3, 393, 5, 12, 2, 25,
+    58, 5, 341, 155, 145, 6, 1, 15, 50, 64, 86, 33,
+    8, 1, 2, 3, 283, 5, 23, 783, 23, 129, 63, 12,
+    6, 16, 19, 2, 18, 69, 6, 151, 1, 3, 11, 42,
+    24, 143, 13, 246, 2, 0, 12, 5, 10, 164, 1, 40,
+    1, 14, 205, 118, 13, 10, 22, 0, 16, 100, 99, 181,
+    29, 98, 31, 269, 18, 1088, 1, 16, 57, 1, 221, 94,
+    58, 118, 24, 295, 10, 75, 16, 84, 43, 105, 19, 57,
+    6, 287, 155, 52, 4, 78, 16, 11, 17, 2, 1, 2,
+    45, 103, 6, 22, 67, 1, 76, 48, 267, 862, 67, 2,
+    10, 33, 91, 10, 188, 34, 35, 63, 266, 531, 20, 1,
+    5, 146, 134, 1, 165, 2, 135, 5, 55, 137, 5, 93,
+    1, 2, 54, 9, 34, 77, 1, 1, 2, 1, 224, 8,
+    35, 7, 2, 1161, 22, 9, 139, 184, 1, 318, 732, 21,
+    412, 5, 1025, 138, 267, 38, 0, 10, 659, 57, 250, 190,
+    261, 399, 59, 123, 580, 491, 14, 911, 159, 125, 3, 18,
+    18, 68, 48, 126, 920, 15, 119, 250, 103, 126, 3, 7,
+    575, 9, 1382, 3, 94, 744, 4, 9, 346, 173, 222, 90,
+    15, 1, 16, 2, 707, 6, 1600, 5, 128, 56, 354, 94,
+    1191, 69, 5, 11, 25, 1, 3, 59, 8, 1067, 3, 19,
+    42, 1328, 34, 20, 190, 1, 1548, 8, 100, 221, 6, 2,
+    4, 34, 1, 2, 117, 154, 21, 21, 161, 1, 1, 315,
+    195, 413, 231, 395, 0, 71, 1, 733, 7, 66, 615, 557,
+    189, 47, 16, 30, 31, 1, 50, 225, 162, 1564, 154, 58,
+    50, 1328, 8, 8, 106, 55, 4, 34, 1, 27, 152, 1,
+    482, 498, 25, 177, 587, 46, 15, 2, 108, 52, 421, 242,
+    26, 79, 305, 483, 211, 8, 4, 8, 165, 1672, 27, 4,
+    13, 651, 91, 78, 849, 459, 4, 21, 40, 189, 5, 51,
+    1146, 98, 190, 2, 31, 235, 9, 22, 155, 1, 2446, 128,
+    217, 270, 57, 133, 533, 97, 402, 234, 10, 59, 1150, 133,
+    286, 23, 2, 1105, 13, 55, 150, 235, 14, 77, 1020, 12,
+    109, 101, 250, 1175, 321, 24, 3, 356, 10, 757, 993, 2,
+    6, 90, 4, 1231, 16, 1, 1011, 90, 664, 2390, 144, 809,
+    236, 127, 2486, 719, 68, 21, 4, 0, 2, 2871, 208, 4,
+    21, 8, 287, 1, 1, 328, 269, 53, 275, 356, 6205, 83,
+    15, 1, 23, 604, 287, 2, 733, 578, 4, 1, 719, 2,
+    38, 0, 527, 47, 434, 0, 170, 1, 131, 61, 925, 111,
+    2, 10, 389, 144, 563, 479, 2, 1507, 382, 68, 7, 516,
+    1869, 6, 4473, 49, 1413, 256, 641, 290, 337, 2010, 100, 279,
+    15, 1, 26, 5715, 13, 28, 865, 1, 6, 65, 8, 816,
+    2682, 1120, 4, 30,
+};
+
+static const CityData city_slots[CITY_INDEX_SLOTS] = {
+    {"Gandajika", -6.745040f, 23.953280f},
+    {"Kasukabe", 35.983080f, 139.749660f},
+    {"Pereira", 4.813330f, -75.696110f},
+    {"Gelsenkirchen", 51.505080f, 7.096540f},
+    {"Kirov", 58.596650f, 49.660070f},
+    {"Canoas", -29.917780f, -51.183610f},
+    {"Cangzhou", 38.311240f, 116.853340f},
+    {"Altona", 53.550000f, 9.933330f},
+    {"Tân An", 10.535890f, 106.413660f},
+    {"Sinfra", 6.621030f, -5.911440f},
+    {"Zhytomyr", 50.264870f, 28.676690f},
+    {"Kanggye", 40.969460f, 126.585230f},
+    {"Palermo", 38.116600f, 13.363600f},
+    {"Pelotas", -31.769970f, -52.341010f},
+    {"Al Ḩudaydah", 14.797810f, 42.954520f},
+    {"Chizhou", 30.661340f, 117.477830f},
+    {"Zaria", 11.111280f, 7.722700f},
+    {"Huangshi", 30.247060f, 115.048140f},
+    {"Liuzhou", 24.324050f, 109.406980f},
+    {"Al ‘Āshir min Ramaḑān", 30.296360f, 31.746330f},
+    {"Espoo", 60.205200f, 24.652200f},
+    {"Rio de Janeiro", -22.906420f, -43.182230f},
+    {"São Paulo", -23.547500f, -46.636110f},
+    {"São Carlos", -22.017500f, -47.890830f},
+    {"Mauá", -23.667780f, -46.461390f},
+    {"Bellary", 15.142050f, 76.923980f},
+    {"Kyzylorda", 44.852780f, 65.509170f},
+    {"Tokorozawa", 35.799160f, 139.469030f},
+    {"Shyamnagar", 22.833330f, 88.366670f},
+    {"Sungai Petani", 5.647000f, 100.487720f},
+    {"Ajegunle", 6.451970f, 3.331150f},
+    {"Krasnodar", 45.044840f, 38.976030f},
+    {"Birkenhead", 53.393370f, -3.014790f},
+    {"Kunming", 25.038890f, 102.718330f},
+    {"Montgomery", 32.366810f, -86.299970f},
+    {"Santiago de Surco", -12.135880f, -77.007420f},
+    {"Gebze", 40.802760f, 29.430680f},
+    {"Caruaru", -8.283330f, -35.976110f},
+    {"Zarqa", 32.072750f, 36.087960f},
+    {"Konya", 37.871350f, 32.484640f},
+    {"Århus", 56.156740f, 10.210760f},
+    {"Boma", -5.850980f, 13.053640f},
+    {"Wanzhou", 30.764510f, 108.395860f},
+    {"Cuttack", 20.464970f, 85.879270f},
+    {"Parnamirim", -5.915560f, -35.262780f},
+    {"San Jose del Monte", 14.813890f, 121.045280f},
+    {"Tegucigalpa", 14.081800f, -87.206810f},
+    {"Zhengzhou", 34.757780f, 113.648610f},
+    {"Luxor", 25.698930f, 32.642100f},
+    {"Sha Tin", 22.383330f, 114.183330f},
+    {"Nagano", 36.650000f, 138.183330f},
+    {"Yishun New Town", 1.433330f, 103.831110f},
+    {"San Felipe", 10.339910f, -68.742470f},
+    {"Cileungsir", -6.394720f, 106.959170f},
+    {"Sector 2", 44.452800f, 26.133210f},
+    {"Akola", 20.709570f, 76.998100f},
+    {"Utsunomiya", 36.566670f, 139.883330f},
+    {"Tambov", 52.731690f, 41.443260f},
+    {"Kasulu", -4.576670f, 30.102500f},
+    {"Kochi", 33.550000f, 133.533330f},
+    {"Terrassa", 41.566670f, 2.016670f},
+    {"Jinhua", 29.106780f, 119.644210f},
+    {"Surrey", 49.106350f, -122.825090f},
+    {"Zhangjiakou", 40.783410f, 114.871390f},
+    {"Gorakhpur", 29.447680f, 75.672060f},
+    {"Tanta", 30.788470f, 31.001920f},
+    {"Muzaffarpur", 26.122590f, 85.390550f},
+    {"Batikent", 39.968330f, 32.730830f},
+    {"Bunamwaya", 0.253440f, 32.557230f},
+    {"Kapar", 3.133330f, 101.383330f},
+    {"Coro", 11.404500f, -69.673440f},
+    {"Campos dos Goytacazes", -21.752270f, -41.330440f},
+    {"Vladimir", 56.136550f, 40.396580f},
+    {"Kowloon", 22.316670f, 114.183330f},
+    {"Campo Grande", -20.442780f, -54.646390f},
+    {"Calgary", 51.050110f, -114.085290f},
+    {"Bijapur", 16.824420f, 75.715370f},
+    {"Suncheon", 34.950500f, 127.487840f},
+    {"Gunsan", 35.978610f, 126.711390f},
+    {"Atush", 39.710850f, 76.171380f},
+    {"Paulista", -7.940830f, -34.873060f},
+    {"Tangerang", -6.178060f, 106.630000f},
+    {"Las Vegas", 36.174970f, -115.137220f},
+    {"The Bronx", 40.849850f, -73.866410f},
+    {"Qingyuan", 23.700000f, 113.033330f},
+    {"Chandler", 33.306160f, -111.841250f},
+    {"Qarchak", 35.428730f, 51.577570f},
+    {"New Kingston", 18.007470f, -76.783190f},
+    {"Sanmenxia", 34.774720f, 111.181390f},
+    {"Vaughan", 43.836100f, -79.498270f},
+    {"Koumassi", 5.297160f, -3.967530f},
+    {"Chōfu", 35.659240f, 139.548370f},
+    {"Vizianagaram", 18.116920f, 83.411480f},
+    {"Veracruz", 19.180950f, -96.142900f},
+    {"Niamey", 13.513660f, 2.109800f},
+    {"Sumbawanga", -7.966670f, 31.616670f},
+    {"Suining", 30.508020f, 105.573320f},
+    {"Pétionville", 18.512500f, -72.285280f},
+    {"Oradea", 47.045800f, 21.918330f},
+    {"Valledupar", 10.463140f, -73.253220f},
+    {"Vitória da Conquista", -14.866110f, -40.839440f},
+    {"Makhachkala", 42.976380f, 47.502360f},
+    {"San Antonio", 29.424120f, -98.493630f},
+    {"Minya", 28.091930f, 30.758130f},
+    {"Soyapango", 13.710240f, -89.139890f},
+    {"Valenzuela", 14.700000f, 120.966700f},
+    {"Kira", 0.400000f, 32.633330f},
+    {"Kanchipuram", 12.835150f, 79.700060f},
+    {"Bijie", 27.301930f, 105.286270f},
+    {"Gustavo Adolfo Madero", 19.493920f, -99.110750f},
+    {"Dongying", 37.462710f, 118.491650f},
+    {"Preston", 53.762820f, -2.704520f},
+    {"Chuzhou", 32.321940f, 118.297780f},
+    {"Doha", 25.285450f, 51.530960f},
+    {"Al ‘Amārah", 31.835610f, 47.144830f},
+    {"Frankfurt am Main", 50.115520f, 8.684170f},
+    {"Morvi", 22.817310f, 70.837700f},
+    {"Asmara", 15.338050f, 38.931840f},
+    {"Erfurt", 50.978700f, 11.032830f},
+    {"Ahmedabad", 23.025790f, 72.587270f},
+    {"Ramadi", 33.420560f, 43.307780f},
+    {"Bafoussam", 5.477750f, 10.417590f},
+    {"Ranchi", 23.343160f, 85.309400f},
+    {"Manhattan", 40.783430f, -73.966250f},
+    {"Jinchang", 38.500620f, 102.193790f},
+    {"Djelfa", 34.672790f, 3.263000f},
+    {"Campo Limpo de Goiás", -16.293450f, -49.090830f},
+    {"Amarnāth", 19.200000f, 73.166670f},
+    {"Shantou", 23.354890f, 116.678760f},
+    {"Handan", 36.609990f, 114.487640f},
+    {"Mexico City", 19.428470f, -99.127660f},
+    {"Baranagar", 22.641320f, 88.377270f},
+    {"Iringa", -7.766670f, 35.700000f},
+    {"Meerut", 28.980020f, 77.706360f},
+    {"Luzhou", 28.890300f, 105.425750f},
+    {"Jundiaí", -23.186390f, -46.884170f},
+    {"Derby", 52.922770f, -1.476630f},
+    {"Higashiosaka", 34.666670f, 135.583330f},
+    {"Tongchuan", 34.898800f, 108.950560f},
+    {"Jieyang", 23.541800f, 116.365810f},
+    {"Ma On Shan", 22.406130f, 114.240790f},
+    {"Kurnool", 15.828870f, 78.036020f},
+    {"Banqiao", 25.014270f, 121.467190f},
+    {"Rajpur Sonarpur", 22.438200f, 88.432050f},
+    {"Thrissur", 10.516670f, 76.216670f},
+    {"Ḩamāh", 35.131790f, 36.757830f},
+    {"Changshu", 31.646150f, 120.742210f},
+    {"Giza", 30.009440f, 31.208610f},
+    {"Kolhāpur", 16.695630f, 74.231670f},
+    {"Niterói", -22.883330f, -43.103610f},
+    {"Temara", 33.928660f, -6.906560f},
+    {"Jālna", 19.841020f, 75.886360f},
+    {"Yingkou", 40.664720f, 122.231760f},
+    {"Washington", 38.895110f, -77.036370f},
+    {"Nicolás Romero", 19.641770f, -99.306800f},
+    {"Datong", 40.093610f, 113.291390f},
+    {"Loa Janan", -0.582950f, 117.095030f},
+    {"Xi'an", 34.258330f, 108.928610f},
+    {"Viña del Mar", -33.024570f, -71.551830f},
+    {"Móstoles", 40.322340f, -3.864960f},
+    {"Aizawl", 23.728940f, 92.717910f},
+    {"Krugersdorp", -26.085770f, 27.775150f},
+    {"Valera", 9.317780f, -70.603610f},
+    {"Karbala", 32.616030f, 44.024880f},
+    {"Munich", 48.137430f, 11.575490f},
+    {"Köln", 50.933330f, 6.950000f},
+    {"Volta Redonda", -22.523060f, -44.104170f},
+    {"Ciudad Bolívar", 8.129230f, -63.540860f},
+    {"Banī Suwayf", 29.074410f, 31.097850f},
+    {"Chimoio", -19.116390f, 33.483330f},
+    {"Pittsburgh", 40.440620f, -79.995890f},
+    {"Samarinda", -0.491670f, 117.145830f},
+    {"Taipei", 25.053060f, 121.526390f},
+    {"Elche", 38.262180f, -0.701070f},
+    {"Radom", 51.402530f, 21.147140f},
+    {"Yili", 43.900000f, 81.350000f},
+    {"Ar Raqqah", 35.952830f, 39.007880f},
+    {"Kremenchuk", 49.062530f, 33.404840f},
+    {"Rājkot", 22.291610f, 70.793220f},
+    {"Hāthazāri", 22.505150f, 91.813390f},
+    {"Chaoyang", 41.570280f, 120.458610f},
+    {"Nanping", 26.645000f, 118.173610f},
+    {"Kabul", 34.528130f, 69.172330f},
+    {"Zhangzhou", 24.513330f, 117.655560f},
+    {"Samut Prakan", 13.597600f, 100.597200f},
+    {"Khorramabad", 33.487780f, 48.355830f},
+    {"Nairobi", -1.283330f, 36.816670f},
+    {"Tepic", 21.509510f, -104.895690f},
+    {"Zagazig", 30.587680f, 31.502000f},
+    {"Nellore", 14.449920f, 79.986970f},
+    {"Turpan", 42.947690f, 89.178860f},
+    {"Hāpur", 28.729850f, 77.780680f},
+    {"Cúcuta", 7.893910f, -72.507820f},
+    {"Longueuil", 45.515200f, -73.468180f},
+    {"Bihār Sharīf", 25.200840f, 85.523890f},
+    {"Takarazuka", 34.799360f, 135.356970f},
+    {"Bari", 41.120660f, 16.869820f},
+    {"Asahikawa", 43.770630f, 142.364890f},
+    {"Bakersfield", 35.373290f, -119.018710f},
+    {"Denizli", 37.774170f, 29.087500f},
+    {"Madīnat an Naşr", 30.066670f, 31.300000f},
+    {"Laixi", 36.859170f, 120.526940f},
+    {"Ado-Ekiti", 7.623290f, 5.220870f},
+    {"Hiratsuka", 35.327850f, 139.337350f},
+    {"Taboão da Serra", -23.626110f, -46.791670f},
+    {"Almaty", 43.250000f, 76.916670f},
+    {"Rostov-na-Donu", 47.231350f, 39.723280f},
+    {"Ust-Kamenogorsk", 49.971430f, 82.605860f},
+    {"Begusarai", 25.418530f, 86.133890f},
+    {"Mar'ino", 55.650000f, 37.716670f},
+    {"Piracicaba", -22.725280f, -47.649170f},
+    {"Rizhao", 35.414140f, 119.529080f},
+    {"Itaquera", -23.531940f, -46.444170f},
+    {"Olinda", -8.008890f, -34.855280f},
+    {"Ulanqab", 40.993000f, 113.133000f},
+    {"Homyel'", 52.434500f, 30.975400f},
+    {"Guankou", 28.158610f, 113.627090f},
+    {"Zhucheng", 35.994720f, 119.397500f},
+    {"Mixco", 14.630770f, -90.607110f},
+    {"Bukhara", 39.774720f, 64.428610f},
+    {"Kinshasa", -4.327580f, 15.313570f},
+    {"Sikasso", 11.317550f, -5.666540f},
+    {"Chiclayo", -6.771370f, -79.840880f},
+    {"Suita", 34.761430f, 135.515670f},
+    {"Maradi", 13.500000f, 7.101740f},
+    {"Cajamarca", -7.163780f, -78.500270f},
+    {"Khartoum North", 15.649250f, 32.534580f},
+    {"Pavlodar", 52.283330f, 76.966670f},
+    {"Xianning", 29.843470f, 114.322010f},
+    {"Freiburg", 47.995900f, 7.852220f},
+    {"Anshan", 41.123610f, 122.990000f},
+    {"Buffalo", 42.886450f, -78.878370f},
+    {"Oakland", 37.804370f, -122.270800f},
+    {"Jalgaon", 21.002920f, 75.566020f},
+    {"Hermosillo", 29.102600f, -110.977320f},
+    {"Kaluga", 54.529300f, 36.275420f},
+    {"Osogbo", 7.771040f, 4.556980f},
+    {"Ramagundam", 18.755000f, 79.474000f},
+    {"Fukui-shi", 36.064430f, 136.222570f},
+    {"Itabashi", 35.748930f, 139.714970f},
+    {"Baoji", 34.367750f, 107.237050f},
+    {"Callao", -12.056590f, -77.118140f},
+    {"Yamato", 35.472760f, 139.451010f},
+    {"Antsirabe", -19.865860f, 47.033330f},
+    {"Tianshui", 34.579520f, 105.742380f},
+    {"Kakamega", 0.284220f, 34.752290f},
+    {"Stavropol'", 45.042800f, 41.973400f},
+    {"Pasarkemis", -6.170280f, 106.530280f},
+    {"Carabanchel", 40.390940f, -3.724200f},
+    {"Bila Tserkva", 49.800400f, 30.128510f},
+    {"Bydgoszcz", 53.123500f, 18.007620f},
+    {"St. Louis", 38.627270f, -90.197890f},
+    {"Guntur", 16.299740f, 80.457290f},
+    {"Latur", 18.397210f, 76.567840f},
+    {"Hisar", 29.153940f, 75.722940f},
+    {"Hegang", 47.347270f, 130.290330f},
+    {"Paya Terubong", 5.372780f, 100.279720f},
+    {"Bariadi", -2.800000f, 33.983330f},
+    {"Sancaktepe", 41.002440f, 29.231870f},
+    {"Thanjavur", 10.785230f, 79.139090f},
+    {"Mallawī", 27.732640f, 30.841290f},
+    {"Fujisawa", 35.349260f, 139.476660f},
+    {"Campina Grande", -7.230560f, -35.881110f},
+    {"Kadapa", 14.479950f, 78.823460f},
+    {"Kampong Baharu Cheras Batu Sebelas", 3.050000f, 101.766670f},
+    {"Türkmenabat", 39.073280f, 63.578610f},
+    {"Mutare", -18.970700f, 32.670860f},
+    {"Newcastle upon Tyne", 54.973280f, -1.613960f},
+    {"Mahajanga", -15.716670f, 46.316670f},
+    {"Bogra", 24.850980f, 89.371080f},
+    {"Jiangyin", 31.911020f, 120.263020f},
+    {"Sepang", 2.693100f, 101.749800f},
+    {"Kasangati", 0.438030f, 32.602460f},
+    {"Fukuyama", 34.483330f, 133.366670f},
+    {"Bratsk", 56.132500f, 101.614170f},
+    {"Florence", 43.779250f, 11.246260f},
+    {"Yakutsk", 62.033890f, 129.733060f},
+    {"Hsinchu", 24.803610f, 120.968610f},
+    {"Gasteiz / Vitoria", 42.849980f, -2.672680f},
+    {"Karnaphuli", 22.690560f, 92.234720f},
+    {"Gajuwaka", 17.700000f, 83.216670f},
+    {"Naha", 26.213000f, 127.678510f},
+    {"Lubuklinggau", -3.294500f, 102.861400f},
+    {"Guangzhou", 23.116670f, 113.250000f},
+    {"Anyang", 36.096000f, 114.382780f},
+    {"Bago", 17.335210f, 96.481350f},
+    {"Dresden", 51.050890f, 13.738320f},
+    {"Honchō", 35.701290f, 139.986480f},
+    {"Ngaoundéré", 7.327650f, 13.584720f},
+    {"Ciudad Victoria", 23.741740f, -99.145990f},
+    {"Hyderabad", 25.396890f, 68.377180f},
+    {"Solwezi", -12.168800f, 26.389380f},
+    {"Rennes", 48.111980f, -1.674290f},
+    {"Comilla", 23.461860f, 91.185030f},
+    {"Kukatpally", 17.484860f, 78.413760f},
+    {"Gyānpur", 25.332680f, 82.466370f},
+    {"Muscat", 23.584130f, 58.407780f},
+    {"Longyan", 25.074850f, 117.017750f},
+    {"Jiaxing", 30.752200f, 120.750000f},
+    {"Betim", -19.967780f, -44.198330f},
+    {"Holguín", 20.887220f, -76.263060f},
+    {"Wuhu", 31.352590f, 118.429470f},
+    {"Colorado Springs", 38.833880f, -104.821360f},
+    {"Gold Coast", -28.000290f, 153.430880f},
+    {"Huambo", -12.776110f, 15.739170f},
+    {"San Luis Potosí", 22.149820f, -100.979160f},
+    {"Mohāmmadpur", 24.898430f, 88.528440f},
+    {"Bishkek", 42.870000f, 74.590000f},
+    {"Gwalior", 26.229830f, 78.173370f},
+    {"Wakayama", 34.233330f, 135.166670f},
+    {"Hong Kong Island", 22.263020f, 114.184190f},
+    {"Miami", 25.774270f, -80.193660f},
+    {"Randburg", -26.094100f, 28.001230f},
+    {"Bengkulu", -3.800440f, 102.265540f},
+    {"Bab Ezzouar", 36.726150f, 3.182910f},
+    {"Poznań", 52.406920f, 16.929930f},
+    {"Luhansk", 48.569520f, 39.328570f},
+    {"Guwahati", 26.184400f, 91.745800f},
+    {"Bandar Utama", 3.148180f, 101.614070f},
+    {"Jhānsi", 25.458870f, 78.579940f},
+    {"Durban", -29.857900f, 31.029200f},
+    {"Qingzhou", 36.696670f, 118.479720f},
+    {"Durham", 35.994030f, -78.898620f},
+    {"Luoyang", 34.683610f, 112.453610f},
+    {"Guigang", 23.116030f, 109.594720f},
+    {"Selayang Baru Utara", 3.254900f, 101.666800f},
+    {"Puerto Montt", -41.469300f, -72.942370f},
+    {"Managua", 12.132820f, -86.250400f},
+    {"Chihuahua", 28.635280f, -106.088890f},
+    {"Makkah", 21.426640f, 39.825630f},
+    {"Kandahār", 31.613320f, 65.710130f},
+    {"Hurghada", 27.257380f, 33.812910f},
+    {"Vologda", 59.223900f, 39.883980f},
+    {"Hami", 42.833930f, 93.506010f},
+    {"Sirjan", 29.451370f, 55.680900f},
+    {"Nakuru", -0.307190f, 36.072250f},
+    {"Semey", 50.426750f, 80.266690f},
+    {"Fuji", 35.166670f, 138.683330f},
+    {"Vijayawada", 16.507450f, 80.646600f},
+    {"Ichihara", 35.516670f, 140.083330f},
+    {"Sumqayıt", 40.589720f, 49.668610f},
+    {"Victoria", 22.287500f, 114.144170f},
+    {"Mississauga", 43.578900f, -79.658300f},
+    {"Helsinki", 60.169520f, 24.935450f},
+    {"Kharkiv", 49.980810f, 36.252720f},
+    {"Nakano", 35.704490f, 139.669460f},
+    {"Ōita", 33.233330f, 131.600000f},
+    {"Al Mawşil al Jadīdah", 36.332710f, 43.105550f},
+    {"St. Petersburg", 27.770860f, -82.679270f},
+    {"Zhuzhou", 27.833330f, 113.150000f},
+    {"Dongguan", 23.017970f, 113.748660f},
+    {"Chisinau", 47.005560f, 28.857500f},
+    {"Pemba", -12.973950f, 40.517750f},
+    {"Wŏnsan", 39.152780f, 127.443610f},
+    {"San Pedro Sula", 15.504170f, -88.025000f},
+    {"Sfax", 34.740560f, 10.760280f},
+    {"Gifu", 35.422910f, 136.760390f},
+    {"Malacca", 2.196000f, 102.240500f},
+    {"Anand", 22.552510f, 72.955200f},
+    {"Narela", 28.852670f, 77.092880f},
+    {"Wah Cantt", 33.770940f, 72.751160f},
+    {"Częstochowa", 50.796460f, 19.124090f},
+    {"Ashgabat", 37.950000f, 58.383330f},
+    {"Los Mochis", 25.793020f, -108.998080f},
+    {"Shangluo", 33.866670f, 109.930560f},
+    {"Amrāvati", 20.933330f, 77.750000f},
+    {"Tampere", 61.499110f, 23.787120f},
+    {"Santa Luzia", -19.769720f, -43.851390f},
+    {"Sector 5", 44.388080f, 26.071440f},
+    {"Arusha", -3.366670f, 36.683330f},
+    {"Aral", 40.541840f, 81.265660f},
+    {"Kaohsiung", 22.616260f, 120.313330f},
+    {"Merkezefendi", 37.805440f, 29.042360f},
+    {"Changwon", 35.228060f, 128.681110f},
+    {"Batman", 37.887380f, 41.132210f},
+    {"Accra", 5.556020f, -0.196900f},
+    {"Hobart", -42.879360f, 147.329410f},
+    {"Tehran", 35.694390f, 51.421510f},
+    {"Santiago del Estero", -27.795110f, -64.261490f},
+    {"As Sulaymānīyah", 35.564960f, 45.432900f},
+    {"Zahedan", 29.496300f, 60.862900f},
+    {"Jamnagar", 22.472920f, 70.066730f},
+    {"Tshikapa", -6.416210f, 20.799950f},
+    {"Jakarta", -6.214620f, 106.845130f},
+    {"Ataşehir", 40.983300f, 29.116700f},
+    {"Ciudad del Este", -25.509720f, -54.611110f},
+    {"North Las Vegas", 36.198860f, -115.117500f},
+    {"Coacalco", 19.629230f, -99.106890f},
+    {"Saurimo", -9.660780f, 20.391550f},
+    {"Mataram", -8.583330f, 116.116670f},
+    {"Shashamane", 7.200000f, 38.600000f},
+    {"Jhang Sadr", 31.269810f, 72.316870f},
+    {"Itapevi", -23.548890f, -46.934170f},
+    {"Salé Al Jadida", 33.997220f, -6.740470f},
+    {"Mossoró", -5.187500f, -37.344170f},
+    {"Nantes", 47.217250f, -1.553360f},
+    {"Donetsk", 48.023000f, 37.802240f},
+    {"Singida", -4.816290f, 34.743580f},
+    {"Mau", 25.941670f, 83.561110f},
+    {"Gusau", 12.170240f, 6.664120f},
+    {"Kahramanmaraş", 37.584700f, 36.926410f},
+    {"Santa Rosa", 14.312220f, 121.111390f},
+    {"Biysk", 52.536390f, 85.207220f},
+    {"Al Mubarraz", 25.407680f, 49.590280f},
+    {"Ryazan'", 54.626900f, 39.691600f},
+    {"Mandaue City", 10.323610f, 123.922220f},
+    {"Sorong", -0.879560f, 131.261040f},
+    {"Brest", 52.097550f, 23.687750f},
+    {"Tripoli", 32.887430f, 13.187330f},
+    {"Toyota", 35.083330f, 137.150000f},
+    {"Al Khums", 32.648610f, 14.261910f},
+    {"Portsmouth", 50.798990f, -1.091250f},
+    {"Yichang", 30.714440f, 111.284720f},
+    {"San Salvador", 13.689350f, -89.187180f},
+    {"Muzaffarnagar", 29.470910f, 77.703320f},
+    {"Brakpan", -26.236560f, 28.369380f},
+    {"Tabora", -5.016220f, 32.826630f},
+    {"Maoming", 21.666250f, 110.913640f},
+    {"Thoothukudi", 8.767350f, 78.134250f},
+    {"Bathinda", 30.207470f, 74.938930f},
+    {"Popayán", 2.438230f, -76.613160f},
+    {"Yangshuo", 24.780810f, 110.489670f},
+    {"Bhātāra", 23.800000f, 90.450000f},
+    {"Abu Dhabi", 24.451180f, 54.396960f},
+    {"Oral", 51.233330f, 51.366670f},
+    {"Osh", 40.528280f, 72.798500f},
+    {"Kupang", -10.170830f, 123.606940f},
+    {"Juba", 4.851650f, 31.582470f},
+    {"Aksaray", 38.372550f, 34.025370f},
+    {"Madinah", 24.468610f, 39.614170f},
+    {"Pyongyang", 39.033850f, 125.754320f},
+    {"Guadalupe", 25.676780f, -100.256460f},
+    {"Manaus", -3.101940f, -60.025000f},
+    {"Rotterdam", 51.922500f, 4.479170f},
+    {"Kingston", 17.997020f, -76.793580f},
+    {"Sacramento", 38.581570f, -121.494400f},
+    {"Rāmpur", 28.810140f, 79.026990f},
+    {"Klang", 3.036670f, 101.443330f},
+    {"Ciudad Guayana", 8.351220f, -62.641020f},
+    {"Southend-on-Sea", 51.537820f, 0.714330f},
+    {"Trieste", 45.649530f, 13.776780f},
+    {"Sidi Bel Abbes", 35.189940f, -0.630850f},
+    {"Makassar", -5.148610f, 119.431940f},
+    {"Panshan", 41.188060f, 122.049440f},
+    {"L'Hospitalet de Llobregat", 41.359670f, 2.100280f},
+    {"Huangshan", 29.711390f, 118.312500f},
+    {"Tabuk", 28.399800f, 36.571510f},
+    {"Rabat", 34.013250f, -6.832550f},
+    {"Al Maḩallah al Kubrá", 30.970630f, 31.166900f},
+    {"Luojiang", 31.304970f, 104.504840f},
+    {"Nanyang", 32.994720f, 112.532780f},
+    {"Hengshui", 37.739080f, 115.683480f},
+    {"Hosūr", 12.736470f, 77.832640f},
+    {"Gāndhīdhām", 23.083330f, 70.133330f},
+    {"Savar", 23.848580f, 90.250020f},
+    {"Antakya", 36.206550f, 36.157220f},
+    {"Ilorin", 8.496640f, 4.542140f},
+    {"Malang", -7.979700f, 112.630400f},
+    {"Itagüí", 6.184610f, -75.599130f},
+    {"Cotonou", 6.365360f, 2.418330f},
+    {"Nianbo", 36.480000f, 102.416390f},
+    {"Bogor", -6.594440f, 106.789170f},
+    {"Changchun", 43.880000f, 125.322780f},
+    {"Aihara", 35.600000f, 139.316670f},
+    {"Itaim Paulista", -23.503080f, -46.385660f},
+    {"Mpanda", -6.343790f, 31.069510f},
+    {"Atsugi", 35.442720f, 139.369310f},
+    {"Ndola", -12.958670f, 28.636590f},
+    {"Murcia", 37.987040f, -1.130040f},
+    {"Lapu-Lapu City", 10.310280f, 123.949440f},
+    {"Chenzhou", 25.800000f, 113.033330f},
+    {"Staten Island", 40.562330f, -74.139860f},
+    {"Eixample", 41.388960f, 2.161790f},
+    {"Gurugram", 28.460100f, 77.026350f},
+    {"Taguig", 14.524300f, 121.079200f},
+    {"Soweto", -26.267810f, 27.858490f},
+    {"Alcalá de Henares", 40.482050f, -3.359960f},
+    {"Cluj-Napoca", 46.766670f, 23.600000f},
+    {"Montpellier", 43.610930f, 3.876350f},
+    {"Oldham", 53.540510f, -2.118300f},
+    {"Joinville", -26.304440f, -48.845560f},
+    {"Al Hufūf", 25.364670f, 49.587640f},
+    {"Novosibirsk", 55.041500f, 82.934600f},
+    {"Franca", -20.538610f, -47.400830f},
+    {"Warri", 5.517370f, 5.750060f},
+    {"Lomé", 6.128740f, 1.221540f},
+    {"Białystok", 53.133330f, 23.164330f},
+    {"Huế", 16.461900f, 107.595460f},
+    {"Tehuacán", 18.464220f, -97.397350f},
+    {"Mersin", 36.811960f, 34.638860f},
+    {"Liverpool", 53.410580f, -2.977940f},
+    {"Quito", -0.229850f, -78.524950f},
+    {"Fuyang", 32.900000f, 115.816670f},
+    {"Swansea", 51.620790f, -3.943230f},
+    {"Matsumoto", 36.233330f, 137.966670f},
+    {"Fīrozābād", 27.150920f, 78.397810f},
+    {"Ḩadā'iq al Qubbah", 30.088430f, 31.283510f},
+    {"Cilacap", -7.726390f, 109.009440f},
+    {"Bandung", -6.922220f, 107.606940f},
+    {"Lilongwe", -13.966920f, 33.787250f},
+    {"Biratnagar", 26.455050f, 87.270070f},
+    {"Wenchang", 19.551580f, 110.802790f},
+    {"Dire Dawa", 9.593060f, 41.866110f},
+    {"Dubai", 25.077250f, 55.309270f},
+    {"Kirāri Sulemānnagar", 28.697360f, 77.064800f},
+    {"Anqiu", 36.434170f, 119.192500f},
+    {"Kigoma", -4.876940f, 29.626670f},
+    {"Sa Dec", 10.290850f, 105.756350f},
+    {"Birgañj", 27.017090f, 84.880800f},
+    {"Santol", 15.162220f, 120.567500f},
+    {"Satna", 24.577260f, 80.827190f},
+    {"Chemnitz", 50.835700f, 12.929220f},
+    {"Pekalongan", -6.888600f, 109.675300f},
+    {"Uberaba", -19.748330f, -47.931940f},
+    {"Gujranwala", 32.155670f, 74.187050f},
+    {"Quezon City", 14.648800f, 121.050900f},
+    {"Damanhur", 31.034080f, 30.468230f},
+    {"Epworth", -17.890000f, 31.147500f},
+    {"Arrah", 25.556290f, 84.663350f},
+    {"Rome", 41.891930f, 12.511330f},
+    {"Cabimas", 10.399070f, -71.452060f},
+    {"Suizhou", 31.711110f, 113.363060f},
+    {"Krefeld", 51.336450f, 6.553810f},
+    {"San Cristóbal", 7.766940f, -72.225000f},
+    {"Tonghua", 41.719720f, 125.926390f},
+    {"Badalona", 41.450040f, 2.247410f},
+    {"Baku", 40.377670f, 49.892010f},
+    {"South Tangerang", -6.288620f, 106.717890f},
+    {"Surgut", 61.257570f, 73.417750f},
+    {"Gómez Palacio", 25.569850f, -103.495880f},
+    {"Anaheim", 33.835290f, -117.914500f},
+    {"Yichun", 27.833330f, 114.400000f},
+    {"Madurai", 9.919000f, 78.119530f},
+    {"Mandaluyong City", 14.583200f, 121.040900f},
+    {"Cuernavaca", 18.926100f, -99.230750f},
+    {"Orenburg", 51.772700f, 55.098800f},
+    {"Fort Worth", 32.725410f, -97.320850f},
+    {"Takatsuki", 34.848330f, 135.616780f},
+    {"Chon Buri", 13.362200f, 100.983450f},
+    {"Woodlands", 1.438010f, 103.788770f},
+    {"Thika", -1.033260f, 37.069330f},
+    {"Nansana", 0.363890f, 32.528610f},
+    {"Ulhasnagar", 19.216670f, 73.150000f},
+    {"Paradise", 36.097190f, -115.146660f},
+    {"Shibganj", 25.001460f, 89.322660f},
+    {"Puerto La Cruz", 10.213820f, -64.632800f},
+    {"Malanje", -9.540150f, 16.340960f},
+    {"Yangquan", 37.857500f, 113.563330f},
+    {"Welkom", -27.977420f, 26.735060f},
+    {"Chongqing", 29.560260f, 106.557710f},
+    {"Münster", 51.962360f, 7.625710f},
+    {"Navi Mumbai", 19.036810f, 73.015820f},
+    {"José C. Paz", -34.515410f, -58.768130f},
+    {"Manado", 1.482180f, 124.848920f},
+    {"Shiraz", 29.610310f, 52.531130f},
+    {"Brasilandia", -23.448590f, -46.688390f},
+    {"Secunderabad", 17.504270f, 78.542630f},
+    {"Takeo", 10.990810f, 104.784980f},
+    {"Ordos", 39.608600f, 109.781570f},
+    {"Szczecin", 53.428940f, 14.553020f},
+    {"Samsun", 41.279760f, 36.336100f},
+    {"Wenshan City", 23.363060f, 104.250470f},
+    {"Mingora", 34.779500f, 72.362650f},
+    {"Geelong", -38.147110f, 144.360690f},
+    {"Baoding", 38.872880f, 115.462460f},
+    {"Dinajpur", 25.627450f, 88.637790f},
+    {"Kalininskiy", 59.996750f, 30.389900f},
+    {"Ribeirão Preto", -21.177500f, -47.810280f},
+    {"Raipur", 21.233330f, 81.633330f},
+    {"New Territories", 22.424410f, 114.110950f},
+    {"Duisburg", 51.432470f, 6.765160f},
+    {"Bagerhat", 22.656570f, 89.791230f},
+    {"San José", 9.933330f, -84.083330f},
+    {"Prayagraj", 25.444780f, 81.843220f},
+    {"Madrid", 40.416500f, -3.702560f},
+    {"Musaffah", 24.358930f, 54.482670f},
+    {"Maryvale", 33.501990f, -112.177650f},
+    {"Hialeah", 25.857600f, -80.278110f},
+    {"Ulan Bator", 47.907710f, 106.883240f},
+    {"Rybinsk", 58.045620f, 38.838110f},
+    {"Tacna", -18.014650f, -70.253620f},
+    {"Mokotów", 52.193400f, 21.034870f},
+    {"Oruro", -17.983330f, -67.150000f},
+    {"Toamasina", -18.149200f, 49.402340f},
+    {"Cheonan", 36.806500f, 127.152200f},
+    {"Lobito", -12.364400f, 13.536010f},
+    {"Luohe", 33.563940f, 114.042720f},
+    {"Taganrog", 47.236270f, 38.905300f},
+    {"Kollam", 8.881130f, 76.584690f},
+    {"Basrah", 30.508520f, 47.780400f},
+    {"Windhoek", -22.559410f, 17.083230f},
+    {"Hyderābād", 17.384050f, 78.456360f},
+    {"Toulouse", 43.604260f, 1.443670f},
+    {"Luton", 51.879670f, -0.417480f},
+    {"Shahkot", 31.570900f, 73.485310f},
+    {"Pangkalpinang", -2.129140f, 106.113770f},
+    {"Oyo", 7.853670f, 3.932350f},
+    {"Butembo", 0.141640f, 29.291170f},
+    {"Kraków", 50.061430f, 19.936580f},
+    {"Bengbu", 32.940830f, 117.360830f},
+    {"Singkawang", 0.909250f, 108.984630f},
+    {"Edmonton", 53.550140f, -113.468710f},
+    {"Mirpur Khas", 25.527600f, 69.012550f},
+    {"Koshigaya", 35.890350f, 139.789160f},
+    {"Florianópolis", -27.596670f, -48.549170f},
+    {"Jersey City", 40.728160f, -74.077640f},
+    {"Los Angeles", 34.052230f, -118.243680f},
+    {"Mogadishu", 2.037110f, 45.343750f},
+    {"Isesaki", 36.316670f, 139.200000f},
+    {"Kaliningrad", 54.706490f, 20.510950f},
+    {"Goma", -1.674090f, 29.228450f},
+    {"Sari", 36.563320f, 53.060090f},
+    {"Lincang", 23.879720f, 100.094550f},
+    {"Oxnard", 34.197500f, -119.177050f},
+    {"San Pablo", 14.068300f, 121.325600f},
+    {"Durg", 21.191470f, 81.276190f},
+    {"Xizhi", 25.066150f, 121.659850f},
+    {"Sivas", 39.748330f, 37.016110f},
+    {"Winnipeg", 49.884400f, -97.147040f},
+    {"Constanţa", 44.180730f, 28.634320f},
+    {"Nzérékoré", 7.756240f, -8.817900f},
+    {"Goiânia", -16.678610f, -49.253890f},
+    {"Khimki", 55.900100f, 37.428480f},
+    {"Sokoto", 13.062690f, 5.243220f},
+    {"Santo Domingo", 18.471860f, -69.892320f},
+    {"Chakwama", 11.559650f, 9.664070f},
+    {"New Orleans", 29.954650f, -90.075070f},
+    {"Seongnam-si", 37.438610f, 127.137780f},
+    {"Matsue", 35.483330f, 133.050000f},
+    {"Kismayo", -0.358170f, 42.545360f},
+    {"Greensboro", 36.072640f, -79.791980f},
+    {"Ganja", 40.682780f, 46.360560f},
+    {"Harare", -17.827720f, 31.053370f},
+    {"Pingliang", 35.539170f, 106.686110f},
+    {"Palma", 39.569390f, 2.650240f},
+    {"Eslamshahr", 35.552220f, 51.235040f},
+    {"Santo Domingo Oeste", 18.500000f, -70.000000f},
+    {"Jimma", 7.673440f, 36.834410f},
+    {"Barquisimeto", 10.064700f, -69.357030f},
+    {"Southampton", 50.903950f, -1.404280f},
+    {"Shangrao", 28.451790f, 117.942870f},
+    {"Xining", 36.625540f, 101.757390f},
+    {"Pune", 18.519570f, 73.855350f},
+    {"Ikot Ekpene", 5.181940f, 7.714810f},
+    {"Marseille", 43.296950f, 5.381070f},
+    {"Taoyuan City", 24.993680f, 121.296960f},
+    {"Camagüey", 21.380830f, -77.916940f},
+    {"Aachen", 50.776640f, 6.083420f},
+    {"Nay Pyi Taw", 19.745000f, 96.129720f},
+    {"Quzhou", 28.959440f, 118.868610f},
+    {"Dhūlia", 20.901300f, 74.777370f},
+    {"Bāndarban", 22.195340f, 92.219460f},
+    {"Tláhuac", 19.286890f, -99.005070f},
+    {"Naihāti", 22.893960f, 88.415210f},
+    {"Alicante", 38.345170f, -0.481490f},
+    {"Dalian", 38.912220f, 121.602220f},
+    {"Ajmer", 26.452100f, 74.638670f},
+    {"Minamirinkan", 35.495270f, 139.442790f},
+    {"Bokāro", 23.669340f, 86.151610f},
+    {"Maroua", 10.590950f, 14.315930f},
+    {"Ta'if", 21.270280f, 40.415830f},
+    {"Hirakata", 34.813520f, 135.649140f},
+    {"Medellín", 6.251840f, -75.563590f},
+    {"Zhu Cheng City", 35.995020f, 119.402590f},
+    {"Saransk", 54.183800f, 45.174900f},
+    {"Weifang", 36.710000f, 119.101940f},
+    {"Mumbai", 19.072830f, 72.882610f},
+    {"East London", -33.015290f, 27.911620f},
+    {"Istanbul", 41.013840f, 28.949660f},
+    {"Cartagena", 10.399720f, -75.514440f},
+    {"Pānihāti", 22.690890f, 88.374040f},
+    {"Ashdod", 31.792130f, 34.649660f},
+    {"Al Kūt", 32.512800f, 45.818170f},
+    {"Al Khuşūş", 30.152930f, 31.315010f},
+    {"New Cairo", 30.030000f, 31.470000f},
+    {"Tallinn", 59.436960f, 24.753530f},
+    {"Jeonju", 35.821940f, 127.148890f},
+    {"Xuzhou", 34.204420f, 117.283860f},
+    {"Turmero", 10.228560f, -67.474210f},
+    {"Amagasaki", 34.716670f, 135.416670f},
+    {"Nārāyanganj", 23.613520f, 90.502980f},
+    {"Sapporo", 43.066670f, 141.350000f},
+    {"Nanning", 22.816670f, 108.316670f},
+    {"Xuanhua", 40.612050f, 115.064630f},
+    {"Ile-Ife", 7.482400f, 4.560320f},
+    {"Zhuhai", 22.276940f, 113.567780f},
+    {"San Miguel", 13.483330f, -88.183330f},
+    {"Santa Teresa del Tuy", 10.232910f, -66.664740f},
+    {"Balıkesir", 39.649170f, 27.886110f},
+    {"Tapachula", 14.903850f, -92.257490f},
+    {"Teresina", -5.089170f, -42.801940f},
+    {"Hubli", 15.347760f, 75.133780f},
+    {"Bacoor", 14.458960f, 120.938510f},
+    {"Ambattūr", 13.098180f, 80.161520f},
+    {"Soshanguve", -25.472880f, 28.099190f},
+    {"Charlotte", 35.227090f, -80.843130f},
+    {"Dhangaḍhi̇̄", 28.701370f, 80.589750f},
+    {"Nanjing", 32.061670f, 118.777780f},
+    {"Talcahuano", -36.724940f, -73.116840f},
+    {"Kampung Kangkar Teberau", 1.532000f, 103.754900f},
+    {"Jurong Town", 1.334170f, 103.722780f},
+    {"Cotia", -23.603890f, -46.919170f},
+    {"Narsingdi", 23.922980f, 90.717680f},
+    {"Itaquaquecetuba", -23.486110f, -46.348330f},
+    {"Oklahoma City", 35.467560f, -97.516430f},
+    {"Kurume", 33.316670f, 130.516670f},
+    {"Yola", 9.208390f, 12.481460f},
+    {"João Pessoa", -7.115000f, -34.863060f},
+    {"Manizales", 5.068890f, -75.517380f},
+    {"Naucalpan de Juárez", 19.478510f, -99.239630f},
+    {"Dandong", 40.129170f, 124.394720f},
+    {"Punāsa", 22.235070f, 76.393350f},
+    {"Palembang", -2.916730f, 104.745800f},
+    {"Pohang", 36.029170f, 129.364810f},
+    {"Cuiabá", -15.596110f, -56.096670f},
+    {"Anchorage", 61.218060f, -149.900280f},
+    {"Itabuna", -14.785560f, -39.280280f},
+    {"Aktobe", 50.279690f, 57.207180f},
+    {"Neyshābūr", 36.213290f, 58.795750f},
+    {"Umraniye", 41.016430f, 29.124760f},
+    {"Nāgercoil", 8.178990f, 77.432270f},
+    {"Las Piñas", 14.450560f, 120.982780f},
+    {"Mianzhu, Deyang, Sichuan", 31.337860f, 104.220570f},
+    {"Milton Keynes", 52.041720f, -0.755830f},
+    {"Sungai Buloh", 3.210000f, 101.561000f},
+    {"Puning", 23.310720f, 116.168690f},
+    {"Memphis", 35.149530f, -90.048980f},
+    {"Adıyaman", 37.764410f, 38.276290f},
+    {"Bukit Mertajam", 5.363010f, 100.466700f},
+    {"Saltillo", 25.423210f, -101.005300f},
+    {"Mogi das Cruzes", -23.522780f, -46.188330f},
+    {"Banda Aceh", 5.541670f, 95.333330f},
+    {"Borama", 9.936110f, 43.182780f},
+    {"Sapele", 5.894050f, 5.676660f},
+    {"Grajaú", -23.769790f, -46.671120f},
+    {"Sétif", 36.191120f, 5.413730f},
+    {"Iligan", 8.228900f, 124.243440f},
+    {"Nottingham", 52.953600f, -1.150470f},
+    {"Philadelphia", 39.952380f, -75.163620f},
+    {"Liaoyang", 41.271940f, 123.173060f},
+    {"Boksburg", -26.211970f, 28.259580f},
+    {"Olongapo", 14.829170f, 120.282780f},
+    {"Borūjerd", 33.897300f, 48.751600f},
+    {"Fukuoka", 33.600000f, 130.416670f},
+    {"Damascus", 33.510200f, 36.291280f},
+    {"Nanded", 19.160230f, 77.314970f},
+    {"Kankan", 10.385420f, -9.305680f},
+    {"Abū Ghurayb", 33.305630f, 44.184770f},
+    {"Marg‘ilon", 40.472370f, 71.724630f},
+    {"Bordeaux", 44.840440f, -0.580500f},
+    {"Tiruvottiyūr", 13.158230f, 80.301810f},
+    {"Fortaleza", -3.717220f, -38.543060f},
+    {"Long Xuyên", 10.386390f, 105.435180f},
+    {"Ulan-Ude", 51.827210f, 107.606270f},
+    {"Monrovia", 6.300540f, -10.796900f},
+    {"Mek'ele", 13.496670f, 39.475280f},
+    {"Al Fayyum", 29.309950f, 30.841800f},
+    {"Soledad", 10.918430f, -74.764590f},
+    {"Augsburg", 48.371540f, 10.898510f},
+    {"Islamabad", 33.721480f, 73.043290f},
+    {"Sosnowiec", 50.286820f, 19.103850f},
+    {"Kāmārhāti", 22.671110f, 88.374720f},
+    {"Istaravshan", 39.914200f, 69.003280f},
+    {"Wuppertal", 51.256270f, 7.148160f},
+    {"Hachiōji", 35.655830f, 139.323890f},
+    {"Dessie", 11.133330f, 39.633330f},
+    {"Aomori", 40.816670f, 140.733330f},
+    {"Quận Ba", 10.774940f, 106.686280f},
+    {"Cainta", 14.578600f, 121.122200f},
+    {"Orlando", 28.538340f, -81.379240f},
+    {"Xiantao", 30.370800f, 113.442940f},
+    {"Citeureup", -6.485560f, 106.881940f},
+    {"Zapopan", 20.723560f, -103.384790f},
+    {"Londrina", -23.310280f, -51.162780f},
+    {"Vitória", -20.319440f, -40.337780f},
+    {"Bahawalpur", 29.397790f, 71.675200f},
+    {"Haikou", 20.034210f, 110.346510f},
+    {"Annaba", 36.900000f, 7.766670f},
+    {"Kitwe", -12.802430f, 28.213230f},
+    {"Capao Redondo", -23.668770f, -46.780510f},
+    {"Sector 6", 44.435790f, 26.016490f},
+    {"Milan", 45.464270f, 9.189510f},
+    {"Incheon", 37.456460f, 126.705150f},
+    {"Kabinda", -6.137910f, 24.481790f},
+    {"Nanchang", 28.683960f, 115.853060f},
+    {"El Obeid", 13.184210f, 30.216690f},
+    {"Pāli", 25.772760f, 73.323350f},
+    {"Komsomolsk-on-Amur", 50.550340f, 137.009950f},
+    {"Van", 38.494570f, 43.383230f},
+    {"Machida", 35.540280f, 139.450830f},
+    {"Verona", 45.438540f, 10.993800f},
+    {"Sultangazi", 41.106520f, 28.868470f},
+    {"Yamagata", 38.233330f, 140.366670f},
+    {"Irvine", 33.669460f, -117.823110f},
+    {"Yanzhou", 35.552780f, 116.828610f},
+    {"Üsküdar", 41.022740f, 29.013660f},
+    {"Himeji", 34.816670f, 134.700000f},
+    {"Nyala", 12.048880f, 24.880690f},
+    {"Pachuca de Soto", 20.116970f, -98.733290f},
+    {"Shimoga", 13.931570f, 75.567910f},
+    {"Soyo", -6.134900f, 12.368940f},
+    {"Minsk", 53.900000f, 27.566670f},
+    {"Deoghar", 24.489830f, 86.699020f},
+    {"Bristol", 51.455230f, -2.596650f},
+    {"Nara-shi", 34.685050f, 135.804850f},
+    {"Bhīlwāra", 25.347070f, 74.640810f},
+    {"Yerevan", 40.181110f, 44.513610f},
+    {"Hailar", 49.200000f, 119.700000f},
+    {"Daloa", 6.877350f, -6.450220f},
+    {"Yibin", 28.759300f, 104.639940f},
+    {"Taytay", 14.558830f, 121.132850f},
+    {"Ixtapaluca", 19.315560f, -98.882840f},
+    {"Tbilisi", 41.694110f, 44.833680f},
+    {"Budta", 7.204170f, 124.439720f},
+    {"Panamá", 8.993600f, -79.519730f},
+    {"Marília", -22.213890f, -49.945830f},
+    {"Linfen", 36.088890f, 111.518890f},
+    {"El Fasher", 13.627930f, 25.349360f},
+    {"Casablanca", 33.588310f, -7.611380f},
+    {"Yuen Long San Hui", 22.433330f, 114.033330f},
+    {"Karīmnagar", 18.439150f, 79.128560f},
+    {"Buraydah", 26.325990f, 43.974970f},
+    {"Jaboatão", -8.180280f, -35.001390f},
+    {"Penza", 53.200660f, 45.004640f},
+    {"Gaoping", 30.775760f, 106.102940f},
+    {"Abobo", 5.416130f, -4.015900f},
+    {"Pengze", 29.898850f, 116.545720f},
+    {"Bei'an", 48.266670f, 126.600000f},
+    {"Shouguang", 36.880000f, 118.737500f},
+    {"La Paz", -16.500000f, -68.150000f},
+    {"Maringá", -23.425280f, -51.938610f},
+    {"Haiphong", 20.864810f, 106.683450f},
+    {"Beira", -19.843610f, 34.838890f},
+    {"Linqu", 36.515560f, 118.539720f},
+    {"Bhiwandi", 19.300230f, 73.058810f},
+    {"Takamatsu", 34.333330f, 134.050000f},
+    {"Sorocaba", -23.501670f, -47.458060f},
+    {"Yancheng", 33.357500f, 120.157300f},
+    {"Warangal", 18.000000f, 79.583330f},
+    {"Ongole", 15.503570f, 80.044540f},
+    {"Iligan City", 8.250000f, 124.400000f},
+    {"Arba Minch", 6.033330f, 37.550000f},
+    {"Nadiād", 22.693850f, 72.861570f},
+    {"Chongjin", 41.795560f, 129.775830f},
+    {"Wuhan", 30.583330f, 114.266670f},
+    {"Kitchener", 43.425370f, -80.511200f},
+    {"Kassala", 15.450990f, 36.399980f},
+    {"Yunlong", 34.252810f, 117.251670f},
+    {"Chifeng", 42.268330f, 118.963610f},
+    {"Kabwe", -14.446900f, 28.446440f},
+    {"Ras Al Khaimah City", 25.789530f, 55.943200f},
+    {"San Miguel de Tucumán", -26.824140f, -65.222600f},
+    {"Jiujiang", 29.704750f, 116.002060f},
+    {"Qinhuangdao", 39.941040f, 119.589360f},
+    {"Likasi", -10.983030f, 26.738400f},
+    {"Kozhikode", 11.248020f, 75.780400f},
+    {"Shibīn al Kawm", 30.552580f, 31.009040f},
+    {"Nanchuan", 29.152010f, 107.103350f},
+    {"Duque de Caxias", -22.785560f, -43.311670f},
+    {"Fukushima", 37.750000f, 140.466670f},
+    {"Cumaná", 10.463900f, -64.178590f},
+    {"Efon-Alaaye", 7.656490f, 4.922350f},
+    {"General Santos", 6.112780f, 125.171670f},
+    {"Lagos", 6.454070f, 3.394670f},
+    {"Sagamihara", 35.567070f, 139.241670f},
+    {"Manta", -0.949370f, -80.731370f},
+    {"Bandundu Province", -3.316870f, 17.380630f},
+    {"Faridabad", 28.411240f, 77.313160f},
+    {"Karur", 10.957710f, 78.080950f},
+    {"Honolulu", 21.306940f, -157.858330f},
+    {"Galaţi", 45.436870f, 28.050280f},
+    {"Constantine", 36.365000f, 6.614720f},
+    {"Fontana", 34.092230f, -117.435050f},
+    {"Okara", 30.810290f, 73.451550f},
+    {"Najafābād", 32.634640f, 51.365250f},
+    {"Pasragad Branch", 34.777720f, 48.471680f},
+    {"Zinder", 13.807160f, 8.988100f},
+    {"Quelimane", -17.878610f, 36.888330f},
+    {"Pematangsiantar", 2.959500f, 99.068700f},
+    {"Santo Domingo Este", 18.488470f, -69.857070f},
+    {"Atani", 6.012770f, 6.747680f},
+    {"A Coruña", 43.371350f, -8.396000f},
+    {"Pokhara", 28.266890f, 83.968510f},
+    {"Umuahia", 5.524910f, 7.494610f},
+    {"Gilbert", 33.352830f, -111.789030f},
+    {"Jurong West", 1.350280f, 103.722780f},
+    {"Āsansol", 23.683330f, 86.983330f},
+    {"Port Moresby", -9.477230f, 147.150890f},
+    {"Eldoret", 0.520360f, 35.269930f},
+    {"Fort Wayne", 41.130600f, -85.128860f},
+    {"Parakou", 9.337160f, 2.630310f},
+    {"Amritsar", 31.622340f, 74.875340f},
+    {"Villa Nueva", 14.525120f, -90.585440f},
+    {"Grozny", 43.311950f, 45.688950f},
+    {"Benghazi", 32.114860f, 20.068590f},
+    {"Nashville", 36.165890f, -86.784440f},
+    {"Bamako", 12.650000f, -8.000000f},
+    {"Córdoba", -31.413500f, -64.181050f},
+    {"Bursa", 40.195590f, 29.060130f},
+    {"City of Westminster", 51.497500f, -0.135700f},
+    {"Taiping", 4.850000f, 100.733330f},
+    {"Vancouver", 49.249660f, -123.119340f},
+    {"Jerusalem", 31.769040f, 35.216330f},
+    {"Gunan", 29.023100f, 106.648000f},
+    {"San Fernando de Apure", 7.887820f, -67.472360f},
+    {"Denver", 39.739150f, -104.984700f},
+    {"Changhua", 24.069200f, 120.551200f},
+    {"Bukit Jalil", 3.049130f, 101.680360f},
+    {"Ciudad Juárez", 31.720240f, -106.460840f},
+    {"Smolensk", 54.779440f, 32.043710f},
+    {"Agadir", 30.420180f, -9.598150f},
+    {"Tŏkch'ŏn", 39.752610f, 126.257980f},
+    {"Peshawar", 34.008000f, 71.578490f},
+    {"Taichung", 24.146900f, 120.683900f},
+    {"Kyiv", 50.454660f, 30.523800f},
+    {"Shangyu", 30.015560f, 120.871110f},
+    {"Ivanovo", 56.997190f, 40.971390f},
+    {"Gaza", 31.501610f, 34.466720f},
+    {"Cape Town", -33.925840f, 18.423220f},
+    {"Shanwei", 22.781990f, 115.347500f},
+    {"Batangas", 13.756700f, 121.058400f},
+    {"Kawagoe", 35.908610f, 139.485280f},
+    {"Arequipa", -16.398890f, -71.535000f},
+    {"Ürümqi", 43.800960f, 87.600460f},
+    {"Chita", 52.031710f, 113.500870f},
+    {"Coimbatore", 11.005550f, 76.966120f},
+    {"Yangjiang", 21.855630f, 111.962720f},
+    {"Ya'an", 29.985210f, 102.999000f},
+    {"Ladner", 49.089380f, -123.082410f},
+    {"Panchkula", 30.694610f, 76.850400f},
+    {"Fushun", 41.886690f, 123.943630f},
+    {"Vila Velha", -20.329720f, -40.292500f},
+    {"Ciudad Obregón", 27.486420f, -109.940830f},
+    {"Sumedang", -6.858610f, 107.916390f},
+    {"Zoucheng", 35.400560f, 116.965560f},
+    {"Hong Kong", 22.278320f, 114.174690f},
+    {"Ningbo", 29.878190f, 121.549450f},
+    {"Al Mansurah", 31.036370f, 31.380690f},
+    {"Campeche", 19.843860f, -90.525540f},
+    {"Hengyang", 26.889460f, 112.618880f},
+    {"Columbus", 39.961180f, -82.998790f},
+    {"Zitong", 30.178200f, 105.829910f},
+    {"Perth", -31.952240f, 115.861400f},
+    {"Colonia del Valle", 19.386110f, -99.162040f},
+    {"Bhāgalpur", 25.244460f, 86.971830f},
+    {"Kermanshah", 34.314170f, 47.065000f},
+    {"Rourkela", 22.224960f, 84.864140f},
+    {"Raleigh", 35.772100f, -78.638610f},
+    {"Guayaquil", -2.196160f, -79.886210f},
+    {"Siping", 43.161430f, 124.377850f},
+    {"Benito Juarez", 19.398400f, -99.157660f},
+    {"Benxi", 41.288610f, 123.765000f},
+    {"Konibodom", 40.294140f, 70.431220f},
+    {"Kallakurichi", 11.733790f, 78.959250f},
+    {"Mykolayiv", 46.976250f, 31.992960f},
+    {"Bégoua", 4.454370f, 18.534750f},
+    {"Tirupati", 13.635510f, 79.419890f},
+    {"Neihu", 25.081500f, 121.588090f},
+    {"Xiangtan", 27.850000f, 112.900000f},
+    {"Nishinomiya", 34.715620f, 135.331990f},
+    {"Debrecen", 47.531670f, 21.624440f},
+    {"Hangzhou", 30.293650f, 120.161420f},
+    {"São Vicente", -23.963060f, -46.391940f},
+    {"Huai'an", 33.588610f, 119.019170f},
+    {"San Bernardino", 34.108340f, -117.289770f},
+    {"Port Harcourt", 4.777420f, 7.013400f},
+    {"Cherkasy", 49.444520f, 32.057380f},
+    {"Pointe-Noire", -4.776090f, 11.863520f},
+    {"Cancún", 21.174290f, -86.846560f},
+    {"São Luís", -2.529720f, -44.302780f},
+    {"Celaya", 20.523530f, -100.815700f},
+    {"Kahrīz", 34.383800f, 47.055300f},
+    {"Matadi", -5.838610f, 13.463060f},
+    {"Abeokuta", 7.155710f, 3.345090f},
+    {"Mzuzu", -11.465560f, 34.020710f},
+    {"Oaxaca", 17.065420f, -96.723650f},
+    {"Tiruppur", 11.115410f, 77.354560f},
+    {"Swindon", 51.557970f, -1.781160f},
+    {"Bārāsat", 22.721540f, 88.481980f},
+    {"Krasnoyarsk", 56.026680f, 92.907650f},
+    {"São Bernardo do Campo", -23.693890f, -46.565000f},
+    {"Lucena", 13.931390f, 121.617220f},
+    {"Azcapotzalco", 19.486980f, -99.185940f},
+    {"Orël", 52.959320f, 36.078050f},
+    {"Katsina", 12.990820f, 7.601770f},
+    {"Tongling", 30.950000f, 117.783330f},
+    {"Somerset West", -34.084010f, 18.821130f},
+    {"Mosul", 36.335000f, 43.118890f},
+    {"Singapore", 1.289670f, 103.850070f},
+    {"Rajamahendravaram", 17.005170f, 81.777840f},
+    {"Jingdezhen", 29.294700f, 117.207890f},
+    {"Hŭngnam", 39.841980f, 127.632060f},
+    {"Montevideo", -34.903280f, -56.188160f},
+    {"Padang", -0.949240f, 100.354270f},
+    {"Lankaran", 38.754280f, 48.850620f},
+    {"Los Teques", 10.344470f, -67.043250f},
+    {"Barinas", 8.622610f, -70.207490f},
+    {"South Boston", 42.333430f, -71.049490f},
+    {"El Jadida", 33.256820f, -8.508820f},
+    {"Long Beach", 33.766960f, -118.189230f},
+    {"Khabarovsk", 48.482710f, 135.083790f},
+    {"Huocheng", 44.053050f, 80.871730f},
+    {"Kanpur", 26.465230f, 80.349750f},
+    {"Leeds", 53.796480f, -1.547850f},
+    {"Lubumbashi", -11.660890f, 27.479380f},
+    {"Anshun", 26.250000f, 105.933330f},
+    {"Kananga", -5.896240f, 22.416590f},
+    {"Chí Linh", 21.066670f, 106.316670f},
+    {"Petrozavodsk", 61.784910f, 34.346910f},
+    {"Bacolod City", 10.666670f, 122.950000f},
+    {"Kindu", -2.943730f, 25.922370f},
+    {"Eskişehir", 39.776670f, 30.520560f},
+    {"Naz̧arābād", 35.954110f, 50.606070f},
+    {"Harbin", 45.750000f, 126.650000f},
+    {"Milwaukee", 43.038900f, -87.906470f},
+    {"Tulsa", 36.153980f, -95.992770f},
+    {"Guarujá", -23.993060f, -46.256390f},
+    {"Gunpo", 37.367500f, 126.946940f},
+    {"Carrefour", 18.541140f, -72.399220f},
+    {"Posadas", -27.367080f, -55.896080f},
+    {"Batu Caves", 3.238000f, 101.682000f},
+    {"Omaha", 41.256260f, -95.940430f},
+    {"Xingtai", 37.062170f, 114.492720f},
+    {"Juiz de Fora", -21.764170f, -43.350280f},
+    {"Pingdingshan", 33.738470f, 113.301190f},
+    {"Denpasar", -8.650000f, 115.216670f},
+    {"Cochin", 9.939880f, 76.260220f},
+    {"Purwokerto", -7.421390f, 109.234440f},
+    {"Nantong", 32.030280f, 120.874720f},
+    {"Yokohama", 35.433330f, 139.650000f},
+    {"Leshan", 29.562270f, 103.763860f},
+    {"Okayama", 34.650000f, 133.933330f},
+    {"Morādābād", 28.838930f, 78.776840f},
+    {"Isfahan", 32.652460f, 51.674620f},
+    {"Islington", 51.536220f, -0.103040f},
+    {"Tongliao", 43.612500f, 122.265280f},
+    {"Fenghuang", 27.935570f, 109.599610f},
+    {"Roodepoort", -26.162500f, 27.872500f},
+    {"Koutiala", 12.391730f, -5.464210f},
+    {"Paraná", -31.732710f, -60.528970f},
+    {"Niigata", 37.922590f, 139.041250f},
+    {"Sultanbeyli", 40.960720f, 29.270670f},
+    {"Hangu", 39.248890f, 117.789170f},
+    {"Qingdao", 36.064880f, 120.380420f},
+    {"Bagong Silang", 14.778300f, 121.044870f},
+    {"Iztacalco", 19.395280f, -99.097780f},
+    {"Kaunas", 54.902720f, 23.909610f},
+    {"Akita", 39.716670f, 140.116670f},
+    {"Wafangdian", 39.618330f, 122.008060f},
+    {"Mossamedes", -15.196110f, 12.152220f},
+    {"Etobicoke", 43.644150f, -79.569850f},
+    {"Yulin", 22.630500f, 110.146860f},
+    {"Porto Velho", -8.761940f, -63.903890f},
+    {"Astrakhan", 46.349680f, 48.040760f},
+    {"Rānipet", 12.924710f, 79.333310f},
+    {"Jeddah", 21.490120f, 39.186240f},
+    {"Iksan", 35.943890f, 126.954440f},
+    {"Setapak", 3.207000f, 101.727000f},
+    {"Taizhou", 32.490690f, 119.908120f},
+    {"Manila", 14.604200f, 120.982200f},
+    {"Obalende", 6.446940f, 3.415280f},
+    {"Tirana", 41.327500f, 19.818890f},
+    {"Sucre", -19.033320f, -65.262740f},
+    {"Qitaihe", 45.768000f, 130.995300f},
+    {"Guatemala City", 14.640720f, -90.513270f},
+    {"Portoviejo", -1.054580f, -80.454450f},
+    {"Taicang", 31.447780f, 121.093890f},
+    {"Kota Kinabalu", 5.974900f, 116.072400f},
+    {"Indianapolis", 39.768380f, -86.158040f},
+    {"Kawaguchi", 35.805210f, 139.710720f},
+    {"Ananindeua", -1.365560f, -48.372220f},
+    {"Yamuna Nagar", 30.127960f, 77.283710f},
+    {"Yangon", 16.805280f, 96.156110f},
+    {"Serang", -6.115280f, 106.154170f},
+    {"Alor Setar", 6.121040f, 100.360140f},
+    {"Sodo", 6.860000f, 37.761590f},
+    {"Abomey-Calavi", 6.448520f, 2.355660f},
+    {"Kolwezi", -10.714840f, 25.466740f},
+    {"Ad Dīwānīyah", 31.992890f, 44.925520f},
+    {"Qina", 26.164180f, 32.726710f},
+    {"Nizhnekamsk", 55.636570f, 51.824470f},
+    {"Bandar Seri Alam", 1.504340f, 103.875250f},
+    {"Baicheng", 45.617510f, 122.833020f},
+    {"Ciudad Ojeda", 10.201610f, -71.314800f},
+    {"Sapopemba", -23.595560f, -46.524720f},
+    {"Fremont", 37.548270f, -121.988570f},
+    {"Düsseldorf", 51.221720f, 6.776160f},
+    {"Shihezi", 44.302300f, 86.036940f},
+    {"Miguel Hidalgo", 19.434110f, -99.200240f},
+    {"Vasyl'evsky Ostrov", 59.940910f, 30.253770f},
+    {"Bhātpāra", 22.866430f, 88.401130f},
+    {"Quận Mười", 10.768230f, 106.666320f},
+    {"Kawasaki", 35.520560f, 139.717220f},
+    {"Kamyanske", 48.517160f, 34.606170f},
+    {"Toyama", 36.700000f, 137.216670f},
+    {"Huaihua", 27.563370f, 110.004040f},
+    {"Vũng Tàu", 10.345990f, 107.084260f},
+    {"Natal", -5.795000f, -35.209440f},
+    {"Santa Maria", -29.684170f, -53.806940f},
+    {"Oslo", 59.912730f, 10.746090f},
+    {"Garland", 32.912620f, -96.638880f},
+    {"Palangkaraya", -2.208330f, 113.916670f},
+    {"Jodhpur", 26.268410f, 73.005940f},
+    {"Thuận An", 10.923900f, 106.714280f},
+    {"Kigali", -1.949950f, 30.058850f},
+    {"Tainan", 22.990830f, 120.213330f},
+    {"Baltimore", 39.290380f, -76.612190f},
+    {"Merlo", -34.665360f, -58.727440f},
+    {"Larkana", 27.558980f, 68.212040f},
+    {"Fangchenggang", 21.769450f, 108.356610f},
+    {"Zliten", 32.467390f, 14.568740f},
+    {"Colombo", 6.935480f, 79.848680f},
+    {"Maebashi", 36.400000f, 139.083330f},
+    {"Jebel Ali", 25.002550f, 55.108110f},
+    {"Malingao", 7.160830f, 124.475000f},
+    {"Samarkand", 39.654170f, 66.959720f},
+    {"Gaziantep", 37.059440f, 37.382500f},
+    {"Davao", 7.073060f, 125.612780f},
+    {"Paranaque City", 14.481560f, 121.017490f},
+    {"Sham Shui Po", 22.330230f, 114.159450f},
+    {"Jingmen", 31.033610f, 112.204720f},
+    {"Sabadell", 41.543290f, 2.109420f},
+    {"Mbeya", -8.900000f, 33.450000f},
+    {"Paarl", -33.733780f, 18.975230f},
+    {"Batu", -7.870000f, 112.528330f},
+    {"Aswān", 24.090820f, 32.899420f},
+    {"Reno", 39.529630f, -119.813800f},
+    {"Kano", 12.000120f, 8.516720f},
+    {"Strasbourg", 48.583920f, 7.745530f},
+    {"Heyuan", 23.733330f, 114.683330f},
+    {"Corpus Christi", 27.800580f, -97.396380f},
+    {"Tanggu", 39.021110f, 117.646940f},
+    {"Hiroshima", 34.400000f, 132.450000f},
+    {"Mito", 36.350000f, 140.450000f},
+    {"Qarshi", 38.860560f, 65.789050f},
+    {"Saint Paul", 44.944410f, -93.093270f},
+    {"Howrah", 22.576880f, 88.318570f},
+    {"Bandar Lampung", -5.429170f, 105.261110f},
+    {"Thái Nguyên", 21.594220f, 105.848170f},
+    {"Tampa", 27.947520f, -82.458430f},
+    {"Kirkuk", 35.468060f, 44.392220f},
+    {"León de los Aldama", 21.129080f, -101.673740f},
+    {"Guyuan", 36.006670f, 106.280830f},
+    {"Rishon LeTsiyyon", 31.971020f, 34.789390f},
+    {"Santa Cruz de Tenerife", 28.468240f, -16.254620f},
+    {"Taiz", 13.579520f, 44.020910f},
+    {"Putian", 25.439440f, 119.010280f},
+    {"Wanxian", 30.816010f, 108.374070f},
+    {"Port-au-Prince", 18.543490f, -72.338810f},
+    {"Gazipur", 23.998440f, 90.422340f},
+    {"Gravataí", -29.942180f, -50.992780f},
+    {"Wangsa Maju", 3.200560f, 101.739720f},
+    {"Tawau", 4.244820f, 117.891150f},
+    {"Libertad", 8.944170f, 125.501940f},
+    {"Makurdi", 7.733750f, 8.521390f},
+    {"Simao", 22.788630f, 100.974810f},
+    {"Cherepovets", 59.133330f, 37.900000f},
+    {"Rāichūr", 16.205460f, 77.355670f},
+    {"Ilesa", 7.627890f, 4.741610f},
+    {"Freetown", 8.487140f, -13.235600f},
+    {"Marka", 1.715940f, 44.771660f},
+    {"Donghai", 22.945930f, 115.642040f},
+    {"Lille", 50.632970f, 3.058580f},
+    {"Qo‘qon", 40.528610f, 70.942500f},
+    {"Minneapolis", 44.979970f, -93.263840f},
+    {"Kropyvnytskyy", 48.508340f, 32.266180f},
+    {"Shiyan", 32.647500f, 110.778060f},
+    {"Zhabei", 31.258610f, 121.459720f},
+    {"Pingxiang", 27.616720f, 113.853530f},
+    {"Natore", 24.411120f, 88.986730f},
+    {"Xalapa de Enríquez", 19.531240f, -96.915890f},
+    {"Bilimora", 20.769570f, 72.961340f},
+    {"Glendale", 33.538650f, -112.185990f},
+    {"Hefei", 31.863890f, 117.280830f},
+    {"Poltava", 49.589250f, 34.553670f},
+    {"Cox's Bāzār", 21.439730f, 92.009550f},
+    {"Changzhou", 31.773590f, 119.954010f},
+    {"Al Ain City", 24.191670f, 55.760560f},
+    {"Rangpur", 25.746640f, 89.251660f},
+    {"Purnia", 25.778950f, 87.474220f},
+    {"Santo André", -23.663890f, -46.538330f},
+    {"Tyumen", 57.152220f, 65.527220f},
+    {"Kākināda", 16.960360f, 82.238090f},
+    {"Morelia", 19.700780f, -101.184430f},
+    {"Shizuishan", 38.980820f, 106.389200f},
+    {"Nouakchott", 18.085810f, -15.978500f},
+    {"Santa María Chimalhuacán", 19.421550f, -98.950380f},
+    {"São José do Rio Preto", -20.819720f, -49.379440f},
+    {"Jijiga", 9.350000f, 42.800000f},
+    {"Xintai", 35.900560f, 117.751940f},
+    {"Las Tunas", 20.961670f, -76.951110f},
+    {"Sofia", 42.697510f, 23.324150f},
+    {"Zaragoza", 41.656060f, -0.877340f},
+    {"Eimsbüttel", 53.574160f, 9.956790f},
+    {"Oulu", 65.012360f, 25.468160f},
+    {"Aden", 12.779440f, 45.036670f},
+    {"Adelaide", -34.928660f, 138.598630f},
+    {"Kimhae", 35.234170f, 128.881110f},
+    {"Mashhad", 36.298070f, 59.605670f},
+    {"Kenitra", 34.261010f, -6.580200f},
+    {"Oberhausen", 51.478050f, 6.862500f},
+    {"Varanasi", 25.316680f, 83.010410f},
+    {"Rochester", 43.154780f, -77.615560f},
+    {"Qingyang", 35.709760f, 107.644550f},
+    {"Ibadan", 7.377560f, 3.905910f},
+    {"Gwangmyeong", 37.477220f, 126.866390f},
+    {"Ifakara", -8.133330f, 36.683330f},
+    {"Brescia", 45.535580f, 10.214720f},
+    {"Bahía Blanca", -38.717600f, -62.265450f},
+    {"Bengaluru", 12.971940f, 77.593690f},
+    {"Huainan", 32.626390f, 116.996940f},
+    {"Jianshui", 24.277400f, 101.224000f},
+    {"Ninh Hòa", 12.491870f, 109.124950f},
+    {"Kota Damansara", 3.154540f, 101.580220f},
+    {"Shangqiu", 34.450000f, 115.650000f},
+    {"Nawabshah", 26.239390f, 68.403690f},
+    {"Kurgan", 55.450000f, 65.333330f},
+    {"Kanayannur", 9.966670f, 76.266670f},
+    {"Ichinomiya", 35.300000f, 136.800000f},
+    {"Turkestan", 43.297330f, 68.251750f},
+    {"West Raleigh", 35.786820f, -78.663890f},
+    {"Ambon", -3.695830f, 128.183330f},
+    {"Ciudad López Mateos", 19.557930f, -99.256750f},
+    {"Benito Juárez", 19.372700f, -99.156400f},
+    {"Visakhapatnam", 17.680090f, 83.201610f},
+    {"Riga", 56.946000f, 24.105890f},
+    {"Wandsbek", 53.583340f, 10.083050f},
+    {"Puente Alto", -33.611690f, -70.575770f},
+    {"Xiamen", 24.479790f, 118.081870f},
+    {"Yeosu", 34.760620f, 127.662150f},
+    {"Āzādshahr", 34.790490f, 48.570110f},
+    {"Zhaotong", 27.316670f, 103.716670f},
+    {"Sochi", 43.596990f, 39.724770f},
+    {"Sulţānah", 24.492580f, 39.585720f},
+    {"Lviv", 49.838260f, 24.023240f},
+    {"Salé", 34.053100f, -6.798460f},
+    {"Okanagan", 50.363860f, -119.349970f},
+    {"Minna", 9.615240f, 6.547760f},
+    {"Bole", 44.893340f, 82.069930f},
+    {"Shāhjānpur", 27.881650f, 79.909180f},
+    {"Nukus", 42.453060f, 59.610280f},
+    {"Malabon", 14.673330f, 120.939720f},
+    {"Madiun", -7.629800f, 111.523900f},
+    {"Cuautitlán Izcalli", 19.643880f, -99.215980f},
+    {"Chuncheon", 37.874720f, 127.734170f},
+    {"Şişli", 41.060460f, 28.987170f},
+    {"Mantilla", 23.067940f, -82.341430f},
+    {"Brahmapur", 19.311510f, 84.792900f},
+    {"Warsaw", 52.229770f, 21.011780f},
+    {"Zamboanga", 6.910280f, 122.073890f},
+    {"Cimahi", -6.872220f, 107.542500f},
+    {"Chānda", 19.950760f, 79.295230f},
+    {"Huntsville", 34.730400f, -86.585940f},
+    {"Zaporizhzhya", 47.851670f, 35.117140f},
+    {"Esmeraldas", 0.959200f, -79.653970f},
+    {"Sholapur", 17.671520f, 75.910440f},
+    {"Shaoyang", 27.238180f, 111.462140f},
+    {"Jūnāgadh", 21.519660f, 70.459810f},
+    {"New York City", 40.714270f, -74.005970f},
+    {"Yokosuka", 35.283610f, 139.667220f},
+    {"Halifax", 44.642690f, -63.576880f},
+    {"Deir ez-Zor", 35.335880f, 40.140840f},
+    {"Pātan", 27.676580f, 85.314170f},
+    {"Košice", 48.713950f, 21.258080f},
+    {"Udaipur", 24.585840f, 73.713460f},
+    {"Sacoma", -23.630830f, -46.598170f},
+    {"Dera Ghazi Khan", 30.045870f, 70.640290f},
+    {"Iwaki", 37.050000f, 140.883330f},
+    {"Alto Barinas", 8.593100f, -70.226100f},
+    {"Bozhou", 33.877220f, 115.770280f},
+    {"Hamamatsu", 34.700000f, 137.733330f},
+    {"Surakarta", -7.556110f, 110.831670f},
+    {"Ironville", 38.456470f, -82.692380f},
+    {"Kuching", 1.550000f, 110.333330f},
+    {"Tri-Cities", 46.245400f, -119.196170f},
+    {"Embu das Artes", -23.648890f, -46.852220f},
+    {"Tokyo", 35.689500f, 139.691710f},
+    {"Phoenix", 33.448380f, -112.074040f},
+    {"Ternopil", 49.554040f, 25.590670f},
+    {"Kumba", 4.636300f, 9.446900f},
+    {"Ojo de Agua", 19.680280f, -99.010000f},
+    {"Klerksdorp", -26.852130f, 26.666720f},
+    {"Abha", 18.216390f, 42.505280f},
+    {"Kariega", -33.755620f, 25.400740f},
+    {"Zunyi", 27.686670f, 106.907220f},
+    {"Tanga", -5.068930f, 39.098750f},
+    {"Antananarivo", -18.913680f, 47.536130f},
+    {"Zaozhuang", 34.864720f, 117.554170f},
+    {"Albuquerque", 35.084490f, -106.651140f},
+    {"Bağcılar", 41.039030f, 28.856710f},
+    {"Shagamu", 6.848500f, 3.646330f},
+    {"Yuncheng", 35.023060f, 110.992780f},
+    {"El Paso", 31.758720f, -106.486930f},
+    {"Eluru", 16.713110f, 81.104370f},
+    {"Mantampay", 8.166670f, 124.216670f},
+    {"Bonn", 50.734380f, 7.095490f},
+    {"Rosario", -32.946820f, -60.639320f},
+    {"Hamburg", 53.550730f, 9.993020f},
+    {"Sector 3", 44.423400f, 26.168740f},
+    {"Bhavnagar", 21.762870f, 72.153310f},
+    {"Binhe", 32.688330f, 112.827500f},
+    {"Kuantan", 3.807700f, 103.326000f},
+    {"Antalya", 36.908120f, 30.695560f},
+    {"Cardiff", 51.480000f, -3.180000f},
+    {"Sandakan", 5.840200f, 118.117900f},
+    {"Bade", 24.929810f, 121.283720f},
+    {"Nada", 19.521340f, 109.578950f},
+    {"Brussels", 50.850450f, 4.348780f},
+    {"Omdurman", 15.644530f, 32.477730f},
+    {"Soacha", 4.579370f, -74.216820f},
+    {"Brampton", 43.683410f, -79.766330f},
+    {"Ternate", 0.790650f, 127.384240f},
+    {"Pimpri", 18.622920f, 73.806960f},
+    {"Xianyang", 34.337780f, 108.702610f},
+    {"Binzhou", 37.366670f, 118.016670f},
+    {"Ansan-si", 37.323610f, 126.821940f},
+    {"Butuan", 8.949170f, 125.543610f},
+    {"Tangshan", 39.643810f, 118.183190f},
+    {"Vellore", 12.918400f, 79.132550f},
+    {"Saugor", 23.838770f, 78.738740f},
+    {"Nagar Naluākot", 24.156080f, 90.772800f},
+    {"Santa Catarina", 25.673250f, -100.458130f},
+    {"Tongshan", 34.180450f, 117.157070f},
+    {"Bielefeld", 52.033330f, 8.533330f},
+    {"Huancayo", -12.065130f, -75.204860f},
+    {"Najaf", 32.025940f, 44.346250f},
+    {"Kaduna", 10.526410f, 7.438790f},
+    {"Beni Mellal", 32.337250f, -6.349830f},
+    {"Montréal", 45.508840f, -73.587810f},
+    {"Ciputat", -6.237500f, 106.695560f},
+    {"Al Ḩasakah", 36.502370f, 40.747720f},
+    {"Imperatriz", -5.526390f, -47.491670f},
+    {"Ujjain", 23.182390f, 75.776430f},
+    {"Boa Vista", 2.819720f, -60.673330f},
+    {"Rancagua", -34.170830f, -70.744440f},
+    {"Kotli", 33.518360f, 73.902200f},
+    {"Isiro", 2.773910f, 27.616030f},
+    {"Bawshar", 23.577690f, 58.399820f},
+    {"Safi", 32.299390f, -9.237180f},
+    {"Brăila", 45.271520f, 27.974290f},
+    {"Kaolack", 14.151970f, -16.072590f},
+    {"Tokushima", 34.066670f, 134.566670f},
+    {"São José", -28.213440f, -49.163830f},
+    {"Toyonaka", 34.782440f, 135.469320f},
+    {"Fendou", 46.641420f, 124.862830f},
+    {"Chitungwiza", -18.012740f, 31.075550f},
+    {"Magdeburg", 52.127730f, 11.629160f},
+    {"Malir Cantonment", 24.943430f, 67.205910f},
+    {"Yuen Long", 22.445180f, 114.026210f},
+    {"Hafar Al-Batin", 28.432790f, 45.970770f},
+    {"Sohag", 26.556950f, 31.694780f},
+    {"Ningde", 26.661670f, 119.522780f},
+    {"Kumasi", 6.688480f, -1.624430f},
+    {"Bochum-Hordel", 51.501680f, 7.175600f},
+    {"Marcory", 5.311980f, -3.993630f},
+    {"Gosāba", 22.165470f, 88.800700f},
+    {"Auckland", -36.848530f, 174.763490f},
+    {"Nanchong", 30.795080f, 106.084730f},
+    {"Jaipur", 26.919620f, 75.787810f},
+    {"Ageo", 35.971450f, 139.613820f},
+    {"Benoni", -26.188480f, 28.320780f},
+    {"Sanandaj", 35.314950f, 46.998830f},
+    {"Vitebsk", 55.190400f, 30.204900f},
+    {"Puerto Princesa", 9.739170f, 118.735280f},
+    {"İzmir", 38.412730f, 27.138380f},
+    {"Khartoum", 15.551770f, 32.532410f},
+    {"Centurion", -25.858910f, 28.185770f},
+    {"Groningen", 53.219170f, 6.566670f},
+    {"Fuzhou", 26.061390f, 119.306110f},
+    {"Ruiru", -1.146650f, 36.960870f},
+    {"Puyang", 29.456790f, 119.888720f},
+    {"Suwon", 37.291110f, 127.008890f},
+    {"Québec", 46.812280f, -71.214540f},
+    {"Lubango", -14.917170f, 13.492500f},
+    {"São José dos Campos", -23.179440f, -45.886940f},
+    {"Sargodha", 32.085860f, 72.674180f},
+    {"Mansilingan", 10.631110f, 122.978890f},
+    {"Murmansk", 68.973980f, 33.097470f},
+    {"Wuhai", 39.684420f, 106.815830f},
+    {"Gaborone", -24.654510f, 25.908590f},
+    {"Timişoara", 45.753720f, 21.225710f},
+    {"Malmö", 55.605870f, 13.000730f},
+    {"Dehiwala-Mount Lavinia", 6.840190f, 79.871160f},
+    {"Iaşi", 47.166670f, 27.600000f},
+    {"Matsudo", 35.779950f, 139.901440f},
+    {"Cuíto", -12.383330f, 16.933330f},
+    {"Hwaseong-si", 37.206820f, 126.816900f},
+    {"Panipat", 29.387470f, 76.968250f},
+    {"Belfast", 54.596820f, -5.925410f},
+    {"Jinzhou", 41.107780f, 121.141670f},
+    {"Kŭlob", 37.914590f, 69.784540f},
+    {"Kāfrul", 23.788220f, 90.373590f},
+    {"Toronto", 43.706430f, -79.398640f},
+    {"Tiruchirappalli", 10.815500f, 78.696510f},
+    {"Port Sudan", 19.617450f, 37.216440f},
+    {"Lexington-Fayette", 38.049800f, -84.458550f},
+    {"La Ceiba", 15.759710f, -86.782210f},
+    {"Porto Alegre", -30.032830f, -51.230190f},
+    {"Shijiazhuang", 38.041390f, 114.478610f},
+    {"Khorramshahr", 30.440790f, 48.184280f},
+    {"Jinghong", 22.002650f, 100.769700f},
+    {"Kalyān", 19.243700f, 73.135540f},
+    {"Surat", 21.195940f, 72.830230f},
+    {"Port Elizabeth", -33.961090f, 25.614940f},
+    {"Subang Jaya", 3.043840f, 101.580620f},
+    {"Prague", 50.088040f, 14.420760f},
+    {"Multan", 30.196790f, 71.478240f},
+    {"Shiqi", 22.516820f, 113.385210f},
+    {"Kōriyama", 37.400000f, 140.383330f},
+    {"Bandar Sunway", 3.069300f, 101.607400f},
+    {"San Fernando", 15.034250f, 120.684450f},
+    {"Baguio", 16.416390f, 120.593060f},
+    {"Padangsidempuan", 1.379520f, 99.271460f},
+    {"Palmira", 3.539440f, -76.303610f},
+    {"Changde", 29.032050f, 111.698440f},
+    {"Cuauhtémoc", 19.445060f, -99.146120f},
+    {"Jamshedpur", 22.802780f, 86.185450f},
+    {"Suzhou", 31.304080f, 120.595380f},
+    {"La Romana", 18.427330f, -68.972850f},
+    {"Jabalpur", 23.166970f, 79.950060f},
+    {"El Tigre", 8.889020f, -64.252700f},
+    {"Naberezhnyye Chelny", 55.725450f, 52.411220f},
+    {"Antipolo", 14.625780f, 121.122510f},
+    {"Villahermosa", 17.986890f, -92.930280f},
+    {"Gombe", 10.289690f, 11.167290f},
+    {"Srinagar", 34.085650f, 74.805550f},
+    {"Sanaa", 15.354720f, 44.206670f},
+    {"Feira de Santana", -12.266670f, -38.966670f},
+    {"Libreville", 0.392410f, 9.453560f},
+    {"Phnom Penh", 11.562450f, 104.916010f},
+    {"Longling County", 24.586630f, 98.689340f},
+    {"Sinŭiju", 40.100560f, 124.398060f},
+    {"Lisbon", 38.716670f, -9.133330f},
+    {"Hulunbuir", 49.211410f, 119.755820f},
+    {"Bulawayo", -20.150000f, 28.583330f},
+    {"Mardan", 34.197940f, 72.049650f},
+    {"Bīkaner", 28.017620f, 73.314950f},
+    {"Kulti", 23.731660f, 86.843720f},
+    {"Staryy Oskol", 51.302500f, 37.846130f},
+    {"Chattogram", 22.338400f, 91.831680f},
+    {"Magugpo Poblacion", 7.447500f, 125.804600f},
+    {"Porlamar", 10.957710f, -63.869710f},
+    {"Bekasi", -6.234900f, 106.989600f},
+    {"Mysore", 12.297910f, 76.639250f},
+    {"Kyain Seikgyi Township", 15.822880f, 98.252570f},
+    {"Bāli", 22.648590f, 88.341150f},
+    {"Yenagoa", 4.926750f, 6.267640f},
+    {"Patna", 25.594080f, 85.135630f},
+    {"Makiivka", 48.047820f, 37.925760f},
+    {"Meknes", 33.893520f, -5.547270f},
+    {"Rustenburg", -25.667560f, 27.242080f},
+    {"Dortmund", 51.514940f, 7.466000f},
+    {"Kerman", 30.283210f, 57.078790f},
+    {"Keelung", 25.130890f, 121.740940f},
+    {"Buenavista", 19.608330f, -99.169440f},
+    {"Nishi-Tokyo-shi", 35.725260f, 139.538300f},
+    {"Kashiwa", 35.862240f, 139.977320f},
+    {"Bishoftu", 8.752250f, 38.978460f},
+    {"Montería", 8.747980f, -75.881430f},
+    {"Chingola", -12.528970f, 27.883820f},
+    {"Salem", 11.653760f, 78.155380f},
+    {"Xuanzhou", 30.952500f, 118.755280f},
+    {"Wad Medani", 14.401180f, 33.519890f},
+    {"Tsu", 34.733330f, 136.516670f},
+    {"Tunduma", -9.300000f, 32.766670f},
+    {"Jiaozhou", 36.283890f, 120.003330f},
+    {"Torreón", 25.543890f, -103.418980f},
+    {"Dammam", 26.434420f, 50.103260f},
+    {"Sōka", 35.836430f, 139.799570f},
+    {"Banja Luka", 44.778420f, 17.193860f},
+    {"Brighton", 50.828380f, -0.139470f},
+    {"Jabaquara", -23.650550f, -46.645910f},
+    {"Yiwu", 29.315060f, 120.076760f},
+    {"Atsiaman", 5.697750f, -0.328240f},
+    {"Yei", 4.094440f, 30.676390f},
+    {"Oviedo", 43.360290f, -5.844760f},
+    {"Haifa", 32.818410f, 34.988500f},
+    {"Tarakan", 3.313320f, 117.591520f},
+    {"Kostanay", 53.214350f, 63.624630f},
+    {"Newport", 51.587740f, -2.998350f},
+    {"Jining", 35.405000f, 116.581390f},
+    {"Ipatinga", -19.468330f, -42.536670f},
+    {"Cape Coast", 5.105350f, -1.246600f},
+    {"Braunschweig", 52.265940f, 10.526730f},
+    {"Kikuyu", -1.246270f, 36.662910f},
+    {"Wanning", 18.799310f, 110.384100f},
+    {"Petaẖ Tiqva", 32.087070f, 34.887470f},
+    {"North Shore", -36.800000f, 174.750000f},
+    {"Ploieşti", 44.950000f, 26.016670f},
+    {"Bachuan", 29.848630f, 106.050460f},
+    {"Pskov", 57.814040f, 28.344930f},
+    {"Maceió", -9.665830f, -35.735280f},
+    {"Thủ Đức", 10.848630f, 106.772090f},
+    {"Krasnogvargeisky", 59.973050f, 30.476070f},
+    {"Jaboatão dos Guararapes", -8.112780f, -35.014720f},
+    {"Caucaia", -3.736110f, -38.653060f},
+    {"Severnyy", 55.935830f, 37.548890f},
+    {"Machala", -3.258610f, -79.960530f},
+    {"Lublin", 51.250000f, 22.566670f},
+    {"Rui'an", 27.776050f, 120.658590f},
+    {"Bologna", 44.493810f, 11.338750f},
+    {"Erode", 11.342800f, 77.727410f},
+    {"Leipzig", 51.339620f, 12.371290f},
+    {"Geita", -2.872500f, 32.232500f},
+    {"Rạch Giá", 10.012450f, 105.080910f},
+    {"Dazhou", 31.210600f, 107.463080f},
+    {"Vinnytsya", 49.232200f, 28.468710f},
+    {"Brazzaville", -4.266130f, 15.283180f},
+    {"Floridablanca", 7.062220f, -73.086440f},
+    {"Nice", 43.703130f, 7.266080f},
+    {"Daejeon", 36.349130f, 127.384930f},
+    {"Cleveland", 41.499500f, -81.695410f},
+    {"Daegu", 35.870280f, 128.591110f},
+    {"Jessore", 23.169710f, 89.213710f},
+    {"Salamanca", 20.571960f, -101.191540f},
+    {"Thiruvananthapuram", 8.485500f, 76.949240f},
+    {"Palu", -0.908330f, 119.870830f},
+    {"Thessaloníki", 40.643610f, 22.930860f},
+    {"Niš", 43.324720f, 21.903330f},
+    {"Wrocław", 51.100000f, 17.033330f},
+    {"Tuen Mun", 22.391750f, 113.971570f},
+    {"Misratah", 32.375350f, 15.092540f},
+    {"Kibaha", -6.766670f, 38.916670f},
+    {"Kasugai", 35.247620f, 136.972290f},
+    {"Tver", 56.858360f, 35.900570f},
+    {"Bandar Abbas", 27.186500f, 56.280800f},
+    {"Kakogawachō-honmachi", 34.769430f, 134.829050f},
+    {"Belém", -1.455830f, -48.504440f},
+    {"Yongkang", 23.024440f, 120.255560f},
+    {"Dombivli", 19.216670f, 73.083330f},
+    {"Aguascalientes", 21.882340f, -102.282590f},
+    {"Diepsloot", -25.933120f, 28.012130f},
+    {"Sasebo", 33.168340f, 129.725020f},
+    {"Banan", 29.378610f, 106.540000f},
+    {"Wuxue", 29.850580f, 115.552500f},
+    {"Sahiwal", 30.665950f, 73.101860f},
+    {"Jeju City", 33.509720f, 126.521940f},
+    {"Kielce", 50.870330f, 20.627520f},
+    {"Takasaki", 36.333330f, 139.016670f},
+    {"Hortolândia", -22.858330f, -47.220000f},
+    {"Chitato", -7.300000f, 20.733330f},
+    {"Dali", 25.584740f, 100.212290f},
+    {"Quận Sáu", 10.746800f, 106.649030f},
+    {"San Lorenzo", -25.339680f, -57.508790f},
+    {"Neue Neustadt", 52.150000f, 11.633330f},
+    {"Barueri", -23.510560f, -46.876110f},
+    {"Austin", 30.267150f, -97.743060f},
+    {"Asunción", -25.286460f, -57.647000f},
+    {"Buenaventura", 3.583330f, -77.000000f},
+    {"Mulugu", 18.191000f, 79.943000f},
+    {"Haeju", 38.040560f, 125.714720f},
+    {"Tacoma", 47.252880f, -122.444290f},
+    {"Korhogo", 9.458030f, -5.629610f},
+    {"Rāmgundam", 18.800840f, 79.452060f},
+    {"Sejong", 36.592450f, 127.292230f},
+    {"Ipoh", 4.584100f, 101.082900f},
+    {"Baghdad", 33.340580f, 44.400880f},
+    {"Polokwane", -23.904490f, 29.468850f},
+    {"Heze", 35.239290f, 115.473580f},
+    {"Bahir Dar", 11.593640f, 37.390770f},
+    {"Medan", 3.583330f, 98.666670f},
+    {"Erbil", 36.191170f, 44.009430f},
+    {"Jiaozuo", 35.239720f, 113.233060f},
+    {"Ulyanovsk", 54.328240f, 48.386570f},
+    {"Aleppo", 36.201240f, 37.161170f},
+    {"Ahvaz", 31.319010f, 48.684200f},
+    {"Vilnius", 54.689160f, 25.279800f},
+    {"Mbandaka", 0.048650f, 18.260340f},
+    {"Plano", 33.019840f, -96.698890f},
+    {"Owerri", 5.483630f, 7.033250f},
+    {"Cali", 3.437220f, -76.522500f},
+    {"Zhoukou", 33.633330f, 114.633330f},
+    {"Atyrau", 47.116670f, 51.883330f},
+    {"Tampines Estate", 1.358060f, 103.940280f},
+    {"Contagem", -19.931670f, -44.053610f},
+    {"Sabzevar", 36.212600f, 57.681910f},
+    {"Nāgarpur", 24.057830f, 89.876960f},
+    {"Yanbu", 24.089540f, 38.061800f},
+    {"Ikeja", 6.596510f, 3.342050f},
+    {"Santiago", -33.456940f, -70.648270f},
+    {"Irapuato", 20.676750f, -101.356280f},
+    {"Dewas", 22.965850f, 76.055260f},
+    {"Bobo-Dioulasso", 11.177150f, -4.297900f},
+    {"Kanazawa", 36.600000f, 136.616670f},
+    {"Omsk", 54.992440f, 73.368590f},
+    {"Liupanshui", 26.594440f, 104.833330f},
+    {"Stoke-on-Trent", 53.004150f, -2.185380f},
+    {"Christchurch", -43.533330f, 172.633330f},
+    {"Gent", 51.050000f, 3.716670f},
+    {"Sylhet", 24.899040f, 91.871980f},
+    {"Saga", 33.233330f, 130.300000f},
+    {"Cibinong", -6.481670f, 106.854170f},
+    {"Yingtan", 28.233330f, 117.000000f},
+    {"Kalaburagi", 17.335830f, 76.837570f},
+    {"Zhongshan", 22.523060f, 113.379120f},
+    {"Suihua", 46.648140f, 126.966560f},
+    {"Shanghai", 31.222220f, 121.458060f},
+    {"Liaocheng", 36.450640f, 116.002470f},
+    {"Velikiy Novgorod", 58.521310f, 31.271040f},
+    {"Ijebu Ode", 6.819440f, 3.917310f},
+    {"Bābol", 36.551020f, 52.678600f},
+    {"Modesto", 37.639100f, -120.996880f},
+    {"Mokpo", 34.812820f, 126.391810f},
+    {"Athens", 37.983760f, 23.727840f},
+    {"Lal Bahadur Nagar", 17.347690f, 78.557570f},
+    {"Jinan", 36.668330f, 116.997220f},
+    {"Tete", -16.156390f, 33.586670f},
+    {"Weihai", 37.509140f, 122.113560f},
+    {"Barcelona", 41.388790f, 2.158990f},
+    {"Kobe", 34.691300f, 135.183000f},
+    {"Yantai", 37.476490f, 121.440810f},
+    {"Newark", 40.735660f, -74.172370f},
+    {"Zhaoqing", 23.048930f, 112.460910f},
+    {"Orūmīyeh", 37.552740f, 45.076050f},
+    {"Yaoundé", 3.866670f, 11.516670f},
+    {"Agartala", 23.836050f, 91.279390f},
+    {"Cobán", 15.470830f, -90.370830f},
+    {"Sukabumi", -6.918060f, 106.926670f},
+    {"Skopje", 41.996460f, 21.431410f},
+    {"Presidente Prudente", -22.125560f, -51.388890f},
+    {"Formosa", -26.184890f, -58.173130f},
+    {"Banjar", -7.195500f, 107.431300f},
+    {"Santa Clara", 22.406940f, -79.964720f},
+    {"Tarsus", 36.917660f, 34.892770f},
+    {"Guantánamo", 20.144440f, -75.209170f},
+    {"Pucallpa", -8.379150f, -74.553870f},
+    {"Uyo", 5.051270f, 7.933500f},
+    {"Lima", -12.043180f, -77.028240f},
+    {"Chāpra", 25.780310f, 84.747090f},
+    {"Maracaibo", 10.666630f, -71.612450f},
+    {"Xiaogan", 30.926890f, 113.922210f},
+    {"Manisa", 38.612020f, 27.426470f},
+    {"Lusaka", -15.406690f, 28.287130f},
+    {"Chengdu", 30.666670f, 104.066670f},
+    {"Vladivostok", 43.105620f, 131.873530f},
+    {"Bhayandar", 19.301570f, 72.851070f},
+    {"Āvadi", 13.114700f, 80.109810f},
+    {"Kuala Lumpur", 3.141200f, 101.686530f},
+    {"Chennai", 13.087840f, 80.278470f},
+    {"Thiès Nones", 14.783330f, -16.966670f},
+    {"Angarsk", 52.536670f, 103.886390f},
+    {"Kota Kuala Muda", 5.588220f, 100.370850f},
+    {"Voronezh", 51.672040f, 39.184300f},
+    {"Ufa", 54.743060f, 55.967790f},
+    {"Coyoacán", 19.346700f, -99.161740f},
+    {"Santiago de Cuba", 20.020830f, -75.826670f},
+    {"Bobruysk", 53.146360f, 29.205520f},
+    {"Antwerpen", 51.220470f, 4.400260f},
+    {"Karol Bāgh", 28.651360f, 77.190720f},
+    {"Tai Po", 22.450070f, 114.168770f},
+    {"Belford Roxo", -22.764170f, -43.399440f},
+    {"Sevilla", 37.382830f, -5.973170f},
+    {"Gonder", 12.600000f, 37.466670f},
+    {"Chiba", 35.600000f, 140.116670f},
+    {"Bukit Rahman Putra", 3.217270f, 101.560800f},
+    {"Iwo", 7.635270f, 4.181560f},
+    {"Armenia", 4.533890f, -75.681110f},
+    {"Delhi", 28.651950f, 77.231490f},
+    {"New South Memphis", 35.086760f, -90.056760f},
+    {"Az Zāwīyah", 32.757100f, 12.727640f},
+    {"Teni", 10.011150f, 77.477720f},
+    {"Korla", 41.760550f, 86.152310f},
+    {"Lexington", 37.988690f, -84.477720f},
+    {"Douala", 4.048270f, 9.704280f},
+    {"Syktyvkar", 61.685230f, 50.808190f},
+    {"Winejok", 9.012220f, 27.570810f},
+    {"Maturín", 9.745690f, -63.183230f},
+    {"Loudi", 27.734440f, 111.994440f},
+    {"E'zhou", 30.396070f, 114.886550f},
+    {"Kampala", 0.316280f, 32.582190f},
+    {"Awasa", 7.062050f, 38.476350f},
+    {"Alappuzha", 9.490040f, 76.326400f},
+    {"Rufisque est", 14.716200f, -17.272830f},
+    {"Ōtsu", 35.000000f, 135.866670f},
+    {"Aparecida de Goiânia", -16.823330f, -49.243890f},
+    {"Laredo", 27.506410f, -99.507540f},
+    {"Kampung Baru Subang", 3.150000f, 101.533330f},
+    {"Vanderbijlpark", -26.711710f, 27.837950f},
+    {"Gandhinagar", 23.216670f, 72.683330f},
+    {"Hohhot", 40.810560f, 111.652220f},
+    {"Algiers", 36.732250f, 3.087460f},
+    {"Rio Verde", -17.798060f, -50.928060f},
+    {"Lianyungang", 34.598450f, 119.215560f},
+    {"Nagaoka", 37.450000f, 138.850000f},
+    {"Esenyurt", 41.026970f, 28.677320f},
+    {"Saint Petersburg", 59.938630f, 30.314130f},
+    {"Plymouth", 50.371530f, -4.143050f},
+    {"Lekki", 6.412220f, 4.094700f},
+    {"Yongzhou", 26.423890f, 111.613060f},
+    {"Lishui", 28.460420f, 119.910290f},
+    {"Sekondi", 4.934220f, -1.714540f},
+    {"Granada", 37.188170f, -3.606670f},
+    {"Arāk", 34.094930f, 49.698090f},
+    {"Kyoto", 35.021070f, 135.753850f},
+    {"Mirzāpur", 25.144900f, 82.565340f},
+    {"Khamis Mushait", 18.300000f, 42.733330f},
+    {"Kayseri", 38.732220f, 35.485280f},
+    {"Gagnoa", 6.131930f, -5.950600f},
+    {"Toledo", 41.663940f, -83.555210f},
+    {"Mdantsane", -32.933240f, 27.776560f},
+    {"Rasht", 37.276110f, 49.588620f},
+    {"Djibouti", 11.589010f, 43.145030f},
+    {"Tacloban", 11.243330f, 125.004720f},
+    {"Mazār-e Sharīf", 36.709040f, 67.110870f},
+    {"Lichinga", -13.312780f, 35.240560f},
+    {"Osmaniye", 37.074170f, 36.247780f},
+    {"Arkhangel'sk", 64.547170f, 40.552910f},
+    {"Muratpaşa", 36.891570f, 30.764980f},
+    {"Lubbock", 33.577860f, -101.855170f},
+    {"Pingdu", 36.784440f, 119.946390f},
+    {"Beihai", 21.483490f, 109.115490f},
+    {"Takoradi", 4.898160f, -1.760290f},
+    {"Shah Alam", 3.085070f, 101.532810f},
+    {"Turin", 45.070490f, 7.686820f},
+    {"Bucaramanga", 7.125390f, -73.119800f},
+    {"Alexandria", 31.201760f, 29.915820f},
+    {"Ibaraki", 34.816410f, 135.568280f},
+    {"Pasir Mas", 6.049340f, 102.139870f},
+    {"Yao", 34.616670f, 135.600000f},
+    {"Nizhnevartovsk", 60.934400f, 76.553100f},
+    {"Yangsan", 35.341990f, 129.033580f},
+    {"Sialkot", 32.492680f, 74.531340f},
+    {"Abuja", 9.057850f, 7.495080f},
+    {"Bradford", 53.793910f, -1.752060f},
+    {"Karnāl", 29.691970f, 76.984480f},
+    {"Tangier", 35.767270f, -5.799750f},
+    {"Latacunga", -0.935210f, -78.615540f},
+    {"Maltepe", 40.935670f, 29.155070f},
+    {"Fresno", 36.747730f, -119.772370f},
+    {"Barnaul", 53.360560f, 83.763610f},
+    {"Nāngloi Jāt", 28.679570f, 77.067990f},
+    {"Neuquén", -38.951610f, -68.059100f},
+    {"Ciudad Lineal", 40.445050f, -3.651320f},
+    {"Sonīpat", 28.994780f, 77.019370f},
+    {"Abidjan", 5.354440f, -4.001670f},
+    {"Heshan", 28.569380f, 112.347330f},
+    {"Foz do Iguaçu", -25.547780f, -54.588060f},
+    {"Resistencia", -27.460560f, -58.983890f},
+    {"Ichalkaranji", 16.691170f, 74.460540f},
+    {"Jingling", 30.650000f, 113.100000f},
+    {"Navotas", 14.666670f, 120.950000f},
+    {"Wong Tai Sin", 22.350000f, 114.183330f},
+    {"Sydney", -33.867850f, 151.207320f},
+    {"Greater Noida", 28.496150f, 77.536010f},
+    {"Tasikmalaya", -7.327400f, 108.220700f},
+    {"Loja", -3.993130f, -79.204220f},
+    {"Nashik", 19.997270f, 73.790960f},
+    {"Ulu Bedok", 1.333330f, 103.933330f},
+    {"Munger", 25.374590f, 86.474550f},
+    {"Adana", 36.986150f, 35.325310f},
+    {"Padova", 45.407970f, 11.885860f},
+    {"Deyang", 31.130190f, 104.381980f},
+    {"Uberlândia", -18.918610f, -48.277220f},
+    {"Amman", 31.955220f, 35.945030f},
+    {"Essen", 51.456570f, 7.012280f},
+    {"Seremban", 2.729700f, 101.938100f},
+    {"Lianshan", 40.764320f, 120.853270f},
+    {"Belgorod", 50.610740f, 36.580150f},
+    {"Bhimber", 32.974650f, 74.078460f},
+    {"Sevastopol", 44.607950f, 33.521340f},
+    {"Tuxtla", 16.759730f, -93.113080f},
+    {"Calabar", 4.958930f, 8.326950f},
+    {"Xinyu", 27.804290f, 114.933350f},
+    {"Cidade Ademar", -23.673790f, -46.656810f},
+    {"Lyon", 45.748460f, 4.846710f},
+    {"Xico", 19.270320f, -98.950880f},
+    {"Dasmariñas", 14.329440f, 120.936670f},
+    {"Afyonkarahisar", 38.756670f, 30.543330f},
+    {"Cusco", -13.522640f, -71.967340f},
+    {"Xuchang", 34.031890f, 113.862990f},
+    {"Changle", 36.705830f, 118.827500f},
+    {"Esenler", 41.043500f, 28.876190f},
+    {"Zagreb", 45.814440f, 15.977980f},
+    {"Samara", 53.200070f, 50.150000f},
+    {"Taman Petaling", 3.199160f, 101.649830f},
+    {"Qui Nhon", 13.776480f, 109.223670f},
+    {"Horlivka", 48.335760f, 38.053250f},
+    {"Hezhou", 24.403570f, 111.566750f},
+    {"Maracay", 10.235350f, -67.591130f},
+    {"Kathmandu", 27.701690f, 85.320600f},
+    {"Xinzhou", 38.409170f, 112.733330f},
+    {"Varna", 43.216670f, 27.916670f},
+    {"Porto-Novo", 6.496460f, 2.603590f},
+    {"Santos", -23.960830f, -46.333610f},
+    {"Limeira", -22.564720f, -47.401670f},
+    {"Pamplona", 42.816870f, -1.643230f},
+    {"Bitung", 1.440590f, 125.128240f},
+    {"Yuci", 37.680280f, 112.731940f},
+    {"Ordu", 40.977820f, 37.890470f},
+    {"Tampines New Town", 1.349170f, 103.949720f},
+    {"Ibb", 13.966670f, 44.183330f},
+    {"Novorossiysk", 44.731880f, 37.761760f},
+    {"Valladolid", 41.655180f, -4.723720f},
+    {"Dihok", 36.867090f, 42.988450f},
+    {"Jammu", 32.735280f, 74.861670f},
+    {"Yangzhou", 32.397220f, 119.435830f},
+    {"Victoria de Durango", 24.020320f, -104.657560f},
+    {"Kure", 34.232220f, 132.566580f},
+    {"Cixi", 30.176400f, 121.245700f},
+    {"Tirunelveli", 8.727420f, 77.683800f},
+    {"Qom", 34.640100f, 50.876400f},
+    {"Lijiang", 26.868790f, 100.220720f},
+    {"Etāwah", 26.776150f, 79.021330f},
+    {"Zigong", 29.341620f, 104.776890f},
+    {"Mariupol", 47.095140f, 37.541310f},
+    {"Juliaca", -15.500000f, -70.133330f},
+    {"Parbhani", 19.268550f, 76.770810f},
+    {"Hanzhong", 33.075070f, 107.022140f},
+    {"Wichita", 37.692240f, -97.337540f},
+    {"Dallas", 32.783060f, -96.806670f},
+    {"Chongzuo", 22.381610f, 107.368300f},
+    {"Windsor", 42.300080f, -83.016540f},
+    {"Malatya", 38.350180f, 38.316670f},
+    {"Dublin", 53.333060f, -6.248890f},
+    {"Isfara", 40.126490f, 70.625260f},
+    {"Volgograd", 48.719390f, 44.501830f},
+    {"Maheshtala", 22.508620f, 88.253220f},
+    {"Oran", 35.699060f, -0.635880f},
+    {"East Jerusalem", 31.783360f, 35.233880f},
+    {"Latakia", 35.531680f, 35.790110f},
+    {"Bayamón", 18.398560f, -66.155720f},
+    {"Ribeirão das Neves", -19.766940f, -44.086670f},
+    {"Vadodara", 22.299410f, 73.208120f},
+    {"Yogyakarta", -7.801390f, 110.364720f},
+    {"Quevedo", -1.028810f, -79.462640f},
+    {"6th of October City", 29.816670f, 31.050000f},
+    {"Diadema", -23.686110f, -46.622780f},
+    {"San Diego", 32.715710f, -117.164720f},
+    {"Seeb", 23.670270f, 58.189110f},
+    {"Atlanta", 33.749000f, -84.387980f},
+    {"Al Aḩmadī", 29.076940f, 48.083890f},
+    {"Jayapura", -2.533710f, 140.718130f},
+    {"Seattle", 47.606210f, -122.332070f},
+    {"Madison", 43.073050f, -89.401230f},
+    {"Scottsdale", 33.509210f, -111.899030f},
+    {"Wiesbaden", 50.082580f, 8.249320f},
+    {"Chicago", 41.850030f, -87.650050f},
+    {"Richards Bay", -28.783010f, 32.037680f},
+    {"Dhaka", 23.710400f, 90.407440f},
+    {"Wuxi", 31.568870f, 120.288570f},
+    {"Sousse", 35.825390f, 10.636990f},
+    {"El Daein", 11.461860f, 26.125830f},
+    {"Chernivtsi", 48.290450f, 25.932410f},
+    {"Riyadh", 24.687730f, 46.721850f},
+    {"Pontianak", -0.031940f, 109.325000f},
+    {"Toyohashi", 34.766670f, 137.383330f},
+    {"Zhoushan", 29.988690f, 122.204880f},
+    {"Xinyang", 32.122780f, 114.065560f},
+    {"Houston", 29.763280f, -95.363270f},
+    {"Dumai", 1.667110f, 101.443160f},
+    {"Situbondo", -7.706230f, 114.009760f},
+    {"San Nicolás de los Garza", 25.741670f, -100.302220f},
+    {"Langfang", 39.520790f, 116.714710f},
+    {"Henderson", 36.039700f, -114.981940f},
+    {"Mwanza", -2.516670f, 32.900000f},
+    {"Sanya", 18.254350f, 109.509470f},
+    {"Ibagué", 4.438890f, -75.232220f},
+    {"Zhangye", 38.934170f, 100.451670f},
+    {"Quthbullapur", 17.501070f, 78.458180f},
+    {"Novi Sad", 45.251670f, 19.836940f},
+    {"San Francisco", 37.774930f, -122.419420f},
+    {"Hualien City", 23.976940f, 121.604440f},
+    {"Kwai Chung", 22.368280f, 114.138770f},
+    {"Ugep", 5.808650f, 8.080980f},
+    {"Durgapur", 23.515830f, 87.308010f},
+    {"Lincoln", 40.800000f, -96.666960f},
+    {"Mahilyow", 53.916800f, 30.344900f},
+    {"Monclova", 26.906870f, -101.420560f},
+    {"Kendari", -3.977800f, 122.515070f},
+    {"Paris", 48.853410f, 2.348800f},
+    {"Calamba", 14.211670f, 121.165280f},
+    {"Camayenne", 9.535000f, -13.687780f},
+    {"Cheongju-si", 36.637220f, 127.489720f},
+    {"Darbhanga", 26.152160f, 85.897070f},
+    {"Zhumadian", 32.979440f, 114.029440f},
+    {"Khmelnytskyi", 49.418350f, 26.979360f},
+    {"Iloilo", 10.696940f, 122.564440f},
+    {"Tanjung Pinang", 0.916670f, 104.458330f},
+    {"Kampung Larkin Lama", 1.502400f, 103.744000f},
+    {"Barishal", 22.704970f, 90.370130f},
+    {"Mymensingh", 24.756360f, 90.406460f},
+    {"Zanzibar", -6.163940f, 39.197930f},
+    {"Catania", 37.492230f, 15.070410f},
+    {"Rājshāhi", 24.374000f, 88.601140f},
+    {"Uíge", -7.608740f, 15.061310f},
+    {"Mainz", 49.984190f, 8.279100f},
+    {"Al Başrah al Qadīmah", 30.503160f, 47.815070f},
+    {"Mianyang", 31.467840f, 104.681680f},
+    {"Moshi", -3.350000f, 37.333330f},
+    {"Pallabi", 23.825000f, 90.370000f},
+    {"Nagpur", 21.146310f, 79.084910f},
+    {"Guarulhos", -23.462780f, -46.533330f},
+    {"Stuttgart", 48.782320f, 9.177020f},
+    {"Guatire", 10.474000f, -66.542410f},
+    {"Yoshkar-Ola", 56.638770f, 47.890780f},
+    {"Sariwŏn-si", 38.507220f, 125.755830f},
+    {"Mirpur Model Thana", 23.809310f, 90.360930f},
+    {"Suez", 29.973710f, 32.526270f},
+    {"Singa", 13.148300f, 33.931170f},
+    {"Ajman City", 25.401770f, 55.478780f},
+    {"Fes", 34.033130f, -5.000280f},
+    {"Zhangjiagang", 31.865000f, 120.538890f},
+    {"Ratlām", 23.330330f, 75.040320f},
+    {"Mohammedia", 33.686070f, -7.382980f},
+    {"Rahim Yar Khan", 28.419870f, 70.303450f},
+    {"Genoa", 44.404780f, 8.944390f},
+    {"Mwene", -9.816970f, 22.870230f},
+    {"Man'gyŏngdae-ri", 38.991820f, 125.658710f},
+    {"Ziguinchor", 12.568010f, -16.273260f},
+    {"Bida", 9.080440f, 6.009900f},
+    {"Cairo", 30.062630f, 31.249670f},
+    {"Kingston upon Hull", 53.744600f, -0.335250f},
+    {"Baise", 23.890130f, 106.626840f},
+    {"San Jose", 37.339390f, -121.894960f},
+    {"Santa Marta", 11.240790f, -74.199040f},
+    {"Bilbao", 43.262710f, -2.925280f},
+    {"Dĩ An", 10.906820f, 106.769400f},
+    {"Evaton", -26.533330f, 27.850000f},
+    {"Hulan Ergi", 47.204170f, 123.633330f},
+    {"Lübeck", 53.868930f, 10.687290f},
+    {"Bnei Brak", 32.080740f, 34.833800f},
+    {"Lanzhou", 36.057010f, 103.839870f},
+    {"Puerto Vallarta", 20.617000f, -105.230180f},
+    {"Neijiang", 29.583540f, 105.062160f},
+    {"Shivaji Nagar", 18.530170f, 73.852630f},
+    {"Ponta Grossa", -25.095000f, -50.161940f},
+    {"Nassau", 25.058230f, -77.343060f},
+    {"Abadan", 30.339200f, 48.304300f},
+    {"Daliang", 22.840670f, 113.250300f},
+    {"Caxias do Sul", -29.168060f, -51.179440f},
+    {"Alimosho", 6.606560f, 3.302350f},
+    {"Norfolk", 36.846810f, -76.285220f},
+    {"Būkān", 36.521000f, 46.208900f},
+    {"Markham", 43.866820f, -79.266300f},
+    {"Canberra", -35.283460f, 149.128070f},
+    {"Al Qadarif", 14.034930f, 35.383440f},
+    {"Karamay", 45.584730f, 84.887240f},
+    {"Salatiga", -7.331940f, 110.492780f},
+    {"Mérida", 20.975370f, -89.616960f},
+    {"Paramaribo", 5.866380f, -55.166820f},
+    {"Zanjan", 36.676420f, 48.496280f},
+    {"Pasay", 14.537480f, 121.001440f},
+    {"Portland", 45.523450f, -122.676210f},
+    {"Dhanbad", 23.797590f, 86.429920f},
+    {"Zhenjiang", 32.210860f, 119.455080f},
+    {"Thāne", 19.197040f, 72.963550f},
+    {"Bedok New Town", 1.326390f, 103.941670f},
+    {"New Taipei City", 25.061990f, 121.457030f},
+    {"Khomeynī Shahr", 32.685600f, 51.536090f},
+    {"Blantyre", -15.784990f, 35.008540f},
+    {"Volzhsky", 48.785830f, 44.779730f},
+    {"Ar Rayyān", 25.291940f, 51.424440f},
+    {"Kosti", 13.162900f, 32.663470f},
+    {"Namangan", 40.998300f, 71.672570f},
+    {"Fuxin", 42.015560f, 121.658890f},
+    {"Tunis", 36.818970f, 10.165790f},
+    {"London", 51.508530f, -0.125740f},
+    {"Yintai", 35.115240f, 109.097020f},
+    {"Hamadān", 34.799220f, 48.514560f},
+    {"Conakry", 9.537950f, -13.677290f},
+    {"Nova Iguaçu", -22.759170f, -43.451110f},
+    {"Gujrat", 32.574200f, 74.075420f},
+    {"Viamão", -30.081110f, -51.023330f},
+    {"Göteborg", 57.707160f, 11.966790f},
+    {"Luena", -11.783330f, 19.916670f},
+    {"Touba", 14.850000f, -15.883330f},
+    {"Braşov", 45.648610f, 25.606130f},
+    {"Gdynia", 54.518890f, 18.531880f},
+    {"Imphāl", 24.808050f, 93.944200f},
+    {"Podgorica", 42.441110f, 19.263610f},
+    {"San Bernardo", -33.592170f, -70.699600f},
+    {"Imus", 14.429720f, 120.936670f},
+    {"Brooklyn", 40.650100f, -73.949580f},
+    {"Ikire", 7.369830f, 4.186300f},
+    {"Karlsruhe", 49.009370f, 8.404440f},
+    {"Beirut", 33.893320f, 35.501570f},
+    {"Dodoma", -6.172210f, 35.739470f},
+    {"Mueang Nonthaburi", 13.860750f, 100.514770f},
+    {"Shaoguan", 24.800000f, 113.583330f},
+    {"Prokop'yevsk", 53.905900f, 86.719000f},
+    {"Ciudad Apodaca", 25.781950f, -100.188390f},
+    {"Ho Chi Minh City", 10.823020f, 106.629650f},
+    {"Pretoria", -25.744860f, 28.187830f},
+    {"Kherson", 46.636950f, 32.614580f},
+    {"Kaesŏng", 37.970830f, 126.554440f},
+    {"Mannheim", 49.489100f, 8.466940f},
+    {"Farrukhābād", 27.391340f, 79.579300f},
+    {"Antofagasta", -23.652360f, -70.395400f},
+    {"San Miguelito", 9.050320f, -79.470680f},
+    {"Bouaké", 7.693850f, -5.030310f},
+    {"Fuling", 29.709970f, 107.393910f},
+    {"Fianarantsoa", -21.452670f, 47.085690f},
+    {"Gumi", 36.113600f, 128.336000f},
+    {"Changam-ch'on", 40.606110f, 128.781940f},
+    {"Jamaica", 40.691490f, -73.805690f},
+    {"Sumy", 50.921600f, 34.800290f},
+    {"Chigasaki", 35.336380f, 139.404340f},
+    {"Yamoussoukro", 6.820550f, -5.276740f},
+    {"Sector 4", 44.375710f, 26.120850f},
+    {"Pristina", 42.672720f, 21.166880f},
+    {"Plovdiv", 42.150000f, 24.750000f},
+    {"Sambhaji Nagar", 19.877570f, 75.342260f},
+    {"Izhevsk", 56.849760f, 53.204480f},
+    {"San-Pédro", 4.748510f, -6.636300f},
+    {"Blagoveshchensk", 50.279610f, 127.540500f},
+    {"Dzerzhinsk", 56.244220f, 43.455430f},
+    {"Kasur", 31.118660f, 74.450250f},
+    {"Quanzhou", 24.913890f, 118.585830f},
+    {"Almendares", 23.110120f, -82.423220f},
+    {"Chinju", 35.192780f, 128.084720f},
+    {"Kuala Terengganu", 5.330200f, 103.140800f},
+    {"Tlalnepantla", 19.540050f, -99.195380f},
+    {"Virginia Beach", 36.852930f, -75.977990f},
+    {"Álvaro Obregón", 19.358670f, -99.203290f},
+    {"Dengzhou", 32.682220f, 112.081940f},
+    {"Puducherry", 11.933810f, 79.829790f},
+    {"Jerez de la Frontera", 36.686450f, -6.136060f},
+    {"Thiès", 14.789440f, -16.926020f},
+    {"Detroit", 42.331430f, -83.045750f},
+    {"Assiut", 27.180960f, 31.183680f},
+    {"Shekhupura", 31.712870f, 73.985560f},
+    {"Longshan", 42.885450f, 125.136700f},
+    {"Curitiba", -25.427780f, -49.273060f},
+    {"Ankara", 39.919870f, 32.854270f},
+    {"Hamilton", 43.250110f, -79.849630f},
+    {"Chengzhong", 30.944540f, 113.552840f},
+    {"Johannesburg", -26.202270f, 28.043630f},
+    {"Maputo", -25.965530f, 32.583220f},
+    {"Ciudad Nezahualcoyotl", 19.400610f, -99.014830f},
+    {"Bahçelievler", 41.002310f, 28.859800f},
+    {"Tsuen Wan", 22.371370f, 114.113290f},
+    {"Bremen", 53.075820f, 8.807170f},
+    {"Kyengera", 0.295170f, 32.501590f},
+    {"Weinan", 34.503550f, 109.508910f},
+    {"Lucknow", 26.839280f, 80.923130f},
+    {"Gdańsk", 54.352270f, 18.649120f},
+    {"Trabzon", 41.005000f, 39.726940f},
+    {"Jiaojiang", 28.698440f, 121.473310f},
+    {"Belo Horizonte", -19.920830f, -43.937780f},
+    {"Wŏnju", 37.351390f, 127.945280f},
+    {"N'Djamena", 12.106720f, 15.044400f},
+    {"Mukim Pulai", 1.533330f, 103.666670f},
+    {"Yixing", 31.360590f, 119.820160f},
+    {"Nogales", 31.308620f, -110.942170f},
+    {"Bunia", 1.559410f, 30.252240f},
+    {"Kota Bharu", 6.123610f, 102.243330f},
+    {"Großzschocher", 51.301470f, 12.323220f},
+    {"Karabağlar", 38.373960f, 27.135200f},
+    {"Songea", -10.683330f, 35.650000f},
+    {"Taiyuan", 37.869440f, 112.560280f},
+    {"Golestān", 35.518300f, 51.181900f},
+    {"Shenyang", 41.792220f, 123.432780f},
+    {"Matola", -25.962220f, 32.458890f},
+    {"Nalchik", 43.498060f, 43.618890f},
+    {"Bogotá", 4.609710f, -74.081750f},
+    {"Copenhagen", 55.675940f, 12.565530f},
+    {"Ljubljana", 46.051080f, 14.505130f},
+    {"Venustiano Carranza", 19.443610f, -99.104990f},
+    {"Tel Aviv", 32.080880f, 34.780570f},
+    {"Moreno Valley", 33.937520f, -117.230590f},
+    {"Al Hoceïma", 35.251650f, -3.937230f},
+    {"Las Palmas de Gran Canaria", 28.099730f, -15.413430f},
+    {"Okene", 7.551220f, 6.235890f},
+    {"Diez de Octubre", 23.088100f, -82.359700f},
+    {"Havana", 23.133020f, -82.383040f},
+    {"Guilin", 25.280220f, 110.296390f},
+    {"Kashgar", 39.470660f, 75.989510f},
+    {"Jiamusi", 46.797110f, 130.311180f},
+    {"Andijon", 40.782060f, 72.344240f},
+    {"Rohtak", 28.894470f, 76.589170f},
+    {"Budapest", 47.498350f, 19.040450f},
+    {"Hechi", 24.692850f, 108.083760f},
+    {"Jacareí", -23.305280f, -45.965830f},
+    {"Qazvin", 36.268770f, 50.004100f},
+    {"São João de Meriti", -22.803890f, -43.372220f},
+    {"Xochimilco", 19.254650f, -99.103560f},
+    {"Damietta", 31.416480f, 31.813320f},
+    {"Minato", 34.215200f, 135.150100f},
+    {"Kunshan", 31.377620f, 120.954310f},
+    {"Sete Lagoas", -19.465830f, -44.246670f},
+    {"Nasiriyah", 31.057990f, 46.257260f},
+    {"Jardim Angela", -23.716360f, -46.768720f},
+    {"Aksu", 41.184180f, 80.279210f},
+    {"Astana", 51.180100f, 71.445980f},
+    {"Dakar", 14.693700f, -17.444060f},
+    {"Akure", 7.252560f, 5.193120f},
+    {"Coventry", 52.406560f, -1.512170f},
+    {"Zibo", 36.790560f, 118.063330f},
+    {"Nagareyama", 35.856300f, 139.902660f},
+    {"Noida", 28.580000f, 77.330000f},
+    {"Nowrangapur", 19.231140f, 82.548260f},
+    {"Foshan", 23.026770f, 113.131480f},
+    {"Fayetteville", 35.052660f, -78.878360f},
+    {"Taraz", 42.900000f, 71.366670f},
+    {"Winston-Salem", 36.099860f, -80.244220f},
+    {"Irbid", 32.555560f, 35.850000f},
+    {"Pelentong", 1.524300f, 103.824000f},
+    {"Enshi", 30.300000f, 109.483330f},
+    {"Arlington", 32.735690f, -97.108070f},
+    {"Beibei", 29.827390f, 106.436450f},
+    {"Batam", 1.149370f, 104.024910f},
+    {"Mawlamyine", 16.490510f, 97.628250f},
+    {"Nha Trang", 12.245070f, 109.194320f},
+    {"Arica", -18.474600f, -70.297920f},
+    {"Chiayi City", 23.479170f, 120.448890f},
+    {"Wolverhampton", 52.585470f, -2.122960f},
+    {"Zhangjiajie", 29.129440f, 110.478330f},
+    {"Sharjah", 25.337370f, 55.412060f},
+    {"Çankaya", 39.917900f, 32.862680f},
+    {"Taubaté", -23.026390f, -45.555280f},
+    {"Quilmes", -34.720650f, -58.254540f},
+    {"Surabaya", -7.249170f, 112.750830f},
+    {"Indore", 22.717920f, 75.833300f},
+    {"Marrakesh", 31.634160f, -7.999940f},
+    {"Riobamba", -1.670980f, -78.647120f},
+    {"Benguela", -12.576740f, 13.402680f},
+    {"Nagasaki", 32.750000f, 129.883330f},
+    {"Iseyin", 7.970220f, 3.596260f},
+    {"Changsha", 28.198740f, 112.970870f},
+    {"Guédiawaye", 14.774460f, -17.402120f},
+    {"Santa Fe", -31.648810f, -60.708680f},
+    {"Tampico", 22.285190f, -97.877770f},
+    {"Kaech'ŏn", 39.700560f, 125.893330f},
+    {"Kamina", -8.735080f, 24.997980f},
+    {"Gaozhou", 21.919650f, 110.856780f},
+    {"Neyagawa", 34.766150f, 135.627590f},
+    {"Vykhino-Zhulebino", 55.701960f, 37.811780f},
+    {"Nürnberg", 49.454210f, 11.077520f},
+    {"Cascavel", -24.955830f, -53.455280f},
+    {"Reynosa", 26.080610f, -98.288350f},
+    {"Rawalpindi", 33.597330f, 73.047900f},
+    {"Magnitogorsk", 53.418610f, 59.047220f},
+    {"Guang'an", 30.474130f, 106.636960f},
+    {"Baton Rouge", 30.443320f, -91.187470f},
+    {"Korba", 22.345800f, 82.696330f},
+    {"Kisangani", 0.515280f, 25.190990f},
+    {"Oujda", 34.681390f, -1.908580f},
+    {"Anqing", 30.513650f, 117.047230f},
+    {"Piura", -5.194490f, -80.632820f},
+    {"Bishan", 29.594910f, 106.224760f},
+    {"Huayin", 34.565280f, 110.066390f},
+    {"Archway", 51.567330f, -0.134150f},
+    {"Nuevo Laredo", 27.476290f, -99.516390f},
+    {"Katihar", 25.538520f, 87.570440f},
+    {"Serra", -20.128610f, -40.307780f},
+    {"Çorlu", 41.160690f, 27.800930f},
+    {"Hechuan", 29.992280f, 106.264610f},
+    {"Bareilly", 28.366780f, 79.431670f},
+    {"Nizhniy Novgorod", 56.328670f, 44.002050f},
+    {"Bloemfontein", -29.121070f, 26.214000f},
+    {"Belgrade", 44.804010f, 20.465130f},
+    {"Khulna", 22.809790f, 89.564390f},
+    {"Man", 7.412510f, -7.553830f},
+    {"Arroyo Naranjo", 23.038110f, -82.377030f},
+    {"Makati City", 14.550270f, 121.032690f},
+    {"Cirebon", -6.706300f, 108.557000f},
+    {"Utrecht", 52.090830f, 5.122220f},
+    {"New Delhi", 28.621370f, 77.214800f},
+    {"Gangānagar", 29.920090f, 73.874960f},
+    {"Ichikawa", 35.734130f, 139.906500f},
+    {"Macapá", 0.038890f, -51.066390f},
+    {"Louisville", 38.254240f, -85.759410f},
+    {"Chaozhou", 23.653960f, 116.622620f},
+    {"Goyang-si", 37.656390f, 126.835000f},
+    {"Mubi", 10.268580f, 13.267010f},
+    {"Caloocan City", 14.649530f, 120.967880f},
+    {"Marikina City", 14.648100f, 121.113300f},
+    {"Vienna", 48.208490f, 16.372080f},
+    {"Sumaré", -22.821940f, -47.266940f},
+    {"Petare", 10.476790f, -66.807860f},
+    {"Jiayuguan", 39.811210f, 98.286180f},
+    {"Ivano-Frankivsk", 48.923120f, 24.712480f},
+    {"Rengasdengklok", -6.159170f, 107.298060f},
+    {"Irkutsk", 52.297780f, 104.296390f},
+    {"Al Kharj", 24.155410f, 47.334570f},
+    {"Guli", 28.881620f, 120.033080f},
+    {"Huanggang", 30.451430f, 114.870350f},
+    {"Vereeniging", -26.673130f, 27.926150f},
+    {"Kumamoto", 32.805890f, 130.691810f},
+    {"Ankang", 32.680000f, 109.017220f},
+    {"Bucheon-si", 37.498890f, 126.783060f},
+    {"Campinas", -22.905560f, -47.060830f},
+    {"Pasir Gudang", 1.462000f, 103.905300f},
+    {"Ra's Bayrūt", 33.900000f, 35.483330f},
+    {"Lutsk", 50.759320f, 25.342440f},
+    {"Lahore", 31.558000f, 74.350710f},
+    {"La Pintana", -33.583310f, -70.634190f},
+    {"Agra", 27.183330f, 78.016670f},
+    {"Cabinda", -5.567170f, 12.197870f},
+    {"Delmas", 18.544780f, -72.300360f},
+    {"Pietermaritzburg", -29.616790f, 30.392780f},
+    {"Pizhou", 34.311390f, 117.950280f},
+    {"Godomè", 6.389480f, 2.345810f},
+    {"Bauchi", 10.310320f, 9.843880f},
+    {"Borivli", 19.234960f, 72.859760f},
+    {"Temuco", -38.739650f, -72.598420f},
+    {"Khouribga", 32.881080f, -6.906300f},
+    {"Des Moines", 41.600540f, -93.609110f},
+    {"Vigo", 42.232820f, -8.722640f},
+    {"Sheffield", 53.382970f, -1.465900f},
+    {"Namp'o", 38.737500f, 125.407780f},
+    {"Bauru", -22.314720f, -49.060560f},
+    {"Eindhoven", 51.440830f, 5.477780f},
+    {"Karagandy", 49.801870f, 73.102110f},
+    {"Alwar", 27.562460f, 76.625000f},
+    {"Pikine", 14.764570f, -17.390710f},
+    {"Ondo", 7.093160f, 4.835280f},
+    {"Baoshan", 25.116260f, 99.163660f},
+    {"Benin City", 6.338150f, 5.625750f},
+    {"Dezhou", 37.446610f, 116.367060f},
+    {"Bharatpur", 27.676800f, 84.435890f},
+    {"Battagram", 34.677190f, 73.023290f},
+    {"Kahama", -3.833330f, 32.600000f},
+    {"Heihe", 50.244130f, 127.490160f},
+    {"Meishan", 30.043920f, 103.836960f},
+    {"Sarajevo", 43.848640f, 18.356440f},
+    {"Ouagadougou", 12.365660f, -1.533880f},
+    {"Zürich", 47.366670f, 8.550000f},
+    {"Thembisa", -25.996360f, 28.226800f},
+    {"Jalālābād", 34.426470f, 70.451530f},
+    {"Rufisque", 14.715420f, -17.273340f},
+    {"Mandalay", 21.974730f, 96.083590f},
+    {"Belagavi", 15.852120f, 74.504470f},
+    {"Yaroslavl", 57.629870f, 39.873680f},
+    {"Addis Ababa", 9.024970f, 38.746890f},
+    {"Tuluá", 4.084660f, -76.195360f},
+    {"Ismailia", 30.604270f, 32.272250f},
+    {"Najrān", 17.493260f, 44.127660f},
+    {"Valencia", 10.162020f, -68.007650f},
+    {"Lu'an", 31.735610f, 116.516880f},
+    {"Tamale", 9.400790f, -0.839300f},
+    {"Ooty", 11.413400f, 76.695210f},
+    {"Montes Claros", -16.735000f, -43.861670f},
+    {"Anyang-si", 37.392500f, 126.926940f},
+    {"Xinyuan", 43.426490f, 83.249590f},
+    {"Rouen", 49.443130f, 1.099320f},
+    {"Xichang", 27.896420f, 102.263410f},
+    {"Uşak", 38.673510f, 29.405800f},
+    {"Tula", 54.196090f, 37.618220f},
+    {"Masina", -4.383610f, 15.391390f},
+    {"Logan City", -27.639170f, 153.109440f},
+    {"Pathein", 16.779190f, 94.732120f},
+    {"Linz", 48.306390f, 14.286110f},
+    {"Tétouan", 35.578450f, -5.368370f},
+    {"Jos", 9.928490f, 8.892120f},
+    {"Osasco", -23.532500f, -46.791670f},
+    {"Erzurum", 39.908610f, 41.276940f},
+    {"Ensenada", 31.871490f, -116.600710f},
+    {"Laiwu", 36.192780f, 117.656940f},
+    {"Banjarmasin", -3.319870f, 114.590750f},
+    {"Soledad de Graciano Sánchez", 22.189120f, -100.937920f},
+    {"Nandyāl", 15.477990f, 78.483600f},
+    {"Luanda", -8.836820f, 13.234320f},
+    {"Kryvyy Rih", 47.905720f, 33.394040f},
+    {"Ganzhou", 25.846640f, 114.932600f},
+    {"Iztapalapa", 19.355290f, -99.062240f},
+    {"Málaga", 36.720160f, -4.420340f},
+    {"Patiāla", 30.336250f, 76.392200f},
+    {"Tseung Kwan O", 22.327890f, 114.249920f},
+    {"Jiyuan", 35.090000f, 112.580000f},
+    {"Tonalá", 20.624450f, -103.234230f},
+    {"Fanling", 22.494870f, 114.139490f},
+    {"Bamenda", 5.959700f, 10.145970f},
+    {"Brasília", -15.779720f, -47.929720f},
+    {"Georgetown", 6.804480f, -58.155270f},
+    {"Baruta", 10.434240f, -66.875580f},
+    {"Da Nang", 16.067780f, 108.220830f},
+    {"Moscow", 55.752220f, 37.615560f},
+    {"Santiago de los Caballeros", 19.451700f, -70.697030f},
+    {"Orsk", 51.232060f, 58.488020f},
+    {"Chandigarh", 30.736290f, 76.788400f},
+    {"Baotou", 40.651600f, 109.843890f},
+    {"Katowice", 50.258410f, 19.027540f},
+    {"São Leopoldo", -29.760280f, -51.147220f},
+    {"Chula Vista", 32.640050f, -117.084200f},
+    {"Daqing", 46.583330f, 125.000000f},
+    {"Zeytinburnu", 40.994410f, 28.904170f},
+    {"Balikpapan", -1.267530f, 116.828870f},
+    {"Shimonoseki", 33.955480f, 130.937130f},
+    {"Caracas", 10.488010f, -66.879190f},
+    {"Qinzhou", 21.982470f, 108.650610f},
+    {"Cebu City", 10.316720f, 123.890710f},
+    {"Kota", 25.182540f, 75.839070f},
+    {"Leicester", 52.638600f, -1.131690f},
+    {"Port Said", 31.265310f, 32.301900f},
+    {"Stockton", 37.957700f, -121.290780f},
+    {"Wuzhou", 23.480540f, 111.288480f},
+    {"Nazrēt", 8.550000f, 39.266670f},
+    {"Uvira", -3.395340f, 29.137790f},
+    {"Uruapan", 19.411160f, -102.056440f},
+    {"Ahmadnagar", 19.094570f, 74.738430f},
+    {"Zelenograd", 55.982500f, 37.181390f},
+    {"Kleinzschocher", 51.315680f, 12.319790f},
+    {"Jaraguá", -23.440770f, -46.737740f},
+    {"Sukkur", 27.703230f, 68.858890f},
+    {"Shuangyashan", 46.676860f, 131.132730f},
+    {"Morogoro", -6.821020f, 37.661220f},
+    {"Laohekou", 32.385830f, 111.667780f},
+    {"Ebute Ikorodu", 6.600860f, 3.488180f},
+    {"Jixi", 45.293220f, 130.962170f},
+    {"Odesa", 46.485720f, 30.743830f},
+    {"Karaj", 35.832660f, 50.991550f},
+    {"Macau", 22.200560f, 113.546110f},
+    {"Kaifeng", 34.798600f, 114.307420f},
+    {"Berlin", 52.524370f, 13.410530f},
+    {"Beijing", 39.907500f, 116.397230f},
+    {"Shizuoka", 34.983330f, 138.383330f},
+    {"Santiago de Querétaro", 20.588060f, -100.388060f},
+    {"Owo", 7.196200f, 5.586810f},
+    {"Quetta", 30.184140f, 67.001410f},
+    {"Graz", 47.066670f, 15.450000f},
+    {"Meizhou", 24.288590f, 116.117680f},
+    {"Guiyang", 26.583330f, 106.716670f},
+    {"Kurashiki", 34.583330f, 133.766670f},
+    {"Enugu", 6.441320f, 7.498830f},
+    {"Bucharest", 44.432250f, 26.106260f},
+    {"Brisbane", -27.467940f, 153.028090f},
+    {"Novokuznetsk", 53.755700f, 87.109900f},
+    {"Huntington Beach", 33.660300f, -117.999230f},
+    {"Wellington", -41.286640f, 174.775570f},
+    {"Kaili", 26.585830f, 107.979720f},
+    {"Tashkent", 41.264650f, 69.216270f},
+    {"Xingyi", 25.096170f, 104.906390f},
+    {"Kagoshima", 31.566670f, 130.550000f},
+    {"Huzhou", 30.870300f, 120.093300f},
+    {"Gorgān", 36.842700f, 54.443910f},
+    {"Onitsha", 6.149780f, 6.785690f},
+    {"Concepción", -36.826990f, -73.049770f},
+    {"Ulsan", 35.537220f, 129.316670f},
+    {"Praia Grande", -24.005830f, -46.402780f},
+    {"Changyi", 36.853610f, 119.390830f},
+    {"Gaya", 24.796860f, 85.003850f},
+    {"Yan'an", 36.598890f, 109.491670f},
+    {"Tungi", 23.891540f, 90.402320f},
+    {"Maseru", -29.316670f, 27.483330f},
+    {"Tlalpan", 19.295130f, -99.162060f},
+    {"Indaiatuba", -23.088420f, -47.211900f},
+    {"Mathura", 27.503500f, 77.672150f},
+    {"Várzea Grande", -15.646670f, -56.132500f},
+    {"Santa Cruz de la Sierra", -17.786290f, -63.181170f},
+    {"Governador Valadares", -18.851110f, -41.949440f},
+    {"Mar del Plata", -38.000420f, -57.556200f},
+    {"Sunch'ŏn", 39.431670f, 125.932780f},
+    {"Johor Bahru", 1.465500f, 103.757800f},
+    {"Tlaquepaque", 20.640910f, -103.293270f},
+    {"Saitama", 35.908070f, 139.656570f},
+    {"Marne La Vallée", 48.835840f, 2.642410f},
+    {"Sanming", 26.248610f, 117.618610f},
+    {"Tomsk", 56.500320f, 84.982040f},
+    {"Neiva", 2.927300f, -75.281890f},
+    {"Barddhamān", 23.255720f, 87.856910f},
+    {"Emalahleni", -25.871330f, 29.233230f},
+    {"Spokane", 47.659660f, -117.429080f},
+    {"Bukavu", -2.490770f, 28.842810f},
+    {"Dushanbe", 38.535750f, 68.779050f},
+    {"Fergana", 40.384210f, 71.784320f},
+    {"Homs", 34.726820f, 36.723390f},
+    {"Okazaki", 34.950000f, 137.166670f},
+    {"Gijón", 43.535730f, -5.661520f},
+    {"Brent", 51.553060f, -0.302300f},
+    {"Jalandhar", 31.325560f, 75.579170f},
+    {"Nizāmābād", 18.671540f, 78.098800f},
+    {"Yazd", 31.897220f, 54.367500f},
+    {"Bīdar", 17.908020f, 77.515240f},
+    {"Russeifa", 32.017780f, 36.046390f},
+    {"Qionghai", 19.242500f, 110.464170f},
+    {"Bexley", 51.441620f, 0.148660f},
+    {"Pasig City", 14.586910f, 121.061400f},
+    {"Chesapeake", 36.819040f, -76.274940f},
+    {"Bhopāl", 23.254690f, 77.402890f},
+    {"Cabuyao", 14.272600f, 121.126200f},
+    {"Laval", 45.569950f, -73.692000f},
+    {"Valparaíso", -33.036000f, -71.629630f},
+    {"Bhubaneswar", 20.272410f, 85.833850f},
+    {"Edinburgh", 55.952060f, -3.196480f},
+    {"Bratislava", 48.148160f, 17.106740f},
+    {"Tegal", -6.869400f, 109.140200f},
+    {"Monterrey", 25.675070f, -100.318470f},
+    {"Elazığ", 38.674310f, 39.223210f},
+    {"Trujillo", -8.115990f, -79.029980f},
+    {"Carapicuíba", -23.522720f, -46.835000f},
+    {"Ţarţūs", 34.889020f, 35.886590f},
+    {"Marienthal", 53.566670f, 10.083330f},
+    {"Yunfu", 22.927870f, 112.038090f},
+    {"Huizhou", 23.111470f, 114.415230f},
+    {"Ha'il", 27.521880f, 41.690730f},
+    {"Ikare", 7.525910f, 5.753420f},
+    {"Glasgow", 55.865150f, -4.257630f},
+    {"Bryansk", 53.252090f, 34.371670f},
+    {"Ogbomoso", 8.133730f, 4.240140f},
+    {"Baiyin", 36.546960f, 104.170230f},
+    {"Novo Hamburgo", -29.678330f, -51.130560f},
+    {"Hougang New Town", 1.356670f, 103.890830f},
+    {"Najafgarh", 28.609220f, 76.979820f},
+    {"Hrodna", 53.688400f, 23.825800f},
+    {"Akowonjo", 6.610120f, 3.309680f},
+    {"Northampton", 52.250000f, -0.883330f},
+    {"Shrīrāmpur", 22.752780f, 88.342220f},
+    {"Vladikavkaz", 43.036670f, 44.667780f},
+    {"Jiangmen", 22.583330f, 113.083330f},
+    {"Ambato", -1.249080f, -78.616750f},
+    {"Rivne", 50.623080f, 26.227430f},
+    {"Chelyabinsk", 55.154020f, 61.429150f},
+    {"Jimeta", 9.279490f, 12.458190f},
+    {"Karachi", 24.860800f, 67.010400f},
+    {"Cabanatuan City", 15.485860f, 120.966480f},
+    {"Qujing", 25.483330f, 103.783330f},
+    {"Fuchū", 35.674520f, 139.482160f},
+    {"Binangonan", 14.464600f, 121.192900f},
+    {"Ludhiāna", 30.912040f, 75.853790f},
+    {"Sendai", 38.266670f, 140.866670f},
+    {"San Pedro de Macorís", 18.453900f, -69.308640f},
+    {"Chengde", 40.951900f, 117.958830f},
+    {"Jincheng", 35.502220f, 112.832780f},
+    {"Charleroi", 50.411360f, 4.444480f},
+    {"Pekanbaru", 0.516670f, 101.441670f},
+    {"Jinzhong", 37.684030f, 112.754710f},
+    {"Aba", 5.106580f, 7.366670f},
+    {"Bissau", 11.863570f, -15.597670f},
+    {"Jinjiang", 24.819780f, 118.574150f},
+    {"Riverside", 33.953350f, -117.396160f},
+    {"Jiuquan", 39.743180f, 98.517360f},
+    {"Hanoi", 21.024500f, 105.841170f},
+    {"Gaomi", 36.383330f, 119.752780f},
+    {"Salvador", -12.975630f, -38.490960f},
+    {"Zhanjiang", 21.233910f, 110.387490f},
+    {"Nagoya", 35.181470f, 136.906410f},
+    {"Dindigul", 10.368960f, 77.980360f},
+    {"Ghāziābād", 28.665350f, 77.439150f},
+    {"Latina", 40.388970f, -3.745690f},
+    {"Dehra Dūn", 30.324430f, 78.033920f},
+    {"Bochum", 51.481650f, 7.216480f},
+    {"Nicosia", 35.175310f, 33.364200f},
+    {"Pasuruan", -7.645300f, 112.907500f},
+    {"Menongue", -14.658500f, 17.690990f},
+    {"Depok", -6.400000f, 106.818610f},
+    {"Dingxi", 35.570880f, 104.623030f},
+    {"Petaling Jaya", 3.107260f, 101.606710f},
+    {"Acapulco de Juárez", 16.849420f, -99.908910f},
+    {"Mexicali", 32.627810f, -115.454460f},
+    {"Suqian", 33.949170f, 118.295830f},
+    {"Sengkang New Town", 1.391670f, 103.894440f},
+    {"Richmond", 37.553760f, -77.460260f},
+    {"Chernihiv", 51.505510f, 31.284870f},
+    {"Ziyang", 30.121080f, 104.648110f},
+    {"Recife", -8.053890f, -34.881110f},
+    {"Aurora", 39.729430f, -104.831920f},
+    {"Suicheng", 33.896300f, 117.933070f},
+    {"Ma'anshan", 31.685790f, 118.510080f},
+    {"Mazatlán", 23.232900f, -106.406200f},
+    {"Yanji", 42.888250f, 129.502410f},
+    {"Coatzacoalcos", 18.149050f, -94.444700f},
+    {"Sterlitamak", 53.637930f, 55.953300f},
+    {"Hannover", 52.370520f, 9.733220f},
+    {"Binjai", 3.600100f, 98.485400f},
+    {"Xinxiang", 35.190330f, 113.801510f},
+    {"Shaoxing", 30.002370f, 120.578640f},
+    {"Tsukuba", 36.083330f, 140.116670f},
+    {"Hamhŭng", 39.918330f, 127.536390f},
+    {"Busan", 35.101680f, 129.030040f},
+    {"Biên Hòa", 10.944690f, 106.824320f},
+    {"Gboko", 7.322750f, 9.001080f},
+    {"Hargeysa", 9.560000f, 44.065000f},
+    {"Xinyi", 34.384240f, 118.346170f},
+    {"Athlone", -33.967220f, 18.502140f},
+    {"Jizhou", 37.550540f, 115.568710f},
+    {"Tai'an", 36.185280f, 117.120000f},
+    {"Kitakyushu", 33.851810f, 130.850340f},
+    {"Kisumu", -0.102210f, 34.761710f},
+    {"Heroica Matamoros", 25.879720f, -97.504170f},
+    {"Kishiwada", 34.466670f, 135.366670f},
+    {"Trondheim", 63.430490f, 10.395060f},
+    {"Rasapūdipalem", 17.733080f, 83.316220f},
+    {"Santa Ana", 33.745570f, -117.867830f},
+    {"Kemerovo", 55.333330f, 86.083330f},
+    {"Shymkent", 42.300000f, 69.600000f},
+    {"Tabriz", 38.080000f, 46.291900f},
+    {"Panzhihua", 26.585090f, 101.712760f},
+    {"Berbera", 10.439590f, 45.014320f},
+    {"Bangkok", 13.753980f, 100.501440f},
+    {"Guangyuan", 32.442010f, 105.823000f},
+    {"Jingzhou", 30.350280f, 112.190280f},
+    {"Qiqihar", 47.339220f, 123.961540f},
+    {"Adapazarı", 40.780560f, 30.403330f},
+    {"Akashi", 34.655240f, 135.006870f},
+    {"Fuencarral-El Pardo", 40.498400f, -3.731400f},
+    {"Hotan", 37.107500f, 79.935480f},
+    {"San Pedro", 14.359500f, 121.047300f},
+    {"Huaibei", 33.974440f, 116.791670f},
+    {"Eloy Alfaro", -2.169190f, -79.839870f},
+    {"Villavicencio", 4.142000f, -73.626640f},
+    {"Batna City", 35.555970f, 6.174140f},
+    {"Ardabīl", 38.249800f, 48.293300f},
+    {"Seoul", 37.566000f, 126.978400f},
+    {"Ecatepec de Morelos", 19.604920f, -99.060640f},
+    {"Newcastle", -27.757960f, 29.931800f},
+    {"Sincelejo", 9.304720f, -75.397780f},
+    {"Rohini", 28.743220f, 77.067780f},
+    {"Ica", -14.067770f, -75.728610f},
+    {"Halle (Saale)", 51.481580f, 11.979470f},
+    {"Cincinnati", 39.127110f, -84.514390f},
+    {"Favoriten", 48.161160f, 16.382330f},
+    {"Porto", 41.149610f, -8.610990f},
+    {"Tianjin", 39.142220f, 117.176670f},
+    {"Nacala", -14.562570f, 40.685380f},
+    {"South Dublin", 53.290260f, -6.341510f},
+    {"Angeles City", 15.150000f, 120.583330f},
+    {"Melbourne", -37.814000f, 144.963320f},
+    {"Blumenau", -26.919440f, -49.066110f},
+    {"Ostrava", 49.834650f, 18.282040f},
+    {"Mukalla", 14.542480f, 49.124240f},
+    {"Cần Thơ", 10.037110f, 105.788250f},
+    {"Yinchuan", 38.468060f, 106.273060f},
+    {"Percut", 3.625300f, 98.864000f},
+    {"Nampula", -15.116460f, 39.266600f},
+    {"Chimbote", -9.075080f, -78.593730f},
+    {"Luancheng", 37.884520f, 114.646290f},
+    {"Shenzhen", 22.545540f, 114.068300f},
+    {"Shakhty", 47.719160f, 40.216030f},
+    {"Guadalajara", 20.666820f, -103.391820f},
+    {"Chungju", 36.976660f, 127.928700f},
+    {"Hebi", 35.899170f, 114.192500f},
+    {"Dar es Salaam", -6.823490f, 39.269510f},
+    {"Hakodate", 41.775830f, 140.736670f},
+    {"San Salvador de Jujuy", -24.194570f, -65.297120f},
+    {"Kikwit", -5.040980f, 18.816190f},
+    {"Jepara", -6.592400f, 110.671000f},
+    {"Hanam", 37.540000f, 127.205560f},
+    {"Puente de Vallecas", 40.393540f, -3.662000f},
+    {"Herāt", 34.348170f, 62.199670f},
+    {"Jilin", 43.846520f, 126.560800f},
+    {"Kiel", 54.321330f, 10.134890f},
+    {"Messina", 38.193940f, 15.552560f},
+    {"Queens", 40.681490f, -73.836520f},
+    {"Sivakasi", 9.449990f, 77.797970f},
+    {"Bujumbura", -3.381930f, 29.361420f},
+    {"Ciudad General Escobedo", 25.796980f, -100.317910f},
+    {"Tolyatti", 53.530300f, 49.346100f},
+    {"Nizhny Tagil", 57.919440f, 59.965000f},
+    {"Jambi City", -1.600000f, 103.616670f},
+    {"Santo Domingo de los Colorados", -0.253050f, -79.175360f},
+    {"Semarang", -6.993060f, 110.420830f},
+    {"Khabarovsk Vtoroy", 48.437760f, 135.133290f},
+    {"Sant Martí", 41.418140f, 2.199330f},
+    {"Mbarara", -0.604670f, 30.648510f},
+    {"Jardim Sao Luis", -23.680730f, -46.739400f},
+    {"Botshabelo", -29.267370f, 26.725950f},
+    {"Netanya", 32.332910f, 34.859920f},
+    {"Birmingham", 52.481420f, -1.899830f},
+    {"Chiniot", 31.720910f, 72.978360f},
+    {"Mangalore", 12.917230f, 74.856030f},
+    {"Rugao", 32.370350f, 120.576490f},
+    {"Burnaby", 49.266360f, -122.952630f},
+    {"Boston", 42.358430f, -71.059770f},
+    {"Amsterdam", 52.374030f, 4.889690f},
+    {"Yokkaichi", 34.966670f, 136.616670f},
+    {"Pasto", 1.213610f, -77.281110f},
+    {"Stockholm", 59.329380f, 18.068710f},
+    {"Kolkata", 22.562630f, 88.363040f},
+    {"Ottawa", 45.411170f, -75.698120f},
+    {"Jember", -8.172110f, 113.699530f},
+    {"Simferopol", 44.957190f, 34.110790f},
+    {"Tijuana", 32.502700f, -117.003710f},
+    {"Puebla", 19.037930f, -98.203460f},
+    {"Mönchengladbach", 51.185390f, 6.441720f},
+    {"Saratov", 51.540560f, 46.008610f},
+    {"Salta", -24.785900f, -65.411660f},
+    {"Guarenas", 10.470270f, -66.619340f},
+    {"Brno", 49.195220f, 16.607960f},
+    {"Sāngli", 16.854380f, 74.564170f},
+    {"Bimbo", 4.256710f, 18.415830f},
+    {"Karāwalnagar", 28.727120f, 77.270470f},
+    {"Sector 1", 44.492390f, 26.048310f},
+    {"Miri", 4.399280f, 113.991630f},
+    {"Tumkūr", 13.341360f, 77.102200f},
+    {"Matsuyama", 33.839160f, 132.765740f},
+    {"Mandaluyong", 14.578370f, 121.035220f},
+    {"Yueyang", 29.374550f, 113.094810f},
+    {"Muzaffarābād", 34.370020f, 73.470820f},
+    {"Łódź", 51.770580f, 19.473950f},
+    {"Ségou", 13.440320f, -6.259470f},
+    {"Mālegaon", 20.549660f, 74.534620f},
+    {"San Juan", 18.466330f, -66.105720f},
+    {"Hamburg-Mitte", 53.550000f, 10.016670f},
+    {"Lipetsk", 52.603110f, 39.570760f},
+    {"Irving", 32.814020f, -96.948890f},
+    {"Perm", 58.010460f, 56.250170f},
+    {"Croix-des-Bouquets", 18.576770f, -72.226250f},
+    {"Kazan", 55.788740f, 49.122140f},
+    {"Çorum", 40.548890f, 34.953330f},
+    {"Tieling", 42.293060f, 123.841390f},
+    {"Culiacán", 24.790320f, -107.387820f},
+    {"Centralniy", 59.931110f, 30.360720f},
+    {"Linyi", 35.063060f, 118.342780f},
+    {"Dnipro", 48.466640f, 35.040660f},
+    {"Barranquilla", 10.968540f, -74.781320f},
+    {"Morioka", 39.700000f, 141.150000f},
+    {"Probolinggo", -7.754300f, 113.215900f},
+    {"Ibarra", 0.351710f, -78.122330f},
+    {"Alīgarh", 27.881450f, 78.074640f},
+    {"Petrópolis", -22.505000f, -43.178610f},
+    {"Wuwei", 37.926720f, 102.632020f},
+    {"Meads", 38.412580f, -82.709050f},
+    {"Changzhi", 36.183890f, 113.105280f},
+    {"Sumbe", -11.206050f, 13.843710f},
+    {"Quận Mười Một", 10.763830f, 106.643550f},
+    {"Dosquebradas", 4.839160f, -75.667270f},
+    {"Shubrā al Khaymah", 30.125110f, 31.250530f},
+    {"Ciampea", -6.554720f, 106.700830f},
+    {"Wenzhou", 27.999420f, 120.666820f},
+    {"Naples", 40.852160f, 14.268110f},
+    {"Xingning", 24.148300f, 115.722720f},
+    {"Buenos Aires", -34.613150f, -58.377230f},
+    {"Cochabamba", -17.389500f, -66.156800f},
+    {"Davangere", 14.466930f, 75.926940f},
+    {"Burhānpur", 21.308680f, 76.230260f},
+    {"Diyarbakır", 37.913630f, 40.217210f},
+    {"Linxia Chengguanzhen", 35.600280f, 103.206390f},
+    {"Mbour", 14.421960f, -16.963750f},
+    {"Ji'an", 27.117160f, 114.979270f},
+    {"Mbuji-Mayi", -6.136030f, 23.589790f},
+    {"Mesa", 33.422270f, -111.822640f},
+    {"Ōta", 36.300000f, 139.366670f},
+    {"Xiuying", 20.000730f, 110.293590f},
+    {"Hamburg-Nord", 53.589350f, 9.984000f},
+    {"Aracaju", -10.911110f, -37.071670f},
+    {"Laibin", 23.747430f, 109.222220f},
+    {"Al Qāhirah al Jadīdah", 30.042140f, 31.444460f},
+    {"Iquitos", -3.749120f, -73.253830f},
+    {"Bayan Nur", 40.741430f, 107.385990f},
+    {"Al Ḩillah", 32.463670f, 44.419630f},
+    {"Pyeongtaek", 36.994720f, 127.088890f},
+    {"Yonkers", 40.931210f, -73.898750f},
+    {"Şanlıurfa", 37.167080f, 38.793920f},
+    {"Cagayan de Oro", 8.482220f, 124.647220f},
+    {"Wollongong", -34.424000f, 150.893450f},
+    {"Kansas City", 39.099730f, -94.578570f},
+    {"Cotabato", 7.223610f, 124.246390f},
+    {"Basuo", 19.102670f, 108.665650f},
+    {"Suzano", -23.542500f, -46.310830f},
+    {"Gwangju", 35.154720f, 126.915560f},
+    {"Tucson", 32.221740f, -110.926480f},
+    {"Chipata", -13.633330f, 32.650000f},
+    {"Tin Shui Wai", 22.456790f, 114.002340f},
+    {"Cheboksary", 56.132220f, 47.251940f},
+    {"Petropavl", 54.866670f, 69.150000f},
+    {"Lipa City", 13.941100f, 121.163100f},
+    {"Mudanjiang", 44.548040f, 129.625940f},
+    {"Bhilai", 21.209190f, 81.428500f},
+    {"Cuenca", -2.900550f, -79.004530f},
+    {"Siliguri", 26.710040f, 88.428510f},
+    {"Port-de-Paix", 19.939840f, -72.830370f},
+    {"Maiduguri", 11.846920f, 13.157120f},
+    {"Juazeiro do Norte", -7.213060f, -39.315280f},
+    {"Al Jubayl", 27.017400f, 49.622510f},
+    {"Craiova", 44.316670f, 23.800000f},
+    {"Dayrah", 25.271430f, 55.302070f},
+    {"Serekunda", 13.438330f, -16.678060f},
+    {"Miyazaki", 31.916670f, 131.416670f},
+    {"Manchester", 53.480950f, -2.237430f},
+    {"Sakai", 34.582160f, 135.466530f},
+    {"Sahāranpur", 29.967900f, 77.545220f},
+    {"Osaka", 34.693790f, 135.501070f},
+    {"Kediri", -7.816670f, 112.016670f},
+    {"Aliayabiagba", 6.450000f, 3.333330f},
+    {"Gatineau", 45.477230f, -75.701640f},
+    {"The Hague", 52.076670f, 4.298610f},
+    {"Blida", 36.470040f, 2.827700f},
+    {"Tongchuanshi", 35.074740f, 109.084950f},
+    {"Yekaterinburg", 56.851900f, 60.612200f},
+    {"Bilāspur", 22.080050f, 82.155430f},
+    {"Mombasa", -4.054660f, 39.663590f},
+    {"Ḩalwān", 29.841440f, 31.300840f},
+    {"Kostroma", 57.766470f, 40.926860f},
+    {"Faisalabad", 31.415540f, 73.089690f},
+    {"Kharagpur", 22.339710f, 87.325010f},
+    {"West Jerusalem", 31.781990f, 35.219610f},
+    {"Bello", 6.337320f, -75.557950f},
+    {"Saint-Louis", 16.017930f, -16.489620f},
+    {"Kursk", 51.737330f, 36.187350f},
+    {"Iskandar Puteri", 1.393240f, 103.623220f},
+    {"Uijeongbu-si", 37.741500f, 127.047400f},
+    {"Rewa", 24.532560f, 81.292340f},
+    {"Corrientes", -27.467840f, -58.834400f},
+    {"Palmas", -10.167450f, -48.327660f},
+    {"Hachinohe", 40.500000f, 141.500000f},
+    {"Magdalena Contreras", 19.332120f, -99.211180f},
+    {"Toluca", 19.287860f, -99.653240f},
+    {"Bangui", 4.361220f, 18.554960f},
+    {"Biskra", 34.850380f, 5.728050f},
+    {"Masan", 35.127250f, 126.831490f},
+    {"Anápolis", -16.326670f, -48.952780f},
+    {"Manukau City", -36.992820f, 174.879860f},
+    {"Anantapur", 14.677840f, 77.608130f},
+    {"Jacksonville", 30.332180f, -81.655650f},
+    {"Biñan", 14.342670f, 121.080710f},
+    {"Rio Branco", -9.974720f, -67.810000f},
+    {"Reading", 51.456250f, -0.971130f},
+    {"Worcester", 42.262590f, -71.802290f},
+    {"Xiangyang", 32.042200f, 112.144790f},
+    {"Bergen", 60.392990f, 5.324150f},
+    {"Fuencarral", 40.500000f, -3.683330f},
+};
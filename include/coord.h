@@ -37,12 +37,24 @@
  * - Declination        : measured North of the Celestial Equator, along the
  * hour circle passing through the point in question
  *
+ * EQUATORIAL-RECTANGULAR (x, y, z)
+ * - x : towards the Vernal Equinox
+ * - y : towards right ascension π/2 on the Celestial Equator
+ * - z : towards the North Celestial Pole
+ *
+ * HORIZONTAL-RECTANGULAR (x, y, z)
+ * - x : towards the East point of the horizon
+ * - y : towards the North point of the horizon
+ * - z : towards the zenith
+ *
  * See: https://en.wikipedia.org/wiki/Equatorial_coordinate_system
  */
 
 #ifndef COORD_H
 #define COORD_H
 
+#include <stdbool.h>
+
 // CONVERSIONS
 
 /* Converts equatorial coordinates (global) to horizontal coordinates (local)
@@ -59,6 +71,29 @@ void equatorial_to_horizontal(double right_ascension, double declination, double
  */
 void equatorial_rectangular_to_spherical(double xeq, double yeq, double zeq, double *right_ascension, double *declination);
 
+/* Converts spherical equatorial coordinates to a rectangular unit vector
+ */
+void equatorial_spherical_to_rectangular(double right_ascension, double declination, double *xeq, double *yeq, double *zeq);
+
+/* Build the rotation matrix taking rectangular equatorial coordinates to
+ * rectangular horizontal coordinates for a given sidereal time and observer.
+ * This is the same transformation as equatorial_to_horizontal, but it only
+ * needs to be computed once per frame:
+ *
+ *  [xh]            [xeq]
+ *  [yh] = matrix * [yeq]
+ *  [zh]            [zeq]
+ */
+void equatorial_to_horizontal_matrix(double gmst, double latitude, double longitude, double matrix[3][3]);
+
+/* Converts rectangular horizontal coordinates to azimuth and altitude
+ */
+void horizontal_rectangular_to_spherical(double xh, double yh, double zh, double *azimuth, double *altitude);
+
+/* Converts horizontal coordinates to a rectangular unit vector
+ */
+void horizontal_spherical_to_rectangular(double azimuth, double altitude, double *xh, double *yh, double *zh);
+
 /* Converts horizontal coordinates to spherical coordinates
  */
 void horizontal_to_spherical(double azimuth, double altitude, double *theta_sphere, double *phi_sphere);
@@ -106,6 +141,25 @@ void project_stereographic_north(double radius_sphere, double theta_sphere, doub
 
 // SCREEN SPACE MAPPING
 
+/* Scale factors of a stereographic projection of the sky onto a window,
+ * computed once per window size
+ */
+struct StereoProjection
+{
+    double rad_y; // Radius of the horizon in rows and columns
+    double rad_x;
+};
+
+void init_stereo_projection(struct StereoProjection *projection, int win_height, int win_width);
+
+/* Maps a rectangular horizontal unit vector to screen space, the same as
+ * horizontal_to_spherical, project_stereographic_north and polar_to_win
+ * together but without trigonometry. Directions below the horizon lie outside
+ * the projection; returns false for them and leaves row and col unset
+ */
+bool project_horizontal_to_win(const struct StereoProjection *projection, double xh, double yh, double zh, int *row,
+                               int *col);
+
 /* Maps point a point (r, θ) on the unit circle to screen space
  */
 void polar_to_win(double r, double theta, int win_height, int win_width, int *row, int *col);
@@ -4,12 +4,22 @@
 #ifndef CORE_H
 #define CORE_H
 
+#include "arena.h"
 #include "astro.h"
 #include "parse_BSC5.h"
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <time.h>
 
+// Formats positions are exported in
+enum ExportFormat
+{
+    EXPORT_NONE, // Render instead of exporting
+    EXPORT_CSV,
+    EXPORT_BINARY,
+};
+
 /* Describes how objects should be rendered
  */
 struct Conf
@@ -20,15 +30,35 @@ struct Conf
     float threshold;
     float label_thresh;
     int fps;
+    int threads;
+    const char *catalog_path;
+    const char *minor_bodies_path;
+    int frames;      // Number of frames to render in headless mode
+    int width;       // Size of headless frames in cells
+    int height;
+    const char *output_path;
     float speed;
     double julian_date;
     double aspect_ratio;
+    double bandwidth; // Budget for terminal output (bytes per second), 0 for none
+    const char *until_string_utc;   // End of the exported or listed time range
+    double step;                    // Time between exported epochs (s)
+    enum ExportFormat export_format;
     bool quit_on_any;
     bool unicode;
     bool color;
     bool grid;
     bool constell;
     bool metadata;
+    bool headless;
+    bool perf;      // Frame timing overlay shown
+    bool on_change; // Redraw only when the sky changes
+    bool events;    // List rise, set and transit times instead of rendering
+    const char *observers_path; // Observers to tabulate positions for, "cities" for the city database
+    const char *objects;        // Objects tabulated for observers, NULL for the Sun, planets and Moon
+    double min_altitude;        // Lowest position tabulated for observers (rad)
+    const char *record_path;    // Recording of the frames drawn, NULL for none
+    const char *replay_path;    // Recording played back instead of rendering
 };
 
 // All information pertinent to rendering a celestial body
@@ -70,10 +100,17 @@ struct Moon
     float magnitude;
 };
 
-struct Constell
+/* Constellation figures as one array of segments and the offset of each
+ * figure's segments in it (compressed sparse rows). Figure c has segments
+ * [offsets[c], offsets[c + 1]), and segment s joins the stars at star table
+ * indices ends[2s] and ends[2s + 1]
+ */
+struct ConstellTable
 {
-    unsigned int num_segments;
-    int *star_numbers;
+    unsigned int num_constells;
+    const unsigned int *offsets;
+    const int *ends;
+    bool *drawn; // Figures whose stars are all within the magnitude threshold
 };
 
 struct StarName
@@ -82,47 +119,97 @@ struct StarName
 };
 
 // Data structure generation
+//
+// Tables are allocated from an arena (see arena.h) and freed with it. Each
+// *_arena_size function gives the space a table takes in the arena
+
+/* Count the stars of a catalog no dimmer than `max_magnitude`
+ */
+unsigned int count_catalog_stars(const struct Catalog *catalog, float max_magnitude);
 
-/* Fill array of star structures using entries from BSC5 and table of star
- * names. Stars with catalog number `n` are mapped to index `n-1`. This function
- * allocates memory which must be freed by the caller. Returns false upon memory
+/* Space taken by a star table of `num_stars` stars and the planet table
+ */
+size_t star_tables_arena_size(unsigned int num_stars);
+
+/* Space taken by the order of `num_stars` stars by magnitude, including the
+ * sort keys, which are released. The embedded catalog comes sorted, so only
+ * external catalogs need it
+ */
+size_t star_sort_arena_size(unsigned int num_stars);
+
+/* Fill array of star structures from a catalog and table of star names,
+ * keeping only stars no dimmer than `max_magnitude` (pass INFINITY to keep
+ * every star). Stars are numbered by their position in the table, so star `n`
+ * is at index `n-1`; for the full BSC5 this is the catalog number. Names are
+ * looked up by catalog index, so `name_table` must be NULL when filtering.
+ * `num_stars` is the count_catalog_stars of the catalog and threshold, which
+ * callers already need to size the arena. Returns false upon memory
  * allocation error
  */
-bool generate_star_table(struct Star **star_table, struct Entry *entries, const struct StarName *name_table,
-                         unsigned int num_stars);
+bool generate_star_table(struct Arena *arena, struct Star **star_table, unsigned int num_stars,
+                         const struct Catalog *catalog, const struct StarName *name_table, float max_magnitude);
+
+/* Copy a star table generated at build time (see scripts/bsc5_tables.c) into
+ * one whose positions can be updated. Returns false upon memory allocation
+ * error
+ */
+bool copy_star_table(struct Arena *arena, struct Star **star_table_out, const struct Star *stars,
+                     unsigned int num_stars);
+
+/* Space taken by the name table of `num_stars` stars parsed from `data_len`
+ * bytes of bsc5_names.txt
+ */
+size_t name_table_arena_size(size_t data_len, int num_stars);
 
 /* Parse data from bsc5_names.txt and return an array of names. Stars with
- * catalog number `n` are mapped to index `n-1`. This function allocates memory
- * which should be freed by the caller. Returns false upon memory allocation
- * error.
+ * catalog number `n` are mapped to index `n-1`. The names are packed into a
+ * single allocation. Returns false upon memory allocation error.
+ */
+bool generate_name_table(struct Arena *arena, const uint8_t *data, size_t data_len, struct StarName **name_table_out,
+                         int num_stars);
+
+/* Space taken by the constellation table parsed from bsc5_constellations.txt
+ */
+size_t constell_table_arena_size(const uint8_t *data, size_t data_len);
+
+/* Parse data from bsc5_constellations.txt into a constellation table, with
+ * every figure drawn. Returns false upon memory allocation or parsing error.
  */
-bool generate_name_table(const uint8_t *data, size_t data_len, struct StarName **name_table_out, int num_stars);
+bool generate_constell_table(struct Arena *arena, const uint8_t *data, size_t data_len,
+                             struct ConstellTable *constell_table);
 
-/* Parse data from bsc5_constellations.txt and return an array of constell
- * structs. This function allocates memory which should  be freed by the
- * caller. Returns false upon memory allocation error.
- *
- * NOTE: bsc5.constellations.txt MUST end in a new line to grab all the data.
+/* Make a constellation table of existing offsets and ends, such as those
+ * generated at build time, with every figure drawn. Only the mask of drawn
+ * figures is allocated. Returns false upon memory allocation error
  */
-bool generate_constell_table(const uint8_t *data, size_t data_len, struct Constell **constell_table_out,
-                             unsigned int *num_constell_out);
+bool init_constell_table(struct Arena *arena, struct ConstellTable *constell_table, unsigned int num_constells,
+                         const unsigned int *offsets, const int *ends);
 
-/* Generate an array of planet structs. This function allocates memory which
- * should  be freed by the caller. Returns false upon memory allocation error
+/* Draw only the figures whose stars are all in the star table and no dimmer
+ * than `threshold`. Called whenever the threshold changes
  */
-bool generate_planet_table(struct Planet **planet_table, const struct KepElems *planet_elements,
+void set_constell_threshold(struct ConstellTable *constell_table, const struct Star *star_table,
+                            unsigned int num_stars, float threshold);
+
+/* Generate an array of planet structs. Returns false upon memory allocation
+ * error
+ */
+bool generate_planet_table(struct Arena *arena, struct Planet **planet_table, const struct KepElems *planet_elements,
                            const struct KepRates *planet_rates, const struct KepExtra *planet_extras);
 
 /* Generate a moon struct. Returns false upon error during generation
  */
 bool generate_moon_object(struct Moon *moon_data, const struct KepElems *moon_elements, const struct KepRates *moon_rates);
 
+// Positions
+
+/* Calculate the geocentric ICRF position of the Sun or the planet at `index`
+ * of a planet table in rectangular equatorial coordinates
+ */
+void planet_geo_ICRF(const struct Planet *planet_table, int index, double julian_date, double *xg, double *yg, double *zg);
+
 // Memory freeing
 
-void free_stars(struct Star *star_table, unsigned int size);
-void free_star_names(struct StarName *name_table, unsigned int size);
-void free_constells(struct Constell *constell_table, unsigned int size);
-void free_planets(struct Planet *planets, unsigned int size);
 void free_moon_object(struct Moon moon_data);
 
 // Miscellaneous
@@ -131,10 +218,13 @@ void free_moon_object(struct Moon moon_data);
  */
 int star_magnitude_comparator(const void *v1, const void *v2);
 
-/* Modify an array of star numbers sorted by increasing magnitude. Used in
- * rendering functions so brighter stars are always rendered on top
+/* Modify an array of star numbers sorted by decreasing magnitude (dimmest
+ * first). Used in rendering functions so brighter stars are always rendered on
+ * top. Stars of equal magnitude are ordered by catalog number. Stars within a
+ * magnitude threshold form the tail of the array
  */
-bool star_numbers_by_magnitude(int **num_by_mag, const struct Star *star_table, unsigned int num_stars);
+bool star_numbers_by_magnitude(struct Arena *arena, int **num_by_mag, const struct Star *star_table,
+                               unsigned int num_stars);
 
 /* Map a double `input` which lies in range [min_float, max_float]
  * to an integer which lies in range [min_int, max_int].
@@ -5,6 +5,7 @@
 #define CORE_POSITION_H
 
 #include "core.h"
+#include "ephemeris.h"
 
 /* Update apparent star positions for a given observation time and location by
  * setting the azimuth and altitude of each star struct in an array of star
@@ -18,11 +19,23 @@ void update_star_positions(struct Star *star_table, int num_stars, double julian
  */
 void update_planet_positions(struct Planet *planet_table, double julian_date, double latitude, double longitude);
 
+/* Same as update_planet_positions, with geocentric positions taken from an
+ * ephemeris cache
+ */
+void update_planet_positions_cached(struct Ephemeris *ephemeris, struct Planet *planet_table, double julian_date,
+                                    double latitude, double longitude);
+
 /* Update apparent Moon positions for a given observation time and
  * location by setting the azimuth and altitude of a moon struct
  */
 void update_moon_position(struct Moon *moon_object, double julian_date, double latitude, double longitude);
 
+/* Same as update_moon_position, with the geocentric position taken from an
+ * ephemeris cache
+ */
+void update_moon_position_cached(struct Ephemeris *ephemeris, struct Moon *moon_object, double julian_date, double latitude,
+                                 double longitude);
+
 /* Update the phase of the Moon at a given time by setting the unicode symbol
  * for a moon struct
  */
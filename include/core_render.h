@@ -4,34 +4,60 @@
 #ifndef CORE_RENDER_H
 #define CORE_RENDER_H
 
+#include "arena.h"
+#include "canvas.h"
 #include "core.h"
+#include "minor_bodies.h"
 
-#include <curses.h>
+#include <stdbool.h>
 
-/* Render stars to the screen using a stereographic projection
+// Where a star is drawn in the current frame
+struct StarCell
+{
+    int row; // Only set above the horizon
+    int col;
+    bool above_horizon;
+};
+
+/* Allocate cells for a star table of `num_stars` stars, indexed like it, from
+ * an arena. Returns false upon memory allocation error
+ */
+bool create_star_cells(struct Arena *arena, struct StarCell **cells, unsigned int num_stars);
+
+/* Render stars to the screen using a stereographic projection. Every star in
+ * num_by_mag is drawn, so callers pass only the visible tail (see
+ * set_star_buffer_threshold). This includes every constellation star that can
+ * be drawn, and where each is drawn is kept in `cells` for render_constells
  */
-void render_stars_stereo(WINDOW *win, const struct Conf *config, struct Star *star_table, int num_stars, const int *num_by_mag);
+void render_stars_stereo(struct Canvas *canvas, const struct Conf *config, struct Star *star_table, int num_stars,
+                         const int *num_by_mag, struct StarCell *cells);
 
 /* Render the Sun and planets to the screen using a stereographic projection
  */
-void render_planets_stereo(WINDOW *win, const struct Conf *config, const struct Planet *planet_table);
+void render_planets_stereo(struct Canvas *canvas, const struct Conf *config, const struct Planet *planet_table);
+
+/* Render the asteroids and comets listed as visible in the most recent update
+ * using a stereographic projection
+ */
+void render_minor_bodies_stereo(struct Canvas *canvas, const struct Conf *config, const struct MinorBodies *bodies);
 
 /* Render the Moon to the screen using a stereographic projection
  */
-void render_moon_stereo(WINDOW *win, const struct Conf *config, struct Moon moon_object);
+void render_moon_stereo(struct Canvas *canvas, const struct Conf *config, struct Moon moon_object);
 
-/* Render constellations
+/* Render the figures drawn (see set_constell_threshold) between the cells their
+ * stars were drawn in by render_stars_stereo in the same frame
  */
-void render_constells(WINDOW *win, const struct Conf *config, struct Constell **constell_table, int num_const,
-                      const struct Star *star_table);
+void render_constells(struct Canvas *canvas, const struct Conf *config, const struct ConstellTable *constell_table,
+                      const struct Star *star_table, const struct StarCell *cells);
 
 /* Render an azimuthal grid on a stereographic projection
  */
-void render_azimuthal_grid(WINDOW *win, const struct Conf *config);
+void render_azimuthal_grid(struct Canvas *canvas, const struct Conf *config);
 
 /* Render cardinal direction indicators for the Northern, Eastern, Southern, and
  * Western horizons
  */
-void render_cardinal_directions(WINDOW *win, const struct Conf *config);
+void render_cardinal_directions(struct Canvas *canvas, const struct Conf *config);
 
 #endif // CORE_RENDER_H
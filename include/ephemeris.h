@@ -0,0 +1,60 @@
+/* Cache of Chebyshev approximations to the geocentric positions of the Sun,
+ * planets and Moon
+ *
+ * Time is split into fixed windows, and within a window each coordinate of a
+ * body's geocentric position is approximated by a Chebyshev series fitted to
+ * the Keplerian model at Chebyshev nodes. Evaluating the series is a handful
+ * of multiply-adds, compared to solving Kepler's equation for the body and
+ * the Earth.
+ *
+ * A window is only fitted once a second query lands in it, so when simulation
+ * time moves faster than a window per frame every query is computed directly
+ * instead of paying for a fit that is never reused.
+ */
+
+#ifndef EPHEMERIS_H
+#define EPHEMERIS_H
+
+#include "astro.h"
+#include "core.h"
+
+#include <stdbool.h>
+
+// Coefficients per coordinate
+#define EPHEMERIS_COEFFS 14
+
+// Window lengths in days. The Moon moves about 13° a day, the planets' apparent
+// motion is dominated by the Earth's orbit
+#define EPHEMERIS_MOON_DAYS 2.0
+#define EPHEMERIS_PLANET_DAYS 32.0
+
+// Index of the Moon in the ephemeris, after the planets
+#define EPHEMERIS_MOON NUM_PLANETS
+
+struct EphemerisWindow
+{
+    long index;   // Window of the fitted coefficients
+    long pending; // Window of the most recent query that was not fitted
+    bool fitted;
+    double coeffs[3][EPHEMERIS_COEFFS];
+};
+
+struct Ephemeris
+{
+    struct EphemerisWindow bodies[NUM_PLANETS + 1];
+};
+
+void init_ephemeris(struct Ephemeris *ephemeris);
+
+/* Geocentric rectangular equatorial coordinates of a planet (or the Sun) in
+ * AU. The Earth's own are zero
+ */
+void ephemeris_planet_geo(struct Ephemeris *ephemeris, const struct Planet *planet_table, int planet, double julian_date,
+                          double *xg, double *yg, double *zg);
+
+/* Geocentric rectangular equatorial coordinates of the Moon
+ */
+void ephemeris_moon_geo(struct Ephemeris *ephemeris, const struct Moon *moon_object, double julian_date, double *xg,
+                        double *yg, double *zg);
+
+#endif // EPHEMERIS_H
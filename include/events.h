@@ -0,0 +1,106 @@
+/* Find when stars, the Sun, planets and the Moon rise, set and transit the
+ * meridian.
+ *
+ * The altitude and hour angle of an object are sampled at coarse steps to
+ * bracket each event, which is then refined by root finding. An object rises
+ * or sets when its center crosses an altitude of zero, and transits when its
+ * hour angle crosses zero (upper culmination). The altitude is also checked at
+ * culminations within a step, where the altitude of a star is highest or
+ * lowest, so objects near the limit of never rising or setting that cross the
+ * horizon twice within a step are found too.
+ *
+ * Listings of events are CSV, one row per event in order of time:
+ *
+ *     time,object,event,azimuth,altitude
+ *
+ * where the time is in UTC (yyyy-mm-ddThh:mm:ssZ), objects are named as in
+ * exports (see export.h) and angles are in degrees.
+ */
+
+#ifndef EVENTS_H
+#define EVENTS_H
+
+#include "core.h"
+#include "pool.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+enum EventType
+{
+    EVENT_RISE,
+    EVENT_TRANSIT,
+    EVENT_SET,
+};
+
+struct SkyEvent
+{
+    double julian_date;
+    enum EventType type;
+    double azimuth; // Position at the event
+    double altitude;
+};
+
+/* Largest number of events of one object between two Julian dates. Objects
+ * transit at most once a sidereal day
+ */
+int max_events_between(double start, double end);
+
+/* Find the events of a star, the Sun or planet `index` of a planet table, or
+ * the Moon in (start, end], in order of time. At most `max_events` are stored.
+ * Returns the number of events found
+ */
+int find_star_events(const struct Star *star, double start, double end, double latitude, double longitude,
+                     struct SkyEvent *events, int max_events);
+int find_planet_events(const struct Planet *planet_table, int index, double start, double end, double latitude,
+                       double longitude, struct SkyEvent *events, int max_events);
+int find_moon_events(const struct Moon *moon_object, double start, double end, double latitude, double longitude,
+                     struct SkyEvent *events, int max_events);
+
+/* First event of a type in a list of events, or NULL if there is none
+ */
+const struct SkyEvent *first_event(const struct SkyEvent *events, int num_events, enum EventType type);
+
+const char *event_type_name(enum EventType type);
+
+/* Write the events of the Sun, planets, Moon and the stars given by their
+ * numbers in the star table in (start, end] to a stream, finding the events of
+ * each object across the threads of a pool. Returns false upon memory
+ * allocation or write error
+ */
+bool list_events(FILE *stream, struct Pool *pool, const struct Star *star_table, const int *star_numbers,
+                 int num_stars, const struct Planet *planet_table, const struct Moon *moon_object, double start,
+                 double end, double latitude, double longitude);
+
+/* Write the events in (start, end] to config->output_path or stdout. Prints a
+ * message and returns false upon error
+ */
+bool list_events_to_output(const struct Conf *config, struct Pool *pool, const struct Star *star_table,
+                           const int *star_numbers, int num_stars, const struct Planet *planet_table,
+                           const struct Moon *moon_object, double start, double end);
+
+/* Next rise and set of the Sun and Moon, as shown in the metadata. They are
+ * kept until one of them passes or time runs backwards, rather than found
+ * each frame. Zero initialize before use
+ */
+struct NextEvents
+{
+    bool found;
+    double found_at; // Julian date the events were found at
+    double expires;  // First of the events, or the end of the lookahead
+    double sun_rise; // Julian dates, 0 if there is none within the lookahead
+    double sun_set;
+    double moon_rise;
+    double moon_set;
+};
+
+/* Describe the next rise and set of the Sun and Moon after `julian_date` as
+ * "rise hh:mm, set hh:mm" in local time, with --:-- for an event that is not
+ * within the next two days. The events are found again only once `next` has
+ * expired
+ */
+void describe_next_events(struct NextEvents *next, const struct Planet *planet_table, const struct Moon *moon_object,
+                          double julian_date, double latitude, double longitude, char *sun, char *moon, size_t size);
+
+#endif // EVENTS_H
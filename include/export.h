@@ -0,0 +1,91 @@
+/* Export the positions of the Sun, planets, Moon and stars over a range of
+ * times, e.g. a year at one minute steps, as CSV or compact binary records.
+ *
+ * Epochs are split across the threads of a pool in batches. Each thread keeps
+ * its own copy of the object tables and formats its epochs into its own
+ * buffer, and the buffers are written in order once the batch is done, so
+ * memory use is bounded by the buffers rather than the length of the range.
+ *
+ * Objects are identified by a number: stars by their number in the star table
+ * (the BSC5 catalog number unless a catalog is given), the Sun and planets by
+ * -1 - their index in the planet table, and the Moon by -1 - NUM_PLANETS.
+ * Angles are in degrees.
+ *
+ * CSV exports have a header row followed by one row per object per epoch:
+ *
+ *     julian_date,object,azimuth,altitude
+ *
+ * where the Sun, planets and Moon are given by name instead of number.
+ *
+ * Binary exports are little endian. A header
+ *
+ *     char magic[8]           "ASTROEXP"
+ *     uint32_t version        1
+ *     uint32_t num_objects
+ *     double start            Julian date of the first epoch
+ *     double step             Days between epochs
+ *     uint64_t num_epochs
+ *     int32_t objects[num_objects]
+ *
+ * is followed for each epoch by a float azimuth and altitude for each object,
+ * in the order of the header.
+ */
+
+#ifndef EXPORT_H
+#define EXPORT_H
+
+#include "core.h"
+#include "pool.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#define EXPORT_MAGIC "ASTROEXP"
+#define EXPORT_VERSION 1
+
+// Objects are written in the order of the Sun, planets other than the Earth
+// and the Moon, then the stars
+#define NUM_BODIES NUM_PLANETS
+
+// Sizes in bytes of the binary header before the object numbers, and of the
+// record of each object
+#define EXPORT_HEADER_SIZE 40
+#define EXPORT_RECORD_SIZE 8
+
+struct ExportRange
+{
+    double start; // Julian date of the first epoch
+    double step;  // Days between epochs
+    long num_epochs;
+};
+
+/* Write the position of every object at each epoch of a range to a stream,
+ * computing epochs across the threads of a pool. Stars are given by their
+ * numbers in the star table and exported in increasing order of number.
+ * Returns false upon memory allocation or write error
+ */
+bool export_positions(FILE *stream, enum ExportFormat format, struct Pool *pool, const struct Star *star_table,
+                      const int *star_numbers, int num_stars, const struct Planet *planet_table,
+                      const struct Moon *moon_object, const struct ExportRange *range, double latitude,
+                      double longitude);
+
+/* Write the positions of the objects from `start` to `end` (Julian dates), every
+ * config->step seconds, in config->export_format to config->output_path or
+ * stdout. Prints a message and returns false upon error
+ */
+bool export_to_output(const struct Conf *config, struct Pool *pool, const struct Star *star_table,
+                      const int *star_numbers, int num_stars, const struct Planet *planet_table,
+                      const struct Moon *moon_object, double start, double end);
+
+/* Write an integer, or a number rounded half away from zero to a fixed number
+ * of decimal places without a negative zero, as digits without a terminating
+ * null. Returns the end of what was written
+ */
+char *format_integer(char *out, long long value);
+char *format_fixed(char *out, double value, int decimals);
+
+/* Index in the planet table of object i < NUM_BODIES, or -1 for the Moon
+ */
+int body_planet_index(int i);
+
+#endif // EXPORT_H
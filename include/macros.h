@@ -19,6 +19,7 @@
 #endif
 
 #define TO_RAD (M_PI / 180.0)
+#define TO_DEG (180.0 / M_PI)
 
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
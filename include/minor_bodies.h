@@ -0,0 +1,134 @@
+/* Asteroids and comets loaded from orbital elements in the Minor Planet
+ * Center's formats:
+ *
+ * MPCORB.DAT:   https://minorplanetcenter.net/iau/info/MPOrbitFormat.html
+ * CometEls.txt: https://minorplanetcenter.net/iau/info/CometOrbitFormat.html
+ *
+ * Both formats may be mixed in one file and lines that are neither (such as
+ * the header of MPCORB.DAT) are skipped. Only elliptic orbits with an absolute
+ * magnitude are kept.
+ *
+ * Bodies are stored as structures of arrays, ordered from the brightest to the
+ * dimmest they can ever appear. Each frame, the bodies that could be within
+ * the magnitude threshold are propagated together: Kepler's equation is solved
+ * with a fixed number of iterations for each group of SIMD lanes, set by the
+ * most eccentric orbit in the group, so lanes never diverge. Only bodies above
+ * the horizon and close enough to the Sun and Earth then have their apparent
+ * magnitude computed, and those within the threshold are listed for drawing.
+ */
+
+#ifndef MINOR_BODIES_H
+#define MINOR_BODIES_H
+
+#include "core.h"
+
+#include <stdbool.h>
+
+// Longest name kept, including the terminator
+#define MINOR_BODY_NAME 32
+
+// Most Halley iterations for Kepler's equation, enough for eccentricities up
+// to 0.9999. Three are enough up to 0.8, which covers nearly every asteroid
+#define MAX_KEPLER_ITERATIONS 8
+
+/* Orbital elements of a body as read from a file, referred to the ecliptic
+ * and equinox of J2000
+ */
+struct MinorBody
+{
+    char name[MINOR_BODY_NAME];
+    bool comet;
+    double epoch;          // Julian date of the mean anomaly
+    double mean_anomaly;   // (deg)
+    double mean_motion;    // (deg/day)
+    double semi_major;     // (au)
+    double eccentricity;
+    double inclination;    // (deg)
+    double arg_perihelion; // (deg)
+    double node;           // Longitude of the ascending node (deg)
+    float abs_magnitude;   // H
+    float slope;           // G for asteroids, the activity index n for comets
+};
+
+struct MinorBodies
+{
+    int num_bodies;
+
+    // Mean anomaly (rad) at epoch and mean motion (rad/day)
+    double *epoch;
+    double *mean_anomaly;
+    double *mean_motion;
+    double *semi_major;
+    double *eccentricity;
+
+    // Directions of perihelion (P) and of the orbit's semi-minor axis (Q) in
+    // rectangular equatorial coordinates, scaled by the semi-major and
+    // semi-minor axes
+    double *px;
+    double *py;
+    double *pz;
+    double *qx;
+    double *qy;
+    double *qz;
+
+    float *abs_magnitude;
+    float *slope;
+    float *peak_magnitude; // Brightest apparent magnitude possible, increasing
+    bool *comet;
+    char (*names)[MINOR_BODY_NAME];
+
+    // Bodies [0, num_candidates) may be brighter than the threshold. Asteroids
+    // farther than distance_limit from the Sun and Earth multiplied together
+    // are dimmer than the threshold whatever their phase
+    int num_candidates;
+    float threshold;
+    double *distance_limit;
+
+    // Geocentric rectangular horizontal coordinates (au) and distance from
+    // the Sun from the most recent update, for candidates only
+    double *xh;
+    double *yh;
+    double *zh;
+    double *r;
+
+    // Bodies above the horizon and within the threshold in the most recent
+    // update, brightest peak first, with their position and magnitude
+    int *visible;
+    int num_visible;
+    double *azimuth;
+    double *altitude;
+    float *magnitude;
+};
+
+/* Parse one line of MPCORB.DAT or CometEls.txt. Returns false if the line is
+ * neither or the orbit is not elliptic
+ */
+bool parse_minor_body(const char *line, struct MinorBody *body);
+
+/* Fill minor bodies from an array of orbital elements. Every body is a
+ * candidate until set_minor_body_threshold is called. This function allocates
+ * memory which must be freed with free_minor_bodies. Returns false upon memory
+ * allocation error
+ */
+bool generate_minor_bodies(struct MinorBodies *bodies, const struct MinorBody *elements, int num_bodies);
+
+/* Read every body from a file of orbital elements. Returns false in event of
+ * a file error or if the file has no bodies
+ */
+bool load_minor_bodies(struct MinorBodies *bodies, const char *path);
+
+void free_minor_bodies(struct MinorBodies *bodies);
+
+/* Restrict updates to bodies that can be brighter than `threshold`. Returns
+ * the number of candidates
+ */
+int set_minor_body_threshold(struct MinorBodies *bodies, float threshold);
+
+/* Propagate the candidates to a julian date and list those above the horizon
+ * and within the threshold for an observer. Vectorized when SSE2 or AVX2 is
+ * available
+ */
+void update_minor_bodies(struct MinorBodies *bodies, const struct Planet *planet_table, double julian_date,
+                         double latitude, double longitude);
+
+#endif // MINOR_BODIES_H
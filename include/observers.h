@@ -0,0 +1,114 @@
+/* Positions of a few objects as seen by many observers at once, e.g. every
+ * city of the embedded database.
+ *
+ * The equatorial position of each object is found once for the epoch and
+ * turned into a direction fixed to the Earth (x towards the Greenwich
+ * meridian). What remains for each observer is a rotation that depends only on
+ * their latitude and longitude, so the rows of each observer's rotation are
+ * computed when the observers are loaded and stored as structures of arrays,
+ * and the rotation and conversion to azimuth and altitude are done for SIMD
+ * lanes of observers together.
+ *
+ * Observers are read from CSV files with one observer per line. When the first
+ * line names columns "latitude" and "longitude" (such as data/cities.csv) those
+ * columns are used, along with a "name" or "city_name" column if there is one.
+ * Otherwise lines are name,latitude,longitude or only latitude,longitude, in
+ * degrees. Fields may be quoted, and empty lines and lines starting with # are
+ * skipped.
+ *
+ * Tables of positions are CSV, with one row per observer per object:
+ *
+ *     observer,latitude,longitude,object,azimuth,altitude
+ *
+ * where objects are named as in exports (see export.h) and angles are in
+ * degrees.
+ */
+
+#ifndef OBSERVERS_H
+#define OBSERVERS_H
+
+#include "core.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+
+// Longest observer name kept, including the terminator
+#define MAX_OBSERVER_NAME 64
+
+// Longest object name, including the terminator
+#define MAX_OBJECT_NAME 16
+
+struct Observers
+{
+    int num_observers;
+    const char **names;
+    double *latitude; // (rad)
+    double *longitude;
+
+    // Rows of the rotation from Earth-fixed equatorial coordinates to each
+    // observer's horizontal coordinates. The East row has no z component
+    double *east_x;
+    double *east_y;
+    double *north_x;
+    double *north_y;
+    double *north_z;
+    double *zenith_x;
+    double *zenith_y;
+    double *zenith_z;
+
+    char *name_storage; // Names read from a file, NULL for the city database
+};
+
+struct ObservedObject
+{
+    char name[MAX_OBJECT_NAME];
+    double right_ascension; // At the epoch of the table
+    double declination;
+};
+
+/* Load every city of the embedded database as an observer, in order of name.
+ * Returns false upon memory allocation error
+ */
+bool load_city_observers(struct Observers *observers);
+
+/* Load observers from a CSV file. Returns false if the file can't be read, has
+ * a line that isn't an observer or has no observers, or upon memory allocation
+ * error
+ */
+bool load_observers(struct Observers *observers, const char *path);
+
+void free_observers(struct Observers *observers);
+
+/* Find the azimuth and altitude of an object for observers [begin, end) at a
+ * Greenwich mean sidereal time. azimuth[0] and altitude[0] are for observer
+ * begin
+ */
+void observe_object(const struct Observers *observers, int begin, int end, double right_ascension, double declination,
+                    double gmst, double *azimuth, double *altitude);
+
+/* Find the positions of objects at a Julian date. The objects are listed by
+ * name separated by commas: the Sun, planets other than the Earth and the Moon
+ * by name, and stars by their number in the star table or their name, ignoring
+ * case. A NULL list selects the Sun, planets and Moon. Returns false if an
+ * object is unknown or upon memory allocation error. The caller frees the
+ * objects
+ */
+bool select_observed_objects(const char *list, const struct Star *star_table, int num_stars,
+                             const struct Planet *planet_table, const struct Moon *moon_object, double julian_date,
+                             struct ObservedObject **objects, int *num_objects);
+
+/* Write the position of each object for each observer at a Julian date to a
+ * stream, leaving out positions below an altitude (rad). Returns false upon
+ * memory allocation or write error
+ */
+bool write_observed_positions(FILE *stream, const struct Observers *observers, const struct ObservedObject *objects,
+                              int num_objects, double julian_date, double min_altitude);
+
+/* Write the positions of config->objects at a Julian date for the observers of
+ * config->observers_path, or of every city if it is "cities", to
+ * config->output_path or stdout. Prints a message and returns false upon error
+ */
+bool observe_to_output(const struct Conf *config, const struct Star *star_table, int num_stars,
+                       const struct Planet *planet_table, const struct Moon *moon_object, double julian_date);
+
+#endif // OBSERVERS_H
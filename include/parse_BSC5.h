@@ -1,5 +1,8 @@
 /* Simple parser for the Yale Bright Star Catalog 5:
  * http://tdc-www.harvard.edu/catalogs/bsc5.html
+ *
+ * Other catalogs distributed in the same binary format (SAO, PPM, Tycho-2,
+ * ...) can be read too: http://tdc-www.harvard.edu/catalogs/catalogsb.html
  */
 
 #ifndef PARSE_BSC5_H
@@ -15,7 +18,7 @@ struct Header
     int STAR1;
     int STARN;
     int STNUM;
-    bool MPROP;
+    int MPROP;
     int NMAG;
     int NBENT;
 };
@@ -31,6 +34,40 @@ struct Entry
     float XDPM;
 };
 
+/* Read-only view of a catalog. Entries are decoded on demand straight from the
+ * catalog bytes, so a memory mapped catalog only has the pages that are
+ * actually read resident
+ */
+struct Catalog
+{
+    const uint8_t *data;
+    size_t data_size;
+    struct Header header;
+    unsigned int num_entries;
+    bool mapped; // Whether data is a file mapping owned by the catalog
+};
+
+/* Validate the header of a catalog held in memory and set up a view of it. The
+ * data must outlive the catalog. Returns false if the data is not a supported
+ * catalog
+ */
+bool open_catalog(struct Catalog *catalog, const uint8_t *data, size_t data_size);
+
+/* Memory map a catalog file and set up a view of it. The mapping must be
+ * released with close_catalog. Returns false in event of a file error
+ */
+bool map_catalog(struct Catalog *catalog, const char *path);
+
+/* Release a catalog opened with map_catalog. Does nothing for catalogs in
+ * memory
+ */
+void close_catalog(struct Catalog *catalog);
+
+/* Decode entry `index` of a catalog. Catalogs without catalog numbers are
+ * numbered by position, starting at 1, and only the first magnitude is read
+ */
+struct Entry catalog_entry(const struct Catalog *catalog, unsigned int index);
+
 /* Parse BSC5 star catalog and fill the array of entry structures (sorted by
  * increasing catalog number, the default order in the BSC5 file). This function
  * allocates memory which must be freed by the caller. Returns false in event
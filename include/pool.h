@@ -0,0 +1,51 @@
+/* Persistent pool of worker threads for data parallel loops. Workers are
+ * created once and parked on a condition variable between jobs, so handing
+ * out work every frame only costs a wake up.
+ */
+
+#ifndef POOL_H
+#define POOL_H
+
+#include <pthread.h>
+#include <stdbool.h>
+
+/* Process items [begin, end). Called concurrently on disjoint ranges
+ */
+typedef void (*pool_task)(void *context, int begin, int end);
+
+struct Pool
+{
+    int num_threads; // Including the calling thread
+    pthread_t *workers;
+
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_cond_t done;
+
+    // Current job, valid while pending > 0
+    unsigned long generation;
+    int pending;
+    bool quit;
+    pool_task task;
+    void *context;
+    int count;
+    int chunk;
+};
+
+/* Start a pool that runs jobs across `num_threads` threads, the caller of
+ * pool_run being one of them. Returns false if the threads could not be
+ * created
+ */
+bool pool_create(struct Pool *pool, int num_threads);
+
+/* Split [0, count) into one contiguous chunk per thread and run `task` on each,
+ * returning once all chunks are complete. Chunk boundaries are multiples of
+ * `grain`, so items that are processed in groups are never split
+ */
+void pool_run(struct Pool *pool, pool_task task, void *context, int count, int grain);
+
+/* Stop and join all worker threads
+ */
+void pool_destroy(struct Pool *pool);
+
+#endif // POOL_H
@@ -0,0 +1,134 @@
+/* Recording and replay of sessions. A recording holds the cells of every frame
+ * drawn, so a session rendered once, e.g. a year at high speed, can be played
+ * back without computing a single position.
+ *
+ * Each frame is stored as the cells that differ from the frame before it.
+ * Every RECORDING_KEYFRAME_INTERVAL frames, a keyframe is stored instead as the
+ * cells that differ from a blank frame, so any frame is rebuilt from the
+ * keyframe before it and at most RECORDING_KEYFRAME_INTERVAL - 1 deltas.
+ *
+ * Recordings are little endian. A header
+ *
+ *     char magic[8]           "ASTROREC"
+ *     uint32_t version        1
+ *     uint32_t height         Rows and columns of every frame
+ *     uint32_t width
+ *     uint32_t keyframe_interval
+ *
+ * is followed by the frames, then by an index of every frame
+ *
+ *     uint64_t offset         From the start of the recording
+ *     uint64_t time           When the frame is shown (µs from the start)
+ *
+ * and a trailer
+ *
+ *     uint64_t num_frames
+ *     uint64_t end            When the last frame stops being shown (µs)
+ *     uint64_t index_offset
+ *
+ * A frame is a list of runs of changed cells in row major order. Integers are
+ * unsigned LEB128 varints:
+ *
+ *     varint num_runs
+ *     for each run:
+ *         varint skip         Unchanged cells since the end of the last run
+ *         varint length
+ *         for each cell:
+ *             varint codepoint << 1 | has_attributes
+ *             if has_attributes: varint color_pair, varint variation
+ */
+
+#ifndef RECORDING_H
+#define RECORDING_H
+
+#include "canvas.h"
+#include "core.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define RECORDING_MAGIC "ASTROREC"
+#define RECORDING_VERSION 1
+#define RECORDING_KEYFRAME_INTERVAL 240
+
+// Sizes in bytes of the header, of an entry of the index, and of the trailer
+#define RECORDING_HEADER_SIZE 24
+#define RECORDING_INDEX_SIZE 16
+#define RECORDING_TRAILER_SIZE 24
+
+struct Recorder
+{
+    FILE *stream;
+    struct Canvas previous; // Frame last recorded
+    struct Canvas frame;    // Frame being recorded
+    uint8_t *buffer;        // Encoded frame, large enough for any frame
+    uint64_t *index;        // Offset and time of each frame recorded
+    long num_frames;
+    long capacity;
+    uint64_t offset; // Bytes written
+};
+
+struct Recording
+{
+    uint8_t *data;
+    size_t size;
+    int height;
+    int width;
+    long num_frames;
+    long keyframe_interval;
+    unsigned long long end;
+    const uint8_t *index;
+
+    struct Canvas canvas; // Frame last seeked to
+    long frame;           // -1 before the first seek
+};
+
+/* Create a recording of frames of `height` rows and `width` columns. This
+ * function allocates memory which is freed by recorder_close. Returns false
+ * upon memory allocation or write error
+ */
+bool recorder_open(struct Recorder *recorder, const char *path, int height, int width);
+
+/* Record the cells of an in-memory canvas as the frame shown at `time` (µs
+ * from the start). Cells outside of the canvas are recorded blank, so the
+ * canvas may change size. Returns false upon memory allocation or write error
+ */
+bool record_frame(struct Recorder *recorder, const struct Canvas *canvas, unsigned long long time);
+
+/* Write the index and trailer, with the last frame shown until `end` (µs from
+ * the start), and free the recorder. Returns false upon write error
+ */
+bool recorder_close(struct Recorder *recorder, unsigned long long end);
+
+/* Read a recording. This function allocates memory which must be freed with
+ * close_recording. Returns false upon read or memory allocation error, or if
+ * the file is not a recording
+ */
+bool open_recording(struct Recording *recording, const char *path);
+
+void close_recording(struct Recording *recording);
+
+/* Rebuild frame `frame` in recording->canvas. Frames after the current one
+ * are reached by applying deltas, others from the keyframe before them.
+ * Returns false if the frame is out of range or corrupt
+ */
+bool seek_recording(struct Recording *recording, long frame);
+
+/* Time (µs from the start) when a frame is shown
+ */
+unsigned long long recording_frame_time(const struct Recording *recording, long frame);
+
+/* Frame shown at `time` (µs from the start): the last frame whose time is not
+ * after it
+ */
+long recording_frame_at(const struct Recording *recording, unsigned long long time);
+
+/* Play back config->replay_path in the terminal, or with config->headless write
+ * its frames like headless frames. Frames are taken at config->fps, each the
+ * recorded frame shown at that time, so playback keeps the recorded timing
+ * whatever the rate. Prints a message and returns false upon error
+ */
+bool replay_recording(const struct Conf *config);
+
+#endif // RECORDING_H
@@ -0,0 +1,58 @@
+/* Predict when the drawn sky next changes, so it can be left on screen until
+ * then.
+ *
+ * Between updates the sky turns about the celestial pole at the sidereal rate.
+ * For each drawn point, its position on the stereographic projection and its
+ * velocity in cells give the time until it crosses a cell boundary, or rises
+ * or sets. The earliest of these is when the next redraw is due. The Moon and
+ * planets also move against the stars, but slowly enough that the rate is only
+ * padded for them.
+ */
+
+#ifndef REDRAW_H
+#define REDRAW_H
+
+#include "core.h"
+#include "minor_bodies.h"
+
+struct RedrawPrediction
+{
+    int height; // Size of the projection in cells
+    int width;
+    double rate;          // Angular speed of the sky (rad per second of real time)
+    double turn[2][3][3]; // Rotations of the sky a step back and forth, in
+                          // rectangular horizontal coordinates (east, north, up)
+    double seconds;       // Earliest change predicted so far (s of real time)
+};
+
+/* Start a prediction for a projection of `height` by `width` cells, with time
+ * running `speed` times faster than real time. Nothing is predicted to change
+ * sooner than `max_seconds` until points are added
+ */
+void begin_redraw_prediction(struct RedrawPrediction *prediction, int height, int width, double latitude, float speed,
+                             double max_seconds);
+
+/* Add an object drawn at its position while above the horizon
+ */
+void predict_object_change(struct RedrawPrediction *prediction, double azimuth, double altitude);
+
+/* Add the stars drawn by render_stars_stereo
+ */
+void predict_stars_change(struct RedrawPrediction *prediction, const struct Star *star_table, int num_stars,
+                          const int *num_by_mag);
+
+/* Add the ends of the constellation segments drawn by render_constells. An
+ * end below the horizon is drawn clipped to it and still moves along it
+ */
+void predict_constells_change(struct RedrawPrediction *prediction, const struct ConstellTable *constell_table,
+                              const struct Star *star_table);
+
+/* Add the Sun and planets drawn by render_planets_stereo
+ */
+void predict_planets_change(struct RedrawPrediction *prediction, const struct Planet *planet_table);
+
+/* Add the asteroids and comets drawn by render_minor_bodies_stereo
+ */
+void predict_minor_bodies_change(struct RedrawPrediction *prediction, const struct MinorBodies *bodies);
+
+#endif // REDRAW_H
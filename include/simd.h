@@ -0,0 +1,185 @@
+/* Minimal portable layer over SSE2 and AVX2 double precision vectors, along
+ * with the handful of transcendental functions the position kernels need.
+ *
+ * The widest instruction set enabled at compile time is used (e.g. build with
+ * -mavx2 or -march=native for AVX2). When neither is available SIMD_LANES is
+ * defined as 1 and callers are expected to take their scalar path instead.
+ *
+ * The trigonometric approximations are accurate to roughly 1e-15 over the
+ * documented domains, which is well beyond what a terminal can display.
+ */
+
+#ifndef SIMD_H
+#define SIMD_H
+
+#include "macros.h"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+#define SIMD_LANES 4
+
+typedef __m256d vf64;
+
+#define v_load(p) _mm256_loadu_pd(p)
+#define v_store(p, a) _mm256_storeu_pd(p, a)
+#define v_set1(d) _mm256_set1_pd(d)
+#define v_add(a, b) _mm256_add_pd(a, b)
+#define v_sub(a, b) _mm256_sub_pd(a, b)
+#define v_mul(a, b) _mm256_mul_pd(a, b)
+#define v_div(a, b) _mm256_div_pd(a, b)
+#define v_sqrt(a) _mm256_sqrt_pd(a)
+#define v_min(a, b) _mm256_min_pd(a, b)
+#define v_max(a, b) _mm256_max_pd(a, b)
+#define v_and(a, b) _mm256_and_pd(a, b)
+#define v_andnot(a, b) _mm256_andnot_pd(a, b)
+#define v_or(a, b) _mm256_or_pd(a, b)
+#define v_xor(a, b) _mm256_xor_pd(a, b)
+#define v_lt(a, b) _mm256_cmp_pd(a, b, _CMP_LT_OQ)
+#define v_gt(a, b) _mm256_cmp_pd(a, b, _CMP_GT_OQ)
+
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+#include <emmintrin.h>
+
+#define SIMD_LANES 2
+
+typedef __m128d vf64;
+
+#define v_load(p) _mm_loadu_pd(p)
+#define v_store(p, a) _mm_storeu_pd(p, a)
+#define v_set1(d) _mm_set1_pd(d)
+#define v_add(a, b) _mm_add_pd(a, b)
+#define v_sub(a, b) _mm_sub_pd(a, b)
+#define v_mul(a, b) _mm_mul_pd(a, b)
+#define v_div(a, b) _mm_div_pd(a, b)
+#define v_sqrt(a) _mm_sqrt_pd(a)
+#define v_min(a, b) _mm_min_pd(a, b)
+#define v_max(a, b) _mm_max_pd(a, b)
+#define v_and(a, b) _mm_and_pd(a, b)
+#define v_andnot(a, b) _mm_andnot_pd(a, b)
+#define v_or(a, b) _mm_or_pd(a, b)
+#define v_xor(a, b) _mm_xor_pd(a, b)
+#define v_lt(a, b) _mm_cmplt_pd(a, b)
+#define v_gt(a, b) _mm_cmpgt_pd(a, b)
+
+#else
+
+#define SIMD_LANES 1
+
+#endif
+
+#if SIMD_LANES > 1
+
+/* Select b where mask is set, otherwise a
+ */
+static inline vf64 v_select(vf64 mask, vf64 a, vf64 b)
+{
+    return v_or(v_and(mask, b), v_andnot(mask, a));
+}
+
+static inline vf64 v_abs(vf64 a)
+{
+    return v_andnot(v_set1(-0.0), a);
+}
+
+/* Round to the nearest integer, ties to even, for |a| < 2^51. Adding 1.5 * 2^52
+ * leaves no bits for the fraction, so the addition itself rounds
+ */
+static inline vf64 v_round(vf64 a)
+{
+    const vf64 magic = v_set1(6755399441055744.0);
+    return v_sub(v_add(a, magic), magic);
+}
+
+/* Compute the sine and cosine of x for |x| <= π. The angle is halved so the
+ * Taylor series converge quickly, then recombined with the double angle
+ * identities
+ */
+static inline void v_sincos(vf64 x, vf64 *sin_out, vf64 *cos_out)
+{
+    vf64 h = v_mul(x, v_set1(0.5));
+    vf64 z = v_mul(h, h);
+
+    // sin(h) = h * (1 - h²/3! + h⁴/5! - ... - h¹⁸/19!)
+    vf64 s = v_set1(-1.0 / 121645100408832000.0);
+    s = v_add(v_mul(s, z), v_set1(1.0 / 355687428096000.0));
+    s = v_add(v_mul(s, z), v_set1(-1.0 / 1307674368000.0));
+    s = v_add(v_mul(s, z), v_set1(1.0 / 6227020800.0));
+    s = v_add(v_mul(s, z), v_set1(-1.0 / 39916800.0));
+    s = v_add(v_mul(s, z), v_set1(1.0 / 362880.0));
+    s = v_add(v_mul(s, z), v_set1(-1.0 / 5040.0));
+    s = v_add(v_mul(s, z), v_set1(1.0 / 120.0));
+    s = v_add(v_mul(s, z), v_set1(-1.0 / 6.0));
+    s = v_add(v_mul(s, z), v_set1(1.0));
+    s = v_mul(s, h);
+
+    // cos(h) = 1 - h²/2! + h⁴/4! - ... + h²⁰/20!
+    vf64 c = v_set1(1.0 / 2432902008176640000.0);
+    c = v_add(v_mul(c, z), v_set1(-1.0 / 6402373705728000.0));
+    c = v_add(v_mul(c, z), v_set1(1.0 / 20922789888000.0));
+    c = v_add(v_mul(c, z), v_set1(-1.0 / 87178291200.0));
+    c = v_add(v_mul(c, z), v_set1(1.0 / 479001600.0));
+    c = v_add(v_mul(c, z), v_set1(-1.0 / 3628800.0));
+    c = v_add(v_mul(c, z), v_set1(1.0 / 40320.0));
+    c = v_add(v_mul(c, z), v_set1(-1.0 / 720.0));
+    c = v_add(v_mul(c, z), v_set1(1.0 / 24.0));
+    c = v_add(v_mul(c, z), v_set1(-1.0 / 2.0));
+    c = v_add(v_mul(c, z), v_set1(1.0));
+
+    *sin_out = v_mul(v_set1(2.0), v_mul(s, c));
+    *cos_out = v_sub(v_set1(1.0), v_mul(v_set1(2.0), v_mul(s, s)));
+}
+
+/* Four quadrant arctangent of y/x with the same conventions as atan2().
+ * Arguments are reduced to [0, 1] and evaluated with the Cephes rational
+ * approximation for atan
+ */
+static inline vf64 v_atan2(vf64 y, vf64 x)
+{
+    const vf64 zero = v_set1(0.0);
+    const vf64 one = v_set1(1.0);
+
+    vf64 ay = v_abs(y);
+    vf64 ax = v_abs(x);
+
+    // Reduce to t = min / max so that t ∈ [0, 1]
+    vf64 swap = v_gt(ay, ax);
+    vf64 num = v_select(swap, ay, ax);
+    vf64 den = v_select(swap, ax, ay);
+    vf64 t = v_and(v_div(num, den), v_gt(den, zero)); // atan2(0, 0) = 0
+
+    // Further reduce t > 0.66 using atan(t) = π/4 + atan((t - 1) / (t + 1))
+    vf64 big = v_gt(t, v_set1(0.66));
+    vf64 u = v_select(big, t, v_div(v_sub(t, one), v_add(t, one)));
+    vf64 base = v_and(big, v_set1(M_PI / 4.0 + 0.5 * 6.123233995736765886130e-17));
+
+    vf64 z = v_mul(u, u);
+
+    vf64 p = v_set1(-8.750608600031904122785e-1);
+    p = v_add(v_mul(p, z), v_set1(-1.615753718733365076637e1));
+    p = v_add(v_mul(p, z), v_set1(-7.500855792314704667340e1));
+    p = v_add(v_mul(p, z), v_set1(-1.228866684490136173410e2));
+    p = v_add(v_mul(p, z), v_set1(-6.485021904942025371773e1));
+
+    vf64 q = v_add(z, v_set1(2.485846490142306297962e1));
+    q = v_add(v_mul(q, z), v_set1(1.650270098316988542046e2));
+    q = v_add(v_mul(q, z), v_set1(4.328810604912902668951e2));
+    q = v_add(v_mul(q, z), v_set1(4.853903996359136964868e2));
+    q = v_add(v_mul(q, z), v_set1(1.945506571482613964425e2));
+
+    vf64 r = v_add(v_mul(u, v_div(v_mul(z, p), q)), u);
+    r = v_add(r, base);
+
+    // Undo the reductions
+    r = v_select(swap, r, v_sub(v_set1(M_PI / 2.0), r));
+    r = v_select(v_lt(x, zero), r, v_sub(v_set1(M_PI), r));
+    r = v_xor(r, v_and(y, v_set1(-0.0))); // Copy sign of y
+
+    return r;
+}
+
+#endif // SIMD_LANES > 1
+
+#endif // SIMD_H
@@ -0,0 +1,126 @@
+/* Structure-of-arrays copy of the star table used by the per-frame position
+ * kernel. Keeping each field in its own contiguous array lets the kernel stream
+ * through the catalog with SIMD loads instead of striding over `struct Star`.
+ *
+ * Each star's J2000 direction is stored as a unit vector so that the per-frame
+ * equatorial to horizontal conversion is a single 3x3 rotation shared by every
+ * star. Trigonometry is deferred until a star is known to be drawn.
+ *
+ * Stars are bucketed into equal-area tiles of the sky. Each frame, tiles that
+ * lie entirely below the horizon are skipped without touching their stars.
+ * Within a tile stars are stored from dimmest to brightest, so the stars within
+ * the magnitude threshold are a contiguous tail of the tile.
+ */
+
+#ifndef STAR_BUFFER_H
+#define STAR_BUFFER_H
+
+#include "arena.h"
+#include "core.h"
+#include "pool.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Tiles are bounded by lines of constant right ascension and constant
+// sin(declination), which makes every tile cover the same solid angle
+#define STAR_TILE_BANDS 16
+#define STAR_TILE_SEGMENTS 32
+#define NUM_STAR_TILES (STAR_TILE_BANDS * STAR_TILE_SEGMENTS)
+
+struct StarTile
+{
+    // Stars [begin, end) of the buffer are in this tile. Stars before
+    // first_visible are dimmer than the threshold
+    int begin;
+    int first_visible;
+    int end;
+
+    // Cone containing the tile, and the fastest proper motion in it (1/year)
+    double center[3];
+    double radius;
+    double max_rate;
+
+    bool culled; // Entirely below the horizon in the most recent update
+    bool marked; // Visible stars marked below the horizon in the star table
+};
+
+struct StarBuffer
+{
+    int num_stars;
+
+    // J2000 direction in rectangular equatorial coordinates and its rate of
+    // change due to proper motion (1/year)
+    double *x;
+    double *y;
+    double *z;
+    double *dx;
+    double *dy;
+    double *dz;
+
+    float *magnitude;
+    int *table_index; // Index of each star in the star table
+
+    // Rectangular horizontal coordinates from the most recent update. Only
+    // stars of tiles that were not culled are updated
+    double *xh;
+    double *yh;
+    double *zh;
+
+    struct StarTile *tiles;
+    int *active_tiles; // Indices of tiles not culled in the most recent update
+    int num_active;
+
+    // Stars updated even when their tile is culled, and their tiles
+    int *pinned;
+    int *pinned_tiles;
+    int num_pinned;
+};
+
+/* Space taken in an arena by the star buffer of `num_stars` stars with the
+ * stars of `num_segments` constellation segments pinned
+ */
+size_t star_buffer_arena_size(int num_stars, unsigned int num_segments);
+
+/* Fill a star buffer from an array of star structs, bucketed into tiles and
+ * within each tile in the order given by num_by_mag (see
+ * star_numbers_by_magnitude). Every star is visible until
+ * set_star_buffer_threshold is called. The buffer is allocated from the arena.
+ * Returns false upon memory allocation error
+ */
+bool generate_star_buffer(struct Arena *arena, struct StarBuffer *buffer, const struct Star *star_table,
+                          const int *num_by_mag, int num_stars);
+
+/* Keep updating the stars of constellation figures even when their tile is
+ * culled, since figures are drawn towards endpoints below the horizon. Called
+ * at most once per buffer. Returns false upon memory allocation error
+ */
+bool pin_constellation_stars(struct Arena *arena, struct StarBuffer *buffer,
+                             const struct ConstellTable *constell_table);
+
+/* Binary search each tile for the first star no dimmer than `threshold` and
+ * restrict updates to those stars. Returns the number of dimmer stars, which
+ * is the offset of the visible stars in num_by_mag
+ */
+int set_star_buffer_threshold(struct StarBuffer *buffer, float threshold);
+
+/* Cull tiles below the horizon and update the rectangular horizontal
+ * coordinates of the visible stars in the remaining tiles for a given
+ * observation time and location. Vectorized when SSE2 or AVX2 is available
+ */
+void update_star_buffer(struct StarBuffer *buffer, double julian_date, double latitude, double longitude);
+
+/* Convert the horizontal coordinates of the visible stars to azimuth and
+ * altitude and store them in the star table for rendering. Visible stars in
+ * culled tiles are given an altitude of -π/2. Other stars are left untouched
+ */
+void star_buffer_to_table(struct StarBuffer *buffer, struct Star *star_table);
+
+/* Equivalent to update_star_buffer followed by star_buffer_to_table, with the
+ * tiles that are not culled split across the threads of a pool. Results are
+ * bit identical to the single-threaded path
+ */
+void update_stars_parallel(struct Pool *pool, struct StarBuffer *buffer, struct Star *star_table, double julian_date,
+                           double latitude, double longitude);
+
+#endif // STAR_BUFFER_H
@@ -49,6 +49,11 @@ int sw_gettime(struct SwTimestamp *stamp);
  */
 int sw_timediff_usec(struct SwTimestamp end, struct SwTimestamp begin, unsigned long long *diff);
 
+/* Set the difference between two timestamps in nanoseconds. Resolution is that
+ * of the underlying clock. Returns 0 on success -1 on failure
+ */
+int sw_timediff_nsec(struct SwTimestamp end, struct SwTimestamp begin, unsigned long long *diff);
+
 /* Sleep for the specified number of microseconds. Returns 0 on success and -1
  * on failure
  */
@@ -5,6 +5,7 @@
 #define TERM_H
 
 #include <curses.h>
+#include <stdbool.h>
 #ifdef _WIN32
 #include <windows.h>
 #endif
@@ -51,6 +52,35 @@ float get_cell_aspect_ratio(void);
  */
 void mvwaddstr_truncate(WINDOW *win, int y, int x, const char *str);
 
+/* Total bytes written and write calls made by this process so far, as counted
+ * by the kernel. Curses writes the whole frame in doupdate, so the difference
+ * over a call is what the frame sent to the terminal. Returns false where the
+ * counts are not available (only Linux keeps them)
+ */
+bool output_counters(unsigned long long *bytes, unsigned long long *writes);
+
+/* Time between frames (µs) that keeps frames of `frame_bytes` within a budget
+ * of `bytes_per_sec`, and never shorter than `dt`. A budget of 0 is unlimited
+ */
+unsigned long long paced_frame_usec(unsigned long long dt, double frame_bytes, double bytes_per_sec);
+
+/* Catch resizes of the terminal from now on
+ */
+void catch_term_resizes(void);
+
+/* Whether the terminal was resized since curses was last resized to it
+ */
+bool term_resized(void);
+
+/* Resize curses to the terminal
+ */
+void resize_ncurses(void);
+
+/* Wait up to `usec` for a key to be pressed or the terminal to be resized. A
+ * key pressed is left for the next getch
+ */
+void wait_for_input(unsigned long long usec);
+
 /* Check for window resizing on windows
  */
 #ifdef _WIN32
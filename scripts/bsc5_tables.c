@@ -0,0 +1,194 @@
+/* Generate the star, magnitude order and constellation tables of the embedded
+ * Yale Bright Star Catalog
+ *
+ * Usage: bsc5_tables <bsc5> <bsc5_names.txt> <bsc5_constellations.txt>
+ *            > include/bsc5_tables.h
+ *
+ * The tables are built with the same functions the program used to run at
+ * every launch (generate_star_table, generate_name_table,
+ * generate_constell_table and star_numbers_by_magnitude), then written out as
+ * const arrays. Startup then parses and sorts nothing, and the tables are
+ * shared read-only pages of the executable.
+ */
+
+#include "arena.h"
+#include "core.h"
+#include "parse_BSC5.h"
+#include "src/arena.c"
+#include "src/astro.c"
+#include "src/bit.c"
+#include "src/core.c"
+#include "src/parse_BSC5.c"
+#include "src/strptime.c"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Read a whole file. Returns NULL upon error
+static uint8_t *read_file(const char *path, size_t *size)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Unable to open '%s'\n", path);
+        return NULL;
+    }
+
+    uint8_t *data = NULL;
+    size_t length = 0;
+    size_t capacity = 0;
+    for (;;)
+    {
+        if (length == capacity)
+        {
+            capacity = MAX(2 * capacity, 4096);
+            uint8_t *temp = realloc(data, capacity);
+            if (temp == NULL)
+            {
+                fprintf(stderr, "Allocation of memory for '%s' failed\n", path);
+                free(data);
+                fclose(file);
+                return NULL;
+            }
+            data = temp;
+        }
+
+        size_t read = fread(data + length, 1, capacity - length, file);
+        if (read == 0)
+        {
+            break;
+        }
+        length += read;
+    }
+    fclose(file);
+
+    *size = length;
+    return data;
+}
+
+// Write a string literal, escaping characters that would end it
+static void print_literal(const char *str)
+{
+    if (str == NULL)
+    {
+        printf("NULL");
+        return;
+    }
+
+    putchar('"');
+    for (const char *p = str; *p != '\0'; ++p)
+    {
+        if (*p == '"' || *p == '\\')
+        {
+            putchar('\\');
+        }
+        putchar(*p);
+    }
+    putchar('"');
+}
+
+// Doubles are written with enough digits to be read back exactly, as are
+// floats through the double they convert to
+static void print_star(const struct Star *star)
+{
+    printf("    {.base = {.symbol_ASCII = '%c', .symbol_unicode = ", star->base.symbol_ASCII);
+    print_literal(star->base.symbol_unicode);
+    printf(", .label = ");
+    print_literal(star->base.label);
+    printf("}, .catalog_number = %d, .right_ascension = %.17g, .declination = %.17g, .ra_motion = %.17g, "
+           ".dec_motion = %.17g, .magnitude = %.17g},\n",
+           star->catalog_number, star->right_ascension, star->declination, star->ra_motion, star->dec_motion,
+           (double)star->magnitude);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 4)
+    {
+        fprintf(stderr, "Usage: %s <bsc5> <bsc5_names.txt> <bsc5_constellations.txt>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    size_t catalog_size, names_size, constells_size;
+    uint8_t *catalog_data = read_file(argv[1], &catalog_size);
+    uint8_t *names_data = read_file(argv[2], &names_size);
+    uint8_t *constells_data = read_file(argv[3], &constells_size);
+    if (catalog_data == NULL || names_data == NULL || constells_data == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+
+    struct Catalog catalog;
+    struct Arena arena;
+    struct StarName *name_table = NULL;
+    struct ConstellTable constell_table;
+    struct Star *star_table = NULL;
+    int *num_by_mag = NULL;
+    unsigned int num_stars;
+
+    bool s = true;
+    s = s && open_catalog(&catalog, catalog_data, catalog_size);
+    s = s && arena_create(&arena, name_table_arena_size(names_size, catalog.num_entries) +
+                                      constell_table_arena_size(constells_data, constells_size) +
+                                      star_tables_arena_size(catalog.num_entries) +
+                                      star_sort_arena_size(catalog.num_entries));
+    s = s && generate_name_table(&arena, names_data, names_size, &name_table, catalog.num_entries);
+    s = s && generate_constell_table(&arena, constells_data, constells_size, &constell_table);
+    num_stars = catalog.num_entries;
+    s = s && generate_star_table(&arena, &star_table, num_stars, &catalog, name_table, INFINITY);
+    s = s && star_numbers_by_magnitude(&arena, &num_by_mag, star_table, num_stars);
+    if (!s)
+    {
+        fprintf(stderr, "Unable to generate the tables of '%s'\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    printf("/* Generated by scripts/bsc5_tables.c from %s, %s and %s. Do not edit\n */\n\n", argv[1], argv[2],
+           argv[3]);
+    printf("#include \"core.h\"\n\n");
+    unsigned int num_const = constell_table.num_constells;
+    unsigned int num_segments = constell_table.offsets[num_const];
+    printf("#define BSC5_NUM_STARS %u\n", num_stars);
+    printf("#define BSC5_NUM_CONSTELLS %u\n", num_const);
+    printf("#define BSC5_NUM_CONSTELL_SEGMENTS %u\n\n", num_segments);
+
+    printf("static const struct Star bsc5_stars[BSC5_NUM_STARS] = {\n");
+    for (unsigned int i = 0; i < num_stars; ++i)
+    {
+        print_star(&star_table[i]);
+    }
+    printf("};\n\n");
+
+    printf("static const int bsc5_num_by_mag[BSC5_NUM_STARS] = {\n");
+    for (unsigned int i = 0; i < num_stars; ++i)
+    {
+        printf("%s%d,%s", i % 12 == 0 ? "    " : "", num_by_mag[i], i % 12 == 11 || i + 1 == num_stars ? "\n" : " ");
+    }
+    printf("};\n\n");
+
+    // First segment of every figure, and of the figure past the last
+    printf("static const unsigned int bsc5_constell_offsets[BSC5_NUM_CONSTELLS + 1] = {\n");
+    for (unsigned int c = 0; c <= num_const; ++c)
+    {
+        printf("%s%u,%s", c % 12 == 0 ? "    " : "", constell_table.offsets[c], c % 12 == 11 || c == num_const ? "\n" : " ");
+    }
+    printf("};\n\n");
+
+    // Star table indices of the ends of the segments, one figure per line
+    printf("static const int bsc5_constell_ends[2 * BSC5_NUM_CONSTELL_SEGMENTS] = {\n");
+    for (unsigned int c = 0; c < num_const; ++c)
+    {
+        unsigned int begin = 2 * constell_table.offsets[c];
+        unsigned int end = 2 * constell_table.offsets[c + 1];
+        printf("    ");
+        for (unsigned int i = begin; i < end; ++i)
+        {
+            printf("%d,%s", constell_table.ends[i], i + 1 < end ? " " : "\n");
+        }
+    }
+    printf("};\n");
+
+    return EXIT_SUCCESS;
+}
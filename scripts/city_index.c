@@ -0,0 +1,301 @@
+/* Generate the city lookup table from data/cities.csv
+ *
+ * Usage: city_index <cities.csv> > include/city_index.h
+ *
+ * Cities are placed with a minimal perfect hash (hash and displace): every
+ * normalized name first hashes to a bucket, and each bucket stores the seed
+ * of a second hash that sends all of its names to distinct, otherwise unused
+ * slots. Looking up a name then takes two hashes and one comparison. Of
+ * cities that share a name, only the most populous is kept.
+ */
+
+#include "city_hash.h"
+#include "src/city_hash.c"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LINE_LENGTH 1024
+#define MAX_FIELDS 6
+#define MAX_SEED 100000000u
+
+// Average number of names per bucket
+#define BUCKET_SIZE 4
+
+struct City
+{
+    char *name;
+    char key[MAX_CITY_NAME];
+    long population;
+    double latitude;
+    double longitude;
+};
+
+struct Bucket
+{
+    uint32_t index;
+    int *cities;
+    int size;
+};
+
+// Split a CSV line in place, handling double quoted fields. Returns the number
+// of fields
+static int split_csv(char *line, char *fields[MAX_FIELDS])
+{
+    int num_fields = 0;
+    char *p = line;
+
+    while (num_fields < MAX_FIELDS)
+    {
+        char *out = p;
+        fields[num_fields++] = p;
+
+        bool quoted = *p == '"';
+        if (quoted)
+        {
+            p++;
+        }
+
+        while (*p != '\0')
+        {
+            if (quoted && *p == '"')
+            {
+                if (p[1] == '"')
+                {
+                    // Escaped quote
+                    *out++ = '"';
+                    p += 2;
+                    continue;
+                }
+                quoted = false;
+                p++;
+                continue;
+            }
+            if (!quoted && (*p == ',' || *p == '\n' || *p == '\r'))
+            {
+                break;
+            }
+            *out++ = *p++;
+        }
+
+        char end = *p;
+        *out = '\0';
+        if (end != ',')
+        {
+            break;
+        }
+        p++;
+    }
+
+    return num_fields;
+}
+
+static char *copy_string(const char *str)
+{
+    char *copy = malloc(strlen(str) + 1);
+    if (copy == NULL)
+    {
+        fprintf(stderr, "Allocation of memory for city failed\n");
+        exit(EXIT_FAILURE);
+    }
+    return strcpy(copy, str);
+}
+
+static int compare_buckets(const void *a, const void *b)
+{
+    const struct Bucket *x = a;
+    const struct Bucket *y = b;
+    if (x->size != y->size)
+    {
+        return y->size - x->size;
+    }
+    return (x->index > y->index) - (x->index < y->index);
+}
+
+// Write a string literal, escaping characters that would end it
+static void print_literal(const char *str)
+{
+    putchar('"');
+    for (const char *p = str; *p != '\0'; ++p)
+    {
+        if (*p == '"' || *p == '\\')
+        {
+            putchar('\\');
+        }
+        putchar(*p);
+    }
+    putchar('"');
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <cities.csv>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    FILE *file = fopen(argv[1], "r");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Unable to open '%s'\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    struct City *cities = NULL;
+    int num_cities = 0;
+
+    char line[MAX_LINE_LENGTH];
+    bool header = true;
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char *fields[MAX_FIELDS];
+        if (header)
+        {
+            header = false;
+            continue;
+        }
+        if (split_csv(line, fields) != MAX_FIELDS)
+        {
+            continue;
+        }
+
+        // city_name,population,country_code,timezone,latitude,longitude
+        struct City city = {
+            .population = atol(fields[1]),
+        };
+        if (!normalize_city_name(fields[0], city.key, sizeof(city.key)) || city.key[0] == '\0')
+        {
+            fprintf(stderr, "Skipping city name '%s'\n", fields[0]);
+            continue;
+        }
+
+        // Keep the most populous city of each name
+        int existing = -1;
+        for (int i = 0; i < num_cities; ++i)
+        {
+            if (strcmp(cities[i].key, city.key) == 0)
+            {
+                existing = i;
+                break;
+            }
+        }
+        if (existing >= 0 && cities[existing].population >= city.population)
+        {
+            continue;
+        }
+
+        city.name = copy_string(fields[0]);
+        city.latitude = strtod(fields[4], NULL);
+        city.longitude = strtod(fields[5], NULL);
+
+        if (existing >= 0)
+        {
+            cities[existing] = city;
+            continue;
+        }
+
+        struct City *temp = realloc(cities, (num_cities + 1) * sizeof(struct City));
+        if (temp == NULL)
+        {
+            fprintf(stderr, "Allocation of memory for cities failed\n");
+            return EXIT_FAILURE;
+        }
+        cities = temp;
+        cities[num_cities++] = city;
+    }
+    fclose(file);
+
+    if (num_cities == 0)
+    {
+        fprintf(stderr, "No cities in '%s'\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    // Group names by their first hash
+    uint32_t num_buckets = (num_cities + BUCKET_SIZE - 1) / BUCKET_SIZE;
+    struct Bucket *buckets = calloc(num_buckets, sizeof(struct Bucket));
+    for (uint32_t b = 0; b < num_buckets; ++b)
+    {
+        buckets[b].index = b;
+        buckets[b].cities = malloc(num_cities * sizeof(int));
+    }
+    for (int i = 0; i < num_cities; ++i)
+    {
+        struct Bucket *bucket = &buckets[hash_city_name(cities[i].key, 0) % num_buckets];
+        bucket->cities[bucket->size++] = i;
+    }
+
+    // Place the largest buckets first, while most slots are still free
+    qsort(buckets, num_buckets, sizeof(struct Bucket), compare_buckets);
+
+    uint32_t num_slots = num_cities;
+    int *slots = malloc(num_slots * sizeof(int));
+    uint32_t *seeds = calloc(num_buckets, sizeof(uint32_t));
+    uint32_t *placed = malloc(num_cities * sizeof(uint32_t));
+    for (uint32_t s = 0; s < num_slots; ++s)
+    {
+        slots[s] = -1;
+    }
+
+    for (uint32_t b = 0; b < num_buckets && buckets[b].size > 0; ++b)
+    {
+        struct Bucket *bucket = &buckets[b];
+
+        uint32_t seed;
+        for (seed = 1; seed < MAX_SEED; ++seed)
+        {
+            bool fits = true;
+            for (int i = 0; i < bucket->size && fits; ++i)
+            {
+                placed[i] = hash_city_name(cities[bucket->cities[i]].key, seed) % num_slots;
+                fits = slots[placed[i]] < 0;
+                for (int j = 0; j < i && fits; ++j)
+                {
+                    fits = placed[j] != placed[i];
+                }
+            }
+            if (fits)
+            {
+                break;
+            }
+        }
+        if (seed == MAX_SEED)
+        {
+            fprintf(stderr, "Unable to find a perfect hash for the cities\n");
+            return EXIT_FAILURE;
+        }
+
+        seeds[bucket->index] = seed;
+        for (int i = 0; i < bucket->size; ++i)
+        {
+            slots[placed[i]] = bucket->cities[i];
+        }
+    }
+
+    printf("/* Generated by scripts/city_index.c from %s. Do not edit\n */\n\n", argv[1]);
+    printf("#define CITY_INDEX_BUCKETS %u\n", num_buckets);
+    printf("#define CITY_INDEX_SLOTS %u\n\n", num_slots);
+
+    printf("static const uint32_t city_seeds[CITY_INDEX_BUCKETS] = {\n");
+    for (uint32_t b = 0; b < num_buckets; ++b)
+    {
+        printf("%s%u,%s", b % 12 == 0 ? "    " : "", seeds[b], b % 12 == 11 || b + 1 == num_buckets ? "\n" : " ");
+    }
+    printf("};\n\n");
+
+    printf("static const CityData city_slots[CITY_INDEX_SLOTS] = {\n");
+    for (uint32_t s = 0; s < num_slots; ++s)
+    {
+        const struct City *city = &cities[slots[s]];
+        printf("    {");
+        print_literal(city->name);
+        printf(", %.6ff, %.6ff},\n", city->latitude, city->longitude);
+    }
+    printf("};\n");
+
+    return EXIT_SUCCESS;
+}
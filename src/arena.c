@@ -0,0 +1,61 @@
+#include "arena.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+bool arena_create(struct Arena *arena, size_t capacity)
+{
+    *arena = (struct Arena){0};
+
+    // Tables start on cache lines. aligned_alloc is missing on Windows, so
+    // the arena is aligned within a larger block
+    arena->block = malloc(ARENA_SIZE(capacity) + ARENA_ALIGNMENT);
+    if (arena->block == NULL)
+    {
+        printf("Allocation of memory for arena failed\n");
+        return false;
+    }
+
+    uintptr_t address = (uintptr_t)arena->block;
+    arena->base = (char *)arena->block + (ARENA_SIZE(address) - address);
+    arena->capacity = ARENA_SIZE(capacity);
+
+    return true;
+}
+
+void arena_destroy(struct Arena *arena)
+{
+    free(arena->block);
+    arena->block = NULL;
+    arena->base = NULL;
+    arena->capacity = 0;
+    arena->used = 0;
+}
+
+void *arena_alloc(struct Arena *arena, size_t size)
+{
+    // The arena starts aligned and every allocation is padded to the
+    // alignment, so the next one starts aligned too
+    if (ARENA_SIZE(size) < size || ARENA_SIZE(size) > arena->capacity - arena->used)
+    {
+        return NULL;
+    }
+
+    void *memory = arena->base + arena->used;
+    arena->used += ARENA_SIZE(size);
+    arena->num_allocs++;
+    arena->num_bytes += size;
+
+    return memory;
+}
+
+void arena_release(struct Arena *arena, size_t mark)
+{
+    if (mark < arena->used)
+    {
+        arena->used = mark;
+    }
+}
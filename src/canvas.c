@@ -0,0 +1,378 @@
+#include "canvas.h"
+
+#include "macros.h"
+
+#include <curses.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+bool create_cell_canvas(struct Canvas *canvas, int height, int width)
+{
+    *canvas = (struct Canvas){
+        .height = height,
+        .width = width,
+    };
+
+    canvas->cells = malloc((size_t)height * width * sizeof(struct Cell));
+    if (canvas->cells == NULL)
+    {
+        printf("Allocation of memory for canvas failed\n");
+        return false;
+    }
+
+    canvas_erase(canvas);
+
+    return true;
+}
+
+void free_canvas(struct Canvas *canvas)
+{
+    free(canvas->cells);
+    canvas->cells = NULL;
+}
+
+void canvas_size(const struct Canvas *canvas, int *height, int *width)
+{
+    *height = canvas->height;
+    *width = canvas->width;
+}
+
+void canvas_erase(struct Canvas *canvas)
+{
+    int num_cells = canvas->height * canvas->width;
+    for (int i = 0; i < num_cells; ++i)
+    {
+        canvas->cells[i] = (struct Cell){' ', 0, 0};
+    }
+}
+
+void canvas_color_on(struct Canvas *canvas, int color_pair)
+{
+    canvas->color_pair = (short)color_pair;
+}
+
+void canvas_color_off(struct Canvas *canvas, int color_pair)
+{
+    canvas->color_pair = 0;
+}
+
+static void put_cell(struct Canvas *canvas, int y, int x, uint32_t codepoint)
+{
+    if (y < 0 || y >= canvas->height || x < 0 || x >= canvas->width)
+    {
+        return;
+    }
+
+    canvas->cells[y * canvas->width + x] = (struct Cell){codepoint, canvas->color_pair, 0};
+}
+
+void canvas_add_ch(struct Canvas *canvas, int y, int x, char ch)
+{
+    put_cell(canvas, y, x, (unsigned char)ch);
+}
+
+// Decode one UTF-8 sequence, returning the number of bytes consumed. Invalid
+// bytes decode to U+FFFD
+static int decode_utf8(const char *str, uint32_t *codepoint)
+{
+    const unsigned char *s = (const unsigned char *)str;
+
+    int length;
+    uint32_t c;
+    if (s[0] < 0x80)
+    {
+        *codepoint = s[0];
+        return 1;
+    }
+    else if ((s[0] & 0xE0) == 0xC0)
+    {
+        length = 2;
+        c = s[0] & 0x1F;
+    }
+    else if ((s[0] & 0xF0) == 0xE0)
+    {
+        length = 3;
+        c = s[0] & 0x0F;
+    }
+    else if ((s[0] & 0xF8) == 0xF0)
+    {
+        length = 4;
+        c = s[0] & 0x07;
+    }
+    else
+    {
+        *codepoint = 0xFFFD;
+        return 1;
+    }
+
+    for (int i = 1; i < length; ++i)
+    {
+        if ((s[i] & 0xC0) != 0x80)
+        {
+            *codepoint = 0xFFFD;
+            return i;
+        }
+        c = (c << 6) | (s[i] & 0x3F);
+    }
+
+    *codepoint = c;
+    return length;
+}
+
+// Number of columns a codepoint occupies. Only covers the characters this
+// program draws: combining marks and variation selectors take none, emoji and
+// CJK take two
+static int codepoint_width(uint32_t c)
+{
+    if ((c >= 0x0300 && c <= 0x036F) || (c >= 0xFE00 && c <= 0xFE0F) || c == 0x200D)
+    {
+        return 0;
+    }
+    if ((c >= 0x1F300 && c <= 0x1FAFF) || (c >= 0x2E80 && c <= 0xA4CF) || (c >= 0xFF00 && c <= 0xFF60))
+    {
+        return 2;
+    }
+    return 1;
+}
+
+static void add_str_cells(struct Canvas *canvas, int y, int x, const char *str)
+{
+    struct Cell *last = NULL;
+    while (*str != '\0')
+    {
+        uint32_t codepoint;
+        str += decode_utf8(str, &codepoint);
+
+        // Variation selectors choose how the previous character is presented,
+        // so they are kept with it
+        int width = codepoint_width(codepoint);
+        if (width == 0)
+        {
+            if (last != NULL && codepoint >= 0xFE00 && codepoint <= 0xFE0F)
+            {
+                last->variation = (uint16_t)codepoint;
+            }
+            continue;
+        }
+
+        put_cell(canvas, y, x, codepoint);
+        last = (struct Cell *)canvas_cell(canvas, y, x);
+        if (width == 2)
+        {
+            put_cell(canvas, y, x + 1, CELL_CONTINUATION);
+        }
+        x += width;
+    }
+}
+
+void canvas_add_str(struct Canvas *canvas, int y, int x, const char *str)
+{
+    add_str_cells(canvas, y, x, str);
+}
+
+void canvas_add_str_truncate(struct Canvas *canvas, int y, int x, const char *str)
+{
+    // Cells past the edge are dropped anyway
+    add_str_cells(canvas, y, x, str);
+}
+
+void canvas_add_run(struct Canvas *canvas, int y, int x, int length, const char *str)
+{
+    if (y < 0 || y >= canvas->height)
+    {
+        return;
+    }
+
+    uint32_t codepoint;
+    decode_utf8(str, &codepoint);
+
+    int begin = MAX(x, 0);
+    int end = MIN(x + length, canvas->width);
+    struct Cell cell = {codepoint, canvas->color_pair, 0};
+    for (int col = begin; col < end; ++col)
+    {
+        canvas->cells[y * canvas->width + col] = cell;
+    }
+}
+
+const struct Cell *canvas_cell(const struct Canvas *canvas, int y, int x)
+{
+    if (y < 0 || y >= canvas->height || x < 0 || x >= canvas->width)
+    {
+        return NULL;
+    }
+
+    return &canvas->cells[y * canvas->width + x];
+}
+
+// Encode a codepoint as UTF-8, returning the number of bytes written
+static int encode_utf8(uint32_t c, char *out)
+{
+    if (c < 0x80)
+    {
+        out[0] = (char)c;
+        return 1;
+    }
+    else if (c < 0x800)
+    {
+        out[0] = (char)(0xC0 | (c >> 6));
+        out[1] = (char)(0x80 | (c & 0x3F));
+        return 2;
+    }
+    else if (c < 0x10000)
+    {
+        out[0] = (char)(0xE0 | (c >> 12));
+        out[1] = (char)(0x80 | ((c >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (c & 0x3F));
+        return 3;
+    }
+    else
+    {
+        out[0] = (char)(0xF0 | (c >> 18));
+        out[1] = (char)(0x80 | ((c >> 12) & 0x3F));
+        out[2] = (char)(0x80 | ((c >> 6) & 0x3F));
+        out[3] = (char)(0x80 | (c & 0x3F));
+        return 4;
+    }
+}
+
+static bool cells_equal(struct Cell a, struct Cell b)
+{
+    return a.codepoint == b.codepoint && a.color_pair == b.color_pair && a.variation == b.variation;
+}
+
+int present_canvas(const struct Canvas *canvas, struct Canvas *shown, WINDOW *win)
+{
+    int num_changed = 0;
+    short color_pair = 0;
+
+    int num_cells = canvas->height * canvas->width;
+    for (int i = 0; i < num_cells; ++i)
+    {
+        struct Cell cell = canvas->cells[i];
+        if (cells_equal(cell, shown->cells[i]))
+        {
+            continue;
+        }
+
+        shown->cells[i] = cell;
+        ++num_changed;
+
+        // The right half of a double width character is drawn with its left
+        // half, which has changed too
+        if (win == NULL || cell.codepoint == CELL_CONTINUATION)
+        {
+            continue;
+        }
+
+        if (cell.color_pair != color_pair)
+        {
+            wattrset(win, COLOR_PAIR(cell.color_pair));
+            color_pair = cell.color_pair;
+        }
+
+        char utf8[9];
+        int length = encode_utf8(cell.codepoint, utf8);
+        if (cell.variation != 0)
+        {
+            length += encode_utf8(cell.variation, utf8 + length);
+        }
+        utf8[length] = '\0';
+
+        mvwaddstr(win, i / canvas->width, i % canvas->width, utf8);
+    }
+
+    if (win != NULL && color_pair != 0)
+    {
+        wattrset(win, A_NORMAL);
+    }
+
+    return num_changed;
+}
+
+bool write_canvas(const struct Canvas *canvas, FILE *stream, bool color)
+{
+    for (int y = 0; y < canvas->height; ++y)
+    {
+        short current_pair = 0;
+
+        for (int x = 0; x < canvas->width; ++x)
+        {
+            const struct Cell *cell = &canvas->cells[y * canvas->width + x];
+            if (cell->codepoint == CELL_CONTINUATION)
+            {
+                continue;
+            }
+
+            if (color && cell->color_pair != current_pair)
+            {
+                // Pairs 1-8 are the eight standard colors, see ncurses_init
+                if (cell->color_pair >= 1 && cell->color_pair <= 8)
+                {
+                    fprintf(stream, "\x1b[%dm", 30 + cell->color_pair - 1);
+                }
+                else
+                {
+                    fputs("\x1b[0m", stream);
+                }
+                current_pair = cell->color_pair;
+            }
+
+            char utf8[4];
+            fwrite(utf8, 1, encode_utf8(cell->codepoint, utf8), stream);
+        }
+
+        if (color && current_pair != 0)
+        {
+            fputs("\x1b[0m", stream);
+        }
+        putc('\n', stream);
+    }
+
+    return !ferror(stream);
+}
+
+bool write_canvas_frame(const struct Canvas *canvas, const char *path, bool color, int frame)
+{
+    if (path == NULL)
+    {
+        if (!write_canvas(canvas, stdout, color))
+        {
+            fprintf(stderr, "ERROR: Unable to write frame to stdout\n");
+            return false;
+        }
+        return true;
+    }
+
+    // Replace a %d in the path with the frame number, otherwise all frames are
+    // appended to the same file
+    char frame_path[4096];
+    const char *number = strstr(path, "%d");
+    if (number == NULL)
+    {
+        snprintf(frame_path, sizeof(frame_path), "%s", path);
+    }
+    else
+    {
+        snprintf(frame_path, sizeof(frame_path), "%.*s%d%s", (int)(number - path), path, frame, number + 2);
+    }
+
+    FILE *stream = fopen(frame_path, number == NULL && frame > 0 ? "a" : "w");
+    if (stream == NULL)
+    {
+        fprintf(stderr, "ERROR: Unable to open '%s'\n", frame_path);
+        return false;
+    }
+
+    bool s = write_canvas(canvas, stream, color);
+    s = fclose(stream) == 0 && s;
+    if (!s)
+    {
+        fprintf(stderr, "ERROR: Unable to write frame to '%s'\n", frame_path);
+    }
+
+    return s;
+}
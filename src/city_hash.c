@@ -0,0 +1,60 @@
+#include "city_hash.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Locale independent, so the generator and lookup always agree
+static bool is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+bool normalize_city_name(const char *name, char *normalized, size_t size)
+{
+    const char *start = name;
+    while (is_space(*start))
+    {
+        start++;
+    }
+
+    size_t length = strlen(start);
+    while (length > 0 && is_space(start[length - 1]))
+    {
+        length--;
+    }
+
+    if (length + 1 > size)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        char c = start[i];
+        normalized[i] = (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+    }
+    normalized[length] = '\0';
+
+    return true;
+}
+
+uint32_t hash_city_name(const char *normalized, uint32_t seed)
+{
+    // FNV-1a followed by the MurmurHash3 finalizer, so that nearby seeds give
+    // unrelated hashes
+    uint32_t h = 2166136261u ^ seed;
+    for (const unsigned char *p = (const unsigned char *)normalized; *p != '\0'; ++p)
+    {
+        h ^= *p;
+        h *= 16777619u;
+    }
+
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
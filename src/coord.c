@@ -2,6 +2,7 @@
 #include "macros.h"
 
 #include <math.h>
+#include <stdbool.h>
 
 // Conversions
 
@@ -11,6 +12,55 @@ void equatorial_rectangular_to_spherical(double xeq, double yeq, double zeq, dou
     *declination = atan2(zeq, sqrt(xeq * xeq + yeq * yeq));
 }
 
+void equatorial_spherical_to_rectangular(double right_ascension, double declination, double *xeq, double *yeq, double *zeq)
+{
+    *xeq = cos(declination) * cos(right_ascension);
+    *yeq = cos(declination) * sin(right_ascension);
+    *zeq = sin(declination);
+}
+
+void equatorial_to_horizontal_matrix(double gmst, double latitude, double longitude, double matrix[3][3])
+{
+    // Rotate about the polar axis by the local sidereal time, then tilt the
+    // pole down to the observer's latitude. Expanding equatorial_to_horizontal
+    // with the hour angle H = LST - α gives the same result
+    double local_sidereal_time = gmst + longitude;
+
+    double sin_lst = sin(local_sidereal_time);
+    double cos_lst = cos(local_sidereal_time);
+    double sin_lat = sin(latitude);
+    double cos_lat = cos(latitude);
+
+    // East
+    matrix[0][0] = -sin_lst;
+    matrix[0][1] = cos_lst;
+    matrix[0][2] = 0.0;
+
+    // North
+    matrix[1][0] = -sin_lat * cos_lst;
+    matrix[1][1] = -sin_lat * sin_lst;
+    matrix[1][2] = cos_lat;
+
+    // Zenith
+    matrix[2][0] = cos_lat * cos_lst;
+    matrix[2][1] = cos_lat * sin_lst;
+    matrix[2][2] = sin_lat;
+}
+
+void horizontal_rectangular_to_spherical(double xh, double yh, double zh, double *azimuth, double *altitude)
+{
+    // atan2 instead of asin keeps precision near the zenith and tolerates
+    // vectors that are not quite unit length
+    *altitude = atan2(zh, sqrt(xh * xh + yh * yh));
+
+    // Azimuth 0 at North, increasing towards the East
+    *azimuth = atan2(xh, yh);
+    if (*azimuth < 0.0)
+    {
+        *azimuth += 2.0 * M_PI;
+    }
+}
+
 void equatorial_to_horizontal(double right_ascension, double declination, double gmst, double latitude, double longitude,
                               double *azimuth, double *altitude)
 {
@@ -46,6 +96,13 @@ void equatorial_to_horizontal(double right_ascension, double declination, double
     return;
 }
 
+void horizontal_spherical_to_rectangular(double azimuth, double altitude, double *xh, double *yh, double *zh)
+{
+    *xh = cos(altitude) * sin(azimuth);
+    *yh = cos(altitude) * cos(azimuth);
+    *zh = sin(altitude);
+}
+
 void horizontal_to_spherical(double azimuth, double altitude, double *point_theta, double *point_phi)
 {
     *point_theta = M_PI / 2 - azimuth;
@@ -114,6 +171,29 @@ void polar_to_win(double r, double theta, int win_height, int win_width, int *ro
     return;
 }
 
+void init_stereo_projection(struct StereoProjection *projection, int win_height, int win_width)
+{
+    projection->rad_y = (win_height - 1) / 2.0;
+    projection->rad_x = (win_width - 1) / 2.0;
+}
+
+bool project_horizontal_to_win(const struct StereoProjection *projection, double xh, double yh, double zh, int *row,
+                               int *col)
+{
+    if (zh < 0.0)
+    {
+        return false;
+    }
+
+    // From the south pole, a unit vector lands on the plane of the horizon at
+    // (x, y) / (1 + z). North is up and East is to the left, since the sky is
+    // seen from below
+    double scale = 1.0 / (1.0 + zh);
+    *row = (int)round(projection->rad_y * (1.0 - yh * scale));
+    *col = (int)round(projection->rad_x * (1.0 - xh * scale));
+    return true;
+}
+
 void perspective_to_win(double aov_phi, double aov_theta, double perspective_phi, double perspective_theta, double object_phi,
                         double object_theta, int win_height, int win_width, int *row, int *col)
 {
@@ -1,6 +1,8 @@
 #include "core.h"
 
+#include "arena.h"
 #include "astro.h"
+#include "macros.h"
 #include "parse_BSC5.h"
 #include "strptime.h"
 
@@ -12,26 +14,46 @@
 
 // Data generation
 
-bool generate_star_table(struct Star **star_table_out, struct Entry *entries, const struct StarName *name_table,
-                         unsigned int num_stars)
+unsigned int count_catalog_stars(const struct Catalog *catalog, float max_magnitude)
 {
-    *star_table_out = malloc(num_stars * sizeof(struct Star));
+    unsigned int num_stars = 0;
+    for (unsigned int i = 0; i < catalog->num_entries; ++i)
+    {
+        if (catalog_entry(catalog, i).MAG / 100.0f <= max_magnitude)
+        {
+            num_stars++;
+        }
+    }
+    return num_stars;
+}
+
+bool generate_star_table(struct Arena *arena, struct Star **star_table_out, unsigned int num_stars,
+                         const struct Catalog *catalog, const struct StarName *name_table, float max_magnitude)
+{
+    *star_table_out = arena_alloc(arena, num_stars * sizeof(struct Star));
     if (*star_table_out == NULL)
     {
         printf("Allocation of memory for star table failed\n");
         return false;
     }
 
-    for (unsigned int i = 0; i < num_stars; ++i)
+    unsigned int n = 0;
+    for (unsigned int i = 0; i < catalog->num_entries && n < num_stars; ++i)
     {
+        struct Entry entry = catalog_entry(catalog, i);
+        if (entry.MAG / 100.0f > max_magnitude)
+        {
+            continue;
+        }
+
         struct Star temp_star;
 
-        temp_star.catalog_number = (int)entries[i].XNO;
-        temp_star.right_ascension = entries[i].SRA0;
-        temp_star.declination = entries[i].SDEC0;
-        temp_star.ra_motion = (double)entries[i].XRPM;
-        temp_star.dec_motion = (double)entries[i].XDPM;
-        temp_star.magnitude = entries[i].MAG / 100.0f;
+        temp_star.catalog_number = (int)n + 1;
+        temp_star.right_ascension = entry.SRA0;
+        temp_star.declination = entry.SDEC0;
+        temp_star.ra_motion = (double)entry.XRPM;
+        temp_star.dec_motion = (double)entry.XDPM;
+        temp_star.magnitude = entry.MAG / 100.0f;
 
         // Star magnitude mapping
         // FIXME: some of these characters render on WSL while not on macOS
@@ -50,27 +72,44 @@ bool generate_star_table(struct Star **star_table_out, struct Entry *entries, co
         const float max_magnitude = 7.96f;
 
         int symbol_index = map_float_to_int_range(min_magnitude, max_magnitude, 0, 9, temp_star.magnitude);
+        symbol_index = MIN(MAX(symbol_index, 0), 9); // Deeper catalogs go past BSC5's range
 
         temp_star.base = (struct ObjectBase){
             .color_pair = 0,
             .symbol_ASCII = (char)mag_map_round_ASCII[symbol_index],
             .symbol_unicode = mag_map_unicode_round[symbol_index],
-            .label = name_table[i].name,
+            .label = name_table == NULL ? NULL : name_table[i].name,
         };
 
         // Copy temp struct to table index
-        (*star_table_out)[i] = temp_star;
+        (*star_table_out)[n++] = temp_star;
+    }
+
+    return true;
+}
+
+bool copy_star_table(struct Arena *arena, struct Star **star_table_out, const struct Star *stars,
+                     unsigned int num_stars)
+{
+    *star_table_out = arena_alloc(arena, num_stars * sizeof(struct Star));
+    if (*star_table_out == NULL)
+    {
+        printf("Allocation of memory for star table failed\n");
+        return false;
     }
 
+    memcpy(*star_table_out, stars, num_stars * sizeof(struct Star));
+
     return true;
 }
 
-bool generate_planet_table(struct Planet **planet_table, const struct KepElems *planet_elements,
+bool generate_planet_table(struct Arena *arena, struct Planet **planet_table, const struct KepElems *planet_elements,
                            const struct KepRates *planet_rates, const struct KepExtra *planet_extras)
 {
-    *planet_table = malloc(NUM_PLANETS * sizeof(struct Planet));
+    *planet_table = arena_alloc(arena, NUM_PLANETS * sizeof(struct Planet));
     if (*planet_table == NULL)
     {
+        printf("Allocation of memory for planet table failed\n");
         return false;
     }
 
@@ -147,11 +186,20 @@ bool generate_moon_object(struct Moon *moon_data, const struct KepElems *moon_el
 // Line buffer (more than enough to store any of the names)
 #define BUF_SIZE 32
 
+size_t name_table_arena_size(size_t data_len, int num_stars)
+{
+    // Each name is shorter than its line, so the names and their terminators
+    // fit in the size of the data and one more terminator
+    return ARENA_SIZE(num_stars * sizeof(struct StarName)) + ARENA_SIZE(data_len + 1);
+}
+
 // TODO: verify this catches the first and last entries
-bool generate_name_table(const uint8_t *data, size_t data_len, struct StarName **name_table_out, int num_stars)
+bool generate_name_table(struct Arena *arena, const uint8_t *data, size_t data_len, struct StarName **name_table_out,
+                         int num_stars)
 {
-    *name_table_out = malloc(num_stars * sizeof(struct StarName));
-    if (*name_table_out == NULL)
+    *name_table_out = arena_alloc(arena, num_stars * sizeof(struct StarName));
+    char *names = arena_alloc(arena, data_len + 1);
+    if (*name_table_out == NULL || names == NULL)
     {
         printf("Allocation of memory for name table failed\n");
         return false;
@@ -192,13 +240,11 @@ bool generate_name_table(const uint8_t *data, size_t data_len, struct StarName *
 
         int table_index = catalog_number - 1;
 
+        // Names are packed one after another
         struct StarName temp_name;
-        temp_name.name = malloc(strlen(name) + 1);
-        if (temp_name.name == NULL)
-        {
-            return false;
-        }
+        temp_name.name = names;
         strcpy(temp_name.name, name);
+        names += strlen(name) + 1;
 
         (*name_table_out)[table_index] = temp_name;
     }
@@ -206,25 +252,52 @@ bool generate_name_table(const uint8_t *data, size_t data_len, struct StarName *
     return true;
 }
 
+/* Count the lines of bsc5_constellations.txt, including a last line without a
+ * new line, and the ends of segments on them
+ */
+static void count_constell_data(const uint8_t *data, size_t data_len, unsigned int *num_lines, size_t *num_numbers)
+{
+    size_t num_tokens = 0;
+    *num_lines = 0;
+    for (size_t i = 0; i < data_len; ++i)
+    {
+        bool separator = data[i] == ' ' || data[i] == '\n';
+        bool after_separator = i == 0 || data[i - 1] == ' ' || data[i - 1] == '\n';
+        if (!separator && after_separator)
+        {
+            num_tokens++;
+        }
+        if (data[i] == '\n' || i == data_len - 1)
+        {
+            (*num_lines)++;
+        }
+    }
+
+    // Every line starts with a name and a number of segments
+    *num_numbers = num_tokens > 2 * (size_t)*num_lines ? num_tokens - 2 * (size_t)*num_lines : 0;
+}
+
+size_t constell_table_arena_size(const uint8_t *data, size_t data_len)
+{
+    unsigned int num_lines;
+    size_t num_numbers;
+    count_constell_data(data, data_len, &num_lines, &num_numbers);
+    return ARENA_SIZE((num_lines + 1) * sizeof(unsigned int)) + ARENA_SIZE(num_numbers * sizeof(int)) +
+           ARENA_SIZE(num_lines * sizeof(bool));
+}
+
 /* Parse a single constellation entry, e.g.:
  *
  * CVn 1 4915 4785
  *
- * Adds the entry *constell_table_out[line_number]:
- *
- * struct Constell
- * {
- * num_segments=1
- * int *star_numbers=[4915, 4785]
- * };
- *
- * NOTE: line numbers are 0-indexed
+ * into its number of segments (1) and the star table indices of their ends
+ * ([4914, 4784]), which must have room for every number on the line
  */
 #define MAX_BUF_SIZE 2048
-bool parse_line(const uint8_t *data, struct Constell **constell_table_out, int line_start, int line_end, int line_number)
+bool parse_line(const uint8_t *data, unsigned int *num_segments_out, int *ends, int line_start, int line_end)
 {
     // Validate the input range
-    if (line_end <= line_start || data == NULL || constell_table_out == NULL)
+    if (line_end <= line_start || data == NULL || ends == NULL)
     {
         return false;
     }
@@ -257,90 +330,54 @@ bool parse_line(const uint8_t *data, struct Constell **constell_table_out, int l
         return false; // Invalid number of segments
     }
 
-    // Allocate memory for the star numbers
-    int *star_numbers = malloc(num_segments * 2 * sizeof(int)); // Each segment has two star numbers
-    if (star_numbers == NULL)
-    {
-        return false; // Memory allocation failed
-    }
-
     // Parse the star numbers (expecting num_segments * 2 star numbers)
     unsigned int i = 0;
     const char *token;
-    while ((token = strtok(NULL, " ")) != NULL && i < num_segments * 2)
+    while ((token = strtok(NULL, " \n")) != NULL && i < num_segments * 2)
     {
-        star_numbers[i] = atoi(token);
+        ends[i] = atoi(token) - 1;
         ++i;
     }
 
     // If we didn't get enough star numbers, it's an error
     if (i != num_segments * 2)
     {
-        free(star_numbers);
         return false; // Malformed line, not enough star numbers
     }
 
-    // Allocate memory for the constellations table if necessary
-    if (*constell_table_out == NULL)
-    {
-        *constell_table_out = malloc(sizeof(struct Constell) * (line_number + 1));
-        if (*constell_table_out == NULL)
-        {
-            free(star_numbers);
-            return false; // Memory allocation failed for the table
-        }
-    }
-    else
-    {
-        // Reallocate memory to accommodate new constellations
-        *constell_table_out = realloc(*constell_table_out, sizeof(struct Constell) * (line_number + 1));
-        if (*constell_table_out == NULL)
-        {
-            free(star_numbers);
-            return false; // Memory allocation failed for the table
-        }
-    }
-
-    // Store the parsed constellation in the correct table location
-    struct Constell temp_constell = {.num_segments = num_segments, .star_numbers = star_numbers};
-
-    (*constell_table_out)[line_number] = temp_constell;
+    *num_segments_out = num_segments;
 
     return true;
 }
 
-bool generate_constell_table(const uint8_t *data, size_t data_len, struct Constell **constell_table_out,
-                             unsigned int *num_constell_out)
+bool generate_constell_table(struct Arena *arena, const uint8_t *data, size_t data_len,
+                             struct ConstellTable *constell_table)
 {
     // Validate input
-    if (data == NULL || constell_table_out == NULL || num_constell_out == NULL || data_len == 0)
+    if (data == NULL || constell_table == NULL || data_len == 0)
     {
         return false;
     }
 
-    unsigned int num_constells = 0;
-    size_t line_start = 0;
-    size_t line_end;
-
-    // Count the number of lines in the data
-    for (size_t i = 0; i < data_len; ++i)
-    {
-        if (data[i] == '\n')
-        {
-            num_constells++;
-        }
-    }
+    // Count the lines and star numbers first so that the offsets and the ends
+    // of every segment are each allocated once
+    unsigned int num_constells;
+    size_t num_numbers;
+    count_constell_data(data, data_len, &num_constells, &num_numbers);
 
-    // Allocate memory for the constellation table
-    *constell_table_out = malloc(num_constells * sizeof(struct Constell));
-    if (*constell_table_out == NULL)
+    unsigned int *offsets = arena_alloc(arena, (num_constells + 1) * sizeof(unsigned int));
+    int *ends = arena_alloc(arena, num_numbers * sizeof(int));
+    if (offsets == NULL || ends == NULL)
     {
         printf("Allocation of memory for constellation table failed\n");
         return false;
     }
 
-    // Parse each line of data
-    int line_number = 0;
+    // Parse each line of data. Figures take consecutive segments
+    size_t line_start = 0;
+    size_t line_end;
+    unsigned int line_number = 0;
+    offsets[0] = 0;
     for (size_t i = 0; i < data_len; ++i)
     {
         // Find the start of the current line
@@ -354,81 +391,91 @@ bool generate_constell_table(const uint8_t *data, size_t data_len, struct Conste
         {
             line_end = i;
 
-            // Parse the line and store the parsed constellation in the table
-            if (!parse_line(data, constell_table_out, line_start, line_end, line_number))
+            // Parse the line and append its segments
+            unsigned int num_segments;
+            if (!parse_line(data, &num_segments, &ends[2 * offsets[line_number]], line_start, line_end))
             {
-                printf("Failed to parse line %d\n", line_number);
+                printf("Failed to parse line %u\n", line_number);
                 return false;
             }
+            offsets[line_number + 1] = offsets[line_number] + num_segments;
 
             line_number++; // Increment line number
         }
     }
 
-    // Set the number of constellations in the output parameter
-    *num_constell_out = num_constells;
-
-    return true;
+    return init_constell_table(arena, constell_table, num_constells, offsets, ends);
 }
 
-// Memory freeing
-
-void free_constell_members(struct Constell constell_data)
+bool init_constell_table(struct Arena *arena, struct ConstellTable *constell_table, unsigned int num_constells,
+                         const unsigned int *offsets, const int *ends)
 {
-    if (constell_data.star_numbers != NULL)
+    bool *drawn = arena_alloc(arena, num_constells * sizeof(bool));
+    if (drawn == NULL)
     {
-        free(constell_data.star_numbers);
+        printf("Allocation of memory for constellation mask failed\n");
+        return false;
     }
-    return;
-}
 
-void free_star_name_members(struct StarName name_data)
-{
-    if (name_data.name != NULL)
+    for (unsigned int c = 0; c < num_constells; ++c)
     {
-        free(name_data.name);
+        drawn[c] = true;
     }
-    return;
-}
 
-void free_stars(struct Star *star_table, unsigned int size)
-{
-    (void)size;
-    free(star_table);
-    return;
-}
+    *constell_table = (struct ConstellTable){
+        .num_constells = num_constells,
+        .offsets = offsets,
+        .ends = ends,
+        .drawn = drawn,
+    };
 
-void free_planets(struct Planet *planets, unsigned int size)
-{
-    (void)size;
-    free(planets);
-    return;
+    return true;
 }
 
-void free_moon_object(struct Moon moon_data)
+void set_constell_threshold(struct ConstellTable *constell_table, const struct Star *star_table,
+                            unsigned int num_stars, float threshold)
 {
-    // Nothing was allocated during moon generation
-    (void)moon_data;
-    return;
+    for (unsigned int c = 0; c < constell_table->num_constells; ++c)
+    {
+        // Figures are only drawn whole
+        bool drawn = true;
+        for (unsigned int i = 2 * constell_table->offsets[c]; i < 2 * constell_table->offsets[c + 1]; ++i)
+        {
+            int table_index = constell_table->ends[i];
+            drawn = drawn && table_index >= 0 && (unsigned int)table_index < num_stars &&
+                    star_table[table_index].magnitude <= threshold;
+        }
+        constell_table->drawn[c] = drawn;
+    }
 }
 
-void free_constells(struct Constell *constell_table, unsigned int size)
+// Positions
+
+void planet_geo_ICRF(const struct Planet *planet_table, int index, double julian_date, double *xg, double *yg, double *zg)
 {
-    for (unsigned int i = 0; i < size; i++)
+    const struct Planet *earth = &planet_table[EARTH];
+    double xe, ye, ze;
+    calc_planet_helio_ICRF(earth->elements, earth->rates, earth->extras, julian_date, &xe, &ye, &ze);
+
+    if (index == SUN)
     {
-        free_constell_members(constell_table[i]);
+        // The Sun is roughly at the origin of the ICRF frame
+        *xg = -xe;
+        *yg = -ye;
+        *zg = -ze;
+        return;
     }
-    free(constell_table);
-    return;
+
+    const struct Planet *planet = &planet_table[index];
+    calc_planet_geo_ICRF(xe, ye, ze, planet->elements, planet->rates, planet->extras, julian_date, xg, yg, zg);
 }
 
-void free_star_names(struct StarName *name_table, unsigned int size)
+// Memory freeing
+
+void free_moon_object(struct Moon moon_data)
 {
-    for (unsigned int i = 0; i < size; ++i)
-    {
-        free_star_name_members(name_table[i]);
-    }
-    free(name_table);
+    // Nothing was allocated during moon generation
+    (void)moon_data;
     return;
 }
 
@@ -448,34 +495,69 @@ int star_magnitude_comparator(const void *v1, const void *v2)
         return 0;
 }
 
-bool star_numbers_by_magnitude(int **num_by_mag, const struct Star *star_table, unsigned int num_stars)
+// Sort key for star_numbers_by_magnitude, much smaller than a struct Star
+struct StarKey
 {
-    // Create and sort a copy of the star table
-    struct Star *table_copy = malloc(num_stars * sizeof(struct Star));
-    if (table_copy == NULL)
-    {
-        printf("Allocation of memory for star table copy failed\n");
-        return false;
-    }
+    float magnitude;
+    int catalog_number;
+};
 
-    memcpy(table_copy, star_table, num_stars * sizeof(*table_copy));
-    qsort(table_copy, num_stars, sizeof(struct Star), star_magnitude_comparator);
+static int star_key_comparator(const void *v1, const void *v2)
+{
+    const struct StarKey *p1 = v1;
+    const struct StarKey *p2 = v2;
+
+    // Lower magnitudes are brighter, ties are broken by catalog number so the
+    // order does not depend on the qsort implementation
+    if (p1->magnitude != p2->magnitude)
+        return p1->magnitude < p2->magnitude ? +1 : -1;
+    else
+        return (p1->catalog_number > p2->catalog_number) - (p1->catalog_number < p2->catalog_number);
+}
 
-    // Create and fill array of indicies in table copy
-    *num_by_mag = malloc(num_stars * sizeof(int));
+size_t star_tables_arena_size(unsigned int num_stars)
+{
+    return ARENA_SIZE(num_stars * sizeof(struct Star)) + ARENA_SIZE(NUM_PLANETS * sizeof(struct Planet));
+}
+
+size_t star_sort_arena_size(unsigned int num_stars)
+{
+    return ARENA_SIZE(num_stars * sizeof(int)) + ARENA_SIZE(num_stars * sizeof(struct StarKey));
+}
+
+bool star_numbers_by_magnitude(struct Arena *arena, int **num_by_mag, const struct Star *star_table,
+                               unsigned int num_stars)
+{
+    *num_by_mag = arena_alloc(arena, num_stars * sizeof(int));
     if (*num_by_mag == NULL)
     {
         printf("Allocation of memory for num by mag array failed\n");
-        free(table_copy);
         return false;
     }
 
+    // Sort (magnitude, number) pairs rather than a copy of the star table. The
+    // keys are only needed until the numbers are filled in
+    size_t mark = arena->used;
+    struct StarKey *keys = arena_alloc(arena, num_stars * sizeof(struct StarKey));
+    if (keys == NULL)
+    {
+        printf("Allocation of memory for star sort keys failed\n");
+        return false;
+    }
+
+    for (unsigned int i = 0; i < num_stars; ++i)
+    {
+        keys[i] = (struct StarKey){star_table[i].magnitude, star_table[i].catalog_number};
+    }
+    qsort(keys, num_stars, sizeof(struct StarKey), star_key_comparator);
+
+    // Fill array of catalog numbers in sorted order
     for (unsigned int i = 0; i < num_stars; ++i)
     {
-        (*num_by_mag)[i] = table_copy[i].catalog_number;
+        (*num_by_mag)[i] = keys[i].catalog_number;
     }
 
-    free(table_copy);
+    arena_release(arena, mark);
 
     return true;
 }
@@ -3,6 +3,7 @@
 #include "astro.h"
 #include "coord.h"
 #include "core.h"
+#include "ephemeris.h"
 
 #include <math.h>
 
@@ -30,21 +31,37 @@ void update_star_positions(struct Star *star_table, int num_stars, double julian
     return;
 }
 
+// Set the azimuth and altitude of a body from its geocentric rectangular
+// equatorial coordinates
+static void set_horizontal(struct ObjectBase *base, double xg, double yg, double zg, double gmst, double latitude,
+                           double longitude)
+{
+    // Convert to spherical equatorial coordinates
+    double right_ascension, declination;
+    equatorial_rectangular_to_spherical(xg, yg, zg, &right_ascension, &declination);
+
+    double azimuth, altitude;
+    equatorial_to_horizontal(right_ascension, declination, gmst, latitude, longitude, &azimuth, &altitude);
+
+    base->azimuth = azimuth;
+    base->altitude = altitude;
+}
+
 void update_planet_positions(struct Planet *planet_table, double julian_date, double latitude, double longitude)
 {
     double gmst = greenwich_mean_sidereal_time_rad(julian_date);
 
+    // Heliocentric coordinates of the Earth-Moon barycenter
+    double xe, ye, ze;
+    calc_planet_helio_ICRF(planet_table[EARTH].elements, planet_table[EARTH].rates, planet_table[EARTH].extras, julian_date,
+                           &xe, &ye, &ze);
+
     int i;
     for (i = SUN; i < NUM_PLANETS; ++i)
     {
         // Geocentric rectangular equatorial coordinates
         double xg, yg, zg;
 
-        // Heliocentric coordinates of the Earth-Moon barycenter
-        double xe, ye, ze;
-        calc_planet_helio_ICRF(planet_table[EARTH].elements, planet_table[EARTH].rates, planet_table[EARTH].extras, julian_date,
-                               &xe, &ye, &ze);
-
         if (i == SUN)
         {
             // Since the origin of the ICRF frame is the barycenter of the Solar
@@ -66,15 +83,20 @@ void update_planet_positions(struct Planet *planet_table, double julian_date, do
             zg -= ze;
         }
 
-        // Convert to spherical equatorial coordinates
-        double right_ascension, declination;
-        equatorial_rectangular_to_spherical(xg, yg, zg, &right_ascension, &declination);
+        set_horizontal(&planet_table[i].base, xg, yg, zg, gmst, latitude, longitude);
+    }
+}
 
-        double azimuth, altitude;
-        equatorial_to_horizontal(right_ascension, declination, gmst, latitude, longitude, &azimuth, &altitude);
+void update_planet_positions_cached(struct Ephemeris *ephemeris, struct Planet *planet_table, double julian_date,
+                                    double latitude, double longitude)
+{
+    double gmst = greenwich_mean_sidereal_time_rad(julian_date);
 
-        planet_table[i].base.azimuth = azimuth;
-        planet_table[i].base.altitude = altitude;
+    for (int i = SUN; i < NUM_PLANETS; ++i)
+    {
+        double xg, yg, zg;
+        ephemeris_planet_geo(ephemeris, planet_table, i, julian_date, &xg, &yg, &zg);
+        set_horizontal(&planet_table[i].base, xg, yg, zg, gmst, latitude, longitude);
     }
 }
 
@@ -85,17 +107,20 @@ void update_moon_position(struct Moon *moon_object, double julian_date, double l
     double xg, yg, zg;
     calc_moon_geo_ICRF(moon_object->elements, moon_object->rates, julian_date, &xg, &yg, &zg);
 
-    // Convert to spherical equatorial coordinates
-    double right_ascension, declination;
-    equatorial_rectangular_to_spherical(xg, yg, zg, &right_ascension, &declination);
+    set_horizontal(&moon_object->base, xg, yg, zg, gmst, latitude, longitude);
 
-    double azimuth, altitude;
-    equatorial_to_horizontal(right_ascension, declination, gmst, latitude, longitude, &azimuth, &altitude);
+    return;
+}
+
+void update_moon_position_cached(struct Ephemeris *ephemeris, struct Moon *moon_object, double julian_date, double latitude,
+                                 double longitude)
+{
+    double gmst = greenwich_mean_sidereal_time_rad(julian_date);
 
-    moon_object->base.azimuth = azimuth;
-    moon_object->base.altitude = altitude;
+    double xg, yg, zg;
+    ephemeris_moon_geo(ephemeris, moon_object, julian_date, &xg, &yg, &zg);
 
-    return;
+    set_horizontal(&moon_object->base, xg, yg, zg, gmst, latitude, longitude);
 }
 
 // FIXME: this does not render the correct phase and angle
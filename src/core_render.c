@@ -1,74 +1,117 @@
 #include "core_render.h"
 #include "macros.h"
 
+#include "arena.h"
+#include "canvas.h"
 #include "coord.h"
 #include "core.h"
 #include "drawing.h"
+#include "minor_bodies.h"
 #include "term.h"
 
-#include <curses.h>
 #include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
-void horizontal_to_polar(double azimuth, double altitude, double *radius, double *theta)
+// Projection onto the whole canvas, shared by every object drawn in a call
+static struct StereoProjection canvas_projection(const struct Canvas *canvas)
 {
-    double theta_sphere, phi_sphere;
-    horizontal_to_spherical(azimuth, altitude, &theta_sphere, &phi_sphere);
-
-    project_stereographic_north(1.0, theta_sphere, phi_sphere, radius, theta);
+    int height, width;
+    canvas_size(canvas, &height, &width);
 
-    return;
+    struct StereoProjection projection;
+    init_stereo_projection(&projection, height, width);
+    return projection;
 }
 
-void render_object_stereo(WINDOW *win, struct ObjectBase *object, const struct Conf *config)
+// Draw an object and its label at a cell
+static void render_object_at(struct Canvas *canvas, const struct ObjectBase *object, int y, int x,
+                             const struct Conf *config)
 {
-    double radius_polar, theta_polar;
-    horizontal_to_polar(object->azimuth, object->altitude, &radius_polar, &theta_polar);
-
-    int y, x;
-    int height, width;
-    getmaxyx(win, height, width);
-    polar_to_win(radius_polar, theta_polar, height, width, &y, &x);
-
-    // If outside projection, ignore
-    if (fabs(radius_polar) > 1)
-    {
-        return;
-    }
-
     bool use_color = config->color && object->color_pair != 0;
 
     if (use_color)
     {
-        wattron(win, COLOR_PAIR(object->color_pair));
+        canvas_color_on(canvas, object->color_pair);
     }
 
     // Draw object
     if (config->unicode)
     {
-        mvwaddstr(win, y, x, object->symbol_unicode);
+        canvas_add_str(canvas, y, x, object->symbol_unicode);
     }
     else
     {
-        mvwaddch(win, y, x, object->symbol_ASCII);
+        canvas_add_ch(canvas, y, x, object->symbol_ASCII);
     }
 
     // Draw label
     if (object->label != NULL)
     {
-        mvwaddstr_truncate(win, y - 1, x + 1, object->label);
+        canvas_add_str_truncate(canvas, y - 1, x + 1, object->label);
     }
 
     if (use_color)
     {
-        wattroff(win, COLOR_PAIR(object->color_pair));
+        canvas_color_off(canvas, object->color_pair);
     }
 
     return;
 }
 
-void render_stars_stereo(WINDOW *win, const struct Conf *config, struct Star *star_table, int num_stars, const int *num_by_mag)
+void render_object_stereo(struct Canvas *canvas, const struct StereoProjection *projection, struct ObjectBase *object,
+                          const struct Conf *config)
+{
+    double xh, yh, zh;
+    horizontal_spherical_to_rectangular(object->azimuth, object->altitude, &xh, &yh, &zh);
+
+    // If outside projection, ignore
+    int y, x;
+    if (!project_horizontal_to_win(projection, xh, yh, zh, &y, &x))
+    {
+        return;
+    }
+
+    render_object_at(canvas, object, y, x, config);
+}
+
+// Move a direction below the horizon up to the horizon at the same azimuth
+static void clip_to_horizon(double v[3])
+{
+    double h = hypot(v[0], v[1]);
+    v[0] = h > 0.0 ? v[0] / h : 0.0;
+    v[1] = h > 0.0 ? v[1] / h : 1.0;
+    v[2] = 0.0;
+}
+
+bool create_star_cells(struct Arena *arena, struct StarCell **cells, unsigned int num_stars)
 {
+    *cells = arena_alloc(arena, num_stars * sizeof(struct StarCell));
+    if (*cells == NULL)
+    {
+        printf("Allocation of memory for star cells failed\n");
+        return false;
+    }
+    memset(*cells, 0, num_stars * sizeof(struct StarCell));
+    return true;
+}
+
+// Cell where a constellation segment to a star below the horizon meets it
+static void clipped_star_cell(const struct StereoProjection *projection, const struct Star *star, int *row, int *col)
+{
+    double v[3];
+    horizontal_spherical_to_rectangular(star->base.azimuth, star->base.altitude, &v[0], &v[1], &v[2]);
+    clip_to_horizon(v);
+    project_horizontal_to_win(projection, v[0], v[1], v[2], row, col);
+}
+
+void render_stars_stereo(struct Canvas *canvas, const struct Conf *config, struct Star *star_table, int num_stars,
+                         const int *num_by_mag, struct StarCell *cells)
+{
+    struct StereoProjection projection = canvas_projection(canvas);
+
     int i;
     for (i = 0; i < num_stars; ++i)
     {
@@ -76,132 +119,119 @@ void render_stars_stereo(WINDOW *win, const struct Conf *config, struct Star *st
         int table_index = catalog_num - 1;
 
         struct Star *star = &star_table[table_index];
+        struct StarCell *cell = &cells[table_index];
 
-        if (star->magnitude > config->threshold)
+        // Below the horizon, including stars of culled tiles. These are never
+        // drawn, so they are only projected if a constellation figure runs to
+        // them
+        cell->above_horizon = star->base.altitude >= 0.0;
+        if (!cell->above_horizon)
         {
             continue;
         }
 
+        double v[3];
+        horizontal_spherical_to_rectangular(star->base.azimuth, star->base.altitude, &v[0], &v[1], &v[2]);
+        project_horizontal_to_win(&projection, v[0], v[1], v[2], &cell->row, &cell->col);
+
         // FIXME: this is hacky
         if (star->magnitude > config->label_thresh)
         {
             star->base.label = NULL;
         }
 
-        render_object_stereo(win, &star->base, config);
+        render_object_at(canvas, &star->base, cell->row, cell->col, config);
     }
 
     return;
 }
 
-void render_constellation(WINDOW *win, const struct Conf *config, struct Constell *constellation, const struct Star *star_table)
+// Draw a constellation segment between the cells its stars were drawn in
+static void render_constell_segment(struct Canvas *canvas, const struct StereoProjection *projection,
+                                    const struct Conf *config, const struct Star *star_table,
+                                    const struct StarCell *cells, int table_index_a, int table_index_b)
 {
-    unsigned int num_segments = constellation->num_segments;
+    // Ends below the horizon are clipped to it
+    const struct StarCell *cell_a = &cells[table_index_a];
+    const struct StarCell *cell_b = &cells[table_index_b];
+    bool a_clipped = !cell_a->above_horizon;
+    bool b_clipped = !cell_b->above_horizon;
 
-    // Only render if all stars are visible
-    for (unsigned int i = 0; i < num_segments * 2; i += 1)
+    if (a_clipped && b_clipped)
     {
-        int catalog_num = constellation->star_numbers[i];
-        int table_index = catalog_num - 1;
-        struct Star star = star_table[table_index];
-        if (star.magnitude > config->threshold)
-        {
-            return;
-        }
+        // Segment lies outside of screen
+        return;
     }
 
-    for (unsigned int i = 0; i < num_segments * 2; i += 2)
+    int ya = cell_a->row;
+    int xa = cell_a->col;
+    int yb = cell_b->row;
+    int xb = cell_b->col;
+    if (a_clipped)
     {
-        int catalog_num_a = constellation->star_numbers[i];
-        int catalog_num_b = constellation->star_numbers[i + 1];
-
-        int table_index_a = catalog_num_a - 1;
-        int table_index_b = catalog_num_b - 1;
-
-        struct Star star_a = star_table[table_index_a];
-        struct Star star_b = star_table[table_index_b];
-
-        // TODO: Same code as in render_object_stereo... perhaps refactor this
-        // or cache coordinates
-        double radius_a, theta_a;
-        double radius_b, theta_b;
-        horizontal_to_polar(star_a.base.azimuth, star_a.base.altitude, &radius_a, &theta_a);
-        horizontal_to_polar(star_b.base.azimuth, star_b.base.altitude, &radius_b, &theta_b);
+        clipped_star_cell(projection, &star_table[table_index_a], &ya, &xa);
+    }
+    if (b_clipped)
+    {
+        clipped_star_cell(projection, &star_table[table_index_b], &yb, &xb);
+    }
 
-        // Clip to edge of screen
-        if (fabs(radius_a) > 1 && fabs(radius_b) > 1)
+    // TODO: In old version, constrained line length for some reason... not
+    // sure why?
+    // FIXME: this logic is super verbose/long (any way to cut it down?)
+    // FIXME: this clipping doesn't seem to work or no-unicode for some reason?
+    if (config->unicode)
+    {
+        draw_line_smooth(canvas, ya, xa, yb, xb);
+        if (!a_clipped)
         {
-            // Segment lies outside of screen
-            continue;
+            canvas_add_str(canvas, ya, xa, "\u25CB"); // Unicode circle symbol
         }
-
-        bool a_clipped = false;
-        bool b_clipped = false;
-
-        // Clip the segment
-        if (fabs(radius_a) > 1)
+        if (!b_clipped)
         {
-            a_clipped = true;
-            radius_a = 1.0;
+            canvas_add_str(canvas, yb, xb, "\u25CB");
         }
-        else if (fabs(radius_b) > 1)
+    }
+    else
+    {
+        draw_line_ASCII(canvas, ya, xa, yb, xb);
+        if (!a_clipped)
         {
-            b_clipped = true;
-            radius_b = 1.0;
+            canvas_add_ch(canvas, ya, xa, '+');
         }
-
-        int height, width;
-        getmaxyx(win, height, width);
-
-        int ya, xa;
-        int yb, xb;
-        polar_to_win(radius_a, theta_a, height, width, &ya, &xa);
-
-        polar_to_win(radius_b, theta_b, height, width, &yb, &xb);
-
-        // TODO: In old version, constrained line length for some reason... not
-        // sure why?
-        // FIXME: this logic is super verbose/long (any way to cut it down?)
-        // FIXME: this clipping doesn't seem to work or no-unicode for some reason?
-        if (config->unicode)
+        if (!b_clipped)
         {
-            draw_line_smooth(win, ya, xa, yb, xb);
-            if (!a_clipped)
-            {
-                mvwaddstr(win, ya, xa, "\u25CB"); // Unicode circle symbol
-            }
-            if (!b_clipped)
-            {
-                mvwaddstr(win, yb, xb, "\u25CB");
-            }
-        }
-        else
-        {
-            draw_line_ASCII(win, ya, xa, yb, xb);
-            if (!a_clipped)
-            {
-                mvwaddch(win, ya, xa, '+');
-            }
-            if (!b_clipped)
-            {
-                mvwaddch(win, yb, xb, '+');
-            }
+            canvas_add_ch(canvas, yb, xb, '+');
         }
     }
 }
 
-void render_constells(WINDOW *win, const struct Conf *config, struct Constell **constell_table, int num_const,
-                      const struct Star *star_table)
+void render_constells(struct Canvas *canvas, const struct Conf *config, const struct ConstellTable *constell_table,
+                      const struct Star *star_table, const struct StarCell *cells)
 {
-    for (int i = 0; i < num_const; ++i)
+    struct StereoProjection projection = canvas_projection(canvas);
+
+    // The segments of consecutive figures are contiguous, so this is a single
+    // pass over the segments of the figures drawn
+    const int *ends = constell_table->ends;
+    for (unsigned int c = 0; c < constell_table->num_constells; ++c)
     {
-        struct Constell *constellation = &((*constell_table)[i]);
-        render_constellation(win, config, constellation, star_table);
+        if (!constell_table->drawn[c])
+        {
+            continue;
+        }
+
+        for (unsigned int i = 2 * constell_table->offsets[c]; i < 2 * constell_table->offsets[c + 1]; i += 2)
+        {
+            render_constell_segment(canvas, &projection, config, star_table, cells, ends[i], ends[i + 1]);
+        }
     }
 }
 
-void render_planets_stereo(WINDOW *win, const struct Conf *config, const struct Planet *planet_table)
+void render_planets_stereo(struct Canvas *canvas, const struct Conf *config, const struct Planet *planet_table)
 {
+    struct StereoProjection projection = canvas_projection(canvas);
+
     // Render planets so that closest are drawn on top
     int i;
     for (i = NUM_PLANETS - 1; i >= 0; --i)
@@ -215,15 +245,40 @@ void render_planets_stereo(WINDOW *win, const struct Conf *config, const struct
         }
 
         struct Planet planet_data = planet_table[i];
-        render_object_stereo(win, &planet_data.base, config);
+        render_object_stereo(canvas, &projection, &planet_data.base, config);
+    }
+
+    return;
+}
+
+void render_minor_bodies_stereo(struct Canvas *canvas, const struct Conf *config, const struct MinorBodies *bodies)
+{
+    struct StereoProjection projection = canvas_projection(canvas);
+
+    // Visible bodies are listed from the brightest they can appear, so draw
+    // them in reverse to keep bright bodies on top
+    for (int v = bodies->num_visible - 1; v >= 0; --v)
+    {
+        int i = bodies->visible[v];
+
+        struct ObjectBase base = {
+            .azimuth = bodies->azimuth[i],
+            .altitude = bodies->altitude[i],
+            .color_pair = 0,
+            .symbol_ASCII = bodies->comet[i] ? '~' : '+',
+            .symbol_unicode = bodies->comet[i] ? "☄" : "+",
+            .label = bodies->magnitude[i] <= config->label_thresh ? bodies->names[i] : NULL,
+        };
+        render_object_stereo(canvas, &projection, &base, config);
     }
 
     return;
 }
 
-void render_moon_stereo(WINDOW *win, const struct Conf *config, struct Moon moon_object)
+void render_moon_stereo(struct Canvas *canvas, const struct Conf *config, struct Moon moon_object)
 {
-    render_object_stereo(win, &moon_object.base, config);
+    struct StereoProjection projection = canvas_projection(canvas);
+    render_object_stereo(canvas, &projection, &moon_object.base, config);
 
     return;
 }
@@ -247,12 +302,12 @@ int compare_angles(const void *a, const void *b)
     return (90 / gcd(x, 90)) < (90 / gcd(y, 90));
 }
 
-void render_azimuthal_grid(WINDOW *win, const struct Conf *config)
+void render_azimuthal_grid(struct Canvas *canvas, const struct Conf *config)
 {
     const double to_rad = M_PI / 180.0;
 
     int height, width;
-    getmaxyx(win, height, width);
+    canvas_size(canvas, &height, &width);
     int maxy = height - 1;
     int maxx = width - 1;
 
@@ -301,11 +356,11 @@ void render_azimuthal_grid(WINDOW *win, const struct Conf *config)
 
             if (config->unicode)
             {
-                draw_line_smooth(win, y, x, rad_vertical, rad_horizontal);
+                draw_line_smooth(canvas, y, x, rad_vertical, rad_horizontal);
             }
             else
             {
-                draw_line_ASCII(win, y, x, rad_vertical, rad_horizontal);
+                draw_line_ASCII(canvas, y, x, rad_vertical, rad_horizontal);
             }
 
             int str_len = snprintf(NULL, 0, "%d", angle);
@@ -316,7 +371,7 @@ void render_azimuthal_grid(WINDOW *win, const struct Conf *config)
             // Offset to avoid truncating string
             int x_off = (x < rad_horizontal) ? 0 : -(str_len - 1);
 
-            mvwaddstr(win, y, x + x_off, label);
+            canvas_add_str(canvas, y, x + x_off, label);
 
             free(label);
         }
@@ -326,35 +381,35 @@ void render_azimuthal_grid(WINDOW *win, const struct Conf *config)
     // {
     //     int rad_x = rad_horizontal * angle / 90.0;
     //     int rad_x = rad_vertical * angle / 90.0;
-    //     // draw_ellipse(win, win->_maxy/2, win->_maxx/2, 20, 20,
+    //     // draw_ellipse(canvas, win->_maxy/2, win->_maxx/2, 20, 20,
     //     ascii); angle += inc;
     // }
 }
 
-void render_cardinal_directions(WINDOW *win, const struct Conf *config)
+void render_cardinal_directions(struct Canvas *canvas, const struct Conf *config)
 {
     // Render horizon directions
 
     if (config->color)
     {
-        wattron(win, COLOR_PAIR(5));
+        canvas_color_on(canvas, 5);
     }
 
     int height, width;
-    getmaxyx(win, height, width);
+    canvas_size(canvas, &height, &width);
     int maxy = height - 1;
     int maxx = width - 1;
 
     int half_maxy = round(maxy / 2.0);
     int half_maxx = round(maxx / 2.0);
 
-    mvwaddch(win, 0, half_maxx, 'N');
-    mvwaddch(win, half_maxy, width - 1, 'W');
-    mvwaddch(win, height - 1, half_maxx, 'S');
-    mvwaddch(win, half_maxy, 0, 'E');
+    canvas_add_ch(canvas, 0, half_maxx, 'N');
+    canvas_add_ch(canvas, half_maxy, width - 1, 'W');
+    canvas_add_ch(canvas, height - 1, half_maxx, 'S');
+    canvas_add_ch(canvas, half_maxy, 0, 'E');
 
     if (config->color)
     {
-        wattroff(win, COLOR_PAIR(5));
+        canvas_color_off(canvas, 5);
     }
 }
@@ -1,82 +1,213 @@
 #include "drawing.h"
 
-#include <curses.h>
+#include "canvas.h"
+#include "macros.h"
+
 #include <math.h>
+#include <stdbool.h>
 #include <stdlib.h>
 
+// Lines are rasterized with integers into runs of cells along rows, and every
+// cell is drawn once. The characters chosen are the same as when lines were
+// stepped in doubles and each cell rounded
+
+// Offsets along the minor axis of a line as it is stepped one cell at a time
+// along its major axis: k * delta / steps at step k, rounded half away from
+// zero as round() does
+struct LineStepper
+{
+    int steps;       // Length of the major axis, not counting the first cell
+    int sign;        // Direction of the minor axis
+    int twice_delta; // 2 |delta|
+    int offset;      // |offset| at the current step
+    int error;       // 2 k |delta| + steps - 2 steps |offset|, in [0, 2 steps)
+};
+
+static void init_stepper(struct LineStepper *stepper, int delta, int steps)
+{
+    *stepper = (struct LineStepper){
+        .steps = steps,
+        .sign = delta < 0 ? -1 : 1,
+        .twice_delta = 2 * abs(delta),
+        .offset = 0,
+        .error = steps,
+    };
+}
+
+// Jump to step k. Steps past the end of the line are never taken
+static void seek_stepper(struct LineStepper *stepper, int k)
+{
+    if (k <= 0 || k > stepper->steps)
+    {
+        return;
+    }
+
+    long long numerator = (long long)k * stepper->twice_delta + stepper->steps;
+    stepper->offset = (int)(numerator / (2 * stepper->steps));
+    stepper->error = (int)(numerator - 2LL * stepper->steps * stepper->offset);
+}
+
+static int stepper_offset(const struct LineStepper *stepper)
+{
+    return stepper->sign * stepper->offset;
+}
+
+// Offset at the next step. A line of a single cell has none, and is treated
+// as jumping to another row or column
+static int stepper_next_offset(const struct LineStepper *stepper)
+{
+    bool carry = stepper->error + stepper->twice_delta >= 2 * stepper->steps;
+    return stepper->sign * (stepper->offset + carry);
+}
+
+static void advance_stepper(struct LineStepper *stepper)
+{
+    stepper->error += stepper->twice_delta;
+    if (stepper->error >= 2 * stepper->steps)
+    {
+        stepper->error -= 2 * stepper->steps;
+        stepper->offset++;
+    }
+}
+
+// Steps [*begin, *end] of a line along an axis of `size` cells, starting at
+// `start` and moving by `step` (±1) for `steps` steps, that are within it
+static void clip_steps(int start, int step, int steps, int size, int *begin, int *end)
+{
+    if (step > 0)
+    {
+        *begin = MAX(0, -start);
+        *end = MIN(steps, size - 1 - start);
+    }
+    else
+    {
+        *begin = MAX(0, start - (size - 1));
+        *end = MIN(steps, start);
+    }
+}
+
+// A run of cells along a row drawn with the same character
+struct LineSpan
+{
+    int y;
+    int x; // Leftmost cell
+    int length;
+    const char *glyph;
+};
+
+// Cells of a line are gathered into a span until one cannot extend it, and
+// the span is drawn then
+struct SpanWriter
+{
+    struct Canvas *canvas;
+    struct LineSpan span; // Empty when its length is 0
+};
+
+static void init_span_writer(struct SpanWriter *writer, struct Canvas *canvas)
+{
+    writer->canvas = canvas;
+    writer->span.length = 0;
+}
+
+static void flush_span(struct SpanWriter *writer)
+{
+    const struct LineSpan *span = &writer->span;
+    if (span->length > 0)
+    {
+        canvas_add_run(writer->canvas, span->y, span->x, span->length, span->glyph);
+    }
+}
+
+static void add_cell(struct SpanWriter *writer, int y, int x, const char *glyph)
+{
+    // Lines are stepped one cell at a time, so a cell either side of the span
+    // extends it
+    struct LineSpan *span = &writer->span;
+    if (span->length > 0 && span->y == y && span->glyph == glyph)
+    {
+        if (x == span->x + span->length)
+        {
+            span->length++;
+            return;
+        }
+        if (x == span->x - 1)
+        {
+            span->x--;
+            span->length++;
+            return;
+        }
+    }
+
+    flush_span(writer);
+    *span = (struct LineSpan){y, x, 1, glyph};
+}
+
 // The difference in logic between drawing an ASCII and unicode line differs
 // enough that having two different functions is warranted
 
-void draw_line_ASCII(WINDOW *win, int ya, int xa, int yb, int xb)
+void draw_line_ASCII(struct Canvas *canvas, int ya, int xa, int yb, int xb)
 {
-    // The logic here is not particularly elegant or efficient
-
     int dy = yb - ya;
     int dx = xb - xa;
 
     // "Joint"/junction character
-    char slope;
+    const char *slope;
 
     // No intelligence... just choose based on case
     if (dx > 0)
     {
-        slope = dy > 0 ? '\\' : '/';
+        slope = dy > 0 ? "\\" : "/";
     }
     else
     {
-        slope = dy > 0 ? '/' : '\\';
+        slope = dy > 0 ? "/" : "\\";
     }
 
+    int height, width;
+    canvas_size(canvas, &height, &width);
+    struct SpanWriter writer;
+    init_span_writer(&writer, canvas);
+
     if (abs(dy) >= abs(dx))
     {
-        int y = 0;
-        double x = 0.0;
-
-        // Step size
         int sy = (dy > 0) ? 1 : -1;
-        double sx = (double)dx / abs(dy);
-
-        while (abs(y) <= abs(dy))
-        {
-            int curr_y = ya + y;
-            int curr_x = xa + (int)round(x);
+        struct LineStepper x;
+        init_stepper(&x, dx, abs(dy));
 
-            int next_y = ya + y + sy;
-            int next_x = xa + (int)round(x + sx);
+        int begin, end;
+        clip_steps(ya, sy, abs(dy), height, &begin, &end);
+        seek_stepper(&x, begin);
 
-            mvwaddch(win, curr_y, curr_x, '|');
+        for (int k = begin; k <= end; ++k)
+        {
+            int curr_x = xa + stepper_offset(&x);
+            int next_x = xa + stepper_next_offset(&x);
 
             // Draw slope if we jump a column
-            if (next_x != curr_x)
-            {
-                mvwaddch(win, curr_y, curr_x, slope);
-            }
+            add_cell(&writer, ya + sy * k, curr_x, next_x != curr_x ? slope : "|");
 
-            y += sy;
-            x += sx;
+            advance_stepper(&x);
         }
     }
     else
     {
-        double y = 0.0;
-        int x = 0;
-
-        // Step size
-        double sy = (double)dy / abs(dx);
         int sx = (dx > 0) ? 1 : -1;
+        struct LineStepper y;
+        init_stepper(&y, dy, abs(dx));
 
-        while (abs(x) <= abs(dx))
-        {
-            int curr_y = ya + (int)round(y);
-            int curr_x = xa + x;
-
-            int next_y = ya + (int)round(y + sy);
-            int next_x = xa + x + sx;
+        // Edge case where we draw a horizontal line
+        const char *horizontal = ya == yb ? "-" : "_";
 
-            // Edge case where we draw a horizontal line
-            char horizontal = ya == yb ? '-' : '_';
+        // Whether a step is skipped depends on the steps before it, so only
+        // the steps after the window are clipped
+        int begin, end;
+        clip_steps(xa, sx, abs(dx), width, &begin, &end);
 
-            mvwaddch(win, curr_y, curr_x, horizontal);
+        for (int k = 0; k <= end; ++k)
+        {
+            int curr_y = ya + stepper_offset(&y);
+            int curr_x = xa + sx * k;
+            int next_y = ya + stepper_next_offset(&y);
 
             // This bit requires a little more logic: drawing '-' characters
             // isn't as smooth as '_' characters. Thus, to draw a good lookin'
@@ -84,50 +215,45 @@ void draw_line_ASCII(WINDOW *win, int ya, int xa, int yb, int xb)
             // (remember we're in screen space coordinates and the y-axis is
             // "flipped")
 
-            // Draw slope if we jump a row
-            if (next_y != curr_y)
+            // Draw slope if we jump a row. Moving "up", it replaces the
+            // current cell
+            bool jump = next_y != curr_y;
+            add_cell(&writer, curr_y, curr_x, jump && dy <= 0 ? slope : horizontal);
+
+            // We're moving "down": add the slope to the next position, unless
+            // we're on the last cell, and skip drawing it the next iteration
+            if (jump && dy > 0 && curr_y != yb)
             {
-                if (dy > 0)
-                {
-                    // We're moving "down": add the slope to the next position
-                    // Make sure we're not on the last cell first
-                    if (curr_y != yb)
-                    {
-                        mvwaddch(win, next_y, next_x, slope);
-
-                        // Skip drawing the next position the next iteration
-                        y += sy;
-                        x += sx;
-                    }
-                }
-                else
-                {
-                    // We're moving "up": just add the slope to the current cell
-                    mvwaddch(win, curr_y, curr_x, slope);
-                }
+                add_cell(&writer, next_y, curr_x + sx, slope);
+                advance_stepper(&y);
+                ++k;
             }
 
-            y += sy;
-            x += sx;
+            advance_stepper(&y);
         }
     }
 
+    flush_span(&writer);
+
     // Could add asterisks at beginning and end of segment to "prettify",
     // but not for this application
-    // mvwaddch(win, ya, xa, '*');
-    // mvwaddch(win, yb, xb, '*');
+    // canvas_add_ch(canvas, ya, xa, '*');
+    // canvas_add_ch(canvas, yb, xb, '*');
 }
 
-void draw_line_smooth(WINDOW *win, int ya, int xa, int yb, int xb)
+void draw_line_smooth(struct Canvas *canvas, int ya, int xa, int yb, int xb)
 {
-    // The logic here is not particularly elegant or efficient
-
     int dy = yb - ya;
     int dx = xb - xa;
 
     // "Joint"/junction characters
-    char *joint_a;
-    char *joint_b;
+    const char *joint_a;
+    const char *joint_b;
+
+    int height, width;
+    canvas_size(canvas, &height, &width);
+    struct SpanWriter writer;
+    init_span_writer(&writer, canvas);
 
     if (abs(dy) > abs(dx))
     {
@@ -143,32 +269,32 @@ void draw_line_smooth(WINDOW *win, int ya, int xa, int yb, int xb)
             joint_b = dy > 0 ? "╭" : "╰";
         }
 
-        int y = 0;
-        double x = 0.0;
-
-        // Step size
         int sy = (dy > 0) ? 1 : -1;
-        double sx = (double)dx / abs(dy);
-
-        while (abs(y) <= abs(dy))
-        {
-            int curr_y = ya + y;
-            int curr_x = xa + (int)round(x);
+        struct LineStepper x;
+        init_stepper(&x, dx, abs(dy));
 
-            int next_y = ya + y + sy;
-            int next_x = xa + (int)round(x + sx);
+        int begin, end;
+        clip_steps(ya, sy, abs(dy), height, &begin, &end);
+        seek_stepper(&x, begin);
 
-            mvwaddstr(win, curr_y, curr_x, "│");
+        for (int k = begin; k <= end; ++k)
+        {
+            int curr_y = ya + sy * k;
+            int curr_x = xa + stepper_offset(&x);
+            int next_x = xa + stepper_next_offset(&x);
 
             // Draw joint if we jump a column && we're not on the last cell
             if (curr_x != next_x && curr_x != xb)
             {
-                mvwaddstr(win, curr_y, curr_x, joint_a);
-                mvwaddstr(win, curr_y, next_x, joint_b);
+                add_cell(&writer, curr_y, curr_x, joint_a);
+                add_cell(&writer, curr_y, next_x, joint_b);
+            }
+            else
+            {
+                add_cell(&writer, curr_y, curr_x, "│");
             }
 
-            y += sy;
-            x += sx;
+            advance_stepper(&x);
         }
     }
     else
@@ -185,85 +311,84 @@ void draw_line_smooth(WINDOW *win, int ya, int xa, int yb, int xb)
             joint_a = dx > 0 ? "╯" : "╰";
         }
 
-        double y = 0.0;
-        int x = 0;
-
-        // Step size
-        double sy = (double)dy / abs(dx);
         int sx = (dx > 0) ? 1 : -1;
+        struct LineStepper y;
+        init_stepper(&y, dy, abs(dx));
 
-        while (abs(x) <= abs(dx))
-        {
-            int curr_y = ya + (int)round(y);
-            int curr_x = xa + x;
-
-            int next_y = ya + (int)round(y + sy);
-            int next_x = xa + x + sx;
+        int begin, end;
+        clip_steps(xa, sx, abs(dx), width, &begin, &end);
+        seek_stepper(&y, begin);
 
-            mvwaddstr(win, curr_y, curr_x, "─");
+        for (int k = begin; k <= end; ++k)
+        {
+            int curr_y = ya + stepper_offset(&y);
+            int curr_x = xa + sx * k;
+            int next_y = ya + stepper_next_offset(&y);
 
             // Draw joint if we jump a row && we're not on the last cell
             if (curr_y != next_y && curr_y != yb)
             {
-                mvwaddstr(win, curr_y, curr_x, joint_a);
-                mvwaddstr(win, next_y, curr_x, joint_b);
+                add_cell(&writer, curr_y, curr_x, joint_a);
+                add_cell(&writer, next_y, curr_x, joint_b);
+            }
+            else
+            {
+                add_cell(&writer, curr_y, curr_x, "─");
             }
 
-            y += sy;
-            x += sx;
+            advance_stepper(&y);
         }
     }
+
+    flush_span(&writer);
 }
 
-void draw_line_dotted(WINDOW *win, int ya, int xa, int yb, int xb)
+void draw_line_dotted(struct Canvas *canvas, int ya, int xa, int yb, int xb)
 {
-    // The logic here is not particularly elegant or efficient
-
     int dy = yb - ya;
     int dx = xb - xa;
 
-    char *fill = "•";
+    const char *fill = "•";
+
+    int height, width;
+    canvas_size(canvas, &height, &width);
+    struct SpanWriter writer;
+    init_span_writer(&writer, canvas);
 
     if (abs(dy) >= abs(dx))
     {
-        int y = 0;
-        double x = 0.0;
-
-        // Step size
         int sy = (dy > 0) ? 1 : -1;
-        double sx = (double)dx / abs(dy);
-
-        while (abs(y) <= abs(dy))
-        {
-            int curr_y = ya + y;
-            int curr_x = xa + (int)round(x);
+        struct LineStepper x;
+        init_stepper(&x, dx, abs(dy));
 
-            mvwaddstr(win, curr_y, curr_x, fill);
+        int begin, end;
+        clip_steps(ya, sy, abs(dy), height, &begin, &end);
+        seek_stepper(&x, begin);
 
-            y += sy;
-            x += sx;
+        for (int k = begin; k <= end; ++k)
+        {
+            add_cell(&writer, ya + sy * k, xa + stepper_offset(&x), fill);
+            advance_stepper(&x);
         }
     }
     else
     {
-        double y = 0.0;
-        int x = 0;
-
-        // Step size
-        double sy = (double)dy / abs(dx);
         int sx = (dx > 0) ? 1 : -1;
+        struct LineStepper y;
+        init_stepper(&y, dy, abs(dx));
 
-        while (abs(x) <= abs(dx))
-        {
-            int curr_y = ya + (int)round(y);
-            int curr_x = xa + x;
-
-            mvwaddstr(win, curr_y, curr_x, fill);
+        int begin, end;
+        clip_steps(xa, sx, abs(dx), width, &begin, &end);
+        seek_stepper(&y, begin);
 
-            y += sy;
-            x += sx;
+        for (int k = begin; k <= end; ++k)
+        {
+            add_cell(&writer, ya + stepper_offset(&y), xa + sx * k, fill);
+            advance_stepper(&y);
         }
     }
+
+    flush_span(&writer);
 }
 
 enum FillType
@@ -275,65 +400,65 @@ enum FillType
 
 // Reference: https://dai.fmph.uniba.sk/upload/0/01/Ellipse.pdf
 
-void print_chars_ellipse_ASCII(WINDOW *win, int center_y, int center_x, int y, int x, int fill)
+void print_chars_ellipse_ASCII(struct Canvas *canvas, int center_y, int center_x, int y, int x, int fill)
 {
     switch (fill)
     {
     case CORNER:
-        mvwaddch(win, center_y - y, center_x + x, '\\'); // Quad I
-        mvwaddch(win, center_y - y, center_x - x, '/');  // Quad II
-        mvwaddch(win, center_y + y, center_x - x, '\\'); // Quad III
-        mvwaddch(win, center_y + y, center_x + x, '/');  // Quad IV
+        canvas_add_ch(canvas, center_y - y, center_x + x, '\\'); // Quad I
+        canvas_add_ch(canvas, center_y - y, center_x - x, '/');  // Quad II
+        canvas_add_ch(canvas, center_y + y, center_x - x, '\\'); // Quad III
+        canvas_add_ch(canvas, center_y + y, center_x + x, '/');  // Quad IV
         break;
 
     case VERTICAL:
-        mvwaddch(win, center_y - y, center_x + x, '|');
-        mvwaddch(win, center_y - y, center_x - x, '|');
-        mvwaddch(win, center_y + y, center_x - x, '|');
-        mvwaddch(win, center_y + y, center_x + x, '|');
+        canvas_add_ch(canvas, center_y - y, center_x + x, '|');
+        canvas_add_ch(canvas, center_y - y, center_x - x, '|');
+        canvas_add_ch(canvas, center_y + y, center_x - x, '|');
+        canvas_add_ch(canvas, center_y + y, center_x + x, '|');
         break;
 
     case HORIZONTAL:
-        mvwaddch(win, center_y - y, center_x + x, '-');
-        mvwaddch(win, center_y - y, center_x - x, '-');
-        mvwaddch(win, center_y + y, center_x - x, '-');
-        mvwaddch(win, center_y + y, center_x + x, '-');
+        canvas_add_ch(canvas, center_y - y, center_x + x, '-');
+        canvas_add_ch(canvas, center_y - y, center_x - x, '-');
+        canvas_add_ch(canvas, center_y + y, center_x - x, '-');
+        canvas_add_ch(canvas, center_y + y, center_x + x, '-');
         break;
     }
 }
 
-void print_chars_ellipse_unicode(WINDOW *win, int center_y, int center_x, int y, int x, int fill)
+void print_chars_ellipse_unicode(struct Canvas *canvas, int center_y, int center_x, int y, int x, int fill)
 {
     // TODO: def not correct
     switch (fill)
     {
     case CORNER:
         // Quad I
-        mvwaddstr(win, center_y - y - 1, center_x + x, "╮");
-        mvwaddstr(win, center_y - y, center_x + x, "╰");
+        canvas_add_str(canvas, center_y - y - 1, center_x + x, "╮");
+        canvas_add_str(canvas, center_y - y, center_x + x, "╰");
         // Quad II
-        mvwaddstr(win, center_y - y - 1, center_x - x, "╭");
-        mvwaddstr(win, center_y - y, center_x - x, "╯");
+        canvas_add_str(canvas, center_y - y - 1, center_x - x, "╭");
+        canvas_add_str(canvas, center_y - y, center_x - x, "╯");
         // Quad III
-        mvwaddstr(win, center_y + y - 1, center_x - x, "╮");
-        mvwaddstr(win, center_y + y, center_x - x, "╰");
+        canvas_add_str(canvas, center_y + y - 1, center_x - x, "╮");
+        canvas_add_str(canvas, center_y + y, center_x - x, "╰");
         // Quad IV
-        mvwaddstr(win, center_y + y - 1, center_x + x, "╭");
-        mvwaddstr(win, center_y + y, center_x + x, "╯");
+        canvas_add_str(canvas, center_y + y - 1, center_x + x, "╭");
+        canvas_add_str(canvas, center_y + y, center_x + x, "╯");
         break;
 
     case VERTICAL:
-        mvwaddstr(win, center_y - y, center_x + x, "│");
-        mvwaddstr(win, center_y - y, center_x - x, "│");
-        mvwaddstr(win, center_y + y, center_x - x, "│");
-        mvwaddstr(win, center_y + y, center_x + x, "│");
+        canvas_add_str(canvas, center_y - y, center_x + x, "│");
+        canvas_add_str(canvas, center_y - y, center_x - x, "│");
+        canvas_add_str(canvas, center_y + y, center_x - x, "│");
+        canvas_add_str(canvas, center_y + y, center_x + x, "│");
         break;
 
     case HORIZONTAL:
-        mvwaddstr(win, center_y - y, center_x + x, "─");
-        mvwaddstr(win, center_y - y, center_x - x, "─");
-        mvwaddstr(win, center_y + y, center_x - x, "─");
-        mvwaddstr(win, center_y + y, center_x + x, "─");
+        canvas_add_str(canvas, center_y - y, center_x + x, "─");
+        canvas_add_str(canvas, center_y - y, center_x - x, "─");
+        canvas_add_str(canvas, center_y + y, center_x - x, "─");
+        canvas_add_str(canvas, center_y + y, center_x + x, "─");
         break;
     }
 
@@ -345,7 +470,7 @@ int ellipse_error(int y, int x, int rad_y, int rad_x)
     return (rad_x * rad_x + x * x) + (rad_y * rad_y + y * y) - (rad_x * rad_x * rad_y * rad_y);
 }
 
-void draw_ellipse(WINDOW *win, int center_y, int center_x, int rad_y, int rad_x, bool no_unicode)
+void draw_ellipse(struct Canvas *canvas, int center_y, int center_x, int rad_y, int rad_x, bool no_unicode)
 {
     int y = 0;
     int x = rad_x;
@@ -370,11 +495,11 @@ void draw_ellipse(WINDOW *win, int center_y, int center_x, int rad_y, int rad_x,
 
         if (no_unicode)
         {
-            print_chars_ellipse_ASCII(win, center_y, center_x, y, x, fill);
+            print_chars_ellipse_ASCII(canvas, center_y, center_x, y, x, fill);
         }
         else
         {
-            print_chars_ellipse_unicode(win, center_y, center_x, y, x, fill);
+            print_chars_ellipse_unicode(canvas, center_y, center_x, y, x, fill);
         }
 
         y = y_next;
@@ -395,11 +520,11 @@ void draw_ellipse(WINDOW *win, int center_y, int center_x, int rad_y, int rad_x,
 
         if (no_unicode)
         {
-            print_chars_ellipse_ASCII(win, center_y, center_x, y, x, fill);
+            print_chars_ellipse_ASCII(canvas, center_y, center_x, y, x, fill);
         }
         else
         {
-            print_chars_ellipse_unicode(win, center_y, center_x, y, x, fill);
+            print_chars_ellipse_unicode(canvas, center_y, center_x, y, x, fill);
         }
 
         y = y_next;
@@ -0,0 +1,133 @@
+#include "ephemeris.h"
+
+#include "astro.h"
+#include "core.h"
+
+#include <limits.h>
+#include <math.h>
+#include <stdbool.h>
+
+// Windows are aligned to J2000 so that fits do not depend on the order of
+// queries
+#define EPOCH 2451545.0
+
+struct Body
+{
+    const struct Planet *planet_table;
+    int planet;
+    const struct Moon *moon_object;
+};
+
+// Exact geocentric position from the Keplerian model
+static void body_geo(const struct Body *body, double julian_date, double *xg, double *yg, double *zg)
+{
+    if (body->moon_object != NULL)
+    {
+        calc_moon_geo_ICRF(body->moon_object->elements, body->moon_object->rates, julian_date, xg, yg, zg);
+        return;
+    }
+
+    planet_geo_ICRF(body->planet_table, body->planet, julian_date, xg, yg, zg);
+}
+
+// Fit each coordinate over a window by interpolating at the Chebyshev nodes
+static void fit_window(struct EphemerisWindow *window, const struct Body *body, long index, double days)
+{
+    double samples[3][EPHEMERIS_COEFFS];
+    for (int k = 0; k < EPHEMERIS_COEFFS; ++k)
+    {
+        double u = cos(M_PI * (k + 0.5) / EPHEMERIS_COEFFS);
+        double julian_date = EPOCH + (index + (u + 1.0) / 2.0) * days;
+        body_geo(body, julian_date, &samples[0][k], &samples[1][k], &samples[2][k]);
+    }
+
+    for (int j = 0; j < EPHEMERIS_COEFFS; ++j)
+    {
+        double sum[3] = {0.0, 0.0, 0.0};
+        for (int k = 0; k < EPHEMERIS_COEFFS; ++k)
+        {
+            double t = cos(M_PI * j * (k + 0.5) / EPHEMERIS_COEFFS);
+            sum[0] += samples[0][k] * t;
+            sum[1] += samples[1][k] * t;
+            sum[2] += samples[2][k] * t;
+        }
+
+        // The constant term is halved so evaluation can treat all terms alike
+        double scale = (j == 0 ? 1.0 : 2.0) / EPHEMERIS_COEFFS;
+        for (int c = 0; c < 3; ++c)
+        {
+            window->coeffs[c][j] = sum[c] * scale;
+        }
+    }
+
+    window->index = index;
+    window->fitted = true;
+}
+
+// Clenshaw's recurrence for a Chebyshev series at u in [-1, 1]
+static double evaluate_series(const double *coeffs, double u)
+{
+    double b1 = 0.0, b2 = 0.0;
+    for (int j = EPHEMERIS_COEFFS - 1; j >= 1; --j)
+    {
+        double b0 = 2.0 * u * b1 - b2 + coeffs[j];
+        b2 = b1;
+        b1 = b0;
+    }
+    return u * b1 - b2 + coeffs[0];
+}
+
+static void window_geo(struct EphemerisWindow *window, const struct Body *body, double days, double julian_date,
+                       double *xg, double *yg, double *zg)
+{
+    double offset = (julian_date - EPOCH) / days;
+    long index = (long)floor(offset);
+
+    if (!window->fitted || window->index != index)
+    {
+        if (window->pending != index)
+        {
+            window->pending = index;
+            body_geo(body, julian_date, xg, yg, zg);
+            return;
+        }
+        fit_window(window, body, index, days);
+    }
+
+    double u = 2.0 * (offset - index) - 1.0;
+    *xg = evaluate_series(window->coeffs[0], u);
+    *yg = evaluate_series(window->coeffs[1], u);
+    *zg = evaluate_series(window->coeffs[2], u);
+}
+
+void init_ephemeris(struct Ephemeris *ephemeris)
+{
+    for (int i = 0; i < NUM_PLANETS + 1; ++i)
+    {
+        ephemeris->bodies[i] = (struct EphemerisWindow){
+            .index = LONG_MIN,
+            .pending = LONG_MIN,
+            .fitted = false,
+        };
+    }
+}
+
+void ephemeris_planet_geo(struct Ephemeris *ephemeris, const struct Planet *planet_table, int planet, double julian_date,
+                          double *xg, double *yg, double *zg)
+{
+    if (planet == EARTH)
+    {
+        *xg = *yg = *zg = 0.0;
+        return;
+    }
+
+    struct Body body = {.planet_table = planet_table, .planet = planet};
+    window_geo(&ephemeris->bodies[planet], &body, EPHEMERIS_PLANET_DAYS, julian_date, xg, yg, zg);
+}
+
+void ephemeris_moon_geo(struct Ephemeris *ephemeris, const struct Moon *moon_object, double julian_date, double *xg,
+                        double *yg, double *zg)
+{
+    struct Body body = {.moon_object = moon_object};
+    window_geo(&ephemeris->bodies[EPHEMERIS_MOON], &body, EPHEMERIS_MOON_DAYS, julian_date, xg, yg, zg);
+}
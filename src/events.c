@@ -0,0 +1,799 @@
+#include "events.h"
+
+#include "astro.h"
+#include "coord.h"
+#include "core.h"
+#include "export.h"
+#include "macros.h"
+#include "pool.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Time between the samples that bracket events (days). Objects turn 15° about
+// the pole in this time, so each step holds at most one of each event
+#define EVENT_STEP (1.0 / 24.0)
+
+// Events are refined to within about 0.1 s (days)
+#define EVENT_TOLERANCE 1E-6
+#define MAX_REFINE_STEPS 50
+
+// The Sun, planets and Moon return to the meridian no sooner than the stars,
+// with a margin for planets near their stations (days)
+#define SHORTEST_DAY 0.99
+
+// Listings find events over windows of this many days at a time, so memory use
+// is bounded by the window rather than the length of the range
+#define EVENT_WINDOW 7.0
+
+// Longest listed row: a time, a name or star number, an event and two angles
+#define MAX_EVENT_ROW 64
+
+// Margin on the cosine of the hour angle at which a star crosses the horizon,
+// well above rounding error, for deciding its side from the hour angle alone
+#define HORIZON_MARGIN 1E-9
+
+// Time the next rise and set of the Sun and Moon are looked for ahead of the
+// time shown (days)
+#define EVENT_LOOKAHEAD 2.0
+
+// Room for the events of one object over the lookahead
+#define MAX_LOOKAHEAD_EVENTS 16
+
+// Equatorial coordinates of an object at a time
+typedef void (*equatorial_position)(const void *object, double julian_date, double *right_ascension,
+                                    double *declination);
+
+struct EventSearch
+{
+    equatorial_position position;
+    const void *object;
+    double latitude;
+    double longitude;
+    double sin_latitude;
+    double cos_latitude;
+
+    // The object is above the horizon whenever the magnitude of its hour angle
+    // is at most above_hour_angle, and below whenever it is greater than
+    // below_hour_angle. Between them the altitude is computed
+    double above_hour_angle;
+    double below_hour_angle;
+
+    // Sidereal time at each step, or NULL to compute it
+    const double *sidereal_times;
+
+    // Sidereal time changes at a steady rate over the few days of a search, so
+    // other samples take it from the time at the start of the search
+    double epoch;
+    double epoch_sidereal_time;
+    double sidereal_rate; // rad/day
+};
+
+struct EventSample
+{
+    double julian_date;
+    double hour_angle;   // In (-π, π]
+    double sin_altitude; // NAN if the side of the horizon was known without it
+    bool above;
+};
+
+struct PlanetObject
+{
+    const struct Planet *planet_table;
+    int index;
+};
+
+static void star_position(const void *object, double julian_date, double *right_ascension, double *declination)
+{
+    const struct Star *star = object;
+    calc_star_position(star->right_ascension, star->ra_motion, star->declination, star->dec_motion, julian_date,
+                       right_ascension, declination);
+}
+
+static void planet_position(const void *object, double julian_date, double *right_ascension, double *declination)
+{
+    const struct PlanetObject *planet = object;
+
+    double xg, yg, zg;
+    planet_geo_ICRF(planet->planet_table, planet->index, julian_date, &xg, &yg, &zg);
+    equatorial_rectangular_to_spherical(xg, yg, zg, right_ascension, declination);
+}
+
+static void moon_position(const void *object, double julian_date, double *right_ascension, double *declination)
+{
+    const struct Moon *moon = object;
+
+    double xg, yg, zg;
+    calc_moon_geo_ICRF(moon->elements, moon->rates, julian_date, &xg, &yg, &zg);
+    equatorial_rectangular_to_spherical(xg, yg, zg, right_ascension, declination);
+}
+
+// Steps are spread evenly so a range is covered exactly
+static int count_steps(double start, double end)
+{
+    return MAX(1, (int)ceil((end - start) / EVENT_STEP));
+}
+
+static double step_time(double start, double end, int num_steps, int k)
+{
+    return k == num_steps ? end : start + (end - start) / num_steps * k;
+}
+
+// Wrap an angle to (-π, π]
+static double wrap_angle(double angle)
+{
+    return angle - 2.0 * M_PI * ceil((angle - M_PI) / (2.0 * M_PI));
+}
+
+static double sin_altitude(const struct EventSearch *search, double declination, double hour_angle)
+{
+    return search->sin_latitude * sin(declination) + search->cos_latitude * cos(declination) * cos(hour_angle);
+}
+
+static double search_sidereal_time(const struct EventSearch *search, double julian_date)
+{
+    return search->epoch_sidereal_time + search->sidereal_rate * (julian_date - search->epoch);
+}
+
+static struct EventSample take_sample(const struct EventSearch *search, double julian_date)
+{
+    double right_ascension, declination;
+    search->position(search->object, julian_date, &right_ascension, &declination);
+
+    double gmst = search_sidereal_time(search, julian_date);
+    double hour_angle = wrap_angle(gmst + search->longitude - right_ascension);
+
+    struct EventSample sample = {
+        .julian_date = julian_date,
+        .hour_angle = hour_angle,
+        .sin_altitude = sin_altitude(search, declination, hour_angle),
+    };
+    sample.above = sample.sin_altitude >= 0.0;
+    return sample;
+}
+
+// Sample at step k, leaving out the altitude when the hour angle alone tells
+// which side of the horizon the object is on
+static struct EventSample take_step_sample(const struct EventSearch *search, double julian_date, int k)
+{
+    if (search->sidereal_times == NULL)
+    {
+        return take_sample(search, julian_date);
+    }
+
+    double right_ascension, declination;
+    search->position(search->object, julian_date, &right_ascension, &declination);
+
+    double hour_angle = wrap_angle(search->sidereal_times[k] + search->longitude - right_ascension);
+
+    struct EventSample sample = {
+        .julian_date = julian_date,
+        .hour_angle = hour_angle,
+        .sin_altitude = NAN,
+    };
+    if (fabs(hour_angle) <= search->above_hour_angle)
+    {
+        sample.above = true;
+    }
+    else if (fabs(hour_angle) > search->below_hour_angle)
+    {
+        sample.above = false;
+    }
+    else
+    {
+        sample.sin_altitude = sin_altitude(search, declination, hour_angle);
+        sample.above = sample.sin_altitude >= 0.0;
+    }
+    return sample;
+}
+
+// Functions whose zeros are found
+enum Crossing
+{
+    CROSS_HORIZON,       // Rise or set
+    CROSS_MERIDIAN,      // Upper culmination (transit)
+    CROSS_LOWER_MERIDIAN // Lower culmination
+};
+
+static double crossing_value(const struct EventSample *sample, enum Crossing crossing)
+{
+    switch (crossing)
+    {
+    case CROSS_HORIZON:
+        return sample->sin_altitude;
+    case CROSS_MERIDIAN:
+        return sample->hour_angle;
+    case CROSS_LOWER_MERIDIAN:
+        return wrap_angle(sample->hour_angle - M_PI);
+    }
+    return 0.0;
+}
+
+// Time of a crossing bracketed by two samples, by the Illinois variant of false
+// position. It converges about as fast as the secant method but keeps the root
+// bracketed
+static double refine_crossing(const struct EventSearch *search, enum Crossing crossing, struct EventSample a,
+                              struct EventSample b)
+{
+    if (crossing == CROSS_HORIZON)
+    {
+        a = isnan(a.sin_altitude) ? take_sample(search, a.julian_date) : a;
+        b = isnan(b.sin_altitude) ? take_sample(search, b.julian_date) : b;
+    }
+
+    double ta = a.julian_date, fa = crossing_value(&a, crossing);
+    double tb = b.julian_date, fb = crossing_value(&b, crossing);
+
+    // Steps shrink superlinearly, so one within the tolerance leaves the root
+    // closer still
+    double change = INFINITY;
+    for (int i = 0; i < MAX_REFINE_STEPS && fabs(change) > EVENT_TOLERANCE; ++i)
+    {
+        double tc = tb - fb * (tb - ta) / (fb - fa);
+        change = tc - tb;
+        struct EventSample c = take_sample(search, tc);
+        double fc = crossing_value(&c, crossing);
+        if (fc == 0.0)
+        {
+            return tc;
+        }
+
+        if ((fc < 0.0) != (fb < 0.0))
+        {
+            ta = tb;
+            fa = fb;
+        }
+        else
+        {
+            // The same end was kept twice, so its weight is halved
+            fa /= 2.0;
+        }
+        tb = tc;
+        fb = fc;
+    }
+
+    return tb;
+}
+
+static void add_event(const struct EventSearch *search, double julian_date, enum EventType type,
+                      struct SkyEvent *events, int *num_events, int max_events)
+{
+    if (*num_events >= max_events)
+    {
+        return;
+    }
+
+    double right_ascension, declination;
+    search->position(search->object, julian_date, &right_ascension, &declination);
+
+    struct SkyEvent *event = &events[(*num_events)++];
+    event->julian_date = julian_date;
+    event->type = type;
+    equatorial_to_horizontal(right_ascension, declination, search_sidereal_time(search, julian_date),
+                             search->latitude, search->longitude, &event->azimuth, &event->altitude);
+}
+
+static int find_events(const struct EventSearch *search, double start, double end, struct SkyEvent *events,
+                       int max_events)
+{
+    int num_events = 0;
+    int num_steps = count_steps(start, end);
+
+    struct EventSample a = take_step_sample(search, start, 0);
+    for (int k = 1; k <= num_steps && num_events < max_events; ++k)
+    {
+        struct EventSample b = take_step_sample(search, step_time(start, end, num_steps, k), k);
+        int first = num_events;
+
+        // An event at a sample belongs to the step ending there. The hour
+        // angle jumps from π to -π at lower culmination
+        bool transit = a.hour_angle < 0.0 && b.hour_angle >= 0.0 && b.hour_angle - a.hour_angle < M_PI;
+        bool lower_transit = a.hour_angle > 0.0 && b.hour_angle <= 0.0 && a.hour_angle - b.hour_angle > M_PI;
+
+        if (a.above != b.above)
+        {
+            add_event(search, refine_crossing(search, CROSS_HORIZON, a, b), b.above ? EVENT_RISE : EVENT_SET,
+                      events, &num_events, max_events);
+        }
+
+        if (transit)
+        {
+            // Objects near the limit of never rising may only clear the
+            // horizon around culmination, and rise and set within the step
+            double julian_date = refine_crossing(search, CROSS_MERIDIAN, a, b);
+            add_event(search, julian_date, EVENT_TRANSIT, events, &num_events, max_events);
+            struct EventSample c = !a.above && !b.above ? take_sample(search, julian_date) : a;
+            if (!a.above && c.above)
+            {
+                add_event(search, refine_crossing(search, CROSS_HORIZON, a, c), EVENT_RISE, events, &num_events,
+                          max_events);
+                add_event(search, refine_crossing(search, CROSS_HORIZON, c, b), EVENT_SET, events, &num_events,
+                          max_events);
+            }
+        }
+        else if (lower_transit && a.above && b.above)
+        {
+            // Likewise objects near the limit of never setting
+            double julian_date = refine_crossing(search, CROSS_LOWER_MERIDIAN, a, b);
+            struct EventSample c = take_sample(search, julian_date);
+            if (!c.above)
+            {
+                add_event(search, refine_crossing(search, CROSS_HORIZON, a, c), EVENT_SET, events, &num_events,
+                          max_events);
+                add_event(search, refine_crossing(search, CROSS_HORIZON, c, b), EVENT_RISE, events, &num_events,
+                          max_events);
+            }
+        }
+
+        // Events within a step are put in order of time
+        for (int i = first + 1; i < num_events; ++i)
+        {
+            for (int j = i; j > first && events[j].julian_date < events[j - 1].julian_date; --j)
+            {
+                struct SkyEvent temp = events[j];
+                events[j] = events[j - 1];
+                events[j - 1] = temp;
+            }
+        }
+
+        a = b;
+    }
+
+    return num_events;
+}
+
+static struct EventSearch make_search(equatorial_position position, const void *object, double start,
+                                      double latitude, double longitude)
+{
+    // The rate is found over a day, a whole turn more than the change in angle
+    double epoch_sidereal_time = greenwich_mean_sidereal_time_rad(start);
+    double turn = wrap_angle(greenwich_mean_sidereal_time_rad(start + 1.0) - epoch_sidereal_time);
+
+    // The altitude is always computed
+    return (struct EventSearch){
+        .position = position,
+        .object = object,
+        .latitude = latitude,
+        .longitude = longitude,
+        .sin_latitude = sin(latitude),
+        .cos_latitude = cos(latitude),
+        .above_hour_angle = -1.0,
+        .below_hour_angle = M_PI,
+        .epoch = start,
+        .epoch_sidereal_time = epoch_sidereal_time,
+        .sidereal_rate = 2.0 * M_PI + turn,
+    };
+}
+
+// Stars are above the horizon when the cosine of their hour angle is at least
+// -tan(latitude) tan(declination). Their declination barely changes, so over a
+// range it bounds the hour angles at which they can rise or set
+static struct EventSearch make_star_search(const struct Star *star, double start, double end, double latitude,
+                                           double longitude, const double *sidereal_times)
+{
+    struct EventSearch search = make_search(star_position, star, start, latitude, longitude);
+    search.sidereal_times = sidereal_times;
+
+    double right_ascension, dec_start, dec_end;
+    star_position(star, start, &right_ascension, &dec_start);
+    star_position(star, end, &right_ascension, &dec_end);
+
+    // Near the poles the horizon is too ill conditioned to bound
+    if (search.cos_latitude * MIN(cos(dec_start), cos(dec_end)) < 1E-6)
+    {
+        return search;
+    }
+
+    double tan_latitude = search.sin_latitude / search.cos_latitude;
+    double c_start = -tan_latitude * tan(dec_start);
+    double c_end = -tan_latitude * tan(dec_end);
+    double c_low = MIN(c_start, c_end) - HORIZON_MARGIN;
+    double c_high = MAX(c_start, c_end) + HORIZON_MARGIN;
+
+    search.above_hour_angle = c_high > 1.0 ? -1.0 : acos(MAX(-1.0, c_high));
+    search.below_hour_angle = acos(MIN(1.0, MAX(-1.0, c_low)));
+    return search;
+}
+
+int max_events_between(double start, double end)
+{
+    return 3 * ((int)ceil((end - start) / SHORTEST_DAY) + 1);
+}
+
+int find_star_events(const struct Star *star, double start, double end, double latitude, double longitude,
+                     struct SkyEvent *events, int max_events)
+{
+    struct EventSearch search = make_star_search(star, start, end, latitude, longitude, NULL);
+    return find_events(&search, start, end, events, max_events);
+}
+
+int find_planet_events(const struct Planet *planet_table, int index, double start, double end, double latitude,
+                       double longitude, struct SkyEvent *events, int max_events)
+{
+    struct PlanetObject planet = {planet_table, index};
+    struct EventSearch search = make_search(planet_position, &planet, start, latitude, longitude);
+    return find_events(&search, start, end, events, max_events);
+}
+
+int find_moon_events(const struct Moon *moon_object, double start, double end, double latitude, double longitude,
+                     struct SkyEvent *events, int max_events)
+{
+    struct EventSearch search = make_search(moon_position, moon_object, start, latitude, longitude);
+    return find_events(&search, start, end, events, max_events);
+}
+
+const struct SkyEvent *first_event(const struct SkyEvent *events, int num_events, enum EventType type)
+{
+    for (int i = 0; i < num_events; ++i)
+    {
+        if (events[i].type == type)
+        {
+            return &events[i];
+        }
+    }
+    return NULL;
+}
+
+const char *event_type_name(enum EventType type)
+{
+    switch (type)
+    {
+    case EVENT_RISE:
+        return "rise";
+    case EVENT_TRANSIT:
+        return "transit";
+    case EVENT_SET:
+        return "set";
+    }
+    return "";
+}
+
+// Events of a window are sorted by small keys rather than moved themselves
+struct ListedEvent
+{
+    double julian_date;
+    int object; // Index in the order objects are listed
+    int index;  // Of the event in the object's events
+};
+
+struct EventJob
+{
+    const struct Star *star_table;
+    const int *star_numbers; // In increasing order
+    const struct Planet *planet_table;
+    const struct Moon *moon_object;
+    double latitude;
+    double longitude;
+
+    // Current window, its sidereal time at each step, and room for max_events
+    // of each object
+    double start;
+    double end;
+    const double *sidereal_times;
+    int max_events;
+    struct SkyEvent *events;
+    int *num_events;
+};
+
+static void find_window_events(void *context, int begin, int end)
+{
+    struct EventJob *job = context;
+
+    for (int i = begin; i < end; ++i)
+    {
+        struct SkyEvent *events = job->events + (size_t)i * job->max_events;
+        int planet = i < NUM_BODIES ? body_planet_index(i) : -1;
+        if (planet >= 0)
+        {
+            job->num_events[i] = find_planet_events(job->planet_table, planet, job->start, job->end, job->latitude,
+                                                    job->longitude, events, job->max_events);
+        }
+        else if (i < NUM_BODIES)
+        {
+            job->num_events[i] = find_moon_events(job->moon_object, job->start, job->end, job->latitude,
+                                                  job->longitude, events, job->max_events);
+        }
+        else
+        {
+            // Stars share the sidereal times of the window
+            const struct Star *star = &job->star_table[job->star_numbers[i - NUM_BODIES] - 1];
+            struct EventSearch search =
+                make_star_search(star, job->start, job->end, job->latitude, job->longitude, job->sidereal_times);
+            job->num_events[i] = find_events(&search, job->start, job->end, events, job->max_events);
+        }
+    }
+}
+
+static int compare_listed_events(const void *a, const void *b)
+{
+    const struct ListedEvent *x = a;
+    const struct ListedEvent *y = b;
+    if (x->julian_date != y->julian_date)
+    {
+        return x->julian_date < y->julian_date ? -1 : 1;
+    }
+    return (x->object > y->object) - (x->object < y->object);
+}
+
+static int compare_numbers(const void *a, const void *b)
+{
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static char *format_two_digits(char *out, int value)
+{
+    *out++ = (char)('0' + value / 10);
+    *out++ = (char)('0' + value % 10);
+    return out;
+}
+
+// Write a Julian date rounded to the second as yyyy-mm-ddThh:mm:ssZ. gmtime
+// and strftime would take longer than finding the events
+static char *format_utc_time(char *out, double julian_date)
+{
+    const double JULIAN_DATE_EPOCH = 2440587.5;
+    long long seconds = llround((julian_date - JULIAN_DATE_EPOCH) * 86400.0);
+    long long days = seconds / 86400 - (seconds % 86400 < 0);
+    int second_of_day = (int)(seconds - days * 86400);
+
+    // Civil date from days since 1970-01-01, in eras of 400 years starting on
+    // March 1st so leap days fall at the end of a year
+    long long z = days + 719468;
+    long long era = (z >= 0 ? z : z - 146096) / 146097;
+    int day_of_era = (int)(z - era * 146097);
+    int year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    int day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    int month_index = (5 * day_of_year + 2) / 153;
+    int day = day_of_year - (153 * month_index + 2) / 5 + 1;
+    int month = month_index < 10 ? month_index + 3 : month_index - 9;
+    long long year = year_of_era + era * 400 + (month <= 2);
+
+    out = format_two_digits(out, (int)(year / 100));
+    out = format_two_digits(out, (int)(year % 100));
+    *out++ = '-';
+    out = format_two_digits(out, month);
+    *out++ = '-';
+    out = format_two_digits(out, day);
+    *out++ = 'T';
+    out = format_two_digits(out, second_of_day / 3600);
+    *out++ = ':';
+    out = format_two_digits(out, second_of_day / 60 % 60);
+    *out++ = ':';
+    out = format_two_digits(out, second_of_day % 60);
+    *out++ = 'Z';
+    return out;
+}
+
+static char *format_event_row(char *out, const struct EventJob *job, const struct ListedEvent *listed)
+{
+    const struct SkyEvent *event = &job->events[(size_t)listed->object * job->max_events + listed->index];
+    out = format_utc_time(out, event->julian_date);
+    *out++ = ',';
+
+    int i = listed->object;
+    if (i < NUM_BODIES)
+    {
+        int planet = body_planet_index(i);
+        const struct ObjectBase *base = planet < 0 ? &job->moon_object->base : &job->planet_table[planet].base;
+        size_t length = strlen(base->label);
+        memcpy(out, base->label, length);
+        out += length;
+    }
+    else
+    {
+        out = format_integer(out, job->star_numbers[i - NUM_BODIES]);
+    }
+    *out++ = ',';
+
+    const char *type = event_type_name(event->type);
+    size_t length = strlen(type);
+    memcpy(out, type, length);
+    out += length;
+    *out++ = ',';
+
+    // Azimuths just short of north would round up to 360
+    double azimuth = event->azimuth * TO_DEG;
+    out = format_fixed(out, azimuth >= 359.995 ? azimuth - 360.0 : azimuth, 2);
+    *out++ = ',';
+    out = format_fixed(out, event->altitude * TO_DEG, 2);
+    *out++ = '\n';
+    return out;
+}
+
+bool list_events(FILE *stream, struct Pool *pool, const struct Star *star_table, const int *star_numbers,
+                 int num_stars, const struct Planet *planet_table, const struct Moon *moon_object, double start,
+                 double end, double latitude, double longitude)
+{
+    int num_objects = NUM_BODIES + num_stars;
+    double window = MIN(EVENT_WINDOW, end - start);
+    int max_events = max_events_between(0.0, window);
+    size_t max_listed = (size_t)num_objects * max_events;
+
+    // Errors go to stderr, since stdout may be the listing. Rows of a window
+    // are formatted into one buffer and written together. The length of a
+    // window may round up to another step
+    int *numbers = malloc(MAX(num_stars, 1) * sizeof(int));
+    double *sidereal_times = malloc((count_steps(0.0, window) + 2) * sizeof(double));
+    struct SkyEvent *events = malloc(max_listed * sizeof(struct SkyEvent));
+    int *num_events = malloc(num_objects * sizeof(int));
+    struct ListedEvent *listed = malloc(max_listed * sizeof(struct ListedEvent));
+    char *buffer = malloc(max_listed * MAX_EVENT_ROW);
+    if (numbers == NULL || sidereal_times == NULL || events == NULL || num_events == NULL || listed == NULL ||
+        buffer == NULL)
+    {
+        fprintf(stderr, "Allocation of memory for events failed\n");
+        free(numbers);
+        free(sidereal_times);
+        free(events);
+        free(num_events);
+        free(listed);
+        free(buffer);
+        return false;
+    }
+
+    memcpy(numbers, star_numbers, num_stars * sizeof(int));
+    qsort(numbers, num_stars, sizeof(int), compare_numbers);
+
+    struct EventJob job = {
+        .star_table = star_table,
+        .star_numbers = numbers,
+        .planet_table = planet_table,
+        .moon_object = moon_object,
+        .latitude = latitude,
+        .longitude = longitude,
+        .sidereal_times = sidereal_times,
+        .max_events = max_events,
+        .events = events,
+        .num_events = num_events,
+    };
+
+    bool s = fputs("time,object,event,azimuth,altitude\n", stream) >= 0;
+
+    // Windows are computed from the start rather than accumulated, and each
+    // holds the events in (start, end] so none are listed twice
+    int num_windows = MAX(1, (int)ceil((end - start) / EVENT_WINDOW - 1E-9));
+    for (int w = 0; s && w < num_windows; ++w)
+    {
+        job.start = start + EVENT_WINDOW * w;
+        job.end = w == num_windows - 1 ? end : start + EVENT_WINDOW * (w + 1);
+
+        int num_steps = count_steps(job.start, job.end);
+        for (int k = 0; k <= num_steps; ++k)
+        {
+            sidereal_times[k] = greenwich_mean_sidereal_time_rad(step_time(job.start, job.end, num_steps, k));
+        }
+        pool_run(pool, find_window_events, &job, num_objects, 1);
+
+        size_t num_listed = 0;
+        for (int i = 0; i < num_objects; ++i)
+        {
+            for (int j = 0; j < num_events[i]; ++j)
+            {
+                listed[num_listed++] = (struct ListedEvent){events[(size_t)i * max_events + j].julian_date, i, j};
+            }
+        }
+        qsort(listed, num_listed, sizeof(struct ListedEvent), compare_listed_events);
+
+        char *out = buffer;
+        for (size_t i = 0; i < num_listed; ++i)
+        {
+            out = format_event_row(out, &job, &listed[i]);
+        }
+        size_t length = (size_t)(out - buffer);
+        s = fwrite(buffer, 1, length, stream) == length;
+    }
+
+    free(numbers);
+    free(sidereal_times);
+    free(events);
+    free(num_events);
+    free(listed);
+    free(buffer);
+    return s;
+}
+
+bool list_events_to_output(const struct Conf *config, struct Pool *pool, const struct Star *star_table,
+                           const int *star_numbers, int num_stars, const struct Planet *planet_table,
+                           const struct Moon *moon_object, double start, double end)
+{
+    FILE *stream = stdout;
+    if (config->output_path != NULL)
+    {
+        stream = fopen(config->output_path, "w");
+        if (stream == NULL)
+        {
+            fprintf(stderr, "ERROR: Unable to open '%s'\n", config->output_path);
+            return false;
+        }
+    }
+
+    bool s = list_events(stream, pool, star_table, star_numbers, num_stars, planet_table, moon_object, start, end,
+                         config->latitude, config->longitude);
+    s = fflush(stream) == 0 && s;
+    if (stream != stdout)
+    {
+        s = fclose(stream) == 0 && s;
+    }
+    if (!s)
+    {
+        fprintf(stderr, "ERROR: Unable to list events\n");
+    }
+
+    return s;
+}
+
+static double next_event_date(const struct SkyEvent *events, int num_events, enum EventType type, double *expires)
+{
+    const struct SkyEvent *event = first_event(events, num_events, type);
+    if (event == NULL)
+    {
+        return 0.0;
+    }
+    *expires = MIN(*expires, event->julian_date);
+    return event->julian_date;
+}
+
+static void update_next_events(struct NextEvents *next, const struct Planet *planet_table,
+                               const struct Moon *moon_object, double julian_date, double latitude, double longitude)
+{
+    if (next->found && julian_date >= next->found_at && julian_date < next->expires)
+    {
+        return;
+    }
+
+    double end = julian_date + EVENT_LOOKAHEAD;
+    next->found = true;
+    next->found_at = julian_date;
+    next->expires = end;
+
+    struct SkyEvent events[MAX_LOOKAHEAD_EVENTS];
+    int num_events =
+        find_planet_events(planet_table, SUN, julian_date, end, latitude, longitude, events, MAX_LOOKAHEAD_EVENTS);
+    next->sun_rise = next_event_date(events, num_events, EVENT_RISE, &next->expires);
+    next->sun_set = next_event_date(events, num_events, EVENT_SET, &next->expires);
+
+    num_events = find_moon_events(moon_object, julian_date, end, latitude, longitude, events, MAX_LOOKAHEAD_EVENTS);
+    next->moon_rise = next_event_date(events, num_events, EVENT_RISE, &next->expires);
+    next->moon_set = next_event_date(events, num_events, EVENT_SET, &next->expires);
+}
+
+// Write the local time of an event as hh:mm, or --:-- if there is none
+static void format_event_time(char *out, size_t size, double event_date)
+{
+    const double JULIAN_DATE_EPOCH = 2440587.5;
+    time_t utc_time = (time_t)((event_date - JULIAN_DATE_EPOCH) * 86400);
+    const struct tm *local_time = localtime(&utc_time);
+    if (local_time == NULL)
+    {
+        local_time = gmtime(&utc_time);
+    }
+
+    if (event_date == 0.0 || local_time == NULL)
+    {
+        snprintf(out, size, "--:--");
+        return;
+    }
+    snprintf(out, size, "%02d:%02d", local_time->tm_hour, local_time->tm_min);
+}
+
+static void describe_rise_and_set(char *out, size_t size, double rise_date, double set_date)
+{
+    char rise[8], set[8];
+    format_event_time(rise, sizeof(rise), rise_date);
+    format_event_time(set, sizeof(set), set_date);
+    snprintf(out, size, "rise %s, set %s", rise, set);
+}
+
+void describe_next_events(struct NextEvents *next, const struct Planet *planet_table, const struct Moon *moon_object,
+                          double julian_date, double latitude, double longitude, char *sun, char *moon, size_t size)
+{
+    update_next_events(next, planet_table, moon_object, julian_date, latitude, longitude);
+    describe_rise_and_set(sun, size, next->sun_rise, next->sun_set);
+    describe_rise_and_set(moon, size, next->moon_rise, next->moon_set);
+}
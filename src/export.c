@@ -0,0 +1,416 @@
+#include "export.h"
+
+#include "astro.h"
+#include "core.h"
+#include "core_position.h"
+#include "macros.h"
+#include "pool.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+// Output each thread formats before the batch is written (bytes)
+#define EXPORT_BUFFER_SIZE (1 << 20)
+
+// Longest CSV row: a Julian date, a name or star number and two angles
+#define MAX_CSV_ROW 64
+
+// Decimal places of the Julian dates (about 0.1 s) and angles in CSV rows
+#define DATE_DECIMALS 6
+#define ANGLE_DECIMALS 4
+
+struct ExportWorker
+{
+    // Positions are updated in place, so each thread has its own tables
+    struct Star *stars;
+    struct Planet planets[NUM_PLANETS];
+    struct Moon moon;
+
+    char *buffer;
+    size_t length;
+};
+
+struct ExportJob
+{
+    enum ExportFormat format;
+    const struct ExportRange *range;
+    double latitude;
+    double longitude;
+    int num_stars;
+    struct ExportWorker *workers;
+
+    // Epochs of the current batch, split between workers
+    long first_epoch;
+    long num_epochs;
+    long epochs_per_worker;
+};
+
+int body_planet_index(int i)
+{
+    if (i == NUM_BODIES - 1)
+    {
+        return -1;
+    }
+    return i < EARTH ? i : i + 1;
+}
+
+// Number of the object written at index i of an epoch
+static int object_number(const struct ExportWorker *worker, int i)
+{
+    if (i < NUM_BODIES)
+    {
+        int planet = body_planet_index(i);
+        return planet < 0 ? -1 - NUM_PLANETS : -1 - planet;
+    }
+    return worker->stars[i - NUM_BODIES].catalog_number;
+}
+
+static const struct ObjectBase *object_base(const struct ExportWorker *worker, int i)
+{
+    if (i < NUM_BODIES)
+    {
+        int planet = body_planet_index(i);
+        return planet < 0 ? &worker->moon.base : &worker->planets[planet].base;
+    }
+    return &worker->stars[i - NUM_BODIES].base;
+}
+
+// Formatting. snprintf is several times slower than the position updates, so
+// numbers are written digit by digit. Event listings share these
+
+char *format_integer(char *out, long long value)
+{
+    if (value < 0)
+    {
+        *out++ = '-';
+        value = -value;
+    }
+
+    char digits[20];
+    int n = 0;
+    do
+    {
+        digits[n++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+
+    while (n > 0)
+    {
+        *out++ = digits[--n];
+    }
+    return out;
+}
+
+char *format_fixed(char *out, double value, int decimals)
+{
+    long long scale = 1;
+    for (int i = 0; i < decimals; ++i)
+    {
+        scale *= 10;
+    }
+
+    long long scaled = llround(fabs(value) * (double)scale);
+    if (value < 0.0 && scaled != 0)
+    {
+        *out++ = '-';
+    }
+    out = format_integer(out, scaled / scale);
+
+    long long fraction = scaled % scale;
+    *out++ = '.';
+    for (int i = decimals - 1; i >= 0; --i)
+    {
+        out[i] = (char)('0' + fraction % 10);
+        fraction /= 10;
+    }
+    return out + decimals;
+}
+
+static char *format_csv_row(char *out, double julian_date, const struct ExportWorker *worker, int i)
+{
+    out = format_fixed(out, julian_date, DATE_DECIMALS);
+    *out++ = ',';
+
+    if (i < NUM_BODIES)
+    {
+        const char *label = object_base(worker, i)->label;
+        size_t length = strlen(label);
+        memcpy(out, label, length);
+        out += length;
+    }
+    else
+    {
+        out = format_integer(out, object_number(worker, i));
+    }
+    *out++ = ',';
+
+    const struct ObjectBase *base = object_base(worker, i);
+    out = format_fixed(out, base->azimuth * TO_DEG, ANGLE_DECIMALS);
+    *out++ = ',';
+    out = format_fixed(out, base->altitude * TO_DEG, ANGLE_DECIMALS);
+    *out++ = '\n';
+    return out;
+}
+
+// Little endian encoding of binary exports
+
+static char *put_u32(char *out, uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        out[i] = (char)(value >> (8 * i));
+    }
+    return out + 4;
+}
+
+static char *put_u64(char *out, uint64_t value)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        out[i] = (char)(value >> (8 * i));
+    }
+    return out + 8;
+}
+
+static char *put_f32(char *out, float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return put_u32(out, bits);
+}
+
+static char *put_f64(char *out, double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return put_u64(out, bits);
+}
+
+static size_t epoch_size(enum ExportFormat format, int num_objects)
+{
+    return (size_t)num_objects * (format == EXPORT_CSV ? MAX_CSV_ROW : EXPORT_RECORD_SIZE);
+}
+
+static void export_epochs(void *context, int begin, int end)
+{
+    struct ExportJob *job = context;
+    int num_objects = NUM_BODIES + job->num_stars;
+
+    // One item per worker
+    for (int w = begin; w < end; ++w)
+    {
+        struct ExportWorker *worker = &job->workers[w];
+        char *out = worker->buffer;
+
+        long first = job->first_epoch + w * job->epochs_per_worker;
+        long last = MIN(first + job->epochs_per_worker, job->first_epoch + job->num_epochs);
+        for (long epoch = first; epoch < last; ++epoch)
+        {
+            // Computed from the start rather than accumulated, so long ranges
+            // don't drift
+            double julian_date = job->range->start + job->range->step * (double)epoch;
+
+            update_star_positions(worker->stars, job->num_stars, julian_date, job->latitude, job->longitude);
+            update_planet_positions(worker->planets, julian_date, job->latitude, job->longitude);
+            update_moon_position(&worker->moon, julian_date, job->latitude, job->longitude);
+
+            for (int i = 0; i < num_objects; ++i)
+            {
+                if (job->format == EXPORT_CSV)
+                {
+                    out = format_csv_row(out, julian_date, worker, i);
+                }
+                else
+                {
+                    const struct ObjectBase *base = object_base(worker, i);
+                    out = put_f32(out, (float)(base->azimuth * TO_DEG));
+                    out = put_f32(out, (float)(base->altitude * TO_DEG));
+                }
+            }
+        }
+
+        worker->length = (size_t)(out - worker->buffer);
+    }
+}
+
+static bool write_header(FILE *stream, enum ExportFormat format, const struct ExportWorker *worker, int num_objects,
+                         const struct ExportRange *range)
+{
+    if (format == EXPORT_CSV)
+    {
+        return fputs("julian_date,object,azimuth,altitude\n", stream) >= 0;
+    }
+
+    char header[EXPORT_HEADER_SIZE];
+    char *out = header;
+    memcpy(out, EXPORT_MAGIC, 8);
+    out = put_u32(out + 8, EXPORT_VERSION);
+    out = put_u32(out, (uint32_t)num_objects);
+    out = put_f64(out, range->start);
+    out = put_f64(out, range->step);
+    out = put_u64(out, (uint64_t)range->num_epochs);
+    if (fwrite(header, 1, sizeof(header), stream) != sizeof(header))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < num_objects; ++i)
+    {
+        char number[4];
+        put_u32(number, (uint32_t)object_number(worker, i));
+        if (fwrite(number, 1, sizeof(number), stream) != sizeof(number))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int compare_star_numbers(const void *a, const void *b)
+{
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static void free_workers(struct ExportWorker *workers, int num_workers)
+{
+    for (int w = 0; w < num_workers; ++w)
+    {
+        free(workers[w].stars);
+        free(workers[w].buffer);
+    }
+    free(workers);
+}
+
+bool export_positions(FILE *stream, enum ExportFormat format, struct Pool *pool, const struct Star *star_table,
+                      const int *star_numbers, int num_stars, const struct Planet *planet_table,
+                      const struct Moon *moon_object, const struct ExportRange *range, double latitude,
+                      double longitude)
+{
+    int num_objects = NUM_BODIES + num_stars;
+    int num_workers = pool->num_threads;
+
+    // Each worker formats enough epochs to fill its buffer, at least one
+    size_t per_epoch = epoch_size(format, num_objects);
+    long epochs_per_worker = MAX(1, (long)(EXPORT_BUFFER_SIZE / per_epoch));
+
+    // Errors go to stderr, since stdout may be the export
+    int *numbers = malloc(MAX(num_stars, 1) * sizeof(int));
+    struct ExportWorker *workers = calloc(num_workers, sizeof(struct ExportWorker));
+    if (numbers == NULL || workers == NULL)
+    {
+        fprintf(stderr, "Allocation of memory for export failed\n");
+        free(numbers);
+        free(workers);
+        return false;
+    }
+
+    memcpy(numbers, star_numbers, num_stars * sizeof(int));
+    qsort(numbers, num_stars, sizeof(int), compare_star_numbers);
+
+    for (int w = 0; w < num_workers; ++w)
+    {
+        struct ExportWorker *worker = &workers[w];
+        worker->stars = malloc(MAX(num_stars, 1) * sizeof(struct Star));
+        worker->buffer = malloc(epochs_per_worker * per_epoch);
+        if (worker->stars == NULL || worker->buffer == NULL)
+        {
+            fprintf(stderr, "Allocation of memory for export failed\n");
+            free(numbers);
+            free_workers(workers, num_workers);
+            return false;
+        }
+
+        for (int i = 0; i < num_stars; ++i)
+        {
+            worker->stars[i] = star_table[numbers[i] - 1];
+        }
+        memcpy(worker->planets, planet_table, sizeof(worker->planets));
+        worker->moon = *moon_object;
+    }
+    free(numbers);
+
+    struct ExportJob job = {
+        .format = format,
+        .range = range,
+        .latitude = latitude,
+        .longitude = longitude,
+        .num_stars = num_stars,
+        .workers = workers,
+        .epochs_per_worker = epochs_per_worker,
+    };
+
+    bool s = write_header(stream, format, &workers[0], num_objects, range);
+
+    long batch = epochs_per_worker * num_workers;
+    for (long first = 0; s && first < range->num_epochs; first += batch)
+    {
+        job.first_epoch = first;
+        job.num_epochs = MIN(batch, range->num_epochs - first);
+        pool_run(pool, export_epochs, &job, num_workers, 1);
+
+        // Workers past the end of the range have nothing to write
+        for (int w = 0; s && w < num_workers; ++w)
+        {
+            s = fwrite(workers[w].buffer, 1, workers[w].length, stream) == workers[w].length;
+        }
+    }
+
+    free_workers(workers, num_workers);
+    return s;
+}
+
+bool export_to_output(const struct Conf *config, struct Pool *pool, const struct Star *star_table,
+                      const int *star_numbers, int num_stars, const struct Planet *planet_table,
+                      const struct Moon *moon_object, double start, double end)
+{
+    const double seconds_per_day = 24.0 * 60.0 * 60.0;
+    struct ExportRange range = {
+        .start = start,
+        .step = config->step / seconds_per_day,
+    };
+
+    // Epochs land on the end of the range when the step divides it
+    range.num_epochs = (long)floor((end - start) / range.step + 1E-9) + 1;
+
+    FILE *stream = stdout;
+    if (config->output_path != NULL)
+    {
+        stream = fopen(config->output_path, "wb");
+        if (stream == NULL)
+        {
+            fprintf(stderr, "ERROR: Unable to open '%s'\n", config->output_path);
+            return false;
+        }
+    }
+#ifdef _WIN32
+    else if (config->export_format == EXPORT_BINARY)
+    {
+        _setmode(_fileno(stdout), _O_BINARY);
+    }
+#endif
+
+    bool s = export_positions(stream, config->export_format, pool, star_table, star_numbers, num_stars, planet_table,
+                              moon_object, &range, config->latitude, config->longitude);
+    s = fflush(stream) == 0 && s;
+    if (stream != stdout)
+    {
+        s = fclose(stream) == 0 && s;
+    }
+    if (!s)
+    {
+        fprintf(stderr, "ERROR: Unable to export positions\n");
+    }
+
+    return s;
+}
@@ -0,0 +1,169 @@
+#include "frame_stats.h"
+
+#include "stopwatch.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Values below 2^LINEAR_BITS get a bucket each. Above, every power of two is
+// split into 2^SUB_BITS buckets
+#define LINEAR_BITS 4
+#define SUB_BITS 3
+
+const char *frame_phase_name(enum FramePhase phase)
+{
+    static const char *names[NUM_PHASES] = {
+        [PHASE_UPDATE] = "update", [PHASE_RENDER] = "render", [PHASE_INPUT] = "input",
+        [PHASE_OUTPUT] = "output", [PHASE_SLEEP] = "sleep",   [PHASE_FRAME] = "frame",
+    };
+    return names[phase];
+}
+
+static int bucket_index(unsigned long long usec)
+{
+    if (usec < (1ULL << LINEAR_BITS))
+    {
+        return (int)usec;
+    }
+
+    int exponent = 63 - __builtin_clzll(usec);
+    int sub = (int)(usec >> (exponent - SUB_BITS)) & ((1 << SUB_BITS) - 1);
+    return (1 << LINEAR_BITS) + ((exponent - LINEAR_BITS) << SUB_BITS) + sub;
+}
+
+// Largest value in a bucket
+static unsigned long long bucket_upper(int index)
+{
+    if (index < (1 << LINEAR_BITS))
+    {
+        return index;
+    }
+
+    index -= 1 << LINEAR_BITS;
+    int exponent = (index >> SUB_BITS) + LINEAR_BITS;
+    unsigned long long sub = index & ((1 << SUB_BITS) - 1);
+    unsigned long long lower = (1ULL << exponent) + (sub << (exponent - SUB_BITS));
+    return lower + (1ULL << (exponent - SUB_BITS)) - 1;
+}
+
+void histogram_add(struct Histogram *histogram, unsigned long long usec)
+{
+    histogram->window[histogram->next] = usec;
+    histogram->next = (histogram->next + 1) % STATS_WINDOW;
+    if (histogram->num_window < STATS_WINDOW)
+    {
+        histogram->num_window++;
+    }
+
+    histogram->buckets[bucket_index(usec)]++;
+    histogram->count++;
+    if (usec > histogram->max)
+    {
+        histogram->max = usec;
+    }
+}
+
+void frame_stats_lap(struct FrameStats *stats, enum FramePhase phase, struct SwTimestamp *lap)
+{
+    struct SwTimestamp now;
+    sw_gettime(&now);
+
+    unsigned long long usec;
+    sw_timediff_usec(now, *lap, &usec);
+    histogram_add(&stats->phases[phase], usec);
+
+    *lap = now;
+}
+
+static int compare_samples(const void *a, const void *b)
+{
+    unsigned long long x = *(const unsigned long long *)a;
+    unsigned long long y = *(const unsigned long long *)b;
+    return (x > y) - (x < y);
+}
+
+// Index of a percentile in n sorted samples (nearest rank)
+static unsigned long long rank(int percent, unsigned long long n)
+{
+    unsigned long long r = (percent * n + 99) / 100;
+    return r == 0 ? 0 : r - 1;
+}
+
+struct Percentiles histogram_window_percentiles(const struct Histogram *histogram)
+{
+    struct Percentiles p = {0};
+
+    int n = histogram->num_window;
+    if (n == 0)
+    {
+        return p;
+    }
+
+    unsigned long long sorted[STATS_WINDOW];
+    memcpy(sorted, histogram->window, n * sizeof(unsigned long long));
+    qsort(sorted, n, sizeof(unsigned long long), compare_samples);
+
+    p.p50 = sorted[rank(50, n)];
+    p.p95 = sorted[rank(95, n)];
+    p.p99 = sorted[rank(99, n)];
+    p.max = sorted[n - 1];
+    return p;
+}
+
+struct Percentiles histogram_percentiles(const struct Histogram *histogram)
+{
+    struct Percentiles p = {0};
+
+    if (histogram->count == 0)
+    {
+        return p;
+    }
+
+    const int percents[] = {50, 95, 99};
+    unsigned long long *values[] = {&p.p50, &p.p95, &p.p99};
+
+    int q = 0;
+    unsigned long long seen = 0;
+    for (int i = 0; i < STATS_BUCKETS && q < 3; ++i)
+    {
+        seen += histogram->buckets[i];
+        while (q < 3 && seen > rank(percents[q], histogram->count))
+        {
+            // The bucket bound can overshoot the largest sample
+            unsigned long long upper = bucket_upper(i);
+            *values[q] = upper < histogram->max ? upper : histogram->max;
+            q++;
+        }
+    }
+
+    p.max = histogram->max;
+    return p;
+}
+
+void print_frame_stats(const struct FrameStats *stats, FILE *stream)
+{
+    fprintf(stream, "Frame timing over %llu frames (µs):\n", stats->phases[PHASE_FRAME].count);
+    fprintf(stream, "%-8s %9s %9s %9s %9s\n", "phase", "p50", "p95", "p99", "max");
+    for (int i = 0; i < NUM_PHASES; ++i)
+    {
+        struct Percentiles p = histogram_percentiles(&stats->phases[i]);
+        fprintf(stream, "%-8s %9llu %9llu %9llu %9llu\n", frame_phase_name(i), p.p50, p.p95, p.p99, p.max);
+    }
+
+    if (stats->cells.count > 0)
+    {
+        struct Percentiles p = histogram_percentiles(&stats->cells);
+        fprintf(stream, "Cells drawn per frame:\n");
+        fprintf(stream, "%-8s %9llu %9llu %9llu %9llu\n", "cells", p.p50, p.p95, p.p99, p.max);
+    }
+
+    if (stats->bytes.count > 0)
+    {
+        struct Percentiles b = histogram_percentiles(&stats->bytes);
+        struct Percentiles w = histogram_percentiles(&stats->writes);
+        fprintf(stream, "Terminal output per frame:\n");
+        fprintf(stream, "%-8s %9llu %9llu %9llu %9llu\n", "bytes", b.p50, b.p95, b.p99, b.max);
+        fprintf(stream, "%-8s %9llu %9llu %9llu %9llu\n", "writes", w.p50, w.p95, w.p99, w.max);
+    }
+}
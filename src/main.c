@@ -1,48 +1,63 @@
+#include "arena.h"
+#include "canvas.h"
 #include "city.h"
 #include "core.h"
 #include "core_position.h"
 #include "core_render.h"
 #include "data/keplerian_elements.h"
+#include "ephemeris.h"
+#include "events.h"
+#include "export.h"
+#include "frame_stats.h"
 #include "macros.h"
+#include "minor_bodies.h"
+#include "observers.h"
 #include "parse_BSC5.h"
+#include "pool.h"
+#include "recording.h"
+#include "redraw.h"
+#include "star_buffer.h"
 #include "stopwatch.h"
 #include "term.h"
 #include "version.h"
 
 // Embedded data generated during build
-#include "bsc5.h"
-#include "bsc5_constellations.h"
-#include "bsc5_names.h"
+#include "bsc5_tables.h"
 
 #include <curses.h>
 #include "optparse.c"
 
 #include <locale.h>
-#include <signal.h>
+#include <math.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
-static void catch_winch(int sig);
-static void resize_ncurses(void);
 static void resize_meta(WINDOW *win);
 static void resize_main(WINDOW *win, const struct Conf *config);
+static void resize_perf(WINDOW *win, WINDOW *metadata_win, const struct Conf *config);
+static bool create_window_canvases(struct Canvas *canvas, struct Canvas *shown, WINDOW *win);
 static void parse_options(int argc, char *argv[], struct Conf *config);
 static void convert_options(struct Conf *config);
 static const char *get_timezone(const struct tm *local_time);
-static void render_metadata(WINDOW *win, const struct Conf *config);
+static void render_metadata(WINDOW *win, const struct Conf *config, const struct Planet *planet_table,
+                            const struct Moon *moon_object, double frame_bytes, unsigned long long period);
+static void render_frame_stats(WINDOW *win, const struct FrameStats *stats);
 
-// Track if we need to resize the curses window
-static volatile bool perform_resize = false;
-#ifdef _WIN32
-// Track console size on windows
-static COORD winsize;
-#endif
+// Longest a frame is left on screen with --on-change (s). Stars of culled tiles
+// are not predicted, so this bounds how late they are to rise
+#define MAX_REDRAW_SECONDS 10.0
+
+// Weight of the newest frame in the bytes per frame shown in the metadata
+#define OUTPUT_SMOOTHING 0.1
 
 // Track current simulation time (UTC)
 // Default to current time in dt_string_utc is NULL
 static double julian_date = 0.0;
 static double julian_date_start = 0.0; // Note of when we started
+static double julian_date_end = 0.0;   // End of an exported or listed range
 
 int main(int argc, char *argv[])
 {
@@ -54,14 +69,34 @@ int main(int argc, char *argv[])
         .threshold = 5.0f,
         .label_thresh = 0.25f,
         .fps = 24,
+        .threads = 1,
+        .catalog_path = NULL,
+        .minor_bodies_path = NULL,
+        .frames = 1,
+        .width = 80,
+        .height = 40,
+        .output_path = NULL,
         .speed = 1.0f,
         .aspect_ratio = 0.0,
+        .bandwidth = 0.0,
+        .until_string_utc = NULL,
+        .step = 60.0,
+        .export_format = EXPORT_NONE,
         .quit_on_any = false,
         .unicode = false,
         .color = false,
         .grid = false,
         .constell = false,
         .metadata = false,
+        .headless = false,
+        .perf = false,
+        .on_change = false,
+        .events = false,
+        .observers_path = NULL,
+        .objects = NULL,
+        .min_altitude = -90.0,
+        .record_path = NULL,
+        .replay_path = NULL,
     };
 
     // Parse command line args and convert to internal representations
@@ -71,32 +106,99 @@ int main(int argc, char *argv[])
     // Time for each frame in microseconds
     unsigned long dt = (unsigned long)(1.0 / config.fps * 1.0E6);
 
+    // Recordings are played back without computing any position
+    if (config.replay_path != NULL)
+    {
+        exit(replay_recording(&config) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    // Headless frames are always rendered
+    bool on_change = config.on_change && !config.headless;
+
     // Initialize data structs
-    unsigned int num_stars, num_const;
+    unsigned int num_stars, num_segments = 0;
 
-    struct Entry *BSC5_entries = NULL;
-    struct StarName *name_table = NULL;
-    struct Constell *constell_table = NULL;
+    struct ConstellTable constell_table = {0};
     struct Star *star_table = NULL;
     struct Planet *planet_table = NULL;
     struct Moon moon_object;
-    int *num_by_mag = NULL;
+    struct Ephemeris ephemeris;
+    struct StarBuffer star_buffer;
+    struct MinorBodies minor_bodies = {0};
+    struct Pool pool;
+    const int *num_by_mag = NULL;
+    struct StarCell *star_cells = NULL;
+    struct Catalog catalog = {0};
+    struct Arena arena = {0};
 
     // Track success of functions
     bool s = true;
 
-    // Generated BSC5 data during build in bsc5_xxx.h:
+    // Generated BSC5 tables during build in bsc5_tables.h:
+    //
+    // struct Star bsc5_stars[BSC5_NUM_STARS];
+    // int bsc5_num_by_mag[BSC5_NUM_STARS];
+    // unsigned int bsc5_constell_offsets[BSC5_NUM_CONSTELLS + 1];
+    // int bsc5_constell_ends[2 * BSC5_NUM_CONSTELL_SEGMENTS];
     //
-    // uint8_t bsc5_xxx[];
-    // size_t bsc5_xxx_len;
-
-    s = s && parse_entries(bsc5, bsc5_len, &BSC5_entries, &num_stars);
-    s = s && generate_name_table(bsc5_names, bsc5_names_len, &name_table, num_stars);
-    s = s && generate_constell_table(bsc5_constellations, bsc5_constellations_len, &constell_table, &num_const);
-    s = s && generate_star_table(&star_table, BSC5_entries, name_table, num_stars);
-    s = s && generate_planet_table(&planet_table, planet_elements, planet_rates, planet_extras);
+    // Only the positions of stars change, so only the star table is copied
+
+    if (config.catalog_path == NULL)
+    {
+        num_stars = BSC5_NUM_STARS;
+        num_segments = config.constell ? BSC5_NUM_CONSTELL_SEGMENTS : 0;
+        num_by_mag = bsc5_num_by_mag;
+    }
+    else
+    {
+        // Names and constellations refer to BSC5 catalog numbers. Only stars
+        // that can be drawn are kept, so memory use follows the threshold
+        // rather than the size of the catalog
+        config.constell = false;
+        s = s && map_catalog(&catalog, config.catalog_path);
+        num_stars = s ? count_catalog_stars(&catalog, config.threshold) : 0;
+    }
+
+    // Every table built at startup is carved from one arena, sized now that
+    // the number of stars is known, and freed with it
+    size_t arena_size = star_tables_arena_size(num_stars) + star_buffer_arena_size((int)num_stars, num_segments) +
+                        ARENA_SIZE(num_stars * sizeof(struct StarCell)) + ARENA_SIZE(BSC5_NUM_CONSTELLS * sizeof(bool));
+    if (config.catalog_path != NULL)
+    {
+        arena_size += star_sort_arena_size(num_stars);
+    }
+    s = s && arena_create(&arena, arena_size);
+
+    if (config.catalog_path == NULL)
+    {
+        s = s && copy_star_table(&arena, &star_table, bsc5_stars, num_stars);
+        s = s && init_constell_table(&arena, &constell_table, BSC5_NUM_CONSTELLS, bsc5_constell_offsets,
+                                     bsc5_constell_ends);
+    }
+    else
+    {
+        int *sorted_by_mag = NULL; // Only external catalogs are sorted at startup
+        s = s && generate_star_table(&arena, &star_table, num_stars, &catalog, NULL, config.threshold);
+        s = s && star_numbers_by_magnitude(&arena, &sorted_by_mag, star_table, num_stars);
+        num_by_mag = sorted_by_mag;
+
+        // The catalog is no longer needed
+        close_catalog(&catalog);
+    }
+    s = s && generate_planet_table(&arena, &planet_table, planet_elements, planet_rates, planet_extras);
     s = s && generate_moon_object(&moon_object, &moon_elements, &moon_rates);
-    s = s && star_numbers_by_magnitude(&num_by_mag, star_table, num_stars);
+    init_ephemeris(&ephemeris);
+    s = s && generate_star_buffer(&arena, &star_buffer, star_table, num_by_mag, num_stars);
+    s = s && create_star_cells(&arena, &star_cells, num_stars);
+    s = s && pool_create(&pool, config.threads);
+    if (config.minor_bodies_path != NULL)
+    {
+        s = s && load_minor_bodies(&minor_bodies, config.minor_bodies_path);
+    }
+    if (config.constell)
+    {
+        s = s && pin_constellation_stars(&arena, &star_buffer, &constell_table);
+    }
 
     if (!s)
     {
@@ -104,42 +206,135 @@ int main(int argc, char *argv[])
         exit(EXIT_FAILURE);
     }
 
-    // This memory is no longer needed
-    free(BSC5_entries);
+    // Only stars within the threshold are updated and drawn. They are the tail
+    // of num_by_mag, which the star buffer follows. Figures are drawn if all
+    // of their stars are
+    int first_visible = set_star_buffer_threshold(&star_buffer, config.threshold);
+    set_constell_threshold(&constell_table, star_table, num_stars, config.threshold);
+    set_minor_body_threshold(&minor_bodies, config.threshold);
+
+    // Exports, event listings and tables for observers never touch the
+    // terminal
+    if (config.export_format != EXPORT_NONE)
+    {
+        s = export_to_output(&config, &pool, star_table, num_by_mag + first_visible, num_stars - first_visible,
+                             planet_table, &moon_object, julian_date_start, julian_date_end);
+        pool_destroy(&pool);
+        exit(s ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    if (config.events)
+    {
+        s = list_events_to_output(&config, &pool, star_table, num_by_mag + first_visible, num_stars - first_visible,
+                                  planet_table, &moon_object, julian_date_start, julian_date_end);
+        pool_destroy(&pool);
+        exit(s ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    if (config.observers_path != NULL)
+    {
+        s = observe_to_output(&config, star_table, num_stars, planet_table, &moon_object, julian_date_start);
+        pool_destroy(&pool);
+        exit(s ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
 
     // Terminal/System settings
     setlocale(LC_ALL, ""); // Required for unicode rendering
-#ifndef _WIN32
-    signal(SIGWINCH, catch_winch); // Capture window resizes
-#endif
-    tzset(); // Initialize timezone information
+    tzset();               // Initialize timezone information
+
+    // Projection canvas. Frames are always drawn in memory. Headless mode never
+    // touches the terminal, otherwise only the cells that differ from what the
+    // window shows are drawn to it
+    struct Canvas canvas;
+    struct Canvas shown;
+    WINDOW *main_win = NULL;
+    WINDOW *metadata_win = NULL;
+    WINDOW *perf_win = NULL;
+
+    if (config.headless)
+    {
+        if (!create_cell_canvas(&canvas, config.height, config.width) ||
+            !create_cell_canvas(&shown, config.height, config.width))
+        {
+            exit(EXIT_FAILURE);
+        }
+    }
+    else
+    {
+        catch_term_resizes();
 
-    // Ncurses initialization
-    ncurses_init(config.color);
+        // Ncurses initialization
+        ncurses_init(config.color);
 
-    // Main (projection) window
-    WINDOW *main_win = newwin(0, 0, 0, 0);
-    resize_main(main_win, &config);
+        // Main (projection) window
+        main_win = newwin(0, 0, 0, 0);
+        resize_main(main_win, &config);
+        if (!create_window_canvases(&canvas, &shown, main_win))
+        {
+            ncurses_kill();
+            exit(EXIT_FAILURE);
+        }
 
-    // Metadata window
-    WINDOW *metadata_win = newwin(0, 0, 0, 0); // Position at top left
-    if (config.metadata)
+        // Metadata window
+        metadata_win = newwin(0, 0, 0, 0); // Position at top left
+        if (config.metadata)
+        {
+            resize_meta(metadata_win);
+        }
+
+        // Frame timing overlay
+        perf_win = newwin(0, 0, 0, 0);
+        if (config.perf)
+        {
+            resize_perf(perf_win, metadata_win, &config);
+        }
+    }
+
+    // Frames are recorded at the size of the canvas they start with
+    struct Recorder recorder;
+    bool record = config.record_path != NULL;
+    bool recorded = true;
+    if (record)
     {
-        resize_meta(metadata_win);
+        int height, width;
+        canvas_size(&canvas, &height, &width);
+        if (!recorder_open(&recorder, config.record_path, height, width))
+        {
+            if (!config.headless)
+            {
+                ncurses_kill();
+            }
+            exit(EXIT_FAILURE);
+        }
     }
 
+    // Time since the first frame (µs), as frames are timed in recordings
+    unsigned long long session_time = 0;
+
+    // Time spent in each phase of the frame. The summary is printed on exit if
+    // the overlay was ever shown
+    static struct FrameStats stats;
+    bool print_stats = config.perf;
+
+    // Output written to the terminal by each frame, where the system counts it
+    unsigned long long output_bytes, output_writes;
+    bool count_output = !config.headless && output_counters(&output_bytes, &output_writes);
+
+    // Bytes per frame over recent frames, negative until a frame is measured
+    double frame_bytes = -1.0;
+
+    // Time between frames, lengthened to keep output within the bandwidth
+    unsigned long long period = dt;
+
     // Render loop
-    while (true)
+    for (int frame = 0; !config.headless || frame < config.frames; ++frame)
     {
-        struct SwTimestamp frame_begin;
+        struct SwTimestamp frame_begin, lap;
         sw_gettime(&frame_begin);
 
-#ifdef _WIN32
-        // Use this function to catch console resizes on Windows
-        perform_resize = check_console_window_resize_event(&winsize);
-#endif
-
-        if (perform_resize)
+        if (config.headless)
+        {
+            canvas_erase(&canvas);
+        }
+        else if (term_resized())
         {
             resize_ncurses();
             resize_main(main_win, &config);
@@ -147,66 +342,169 @@ int main(int argc, char *argv[])
             {
                 resize_meta(metadata_win);
             }
+            if (config.perf)
+            {
+                resize_perf(perf_win, metadata_win, &config);
+            }
             doupdate();
 
-            perform_resize = false;
+            free_canvas(&canvas);
+            free_canvas(&shown);
+            s = create_window_canvases(&canvas, &shown, main_win);
+            if (!s)
+            {
+                break;
+            }
         }
         else
         {
+            werase(perf_win);
             werase(metadata_win);
-            werase(main_win);
+            canvas_erase(&canvas);
         }
 
+        sw_gettime(&lap);
+
         // Update object positions
-        update_star_positions(star_table, num_stars, julian_date, config.latitude, config.longitude);
-        update_planet_positions(planet_table, julian_date, config.latitude, config.longitude);
-        update_moon_position(&moon_object, julian_date, config.latitude, config.longitude);
+        if (config.threads > 1)
+        {
+            update_stars_parallel(&pool, &star_buffer, star_table, julian_date, config.latitude, config.longitude);
+        }
+        else
+        {
+            update_star_buffer(&star_buffer, julian_date, config.latitude, config.longitude);
+            star_buffer_to_table(&star_buffer, star_table);
+        }
+        update_planet_positions_cached(&ephemeris, planet_table, julian_date, config.latitude, config.longitude);
+        update_moon_position_cached(&ephemeris, &moon_object, julian_date, config.latitude, config.longitude);
         update_moon_phase(&moon_object, julian_date, config.latitude);
+        if (config.minor_bodies_path != NULL)
+        {
+            update_minor_bodies(&minor_bodies, planet_table, julian_date, config.latitude, config.longitude);
+        }
+        frame_stats_lap(&stats, PHASE_UPDATE, &lap);
 
-        // Render objects
-        render_stars_stereo(main_win, &config, star_table, num_stars, num_by_mag);
+        // Render objects. Constellations reuse the cells stars were drawn in
+        render_stars_stereo(&canvas, &config, star_table, num_stars - first_visible, num_by_mag + first_visible,
+                            star_cells);
         if (config.constell)
         {
-            render_constells(main_win, &config, &constell_table, num_const, star_table);
+            render_constells(&canvas, &config, &constell_table, star_table, star_cells);
         }
-        render_planets_stereo(main_win, &config, planet_table);
-        render_moon_stereo(main_win, &config, moon_object);
+        render_minor_bodies_stereo(&canvas, &config, &minor_bodies);
+        render_planets_stereo(&canvas, &config, planet_table);
+        render_moon_stereo(&canvas, &config, moon_object);
         if (config.grid)
         {
-            render_azimuthal_grid(main_win, &config);
+            render_azimuthal_grid(&canvas, &config);
         }
         else
         {
-            render_cardinal_directions(main_win, &config);
+            render_cardinal_directions(&canvas, &config);
         }
 
-        // Render metadata
-        if (config.metadata)
+        // Draw only the cells that changed since the last frame
+        histogram_add(&stats.cells, present_canvas(&canvas, &shown, main_win));
+        if (record && !record_frame(&recorder, &canvas, session_time))
         {
-            render_metadata(metadata_win, &config);
+            recorded = false;
+            break;
         }
 
-        // Exit if ESC or q is pressed
-        int ch = getch();
-        if (ch != ERR && (ch == 27 || ch == 'q' || config.quit_on_any))
+        if (config.headless)
         {
-            break;
-        }
+            frame_stats_lap(&stats, PHASE_RENDER, &lap);
 
-        // Use double buffering to avoid flickering while updating
-        wnoutrefresh(main_win);
-        if (config.metadata)
+            s = write_canvas_frame(&canvas, config.output_path, config.color, frame);
+            if (!s)
+            {
+                break;
+            }
+            frame_stats_lap(&stats, PHASE_OUTPUT, &lap);
+        }
+        else
         {
-            wnoutrefresh(metadata_win);
+            // Render metadata
+            if (config.metadata)
+            {
+                render_metadata(metadata_win, &config, planet_table, &moon_object, frame_bytes,
+                                paced_frame_usec(dt, frame_bytes, config.bandwidth));
+            }
+            if (config.perf)
+            {
+                render_frame_stats(perf_win, &stats);
+            }
+            frame_stats_lap(&stats, PHASE_RENDER, &lap);
+
+            // Exit if ESC or q is pressed, toggle the timing overlay with p
+            int ch = getch();
+            if (ch != ERR && (ch == 27 || ch == 'q' || config.quit_on_any))
+            {
+                break;
+            }
+            bool perf_was_shown = config.perf;
+            if (ch == 'p')
+            {
+                config.perf = !config.perf;
+                print_stats = print_stats || config.perf;
+                if (config.perf)
+                {
+                    resize_perf(perf_win, metadata_win, &config);
+                    render_frame_stats(perf_win, &stats);
+                }
+            }
+            frame_stats_lap(&stats, PHASE_INPUT, &lap);
+
+            // Use double buffering to avoid flickering while updating. A
+            // hidden overlay is refreshed once more to clear it from the
+            // screen, and the projection beneath it is restored
+            if (perf_was_shown && !config.perf)
+            {
+                wnoutrefresh(perf_win);
+                touchwin(main_win);
+            }
+            wnoutrefresh(main_win);
+            if (config.metadata)
+            {
+                wnoutrefresh(metadata_win);
+            }
+            if (config.perf)
+            {
+                wnoutrefresh(perf_win);
+            }
+
+            // The counts cover every write of the process, e.g. to a
+            // recording, so only those made by doupdate are the frame's
+            unsigned long long bytes, writes;
+            bool counted = count_output && output_counters(&output_bytes, &output_writes);
+            doupdate();
+            counted = counted && output_counters(&bytes, &writes);
+            frame_stats_lap(&stats, PHASE_OUTPUT, &lap);
+
+            if (counted)
+            {
+                unsigned long long sent = bytes - output_bytes;
+                histogram_add(&stats.bytes, sent);
+                histogram_add(&stats.writes, writes - output_writes);
+
+                // A frame that sends more than the bandwidth allows is left on
+                // screen until it has been paid for
+                period = paced_frame_usec(dt, sent, config.bandwidth);
+                frame_bytes = frame_bytes < 0.0 ? sent : frame_bytes + OUTPUT_SMOOTHING * (sent - frame_bytes);
+            }
         }
-        doupdate();
 
         // TODO: this timing scheme *should* minimize any drift or divergence
         // between simulation time and realtime. Check this to make sure.
 
-        // Increment "simulation" time
+        // Increment "simulation" time. Frames drawn on change are instead
+        // timed by how long they are shown
         const double microsec_per_day = 24.0 * 60.0 * 60.0 * 1.0E6;
-        julian_date += (double)dt / microsec_per_day * config.speed;
+        if (!on_change)
+        {
+            julian_date += (double)period / microsec_per_day * config.speed;
+            session_time += period;
+        }
 
         // Determine time it took to update positions and render to screen
         struct SwTimestamp frame_end;
@@ -215,25 +513,92 @@ int main(int argc, char *argv[])
         unsigned long long frame_time;
         sw_timediff_usec(frame_end, frame_begin, &frame_time);
 
-        // If updating the frame took less time than the time between frames,
-        // wait the rest of the time
-        if (frame_time < dt)
+        if (on_change)
+        {
+            // Leave the frame on screen until an object moves to another cell,
+            // a key is pressed or the terminal is resized, but never redraw
+            // faster than the frame rate
+            int height, width;
+            canvas_size(&canvas, &height, &width);
+
+            struct RedrawPrediction prediction;
+            begin_redraw_prediction(&prediction, height, width, config.latitude, config.speed, MAX_REDRAW_SECONDS);
+            predict_stars_change(&prediction, star_table, num_stars - first_visible, num_by_mag + first_visible);
+            if (config.constell)
+            {
+                predict_constells_change(&prediction, &constell_table, star_table);
+            }
+            predict_minor_bodies_change(&prediction, &minor_bodies);
+            predict_planets_change(&prediction, planet_table);
+            predict_object_change(&prediction, moon_object.base.azimuth, moon_object.base.altitude);
+            double seconds = prediction.seconds;
+
+            // The elapsed time in the metadata counts simulated seconds
+            if (config.metadata && config.speed != 0.0f)
+            {
+                double elapsed = (julian_date - julian_date_start) * 86400.0;
+                double to_second = config.speed > 0.0f ? floor(elapsed) + 1.0 - elapsed : elapsed - ceil(elapsed) + 1.0;
+                seconds = MIN(seconds, to_second / fabs(config.speed));
+            }
+
+            unsigned long long wait = MAX((unsigned long long)(seconds * 1.0E6), period);
+            if (frame_time < wait)
+            {
+                wait_for_input(wait - frame_time);
+            }
+        }
+        else if (!config.headless && frame_time < period)
+        {
+            // If updating the frame took less time than the time between
+            // frames, wait the rest of the time. Headless frames are written
+            // back to back
+            sw_sleep(period - frame_time);
+        }
+        frame_stats_lap(&stats, PHASE_SLEEP, &lap);
+
+        if (on_change)
         {
-            sw_sleep(dt - frame_time);
+            struct SwTimestamp shown_at;
+            sw_gettime(&shown_at);
+
+            unsigned long long shown_time;
+            sw_timediff_usec(shown_at, frame_begin, &shown_time);
+            julian_date += (double)shown_time / microsec_per_day * config.speed;
+            session_time += shown_time;
         }
+        frame_stats_lap(&stats, PHASE_FRAME, &frame_begin);
     }
 
     // Clean up
 
-    ncurses_kill();
+    if (!config.headless)
+    {
+        ncurses_kill();
+    }
+    free_canvas(&canvas);
+    free_canvas(&shown);
+
+    if (record)
+    {
+        recorded = recorder_close(&recorder, session_time) && recorded;
+        if (!recorded)
+        {
+            printf("ERROR: Unable to write recording to '%s'\n", config.record_path);
+            s = false;
+        }
+    }
+
+    if (print_stats)
+    {
+        print_frame_stats(&stats, stderr);
+    }
 
-    free_constells(constell_table, num_const);
-    free_stars(star_table, num_stars);
-    free_planets(planet_table, NUM_PLANETS);
+    pool_destroy(&pool);
+    free_minor_bodies(&minor_bodies);
     free_moon_object(moon_object);
-    free_star_names(name_table, num_stars);
+    arena_destroy(&arena);
 
-    return EXIT_SUCCESS;
+    return s ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
 static void usage(void)
@@ -251,6 +616,42 @@ static void usage(void)
 "  -l, --label-thresh FLOAT\n"
 "                            Minimum magnitude to label a star (0.25)\n"
 "  -f, --fps N               Frames per second (24)\n"
+"      --threads N           Update star positions across N threads (1)\n"
+"      --catalog PATH        Load stars from a catalog file in BSC5 format\n"
+"      --minor-bodies PATH   Load asteroids and comets from a file in the\n"
+"                            MPC's MPCORB.DAT or CometEls.txt format\n"
+"      --headless            Render frames to text without a terminal\n"
+"      --frames N            Number of frames to render when headless (1)\n"
+"      --size WxH            Size of frames when headless (80x40)\n"
+"      --on-change           Redraw only when an object moves to another cell,\n"
+"                            a key is pressed or the window is resized\n"
+"      --bandwidth BYTES     Lower the frame rate to keep terminal output under\n"
+"                            BYTES per second, e.g. over a slow SSH link\n"
+"      --perf                Show frame timing (toggle with p) and print a\n"
+"                            summary on exit\n"
+"      --record PATH         Record the frames drawn to PATH\n"
+"      --replay PATH         Play back a recording instead of rendering, at\n"
+"                            its recorded speed whatever the --fps\n"
+"      --export FORMAT       Write the positions of the Sun, planets, Moon and\n"
+"                            stars from the datetime until --until, every\n"
+"                            --step seconds, as csv or binary\n"
+"      --until yyyy-mm-ddThh:mm:ss\n"
+"                            End of the exported or listed range (a day after\n"
+"                            the start)\n"
+"      --step SECONDS        Time between exported positions (60)\n"
+"      --events              List when the Sun, planets, Moon and stars rise,\n"
+"                            transit and set from the datetime until --until,\n"
+"                            as csv\n"
+"      --observers SOURCE    Write the positions of --objects at the datetime\n"
+"                            for each observer, as csv. SOURCE is 'cities' for\n"
+"                            the city database or a csv file of observers\n"
+"      --objects LIST        Comma separated names of the Sun, planets, Moon or\n"
+"                            stars, or star numbers (the Sun, planets and Moon)\n"
+"      --above DEGREES       Leave out positions for observers below DEGREES\n"
+"      --output PATH         Write headless frames, exports, events or positions\n"
+"                            for observers to PATH instead of stdout. For\n"
+"                            headless frames, a %d in PATH is replaced by the\n"
+"                            frame number\n"
 "  -s, --speed FLOAT         Animation speed multiplier (1.0)\n"
 "  -c, --color               Enable terminal colors\n"
 "  -C, --constellations      Draw constellation stick figures\n"
@@ -265,6 +666,30 @@ static void usage(void)
     fwrite(usage, sizeof(usage)-1, 1, stdout);
 }
 
+// Long options without a short equivalent
+enum
+{
+    OPT_THREADS = 256,
+    OPT_CATALOG,
+    OPT_HEADLESS,
+    OPT_FRAMES,
+    OPT_SIZE,
+    OPT_OUTPUT,
+    OPT_PERF,
+    OPT_MINOR_BODIES,
+    OPT_ON_CHANGE,
+    OPT_BANDWIDTH,
+    OPT_EXPORT,
+    OPT_UNTIL,
+    OPT_STEP,
+    OPT_EVENTS,
+    OPT_OBSERVERS,
+    OPT_OBJECTS,
+    OPT_ABOVE,
+    OPT_RECORD,
+    OPT_REPLAY,
+};
+
 void parse_options(int argc, char *argv[], struct Conf *config)
 {
     struct optparse_long longopts[] = {
@@ -274,6 +699,25 @@ void parse_options(int argc, char *argv[], struct Conf *config)
         {"threshold",      't', OPTPARSE_REQUIRED},
         {"label-thresh",   'l', OPTPARSE_REQUIRED},
         {"fps",            'f', OPTPARSE_REQUIRED},
+        {"threads",        OPT_THREADS, OPTPARSE_REQUIRED},
+        {"catalog",        OPT_CATALOG, OPTPARSE_REQUIRED},
+        {"minor-bodies",   OPT_MINOR_BODIES, OPTPARSE_REQUIRED},
+        {"headless",       OPT_HEADLESS, OPTPARSE_NONE},
+        {"frames",         OPT_FRAMES, OPTPARSE_REQUIRED},
+        {"size",           OPT_SIZE, OPTPARSE_REQUIRED},
+        {"output",         OPT_OUTPUT, OPTPARSE_REQUIRED},
+        {"perf",           OPT_PERF, OPTPARSE_NONE},
+        {"on-change",      OPT_ON_CHANGE, OPTPARSE_NONE},
+        {"bandwidth",      OPT_BANDWIDTH, OPTPARSE_REQUIRED},
+        {"export",         OPT_EXPORT, OPTPARSE_REQUIRED},
+        {"until",          OPT_UNTIL, OPTPARSE_REQUIRED},
+        {"step",           OPT_STEP, OPTPARSE_REQUIRED},
+        {"events",         OPT_EVENTS, OPTPARSE_NONE},
+        {"observers",      OPT_OBSERVERS, OPTPARSE_REQUIRED},
+        {"objects",        OPT_OBJECTS, OPTPARSE_REQUIRED},
+        {"above",          OPT_ABOVE, OPTPARSE_REQUIRED},
+        {"record",         OPT_RECORD, OPTPARSE_REQUIRED},
+        {"replay",         OPT_REPLAY, OPTPARSE_REQUIRED},
         {"speed",          's', OPTPARSE_REQUIRED},
         {"color",          'c', OPTPARSE_NONE},
         {"constellations", 'C', OPTPARSE_NONE},
@@ -328,6 +772,112 @@ void parse_options(int argc, char *argv[], struct Conf *config)
                 exit(EXIT_FAILURE);
             }
             break;
+        case OPT_THREADS:
+            config->threads = atoi(options.optarg);
+            if (config->threads < 1)
+            {
+                fputs("ERROR: Threads must be greater than or equal to 1\n",
+                      stderr);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case OPT_CATALOG:
+            config->catalog_path = options.optarg;
+            break;
+        case OPT_MINOR_BODIES:
+            config->minor_bodies_path = options.optarg;
+            break;
+        case OPT_HEADLESS:
+            config->headless = true;
+            break;
+        case OPT_FRAMES:
+            config->frames = atoi(options.optarg);
+            if (config->frames < 1)
+            {
+                fputs("ERROR: Frames must be greater than or equal to 1\n",
+                      stderr);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case OPT_SIZE:
+            if (sscanf(options.optarg, "%dx%d", &config->width, &config->height) != 2 ||
+                config->width < 1 || config->height < 1)
+            {
+                fputs("ERROR: Size must be in form <width>x<height>\n",
+                      stderr);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case OPT_OUTPUT:
+            config->output_path = options.optarg;
+            break;
+        case OPT_PERF:
+            config->perf = true;
+            break;
+        case OPT_ON_CHANGE:
+            config->on_change = true;
+            break;
+        case OPT_BANDWIDTH:
+            config->bandwidth = strtod(options.optarg, NULL);
+            if (config->bandwidth <= 0.0)
+            {
+                fputs("ERROR: Bandwidth must be greater than 0 bytes per second\n",
+                      stderr);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case OPT_EXPORT:
+            if (strcmp(options.optarg, "csv") == 0)
+            {
+                config->export_format = EXPORT_CSV;
+            }
+            else if (strcmp(options.optarg, "binary") == 0)
+            {
+                config->export_format = EXPORT_BINARY;
+            }
+            else
+            {
+                fputs("ERROR: Export format must be csv or binary\n",
+                      stderr);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case OPT_UNTIL:
+            config->until_string_utc = options.optarg;
+            break;
+        case OPT_STEP:
+            config->step = strtod(options.optarg, NULL);
+            if (config->step <= 0.0)
+            {
+                fputs("ERROR: Step must be greater than 0 seconds\n",
+                      stderr);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case OPT_EVENTS:
+            config->events = true;
+            break;
+        case OPT_OBSERVERS:
+            config->observers_path = options.optarg;
+            break;
+        case OPT_OBJECTS:
+            config->objects = options.optarg;
+            break;
+        case OPT_ABOVE:
+            config->min_altitude = strtod(options.optarg, NULL);
+            if (config->min_altitude < -90.0 || config->min_altitude > 90.0)
+            {
+                fputs("ERROR: Altitude must be within [-90°, 90°]\n",
+                      stderr);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case OPT_RECORD:
+            config->record_path = options.optarg;
+            break;
+        case OPT_REPLAY:
+            config->replay_path = options.optarg;
+            break;
         case 's':
             config->speed = strtod(options.optarg, NULL);
             break;
@@ -353,7 +903,7 @@ void parse_options(int argc, char *argv[], struct Conf *config)
             config->aspect_ratio = strtod(options.optarg, NULL);
             break;
         case 'i':
-            CityData *city = get_city(options.optarg);
+            const CityData *city = get_city(options.optarg);
             if (!city)
             {
                 fprintf(stderr, "ERROR: Could not find city \"%s\"\n",
@@ -362,7 +912,6 @@ void parse_options(int argc, char *argv[], struct Conf *config)
             }
             config->latitude = city->latitude;
             config->longitude = city->longitude;
-            free_city(city);
             break;
         case 'h':
             usage();
@@ -378,11 +927,29 @@ void parse_options(int argc, char *argv[], struct Conf *config)
     }
 }
 
+// Parse a datetime string to a Julian date, exiting upon error
+static double parse_julian_date(const char *dt_string_utc)
+{
+    // string_to_time normalizes with mktime, which reads tm_isdst. Left to
+    // mktime, the parsed fields are kept as they are
+    struct tm datetime = {.tm_isdst = -1};
+    bool parse_success = string_to_time(dt_string_utc, &datetime);
+    if (!parse_success)
+    {
+        printf("ERROR: Unable to parse datetime string '%s'\nDatetimes "
+               "must be in form <yyyy-mm-ddThh:mm:ss>\n",
+               dt_string_utc);
+        exit(EXIT_FAILURE);
+    }
+    return datetime_to_julian_date(&datetime);
+}
+
 void convert_options(struct Conf *config)
 {
     // Convert longitude and latitude to radians
     config->longitude *= M_PI / 180.0;
     config->latitude *= M_PI / 180.0;
+    config->min_altitude *= M_PI / 180.0;
 
     // Convert Gregorian calendar date to Julian date
     if (config->dt_string_utc == NULL)
@@ -393,42 +960,28 @@ void convert_options(struct Conf *config)
     }
     else
     {
-        struct tm datetime;
-        bool parse_success = string_to_time(config->dt_string_utc, &datetime);
-        if (!parse_success)
+        julian_date_start = parse_julian_date(config->dt_string_utc);
+        julian_date = julian_date_start;
+    }
+
+    // Exports and event listings cover a day unless told otherwise
+    if (config->until_string_utc == NULL)
+    {
+        julian_date_end = julian_date_start + 1.0;
+    }
+    else
+    {
+        julian_date_end = parse_julian_date(config->until_string_utc);
+        if (julian_date_end < julian_date_start)
         {
-            printf("ERROR: Unable to parse datetime string '%s'\nDatetimes "
-                   "must be in form <yyyy-mm-ddThh:mm:ss>\n",
-                   config->dt_string_utc);
+            fputs("ERROR: End of the range is before its start\n", stderr);
             exit(EXIT_FAILURE);
         }
-        julian_date_start = datetime_to_julian_date(&datetime);
-        julian_date = julian_date_start;
     }
 
     return;
 }
 
-void catch_winch(int sig)
-{
-    (void)sig;
-    perform_resize = true;
-}
-
-void resize_ncurses(void)
-{
-    // Resize ncurses internal terminal
-    int y;
-    int x;
-    term_size(&y, &x);
-
-#ifdef _WIN32
-    resize_term(winsize.Y, winsize.X);
-#else
-    resize_term(y, x);
-#endif
-}
-
 void resize_main(WINDOW *win, const struct Conf *config)
 {
     // Clear the window before resizing
@@ -456,6 +1009,23 @@ void resize_main(WINDOW *win, const struct Conf *config)
 #endif
 }
 
+static bool create_window_canvases(struct Canvas *canvas, struct Canvas *shown, WINDOW *win)
+{
+    // The window has just been erased, as `shown` starts
+    int height, width;
+    getmaxyx(win, height, width);
+    if (!create_cell_canvas(canvas, height, width))
+    {
+        return false;
+    }
+    if (!create_cell_canvas(shown, height, width))
+    {
+        free_canvas(canvas);
+        return false;
+    }
+    return true;
+}
+
 void resize_meta(WINDOW *win)
 {
     // Clear the window before resizing
@@ -464,7 +1034,7 @@ void resize_meta(WINDOW *win)
     wnoutrefresh(win);
 #endif
 
-    const int meta_lines = 6; // Allows for 6 rows
+    const int meta_lines = 9; // Allows for 9 rows
     const int meta_cols = 45; // Set to allow enough room for longest line (elapsed time)
 
     wresize(win, MIN(LINES, meta_lines), MIN(COLS, meta_cols));
@@ -473,6 +1043,28 @@ void resize_meta(WINDOW *win)
 #endif
 }
 
+static void resize_perf(WINDOW *win, WINDOW *metadata_win, const struct Conf *config)
+{
+    // Clear the window before resizing
+    werase(win);
+#ifndef _WIN32
+    wnoutrefresh(win);
+#endif
+
+    const int perf_lines = NUM_PHASES + 4; // Header, a row per phase, cells, bytes and writes
+    const int perf_cols = 49;
+
+    // Sit to the right of the metadata window
+    int col = config->metadata ? getmaxx(metadata_win) + 1 : 0;
+    col = MAX(0, MIN(col, COLS - perf_cols));
+
+    wresize(win, MIN(LINES, perf_lines), MIN(COLS, perf_cols));
+    mvwin(win, 0, col);
+#ifdef _WIN32
+    wnoutrefresh(win);
+#endif
+}
+
 const char *get_timezone(const struct tm *local_time)
 {
 #ifdef _WIN32
@@ -493,7 +1085,11 @@ const char *get_timezone(const struct tm *local_time)
 #endif
 }
 
-void render_metadata(WINDOW *win, const struct Conf *config)
+// Next rise and set of the Sun and Moon shown in the metadata
+static struct NextEvents next_events;
+
+void render_metadata(WINDOW *win, const struct Conf *config, const struct Planet *planet_table,
+                     const struct Moon *moon_object, double frame_bytes, unsigned long long period)
 {
     // Gregorian Date (local time)
 
@@ -554,5 +1150,41 @@ void render_metadata(WINDOW *win, const struct Conf *config)
     mvwprintw(win, 5, 0, "Elapsed Time: \t%03d %s, %03d %s, %02d:%02d:%02d", eyears, year_label, edays, day_label, ehours,
               emins, esecs);
 
+    // Terminal output, and the frame rate the bandwidth allows
+    if (frame_bytes < 0.0)
+    {
+        mvwprintw(win, 6, 0, "Output: \tunknown");
+    }
+    else
+    {
+        mvwprintw(win, 6, 0, "Output: \t%.0f B/frame, %.1f fps", frame_bytes, 1.0E6 / period);
+    }
+
+    // Next rise and set of the Sun and Moon (local time)
+    char sun[32], moon[32];
+    describe_next_events(&next_events, planet_table, moon_object, julian_date, config->latitude, config->longitude, sun,
+                         moon, sizeof(sun));
+    mvwprintw(win, 7, 0, "Sun: \t\t%s", sun);
+    mvwprintw(win, 8, 0, "Moon: \t\t%s", moon);
+
     return;
 }
+
+void render_frame_stats(WINDOW *win, const struct FrameStats *stats)
+{
+    // Times in microseconds over the most recent frames, and what was drawn
+    mvwprintw(win, 0, 0, "%-8s %9s %9s %9s %9s", "phase", "p50", "p95", "p99", "max");
+    for (int i = 0; i < NUM_PHASES; ++i)
+    {
+        struct Percentiles p = histogram_window_percentiles(&stats->phases[i]);
+        mvwprintw(win, i + 1, 0, "%-8s %9llu %9llu %9llu %9llu", frame_phase_name(i), p.p50, p.p95, p.p99, p.max);
+    }
+
+    // Cells drawn to the projection, and the terminal output they took
+    struct Percentiles p = histogram_window_percentiles(&stats->cells);
+    mvwprintw(win, NUM_PHASES + 1, 0, "%-8s %9llu %9llu %9llu %9llu", "cells", p.p50, p.p95, p.p99, p.max);
+    p = histogram_window_percentiles(&stats->bytes);
+    mvwprintw(win, NUM_PHASES + 2, 0, "%-8s %9llu %9llu %9llu %9llu", "bytes", p.p50, p.p95, p.p99, p.max);
+    p = histogram_window_percentiles(&stats->writes);
+    mvwprintw(win, NUM_PHASES + 3, 0, "%-8s %9llu %9llu %9llu %9llu", "writes", p.p50, p.p95, p.p99, p.max);
+}
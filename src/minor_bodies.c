@@ -0,0 +1,641 @@
+#include "minor_bodies.h"
+
+#include "astro.h"
+#include "coord.h"
+#include "core.h"
+#include "macros.h"
+#include "simd.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define NUM_BODY_DOUBLE_ARRAYS 18
+#define NUM_BODY_FLOAT_ARRAYS 4
+
+#define MAX_LINE_LENGTH 512
+
+// Gaussian gravitational constant (deg/day)
+#define GAUSSIAN_MEAN_MOTION 0.9856076686
+
+// Distance of the Earth from the Sun at aphelion (au)
+#define EARTH_APHELION 1.0167
+
+// Slope parameter of asteroids without one
+#define DEFAULT_SLOPE 0.15
+
+// Parse columns [first, last] of a line as a number. Columns count from 1, as
+// in the MPC's format descriptions. Returns false if the field is blank or not
+// a number
+static bool parse_field(const char *line, size_t length, int first, int last, double *value)
+{
+    if ((size_t)last > length)
+    {
+        return false;
+    }
+
+    char field[32];
+    int width = last - first + 1;
+    memcpy(field, line + first - 1, width);
+    field[width] = '\0';
+
+    char *end;
+    *value = strtod(field, &end);
+    if (end == field)
+    {
+        return false;
+    }
+    while (*end == ' ')
+    {
+        end++;
+    }
+
+    return *end == '\0';
+}
+
+// Copy columns [first, last] of a line without surrounding spaces, truncated
+// to fit a name
+static void copy_name(const char *line, size_t length, int first, int last, char name[MINOR_BODY_NAME])
+{
+    size_t begin = MIN((size_t)first - 1, length);
+    size_t end = MIN((size_t)last, length);
+    while (begin < end && line[begin] == ' ')
+    {
+        begin++;
+    }
+    while (end > begin && line[end - 1] == ' ')
+    {
+        end--;
+    }
+
+    size_t size = MIN(end - begin, MINOR_BODY_NAME - 1);
+    memcpy(name, line + begin, size);
+    name[size] = '\0';
+}
+
+static int unpack_digit(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    if (c >= 'A' && c <= 'Z')
+    {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+// Julian date at 0h of a Gregorian calendar date
+static double date_to_julian_date(int year, int month, int day)
+{
+    struct tm date = {
+        .tm_year = year - 1900,
+        .tm_mon = month - 1,
+        .tm_mday = day,
+    };
+    return datetime_to_julian_date(&date);
+}
+
+// Unpack an epoch such as K239D (2023-09-13)
+static bool unpack_epoch(const char *packed, double *julian_date)
+{
+    int century = unpack_digit(packed[0]);
+    int decade = unpack_digit(packed[1]);
+    int year = unpack_digit(packed[2]);
+    int month = unpack_digit(packed[3]);
+    int day = unpack_digit(packed[4]);
+    if (century < 18 || century > 20 || decade < 0 || decade > 9 || year < 0 || year > 9 || month < 1 || month > 12 ||
+        day < 1 || day > 31)
+    {
+        return false;
+    }
+
+    *julian_date = date_to_julian_date(century * 100 + decade * 10 + year, month, day);
+    return true;
+}
+
+static bool parse_asteroid(const char *line, size_t length, struct MinorBody *body)
+{
+    double abs_magnitude, slope;
+    if (!parse_field(line, length, 9, 13, &abs_magnitude))
+    {
+        return false;
+    }
+    if (!parse_field(line, length, 15, 19, &slope))
+    {
+        slope = DEFAULT_SLOPE;
+    }
+
+    *body = (struct MinorBody){
+        .comet = false,
+        .abs_magnitude = (float)abs_magnitude,
+        .slope = (float)slope,
+    };
+
+    bool s = unpack_epoch(line + 20, &body->epoch);
+    s = s && parse_field(line, length, 27, 35, &body->mean_anomaly);
+    s = s && parse_field(line, length, 38, 46, &body->arg_perihelion);
+    s = s && parse_field(line, length, 49, 57, &body->node);
+    s = s && parse_field(line, length, 60, 68, &body->inclination);
+    s = s && parse_field(line, length, 71, 79, &body->eccentricity);
+    s = s && parse_field(line, length, 81, 91, &body->mean_motion);
+    s = s && parse_field(line, length, 93, 103, &body->semi_major);
+    if (!s)
+    {
+        return false;
+    }
+
+    // Numbered asteroids have a readable designation such as "(1) Ceres"
+    copy_name(line, length, 167, 194, body->name);
+    if (body->name[0] == '\0')
+    {
+        copy_name(line, length, 1, 7, body->name);
+    }
+
+    return body->eccentricity < 1.0 && body->semi_major > 0.0;
+}
+
+static bool parse_comet(const char *line, size_t length, struct MinorBody *body)
+{
+    double year, month, day, perihelion, abs_magnitude, slope;
+    bool s = parse_field(line, length, 15, 18, &year);
+    s = s && parse_field(line, length, 20, 21, &month);
+    s = s && parse_field(line, length, 23, 29, &day);
+    s = s && parse_field(line, length, 31, 39, &perihelion);
+    s = s && parse_field(line, length, 92, 95, &abs_magnitude);
+    s = s && parse_field(line, length, 97, 100, &slope);
+    if (!s)
+    {
+        return false;
+    }
+
+    *body = (struct MinorBody){
+        .comet = true,
+        .abs_magnitude = (float)abs_magnitude,
+        .slope = (float)slope,
+    };
+
+    s = parse_field(line, length, 42, 49, &body->eccentricity);
+    s = s && parse_field(line, length, 52, 59, &body->arg_perihelion);
+    s = s && parse_field(line, length, 62, 69, &body->node);
+    s = s && parse_field(line, length, 72, 79, &body->inclination);
+    if (!s || body->eccentricity >= 1.0 || perihelion <= 0.0)
+    {
+        return false;
+    }
+
+    // Elements are given at perihelion, where the mean anomaly is zero
+    double whole_day = floor(day);
+    body->epoch = date_to_julian_date((int)year, (int)month, (int)whole_day) + (day - whole_day);
+    body->mean_anomaly = 0.0;
+    body->semi_major = perihelion / (1.0 - body->eccentricity);
+    body->mean_motion = GAUSSIAN_MEAN_MOTION / pow(body->semi_major, 1.5);
+
+    copy_name(line, length, 103, 158, body->name);
+
+    return true;
+}
+
+bool parse_minor_body(const char *line, struct MinorBody *body)
+{
+    size_t length = strcspn(line, "\r\n");
+
+    // Asteroid epochs are packed, starting with the century as I, J or K
+    if (length >= 103 && line[20] >= 'I' && line[20] <= 'K')
+    {
+        return parse_asteroid(line, length, body);
+    }
+
+    return parse_comet(line, length, body);
+}
+
+// The product of the distances from the Sun and Earth is smallest with the
+// body at perihelion and the Earth at aphelion between it and the Sun. The
+// phase of an asteroid only dims it
+static float peak_magnitude(const struct MinorBody *body)
+{
+    double perihelion = body->semi_major * (1.0 - body->eccentricity);
+
+    // Orbits that reach inside the Earth's can pass arbitrarily close to it
+    if (perihelion <= EARTH_APHELION || (body->comet && body->slope < 0.0f))
+    {
+        return -INFINITY;
+    }
+
+    double delta = perihelion - EARTH_APHELION;
+    if (body->comet)
+    {
+        return (float)(body->abs_magnitude + 5.0 * log10(delta) + 2.5 * body->slope * log10(perihelion));
+    }
+    return (float)(body->abs_magnitude + 5.0 * log10(perihelion * delta));
+}
+
+struct PeakOrder
+{
+    float magnitude;
+    int index;
+};
+
+static int compare_peaks(const void *a, const void *b)
+{
+    const struct PeakOrder *x = a;
+    const struct PeakOrder *y = b;
+    if (x->magnitude != y->magnitude)
+    {
+        return x->magnitude < y->magnitude ? -1 : 1;
+    }
+    return x->index - y->index;
+}
+
+bool generate_minor_bodies(struct MinorBodies *bodies, const struct MinorBody *elements, int num_bodies)
+{
+    // One allocation holds every array
+    size_t n = MAX((size_t)num_bodies, 1);
+    size_t size = n * (NUM_BODY_DOUBLE_ARRAYS * sizeof(double) + NUM_BODY_FLOAT_ARRAYS * sizeof(float) + sizeof(int) +
+                       MINOR_BODY_NAME + sizeof(bool));
+    double *block = malloc(size);
+    struct PeakOrder *order = malloc(n * sizeof(struct PeakOrder));
+    if (block == NULL || order == NULL)
+    {
+        printf("Allocation of memory for minor bodies failed\n");
+        free(block);
+        free(order);
+        return false;
+    }
+
+    *bodies = (struct MinorBodies){
+        .num_bodies = num_bodies,
+        .epoch = block + 0 * n,
+        .mean_anomaly = block + 1 * n,
+        .mean_motion = block + 2 * n,
+        .semi_major = block + 3 * n,
+        .eccentricity = block + 4 * n,
+        .px = block + 5 * n,
+        .py = block + 6 * n,
+        .pz = block + 7 * n,
+        .qx = block + 8 * n,
+        .qy = block + 9 * n,
+        .qz = block + 10 * n,
+        .xh = block + 11 * n,
+        .yh = block + 12 * n,
+        .zh = block + 13 * n,
+        .r = block + 14 * n,
+        .azimuth = block + 15 * n,
+        .altitude = block + 16 * n,
+        .distance_limit = block + 17 * n,
+        .num_candidates = num_bodies,
+        .threshold = INFINITY,
+    };
+    bodies->abs_magnitude = (float *)(block + NUM_BODY_DOUBLE_ARRAYS * n);
+    bodies->slope = bodies->abs_magnitude + n;
+    bodies->peak_magnitude = bodies->slope + n;
+    bodies->magnitude = bodies->peak_magnitude + n;
+    bodies->visible = (int *)(bodies->magnitude + n);
+    bodies->names = (char(*)[MINOR_BODY_NAME])(bodies->visible + n);
+    bodies->comet = (bool *)(bodies->names + n);
+
+    for (int i = 0; i < num_bodies; ++i)
+    {
+        order[i] = (struct PeakOrder){peak_magnitude(&elements[i]), i};
+    }
+    qsort(order, num_bodies, sizeof(struct PeakOrder), compare_peaks);
+
+    // Obliquity at J2000 in radians
+    const double eps = 84381.448 / (60.0 * 60.0) * TO_RAD;
+
+    for (int i = 0; i < num_bodies; ++i)
+    {
+        const struct MinorBody *body = &elements[order[i].index];
+
+        double w = body->arg_perihelion * TO_RAD;
+        double O = body->node * TO_RAD;
+        double I = body->inclination * TO_RAD;
+
+        // Unit vectors towards perihelion and 90° ahead of it in the orbital
+        // plane, in ecliptic coordinates
+        double p[3] = {cos(w) * cos(O) - sin(w) * sin(O) * cos(I), cos(w) * sin(O) + sin(w) * cos(O) * cos(I),
+                       sin(w) * sin(I)};
+        double q[3] = {-sin(w) * cos(O) - cos(w) * sin(O) * cos(I), -sin(w) * sin(O) + cos(w) * cos(O) * cos(I),
+                       cos(w) * sin(I)};
+
+        double a = body->semi_major;
+        double e = body->eccentricity;
+        double b = a * sqrt(1.0 - e * e);
+
+        bodies->px[i] = a * p[0];
+        bodies->py[i] = a * (cos(eps) * p[1] - sin(eps) * p[2]);
+        bodies->pz[i] = a * (sin(eps) * p[1] + cos(eps) * p[2]);
+        bodies->qx[i] = b * q[0];
+        bodies->qy[i] = b * (cos(eps) * q[1] - sin(eps) * q[2]);
+        bodies->qz[i] = b * (sin(eps) * q[1] + cos(eps) * q[2]);
+
+        bodies->epoch[i] = body->epoch;
+        bodies->mean_anomaly[i] = body->mean_anomaly * TO_RAD;
+        bodies->mean_motion[i] = body->mean_motion * TO_RAD;
+        bodies->semi_major[i] = a;
+        bodies->eccentricity[i] = e;
+        bodies->abs_magnitude[i] = body->abs_magnitude;
+        bodies->slope[i] = body->slope;
+        bodies->peak_magnitude[i] = order[i].magnitude;
+        bodies->distance_limit[i] = INFINITY;
+        bodies->comet[i] = body->comet;
+        memcpy(bodies->names[i], body->name, MINOR_BODY_NAME);
+    }
+
+    free(order);
+
+    return true;
+}
+
+bool load_minor_bodies(struct MinorBodies *bodies, const char *path)
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+    {
+        printf("Could not open minor bodies %s\n", path);
+        return false;
+    }
+
+    struct MinorBody *elements = NULL;
+    int num_bodies = 0;
+    int capacity = 0;
+
+    char line[MAX_LINE_LENGTH];
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        struct MinorBody body;
+        if (!parse_minor_body(line, &body))
+        {
+            continue;
+        }
+
+        if (num_bodies == capacity)
+        {
+            capacity = MAX(2 * capacity, 1024);
+            struct MinorBody *temp = realloc(elements, capacity * sizeof(struct MinorBody));
+            if (temp == NULL)
+            {
+                printf("Allocation of memory for minor bodies failed\n");
+                free(elements);
+                fclose(file);
+                return false;
+            }
+            elements = temp;
+        }
+        elements[num_bodies++] = body;
+    }
+    fclose(file);
+
+    if (num_bodies == 0)
+    {
+        printf("No minor bodies in %s\n", path);
+        free(elements);
+        return false;
+    }
+
+    bool s = generate_minor_bodies(bodies, elements, num_bodies);
+    free(elements);
+
+    return s;
+}
+
+void free_minor_bodies(struct MinorBodies *bodies)
+{
+    free(bodies->epoch);
+    *bodies = (struct MinorBodies){0};
+}
+
+int set_minor_body_threshold(struct MinorBodies *bodies, float threshold)
+{
+    // Binary search for the first body that is always dimmer
+    int low = 0;
+    int high = bodies->num_bodies;
+    while (low < high)
+    {
+        int mid = low + (high - low) / 2;
+        if (bodies->peak_magnitude[mid] <= threshold)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    bodies->num_candidates = low;
+    bodies->threshold = threshold;
+
+    // The magnitude of an asteroid is at least H + 5 log10(r Δ)
+    for (int i = 0; i < low; ++i)
+    {
+        bodies->distance_limit[i] = bodies->comet[i] ? INFINITY : pow(10.0, (threshold - bodies->abs_magnitude[i]) / 5.0);
+    }
+
+    return low;
+}
+
+/* Per-frame state shared by every body
+ */
+struct MinorFrame
+{
+    double julian_date;
+    double xe, ye, ze; // Heliocentric position of the Earth
+    double m[3][3];
+};
+
+// Iterations of Halley's method that solve Kepler's equation to 1E-12 radians
+// from the starting guess used below
+static int kepler_iterations(double eccentricity)
+{
+    static const struct
+    {
+        double eccentricity;
+        int iterations;
+    } bands[] = {{0.1, 2}, {0.8, 3}, {0.95, 4}, {0.99, 5}, {0.999, 7}};
+
+    for (size_t b = 0; b < sizeof(bands) / sizeof(bands[0]); ++b)
+    {
+        if (eccentricity <= bands[b].eccentricity)
+        {
+            return bands[b].iterations;
+        }
+    }
+    return MAX_KEPLER_ITERATIONS;
+}
+
+/* Solve Kepler's equation and update the horizontal coordinates of bodies
+ * [begin, end)
+ */
+static void propagate_bodies(struct MinorBodies *bodies, const struct MinorFrame *frame, int begin, int end)
+{
+    const double(*m)[3] = frame->m;
+
+    int i = begin;
+
+#if SIMD_LANES > 1
+    const vf64 julian_date = v_set1(frame->julian_date);
+    const vf64 zero = v_set1(0.0), half = v_set1(0.5), one = v_set1(1.0);
+    const vf64 pi = v_set1(M_PI), minus_pi = v_set1(-M_PI);
+    const vf64 two_pi = v_set1(2.0 * M_PI), inv_two_pi = v_set1(1.0 / (2.0 * M_PI));
+    const vf64 xe = v_set1(frame->xe), ye = v_set1(frame->ye), ze = v_set1(frame->ze);
+    const vf64 m00 = v_set1(m[0][0]), m01 = v_set1(m[0][1]), m02 = v_set1(m[0][2]);
+    const vf64 m10 = v_set1(m[1][0]), m11 = v_set1(m[1][1]), m12 = v_set1(m[1][2]);
+    const vf64 m20 = v_set1(m[2][0]), m21 = v_set1(m[2][1]), m22 = v_set1(m[2][2]);
+
+    for (; i + SIMD_LANES <= end; i += SIMD_LANES)
+    {
+        vf64 e = v_load(&bodies->eccentricity[i]);
+
+        double max_e = bodies->eccentricity[i];
+        for (int lane = 1; lane < SIMD_LANES; ++lane)
+        {
+            max_e = MAX(max_e, bodies->eccentricity[i + lane]);
+        }
+        int iterations = kepler_iterations(max_e);
+
+        // Mean anomaly in [-π, π]
+        vf64 M = v_sub(julian_date, v_load(&bodies->epoch[i]));
+        M = v_add(v_load(&bodies->mean_anomaly[i]), v_mul(v_load(&bodies->mean_motion[i]), M));
+        M = v_sub(M, v_mul(two_pi, v_round(v_mul(M, inv_two_pi))));
+
+        // Halley's method from E = M ± 0.85e. Kepler's equation has its root
+        // in [-π, π] too, so iterates are kept there for v_sincos
+        vf64 offset = v_mul(v_set1(0.85), e);
+        vf64 E = v_add(M, v_select(v_lt(M, zero), offset, v_sub(zero, offset)));
+        vf64 s, c;
+        for (int n = 0; n < iterations; ++n)
+        {
+            E = v_min(v_max(E, minus_pi), pi);
+            v_sincos(E, &s, &c);
+
+            vf64 f = v_sub(v_sub(E, v_mul(e, s)), M);
+            vf64 df = v_sub(one, v_mul(e, c));
+            vf64 d2f_half = v_mul(half, v_mul(e, s));
+            E = v_sub(E, v_div(f, v_sub(df, v_div(v_mul(f, d2f_half), df))));
+        }
+        E = v_min(v_max(E, minus_pi), pi);
+        v_sincos(E, &s, &c);
+
+        // Geocentric rectangular equatorial coordinates
+        vf64 xp = v_sub(c, e);
+        vf64 x = v_sub(v_add(v_mul(v_load(&bodies->px[i]), xp), v_mul(v_load(&bodies->qx[i]), s)), xe);
+        vf64 y = v_sub(v_add(v_mul(v_load(&bodies->py[i]), xp), v_mul(v_load(&bodies->qy[i]), s)), ye);
+        vf64 z = v_sub(v_add(v_mul(v_load(&bodies->pz[i]), xp), v_mul(v_load(&bodies->qz[i]), s)), ze);
+
+        v_store(&bodies->xh[i], v_add(v_add(v_mul(m00, x), v_mul(m01, y)), v_mul(m02, z)));
+        v_store(&bodies->yh[i], v_add(v_add(v_mul(m10, x), v_mul(m11, y)), v_mul(m12, z)));
+        v_store(&bodies->zh[i], v_add(v_add(v_mul(m20, x), v_mul(m21, y)), v_mul(m22, z)));
+        v_store(&bodies->r[i], v_mul(v_load(&bodies->semi_major[i]), v_sub(one, v_mul(e, c))));
+    }
+#endif
+
+    // Remainder (or everything, without SIMD)
+    for (; i < end; ++i)
+    {
+        double e = bodies->eccentricity[i];
+
+        double M = bodies->mean_anomaly[i] + bodies->mean_motion[i] * (frame->julian_date - bodies->epoch[i]);
+        M -= 2.0 * M_PI * nearbyint(M / (2.0 * M_PI));
+
+        double E = M + (M < 0.0 ? -0.85 * e : 0.85 * e);
+        double s, c;
+        int iterations = kepler_iterations(e);
+        for (int n = 0; n < iterations; ++n)
+        {
+            E = MIN(MAX(E, -M_PI), M_PI);
+            s = sin(E);
+            c = cos(E);
+
+            double f = E - e * s - M;
+            double df = 1.0 - e * c;
+            E -= f / (df - f * 0.5 * e * s / df);
+        }
+        E = MIN(MAX(E, -M_PI), M_PI);
+        s = sin(E);
+        c = cos(E);
+
+        double xp = c - e;
+        double x = bodies->px[i] * xp + bodies->qx[i] * s - frame->xe;
+        double y = bodies->py[i] * xp + bodies->qy[i] * s - frame->ye;
+        double z = bodies->pz[i] * xp + bodies->qz[i] * s - frame->ze;
+
+        bodies->xh[i] = m[0][0] * x + m[0][1] * y + m[0][2] * z;
+        bodies->yh[i] = m[1][0] * x + m[1][1] * y + m[1][2] * z;
+        bodies->zh[i] = m[2][0] * x + m[2][1] * y + m[2][2] * z;
+        bodies->r[i] = bodies->semi_major[i] * (1.0 - e * c);
+    }
+}
+
+// Apparent magnitude from the distances to the Sun (r), the Earth (delta) and
+// between the Earth and Sun (R), using the H, G system for asteroids
+static double apparent_magnitude(const struct MinorBodies *bodies, int i, double r, double delta, double R)
+{
+    double H = bodies->abs_magnitude[i];
+    double G = bodies->slope[i];
+
+    if (bodies->comet[i])
+    {
+        return H + 5.0 * log10(delta) + 2.5 * G * log10(r);
+    }
+
+    double cos_phase = (r * r + delta * delta - R * R) / (2.0 * r * delta);
+    cos_phase = MIN(MAX(cos_phase, -1.0 + 1E-12), 1.0);
+    double tan_half_phase = sqrt((1.0 - cos_phase) / (1.0 + cos_phase));
+
+    double phi1 = exp(-3.33 * pow(tan_half_phase, 0.63));
+    double phi2 = exp(-1.87 * pow(tan_half_phase, 1.22));
+
+    return H + 5.0 * log10(r * delta) - 2.5 * log10((1.0 - G) * phi1 + G * phi2);
+}
+
+/* List candidates above the horizon that are within the threshold. Magnitudes
+ * are only computed for bodies above the horizon
+ */
+static void list_visible(struct MinorBodies *bodies, const struct MinorFrame *frame)
+{
+    double R = sqrt(frame->xe * frame->xe + frame->ye * frame->ye + frame->ze * frame->ze);
+
+    bodies->num_visible = 0;
+    for (int i = 0; i < bodies->num_candidates; ++i)
+    {
+        double xh = bodies->xh[i];
+        double yh = bodies->yh[i];
+        double zh = bodies->zh[i];
+        if (zh <= 0.0)
+        {
+            continue;
+        }
+
+        double delta = sqrt(xh * xh + yh * yh + zh * zh);
+        if (bodies->r[i] * delta > bodies->distance_limit[i])
+        {
+            continue;
+        }
+
+        bodies->magnitude[i] = (float)apparent_magnitude(bodies, i, bodies->r[i], delta, R);
+        if (bodies->magnitude[i] > bodies->threshold)
+        {
+            continue;
+        }
+
+        horizontal_rectangular_to_spherical(xh, yh, zh, &bodies->azimuth[i], &bodies->altitude[i]);
+        bodies->visible[bodies->num_visible++] = i;
+    }
+}
+
+void update_minor_bodies(struct MinorBodies *bodies, const struct Planet *planet_table, double julian_date,
+                         double latitude, double longitude)
+{
+    const struct Planet *earth = &planet_table[EARTH];
+
+    struct MinorFrame frame = {.julian_date = julian_date};
+    calc_planet_helio_ICRF(earth->elements, earth->rates, earth->extras, julian_date, &frame.xe, &frame.ye, &frame.ze);
+    equatorial_to_horizontal_matrix(greenwich_mean_sidereal_time_rad(julian_date), latitude, longitude, frame.m);
+
+    propagate_bodies(bodies, &frame, 0, bodies->num_candidates);
+    list_visible(bodies, &frame);
+}
@@ -0,0 +1,675 @@
+#include "observers.h"
+
+#include "astro.h"
+#include "city.h"
+#include "coord.h"
+#include "core.h"
+#include "export.h"
+#include "macros.h"
+#include "simd.h"
+
+#include <ctype.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_OBSERVER_ARRAYS 10
+
+#define MAX_OBSERVER_LINE 512
+#define MAX_FIELDS 16
+
+// Positions found before they are formatted, per object (observers)
+#define OBSERVED_BLOCK 4096
+
+// Output formatted before it is written (bytes)
+#define OBSERVED_BUFFER_SIZE (1 << 16)
+
+// Longest row: a quoted name with every character doubled, an object name and
+// four angles
+#define MAX_OBSERVED_ROW (2 * MAX_OBSERVER_NAME + MAX_OBJECT_NAME + 64)
+
+// Decimal places of the observer coordinates (about 1 m) and of the positions
+#define COORD_DECIMALS 5
+#define ANGLE_DECIMALS 4
+
+// An observer as read from a file, in degrees
+struct ObserverSite
+{
+    char name[MAX_OBSERVER_NAME];
+    double latitude;
+    double longitude;
+};
+
+// Columns of an observer file, -1 if absent
+struct ObserverColumns
+{
+    int name;
+    int latitude;
+    int longitude;
+};
+
+static bool generate_observers(struct Observers *observers, int num_observers)
+{
+    // One allocation holds every array
+    size_t n = MAX((size_t)num_observers, 1);
+    double *block = malloc(n * (NUM_OBSERVER_ARRAYS * sizeof(double) + sizeof(const char *)));
+    if (block == NULL)
+    {
+        fprintf(stderr, "Allocation of memory for observers failed\n");
+        return false;
+    }
+
+    *observers = (struct Observers){
+        .num_observers = num_observers,
+        .latitude = block + 0 * n,
+        .longitude = block + 1 * n,
+        .east_x = block + 2 * n,
+        .east_y = block + 3 * n,
+        .north_x = block + 4 * n,
+        .north_y = block + 5 * n,
+        .north_z = block + 6 * n,
+        .zenith_x = block + 7 * n,
+        .zenith_y = block + 8 * n,
+        .zenith_z = block + 9 * n,
+        .names = (const char **)(block + NUM_OBSERVER_ARRAYS * n),
+        .name_storage = NULL,
+    };
+
+    return true;
+}
+
+// Set an observer at a latitude and longitude in radians
+static void set_observer(struct Observers *observers, int i, const char *name, double latitude, double longitude)
+{
+    // Rows of equatorial_to_horizontal_matrix with the local sidereal time
+    // replaced by the longitude, which leaves the rotation by the Greenwich
+    // sidereal time to the object
+    double sin_lon = sin(longitude);
+    double cos_lon = cos(longitude);
+    double sin_lat = sin(latitude);
+    double cos_lat = cos(latitude);
+
+    observers->names[i] = name;
+    observers->latitude[i] = latitude;
+    observers->longitude[i] = longitude;
+    observers->east_x[i] = -sin_lon;
+    observers->east_y[i] = cos_lon;
+    observers->north_x[i] = -sin_lat * cos_lon;
+    observers->north_y[i] = -sin_lat * sin_lon;
+    observers->north_z[i] = cos_lat;
+    observers->zenith_x[i] = cos_lat * cos_lon;
+    observers->zenith_y[i] = cos_lat * sin_lon;
+    observers->zenith_z[i] = sin_lat;
+}
+
+static int compare_cities(const void *a, const void *b)
+{
+    const CityData *x = *(const CityData *const *)a;
+    const CityData *y = *(const CityData *const *)b;
+    return strcmp(x->city_name, y->city_name);
+}
+
+bool load_city_observers(struct Observers *observers)
+{
+    int num_cities;
+    const CityData *cities = get_cities(&num_cities);
+
+    // The table is in the order of its hash, so cities are sorted by name
+    const CityData **order = malloc(num_cities * sizeof(const CityData *));
+    if (order == NULL)
+    {
+        fprintf(stderr, "Allocation of memory for observers failed\n");
+        return false;
+    }
+    if (!generate_observers(observers, num_cities))
+    {
+        free(order);
+        return false;
+    }
+
+    for (int i = 0; i < num_cities; ++i)
+    {
+        order[i] = &cities[i];
+    }
+    qsort(order, num_cities, sizeof(const CityData *), compare_cities);
+
+    for (int i = 0; i < num_cities; ++i)
+    {
+        set_observer(observers, i, order[i]->city_name, order[i]->latitude * TO_RAD, order[i]->longitude * TO_RAD);
+    }
+
+    free(order);
+
+    return true;
+}
+
+// Split a CSV line in place into at most max_fields fields, removing quotes.
+// Returns the number of fields
+static int split_fields(char *line, char **fields, int max_fields)
+{
+    int num_fields = 0;
+    char *in = line;
+    while (num_fields < max_fields)
+    {
+        // Unquoted fields are written over the line, which never overtakes
+        // what is read
+        char *out = in;
+        fields[num_fields++] = out;
+
+        while (*in == ' ' || *in == '\t')
+        {
+            ++in;
+        }
+        if (*in == '"')
+        {
+            for (++in; *in != '\0'; ++in)
+            {
+                if (*in == '"' && *++in != '"')
+                {
+                    break;
+                }
+                *out++ = *in;
+            }
+        }
+        while (*in != '\0' && *in != ',')
+        {
+            *out++ = *in++;
+        }
+
+        char separator = *in++;
+        while (out > fields[num_fields - 1] && isspace((unsigned char)out[-1]))
+        {
+            --out;
+        }
+        *out = '\0';
+
+        if (separator != ',')
+        {
+            break;
+        }
+    }
+    return num_fields;
+}
+
+static bool names_match(const char *a, const char *b)
+{
+    for (; *a != '\0' && *b != '\0'; ++a, ++b)
+    {
+        if (tolower((unsigned char)*a) != tolower((unsigned char)*b))
+        {
+            return false;
+        }
+    }
+    return *a == *b;
+}
+
+// Find the columns named by a header. Returns false if the line isn't one
+static bool parse_observer_header(char **fields, int num_fields, struct ObserverColumns *columns)
+{
+    *columns = (struct ObserverColumns){-1, -1, -1};
+    for (int i = 0; i < num_fields; ++i)
+    {
+        if (names_match(fields[i], "latitude"))
+        {
+            columns->latitude = i;
+        }
+        else if (names_match(fields[i], "longitude"))
+        {
+            columns->longitude = i;
+        }
+        else if (names_match(fields[i], "name") || names_match(fields[i], "city_name") ||
+                 names_match(fields[i], "observer"))
+        {
+            columns->name = i;
+        }
+    }
+    return columns->latitude >= 0 && columns->longitude >= 0;
+}
+
+static bool parse_angle(const char *field, double limit, double *value)
+{
+    char *end;
+    *value = strtod(field, &end);
+    return end != field && *end == '\0' && fabs(*value) <= limit;
+}
+
+static bool parse_site(char **fields, int num_fields, const struct ObserverColumns *columns, struct ObserverSite *site)
+{
+    if (num_fields <= MAX(columns->name, MAX(columns->latitude, columns->longitude)))
+    {
+        return false;
+    }
+
+    const char *name = columns->name >= 0 ? fields[columns->name] : "";
+    snprintf(site->name, sizeof(site->name), "%s", name);
+
+    return parse_angle(fields[columns->latitude], 90.0, &site->latitude) &&
+           parse_angle(fields[columns->longitude], 360.0, &site->longitude);
+}
+
+// Columns of files without a header
+static bool default_columns(int num_fields, struct ObserverColumns *columns)
+{
+    if (num_fields == 3)
+    {
+        *columns = (struct ObserverColumns){0, 1, 2};
+        return true;
+    }
+    if (num_fields == 2)
+    {
+        *columns = (struct ObserverColumns){-1, 0, 1};
+        return true;
+    }
+    return false;
+}
+
+static bool generate_file_observers(struct Observers *observers, const struct ObserverSite *sites, int num_sites)
+{
+    char *names = malloc(MAX((size_t)num_sites, 1) * MAX_OBSERVER_NAME);
+    if (names == NULL)
+    {
+        fprintf(stderr, "Allocation of memory for observers failed\n");
+        return false;
+    }
+    if (!generate_observers(observers, num_sites))
+    {
+        free(names);
+        return false;
+    }
+
+    observers->name_storage = names;
+    for (int i = 0; i < num_sites; ++i)
+    {
+        char *name = names + (size_t)i * MAX_OBSERVER_NAME;
+        memcpy(name, sites[i].name, MAX_OBSERVER_NAME);
+        set_observer(observers, i, name, sites[i].latitude * TO_RAD, sites[i].longitude * TO_RAD);
+    }
+
+    return true;
+}
+
+bool load_observers(struct Observers *observers, const char *path)
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+    {
+        fprintf(stderr, "ERROR: Could not open observers '%s'\n", path);
+        return false;
+    }
+
+    struct ObserverSite *sites = NULL;
+    int num_sites = 0;
+    int capacity = 0;
+
+    struct ObserverColumns columns;
+    bool first_line = true;
+    bool s = true;
+    int line_number = 0;
+
+    char line[MAX_OBSERVER_LINE];
+    while (s && fgets(line, sizeof(line), file) != NULL)
+    {
+        ++line_number;
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[strspn(line, " \t")] == '\0' || line[0] == '#')
+        {
+            continue;
+        }
+
+        char *fields[MAX_FIELDS];
+        int num_fields = split_fields(line, fields, MAX_FIELDS);
+
+        if (first_line)
+        {
+            first_line = false;
+            if (parse_observer_header(fields, num_fields, &columns))
+            {
+                continue;
+            }
+            if (!default_columns(num_fields, &columns))
+            {
+                fprintf(stderr, "ERROR: Observers must be name,latitude,longitude or latitude,longitude\n");
+                s = false;
+                break;
+            }
+        }
+
+        struct ObserverSite site;
+        if (!parse_site(fields, num_fields, &columns, &site))
+        {
+            fprintf(stderr, "ERROR: Invalid observer on line %d of '%s'\n", line_number, path);
+            s = false;
+            break;
+        }
+
+        if (num_sites == capacity)
+        {
+            capacity = MAX(2 * capacity, 1024);
+            struct ObserverSite *temp = realloc(sites, capacity * sizeof(struct ObserverSite));
+            if (temp == NULL)
+            {
+                fprintf(stderr, "Allocation of memory for observers failed\n");
+                s = false;
+                break;
+            }
+            sites = temp;
+        }
+        sites[num_sites++] = site;
+    }
+    fclose(file);
+
+    if (s && num_sites == 0)
+    {
+        fprintf(stderr, "ERROR: No observers in '%s'\n", path);
+        s = false;
+    }
+
+    s = s && generate_file_observers(observers, sites, num_sites);
+    free(sites);
+
+    return s;
+}
+
+void free_observers(struct Observers *observers)
+{
+    free(observers->latitude);
+    free(observers->name_storage);
+    *observers = (struct Observers){0};
+}
+
+void observe_object(const struct Observers *observers, int begin, int end, double right_ascension, double declination,
+                    double gmst, double *azimuth, double *altitude)
+{
+    // Direction of the object fixed to the Earth, found once for everyone
+    double x, y, z;
+    equatorial_spherical_to_rectangular(right_ascension - gmst, declination, &x, &y, &z);
+
+    int i = begin;
+
+#if SIMD_LANES > 1
+    const vf64 vx = v_set1(x), vy = v_set1(y), vz = v_set1(z);
+    const vf64 zero = v_set1(0.0), two_pi = v_set1(2.0 * M_PI);
+
+    for (; i + SIMD_LANES <= end; i += SIMD_LANES)
+    {
+        vf64 xh = v_add(v_mul(v_load(&observers->east_x[i]), vx), v_mul(v_load(&observers->east_y[i]), vy));
+        vf64 yh = v_add(v_add(v_mul(v_load(&observers->north_x[i]), vx), v_mul(v_load(&observers->north_y[i]), vy)),
+                        v_mul(v_load(&observers->north_z[i]), vz));
+        vf64 zh = v_add(v_add(v_mul(v_load(&observers->zenith_x[i]), vx), v_mul(v_load(&observers->zenith_y[i]), vy)),
+                        v_mul(v_load(&observers->zenith_z[i]), vz));
+
+        // As horizontal_rectangular_to_spherical
+        v_store(&altitude[i - begin], v_atan2(zh, v_sqrt(v_add(v_mul(xh, xh), v_mul(yh, yh)))));
+        vf64 a = v_atan2(xh, yh);
+        v_store(&azimuth[i - begin], v_select(v_lt(a, zero), a, v_add(a, two_pi)));
+    }
+#endif
+
+    // Remainder (or everything, without SIMD)
+    for (; i < end; ++i)
+    {
+        double xh = observers->east_x[i] * x + observers->east_y[i] * y;
+        double yh = observers->north_x[i] * x + observers->north_y[i] * y + observers->north_z[i] * z;
+        double zh = observers->zenith_x[i] * x + observers->zenith_y[i] * y + observers->zenith_z[i] * z;
+        horizontal_rectangular_to_spherical(xh, yh, zh, &azimuth[i - begin], &altitude[i - begin]);
+    }
+}
+
+// Find an object by name and its position. Returns false if there is none
+static bool find_object(const char *name, const struct Star *star_table, int num_stars,
+                        const struct Planet *planet_table, const struct Moon *moon_object, double julian_date,
+                        struct ObservedObject *object)
+{
+    for (int i = SUN; i < NUM_PLANETS; ++i)
+    {
+        if (i != EARTH && names_match(name, planet_table[i].base.label))
+        {
+            snprintf(object->name, sizeof(object->name), "%s", planet_table[i].base.label);
+            double xg, yg, zg;
+            planet_geo_ICRF(planet_table, i, julian_date, &xg, &yg, &zg);
+            equatorial_rectangular_to_spherical(xg, yg, zg, &object->right_ascension, &object->declination);
+            return true;
+        }
+    }
+    if (names_match(name, moon_object->base.label))
+    {
+        snprintf(object->name, sizeof(object->name), "%s", moon_object->base.label);
+        double xg, yg, zg;
+        calc_moon_geo_ICRF(moon_object->elements, moon_object->rates, julian_date, &xg, &yg, &zg);
+        equatorial_rectangular_to_spherical(xg, yg, zg, &object->right_ascension, &object->declination);
+        return true;
+    }
+
+    char *end;
+    long number = strtol(name, &end, 10);
+    bool numbered = end != name && *end == '\0';
+
+    for (int i = 0; i < num_stars; ++i)
+    {
+        const struct Star *star = &star_table[i];
+        if (numbered ? star->catalog_number == number : star->base.label != NULL && names_match(name, star->base.label))
+        {
+            snprintf(object->name, sizeof(object->name), "%d", star->catalog_number);
+            calc_star_position(star->right_ascension, star->ra_motion, star->declination, star->dec_motion,
+                               julian_date, &object->right_ascension, &object->declination);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool select_observed_objects(const char *list, const struct Star *star_table, int num_stars,
+                             const struct Planet *planet_table, const struct Moon *moon_object, double julian_date,
+                             struct ObservedObject **objects, int *num_objects)
+{
+    // The Sun, planets other than the Earth and the Moon, in the order of
+    // exports
+    const char *bodies = "Sun,Mercury,Venus,Mars,Jupiter,Saturn,Uranus,Neptune,Moon";
+    if (list == NULL)
+    {
+        list = bodies;
+    }
+
+    size_t length = strlen(list);
+    int max_objects = 1;
+    for (size_t i = 0; i < length; ++i)
+    {
+        max_objects += list[i] == ',';
+    }
+
+    char *names = malloc(length + 1);
+    char **fields = malloc(max_objects * sizeof(char *));
+    *objects = malloc(max_objects * sizeof(struct ObservedObject));
+    if (names == NULL || fields == NULL || *objects == NULL)
+    {
+        fprintf(stderr, "Allocation of memory for objects failed\n");
+        free(names);
+        free(fields);
+        free(*objects);
+        *objects = NULL;
+        return false;
+    }
+    memcpy(names, list, length + 1);
+
+    *num_objects = split_fields(names, fields, max_objects);
+
+    bool s = true;
+    for (int i = 0; s && i < *num_objects; ++i)
+    {
+        s = find_object(fields[i], star_table, num_stars, planet_table, moon_object, julian_date, &(*objects)[i]);
+        if (!s)
+        {
+            fprintf(stderr, "ERROR: Unknown object \"%s\"\n", fields[i]);
+        }
+    }
+
+    free(names);
+    free(fields);
+    if (!s)
+    {
+        free(*objects);
+        *objects = NULL;
+    }
+
+    return s;
+}
+
+// Names with a separator or quote are quoted, as CSV
+static char *format_name(char *out, const char *name)
+{
+    bool quoted = strpbrk(name, ",\"") != NULL;
+    if (quoted)
+    {
+        *out++ = '"';
+    }
+    for (; *name != '\0'; ++name)
+    {
+        if (*name == '"')
+        {
+            *out++ = '"';
+        }
+        *out++ = *name;
+    }
+    if (quoted)
+    {
+        *out++ = '"';
+    }
+    return out;
+}
+
+static char *format_observed_row(char *out, const struct Observers *observers, int i, const char *object,
+                                 double azimuth, double altitude)
+{
+    out = format_name(out, observers->names[i]);
+    *out++ = ',';
+    out = format_fixed(out, observers->latitude[i] * TO_DEG, COORD_DECIMALS);
+    *out++ = ',';
+    out = format_fixed(out, observers->longitude[i] * TO_DEG, COORD_DECIMALS);
+    *out++ = ',';
+
+    size_t length = strlen(object);
+    memcpy(out, object, length);
+    out += length;
+    *out++ = ',';
+
+    // Azimuths just short of north would round up to 360
+    azimuth *= TO_DEG;
+    out = format_fixed(out, azimuth >= 359.99995 ? azimuth - 360.0 : azimuth, ANGLE_DECIMALS);
+    *out++ = ',';
+    out = format_fixed(out, altitude * TO_DEG, ANGLE_DECIMALS);
+    *out++ = '\n';
+    return out;
+}
+
+bool write_observed_positions(FILE *stream, const struct Observers *observers, const struct ObservedObject *objects,
+                              int num_objects, double julian_date, double min_altitude)
+{
+    // Observers are taken in blocks, so positions of every object are found
+    // for a block before its rows are written
+    int block = MAX(OBSERVED_BLOCK / MAX(num_objects, 1), SIMD_LANES);
+    double *positions = malloc(2 * (size_t)block * MAX(num_objects, 1) * sizeof(double));
+    char *buffer = malloc(OBSERVED_BUFFER_SIZE);
+    if (positions == NULL || buffer == NULL)
+    {
+        fprintf(stderr, "Allocation of memory for positions failed\n");
+        free(positions);
+        free(buffer);
+        return false;
+    }
+    double *azimuths = positions;
+    double *altitudes = positions + (size_t)block * num_objects;
+
+    double gmst = greenwich_mean_sidereal_time_rad(julian_date);
+
+    bool s = fputs("observer,latitude,longitude,object,azimuth,altitude\n", stream) >= 0;
+    size_t length = 0;
+
+    for (int first = 0; s && first < observers->num_observers; first += block)
+    {
+        int end = MIN(first + block, observers->num_observers);
+        for (int j = 0; j < num_objects; ++j)
+        {
+            observe_object(observers, first, end, objects[j].right_ascension, objects[j].declination, gmst,
+                           &azimuths[(size_t)j * block], &altitudes[(size_t)j * block]);
+        }
+
+        for (int i = first; s && i < end; ++i)
+        {
+            for (int j = 0; j < num_objects; ++j)
+            {
+                size_t k = (size_t)j * block + (i - first);
+                if (altitudes[k] < min_altitude)
+                {
+                    continue;
+                }
+                if (length + MAX_OBSERVED_ROW > OBSERVED_BUFFER_SIZE)
+                {
+                    s = fwrite(buffer, 1, length, stream) == length;
+                    length = 0;
+                }
+                char *out = format_observed_row(buffer + length, observers, i, objects[j].name, azimuths[k],
+                                                altitudes[k]);
+                length = (size_t)(out - buffer);
+            }
+        }
+    }
+    s = s && fwrite(buffer, 1, length, stream) == length;
+
+    free(positions);
+    free(buffer);
+
+    return s;
+}
+
+bool observe_to_output(const struct Conf *config, const struct Star *star_table, int num_stars,
+                       const struct Planet *planet_table, const struct Moon *moon_object, double julian_date)
+{
+    struct Observers observers;
+    bool s = strcmp(config->observers_path, "cities") == 0 ? load_city_observers(&observers)
+                                                           : load_observers(&observers, config->observers_path);
+    if (!s)
+    {
+        return false;
+    }
+
+    struct ObservedObject *objects;
+    int num_objects;
+    if (!select_observed_objects(config->objects, star_table, num_stars, planet_table, moon_object, julian_date,
+                                 &objects, &num_objects))
+    {
+        free_observers(&observers);
+        return false;
+    }
+
+    FILE *stream = stdout;
+    if (config->output_path != NULL)
+    {
+        stream = fopen(config->output_path, "w");
+        if (stream == NULL)
+        {
+            fprintf(stderr, "ERROR: Unable to open '%s'\n", config->output_path);
+            free(objects);
+            free_observers(&observers);
+            return false;
+        }
+    }
+
+    s = write_observed_positions(stream, &observers, objects, num_objects, julian_date, config->min_altitude);
+    s = fflush(stream) == 0 && s;
+    if (stream != stdout)
+    {
+        s = fclose(stream) == 0 && s;
+    }
+    if (!s)
+    {
+        fprintf(stderr, "ERROR: Unable to write positions for observers\n");
+    }
+
+    free(objects);
+    free_observers(&observers);
+
+    return s;
+}
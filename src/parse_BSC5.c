@@ -8,10 +8,18 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #define HEADER_BYTES 28
-#define ENTRY_BYTES 32
 
-static struct Header parse_header(uint8_t *buffer)
+static struct Header parse_header(const uint8_t *buffer)
 {
     struct Header header_data;
 
@@ -19,30 +27,42 @@ static struct Header parse_header(uint8_t *buffer)
     header_data.STAR1 = (int)bytes_to_int32_LE(&buffer[4]);
     header_data.STARN = (int)bytes_to_int32_LE(&buffer[8]);
     header_data.STNUM = (int)bytes_to_int32_LE(&buffer[12]);
-    header_data.MPROP = bytes_to_bool32_LE(&buffer[16]);
+    header_data.MPROP = (int)bytes_to_int32_LE(&buffer[16]);
     header_data.NMAG = (int)bytes_to_int32_LE(&buffer[20]);
     header_data.NBENT = (int)bytes_to_int32_LE(&buffer[24]);
 
     return header_data;
 }
 
-static struct Entry parse_entry(uint8_t *buffer)
+// Size of an entry as described by the header fields, see
+// http://tdc-www.harvard.edu/catalogs/catalogsb.html
+static long expected_entry_bytes(struct Header header)
 {
-    struct Entry entry_data;
+    long bytes = 0;
 
-    entry_data.XNO = bytes_to_float32_LE(&buffer[0]);
-    entry_data.SRA0 = bytes_to_double64_LE(&buffer[4]);
-    entry_data.SDEC0 = bytes_to_double64_LE(&buffer[12]);
-    entry_data.IS[0] = byte_to_char(buffer[20]);
-    entry_data.IS[1] = byte_to_char(buffer[21]);
-    entry_data.MAG = (float)bytes_to_int16_LE(&buffer[22]);
-    entry_data.XRPM = bytes_to_float32_LE(&buffer[24]);
-    entry_data.XDPM = bytes_to_float32_LE(&buffer[28]);
+    if (header.STNUM > 0)
+    {
+        bytes += 4; // Catalog number
+    }
+    bytes += 8 + 8 + 2;           // Coordinates and spectral type
+    bytes += 2L * abs(header.NMAG); // Magnitudes
+    if (header.MPROP >= 1)
+    {
+        bytes += 4 + 4; // Proper motion
+    }
+    if (header.MPROP == 2)
+    {
+        bytes += 8; // Radial velocity
+    }
+    if (header.STNUM < 0)
+    {
+        bytes += -header.STNUM; // Object name
+    }
 
-    return entry_data;
+    return bytes;
 }
 
-bool parse_entries(uint8_t *data, size_t data_size, struct Entry **entries_out, unsigned int *num_entries_out)
+bool open_catalog(struct Catalog *catalog, const uint8_t *data, size_t data_size)
 {
     // Check if there's enough data to read the header
     if (data_size < HEADER_BYTES)
@@ -51,47 +71,214 @@ bool parse_entries(uint8_t *data, size_t data_size, struct Entry **entries_out,
         return false;
     }
 
-    // Read the header from the embedded binary data
-    uint8_t header_buffer[HEADER_BYTES];
-    memcpy(header_buffer, data, HEADER_BYTES);
-    struct Header header_data = parse_header(header_buffer);
+    struct Header header = parse_header(data);
+
+    if (header.STNUM > 4 || header.MPROP < 0 || header.MPROP > 2 || header.NMAG == 0 ||
+        header.NBENT != expected_entry_bytes(header))
+    {
+        printf("Unsupported catalog format\n");
+        return false;
+    }
 
     // STARN is negative if coordinates are J2000 (which they are in BSC5)
     // http://tdc-www.harvard.edu/catalogs/catalogsb.html
-    unsigned int num_entries = (unsigned int)abs(header_data.STARN);
+    unsigned int num_entries = (unsigned int)abs(header.STARN);
 
-    // Allocate memory for the entries
-    *entries_out = malloc(num_entries * sizeof(struct Entry));
-    if (*entries_out == NULL)
+    if ((data_size - HEADER_BYTES) / (size_t)header.NBENT < num_entries)
     {
-        printf("Allocation of memory for BSC5 entries failed\n");
+        printf("Insufficient data size for %u entries\n", num_entries);
+        return false;
+    }
+
+    *catalog = (struct Catalog){
+        .data = data,
+        .data_size = data_size,
+        .header = header,
+        .num_entries = num_entries,
+        .mapped = false,
+    };
+
+    return true;
+}
+
+#ifdef _WIN32
+
+bool map_catalog(struct Catalog *catalog, const char *path)
+{
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        printf("Could not open catalog %s\n", path);
         return false;
     }
 
-    // Move the data pointer to the beginning of the entries section
-    data += HEADER_BYTES;
-    data_size -= HEADER_BYTES;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        printf("Could not read size of catalog %s\n", path);
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (mapping == NULL)
+    {
+        printf("Could not map catalog %s\n", path);
+        return false;
+    }
 
-    // Read entries from the embedded binary data
-    uint8_t entry_buffer[ENTRY_BYTES];
-    for (unsigned int i = 0; i < num_entries; ++i)
+    const uint8_t *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (data == NULL)
     {
-        if (data_size < ENTRY_BYTES)
-        {
-            printf("Insufficient data size for entry %u\n", i);
-            return false;
-        }
+        printf("Could not map catalog %s\n", path);
+        return false;
+    }
 
-        memcpy(entry_buffer, data, ENTRY_BYTES);
-        (*entries_out)[i] = parse_entry(entry_buffer);
+    size_t data_size = (size_t)size.QuadPart;
+    if (!open_catalog(catalog, data, data_size))
+    {
+        UnmapViewOfFile(data);
+        return false;
+    }
+    catalog->mapped = true;
 
-        // Move the data pointer to the next entry
-        data += ENTRY_BYTES;
-        data_size -= ENTRY_BYTES;
+    return true;
+}
+
+void close_catalog(struct Catalog *catalog)
+{
+    if (catalog->mapped)
+    {
+        UnmapViewOfFile(catalog->data);
+    }
+    catalog->data = NULL;
+    catalog->mapped = false;
+}
+
+#else
+
+bool map_catalog(struct Catalog *catalog, const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+    {
+        printf("Could not open catalog %s\n", path);
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) == -1 || info.st_size == 0)
+    {
+        printf("Could not read size of catalog %s\n", path);
+        close(fd);
+        return false;
+    }
+
+    size_t data_size = (size_t)info.st_size;
+    void *data = mmap(NULL, data_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping keeps its own reference to the file
+    if (data == MAP_FAILED)
+    {
+        printf("Could not map catalog %s\n", path);
+        return false;
+    }
+
+    // Entries are read in order, once
+    madvise(data, data_size, MADV_SEQUENTIAL);
+
+    if (!open_catalog(catalog, data, data_size))
+    {
+        munmap(data, data_size);
+        return false;
+    }
+    catalog->mapped = true;
+
+    return true;
+}
+
+void close_catalog(struct Catalog *catalog)
+{
+    if (catalog->mapped)
+    {
+        munmap((void *)catalog->data, catalog->data_size);
+    }
+    catalog->data = NULL;
+    catalog->mapped = false;
+}
+
+#endif
+
+struct Entry catalog_entry(const struct Catalog *catalog, unsigned int index)
+{
+    const struct Header *header = &catalog->header;
+    const uint8_t *buffer = catalog->data + HEADER_BYTES + (size_t)index * (size_t)header->NBENT;
+
+    struct Entry entry_data;
+
+    switch (header->STNUM)
+    {
+    case 1:
+    case 2:
+    case 3:
+        entry_data.XNO = bytes_to_float32_LE(buffer);
+        buffer += 4;
+        break;
+    case 4:
+        entry_data.XNO = (float)bytes_to_int32_LE(buffer);
+        buffer += 4;
+        break;
+    default:
+        // No catalog number
+        entry_data.XNO = (float)(index + 1);
+        break;
+    }
+
+    entry_data.SRA0 = bytes_to_double64_LE(&buffer[0]);
+    entry_data.SDEC0 = bytes_to_double64_LE(&buffer[8]);
+    entry_data.IS[0] = byte_to_char(buffer[16]);
+    entry_data.IS[1] = byte_to_char(buffer[17]);
+    entry_data.MAG = (float)bytes_to_int16_LE(&buffer[18]);
+    buffer += 20 + 2 * (abs(header->NMAG) - 1);
+
+    if (header->MPROP >= 1)
+    {
+        entry_data.XRPM = bytes_to_float32_LE(&buffer[0]);
+        entry_data.XDPM = bytes_to_float32_LE(&buffer[4]);
+    }
+    else
+    {
+        entry_data.XRPM = 0.0f;
+        entry_data.XDPM = 0.0f;
+    }
+
+    return entry_data;
+}
+
+bool parse_entries(uint8_t *data, size_t data_size, struct Entry **entries_out, unsigned int *num_entries_out)
+{
+    struct Catalog catalog;
+    if (!open_catalog(&catalog, data, data_size))
+    {
+        return false;
+    }
+
+    // Allocate memory for the entries
+    *entries_out = malloc(catalog.num_entries * sizeof(struct Entry));
+    if (*entries_out == NULL)
+    {
+        printf("Allocation of memory for BSC5 entries failed\n");
+        return false;
+    }
+
+    for (unsigned int i = 0; i < catalog.num_entries; ++i)
+    {
+        (*entries_out)[i] = catalog_entry(&catalog, i);
     }
 
     // Set the number of entries found
-    *num_entries_out = num_entries;
+    *num_entries_out = catalog.num_entries;
 
     return true;
 }
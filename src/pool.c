@@ -0,0 +1,154 @@
+#include "pool.h"
+
+#include "macros.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+struct Worker
+{
+    struct Pool *pool;
+    int index;
+};
+
+static void run_chunk(struct Pool *pool, int index)
+{
+    int begin = index * pool->chunk;
+    int end = MIN(begin + pool->chunk, pool->count);
+    if (begin < end)
+    {
+        pool->task(pool->context, begin, end);
+    }
+}
+
+static void *worker_main(void *arg)
+{
+    struct Worker worker = *(struct Worker *)arg;
+    struct Pool *pool = worker.pool;
+    free(arg);
+
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    while (true)
+    {
+        // Park until there is a new job
+        while (!pool->quit && pool->generation == seen)
+        {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        if (pool->quit)
+        {
+            break;
+        }
+        seen = pool->generation;
+
+        pthread_mutex_unlock(&pool->lock);
+        run_chunk(pool, worker.index);
+        pthread_mutex_lock(&pool->lock);
+
+        if (--pool->pending == 0)
+        {
+            pthread_cond_signal(&pool->done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+bool pool_create(struct Pool *pool, int num_threads)
+{
+    *pool = (struct Pool){
+        .num_threads = MAX(num_threads, 1),
+    };
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    // The calling thread takes chunk 0
+    int num_workers = pool->num_threads - 1;
+    pool->workers = malloc((num_workers + 1) * sizeof(pthread_t));
+    if (pool->workers == NULL)
+    {
+        pthread_mutex_destroy(&pool->lock);
+        pthread_cond_destroy(&pool->wake);
+        pthread_cond_destroy(&pool->done);
+        return false;
+    }
+
+    for (int i = 0; i < num_workers; ++i)
+    {
+        struct Worker *worker = malloc(sizeof(struct Worker));
+        if (worker == NULL)
+        {
+            pool->num_threads = i + 1;
+            pool_destroy(pool);
+            return false;
+        }
+        *worker = (struct Worker){.pool = pool, .index = i + 1};
+
+        if (pthread_create(&pool->workers[i], NULL, worker_main, worker) != 0)
+        {
+            free(worker);
+            pool->num_threads = i + 1;
+            pool_destroy(pool);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void pool_run(struct Pool *pool, pool_task task, void *context, int count, int grain)
+{
+    if (pool->num_threads == 1)
+    {
+        task(context, 0, count);
+        return;
+    }
+
+    // Round the chunk size up to a multiple of the grain
+    int chunk = (count + pool->num_threads - 1) / pool->num_threads;
+    chunk = (chunk + grain - 1) / grain * grain;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->task = task;
+    pool->context = context;
+    pool->count = count;
+    pool->chunk = chunk;
+    pool->pending = pool->num_threads - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    run_chunk(pool, 0);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0)
+    {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void pool_destroy(struct Pool *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = true;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->num_threads - 1; ++i)
+    {
+        pthread_join(pool->workers[i], NULL);
+    }
+    free(pool->workers);
+    pool->workers = NULL;
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->wake);
+    pthread_cond_destroy(&pool->done);
+}
@@ -0,0 +1,646 @@
+#include "recording.h"
+
+#include "canvas.h"
+#include "core.h"
+#include "macros.h"
+#include "stopwatch.h"
+#include "term.h"
+
+#include <curses.h>
+#include <limits.h>
+#include <locale.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Largest encoding of a varint of up to 64 bits, and of a cell with the run
+// it starts: a skip and length of up to 32 bits, a codepoint of 33 bits with
+// the attribute flag, and a color pair and variation of 16 bits
+#define MAX_VARINT 10
+#define MAX_ENCODED_CELL (5 + 5 + 5 + 3 + 3)
+
+static const struct Cell blank_cell = {' ', 0, 0};
+
+// Little endian and varint encoding of recordings
+
+static uint8_t *put_le32(uint8_t *out, uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        out[i] = (uint8_t)(value >> (8 * i));
+    }
+    return out + 4;
+}
+
+static uint8_t *put_le64(uint8_t *out, uint64_t value)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        out[i] = (uint8_t)(value >> (8 * i));
+    }
+    return out + 8;
+}
+
+static uint32_t get_le32(const uint8_t *in)
+{
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        value |= (uint32_t)in[i] << (8 * i);
+    }
+    return value;
+}
+
+static uint64_t get_le64(const uint8_t *in)
+{
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i)
+    {
+        value |= (uint64_t)in[i] << (8 * i);
+    }
+    return value;
+}
+
+static uint8_t *put_varint(uint8_t *out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        *out++ = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = (uint8_t)value;
+    return out;
+}
+
+// Read a varint, advancing `in`. Returns false if it runs past `end` or does
+// not fit in 64 bits
+static bool get_varint(const uint8_t **in, const uint8_t *end, uint64_t *value)
+{
+    *value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (*in == end)
+        {
+            return false;
+        }
+
+        uint8_t byte = *(*in)++;
+        *value |= (uint64_t)(byte & 0x7F) << shift;
+        if (byte < 0x80)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool same_cell(struct Cell a, struct Cell b)
+{
+    return a.codepoint == b.codepoint && a.color_pair == b.color_pair && a.variation == b.variation;
+}
+
+static uint8_t *encode_cell(uint8_t *out, struct Cell cell)
+{
+    // Most cells have neither a color nor a variation selector
+    bool has_attributes = cell.color_pair != 0 || cell.variation != 0;
+    out = put_varint(out, (uint64_t)cell.codepoint << 1 | has_attributes);
+    if (has_attributes)
+    {
+        out = put_varint(out, (uint16_t)cell.color_pair);
+        out = put_varint(out, cell.variation);
+    }
+    return out;
+}
+
+static bool decode_cell(const uint8_t **in, const uint8_t *end, struct Cell *cell)
+{
+    uint64_t key, color_pair = 0, variation = 0;
+    if (!get_varint(in, end, &key))
+    {
+        return false;
+    }
+    if ((key & 1) && (!get_varint(in, end, &color_pair) || !get_varint(in, end, &variation)))
+    {
+        return false;
+    }
+    if (key >> 1 > UINT32_MAX || color_pair > SHRT_MAX || variation > UINT16_MAX)
+    {
+        return false;
+    }
+
+    *cell = (struct Cell){(uint32_t)(key >> 1), (short)color_pair, (uint16_t)variation};
+    return true;
+}
+
+// Encode the runs of cells of `frame` that differ from `previous`, or from a
+// blank frame for a keyframe. Returns the end of the runs
+static uint8_t *encode_runs(uint8_t *out, const struct Canvas *frame, const struct Canvas *previous, bool keyframe,
+                            uint64_t *num_runs)
+{
+    const struct Cell *cells = frame->cells;
+    int num_cells = frame->height * frame->width;
+
+    *num_runs = 0;
+    int run_end = 0;
+    for (int i = 0; i < num_cells;)
+    {
+        if (same_cell(cells[i], keyframe ? blank_cell : previous->cells[i]))
+        {
+            ++i;
+            continue;
+        }
+
+        int begin = i;
+        while (i < num_cells && !same_cell(cells[i], keyframe ? blank_cell : previous->cells[i]))
+        {
+            ++i;
+        }
+
+        out = put_varint(out, (uint64_t)(begin - run_end));
+        out = put_varint(out, (uint64_t)(i - begin));
+        for (int j = begin; j < i; ++j)
+        {
+            out = encode_cell(out, cells[j]);
+        }
+        run_end = i;
+        ++*num_runs;
+    }
+
+    return out;
+}
+
+// Apply the runs of an encoded frame to a canvas. Returns false if the frame
+// is corrupt
+static bool decode_frame(const uint8_t *in, const uint8_t *end, struct Canvas *canvas)
+{
+    uint64_t num_runs;
+    if (!get_varint(&in, end, &num_runs))
+    {
+        return false;
+    }
+
+    uint64_t num_cells = (uint64_t)canvas->height * canvas->width;
+    uint64_t i = 0;
+    for (uint64_t run = 0; run < num_runs; ++run)
+    {
+        uint64_t skip, length;
+        if (!get_varint(&in, end, &skip) || skip > num_cells - i)
+        {
+            return false;
+        }
+        i += skip;
+        if (!get_varint(&in, end, &length) || length > num_cells - i)
+        {
+            return false;
+        }
+
+        for (uint64_t j = 0; j < length; ++j)
+        {
+            if (!decode_cell(&in, end, &canvas->cells[i++]))
+            {
+                return false;
+            }
+        }
+    }
+
+    return in == end;
+}
+
+bool recorder_open(struct Recorder *recorder, const char *path, int height, int width)
+{
+    *recorder = (struct Recorder){0};
+
+    recorder->stream = fopen(path, "wb");
+    if (recorder->stream == NULL)
+    {
+        printf("Could not create recording %s\n", path);
+        return false;
+    }
+
+    size_t buffer_size = (size_t)height * width * MAX_ENCODED_CELL + MAX_VARINT;
+    recorder->buffer = malloc(buffer_size);
+    if (recorder->buffer == NULL)
+    {
+        printf("Allocation of memory for recording failed\n");
+        fclose(recorder->stream);
+        return false;
+    }
+    if (!create_cell_canvas(&recorder->previous, height, width))
+    {
+        free(recorder->buffer);
+        fclose(recorder->stream);
+        return false;
+    }
+    if (!create_cell_canvas(&recorder->frame, height, width))
+    {
+        free_canvas(&recorder->previous);
+        free(recorder->buffer);
+        fclose(recorder->stream);
+        return false;
+    }
+
+    uint8_t header[RECORDING_HEADER_SIZE];
+    uint8_t *out = header;
+    memcpy(out, RECORDING_MAGIC, 8);
+    out = put_le32(out + 8, RECORDING_VERSION);
+    out = put_le32(out, (uint32_t)height);
+    out = put_le32(out, (uint32_t)width);
+    out = put_le32(out, RECORDING_KEYFRAME_INTERVAL);
+
+    recorder->offset = sizeof(header);
+    if (fwrite(header, 1, sizeof(header), recorder->stream) != sizeof(header))
+    {
+        recorder_close(recorder, 0);
+        return false;
+    }
+
+    return true;
+}
+
+bool record_frame(struct Recorder *recorder, const struct Canvas *canvas, unsigned long long time)
+{
+    if (recorder->num_frames == recorder->capacity)
+    {
+        long capacity = recorder->capacity == 0 ? 1024 : 2 * recorder->capacity;
+        uint64_t *index = realloc(recorder->index, (size_t)capacity * 2 * sizeof(uint64_t));
+        if (index == NULL)
+        {
+            printf("Allocation of memory for recording index failed\n");
+            return false;
+        }
+        recorder->index = index;
+        recorder->capacity = capacity;
+    }
+
+    // The canvas is clipped or padded to the size of the recording, so the
+    // frame is encoded from one pass over it and the previous frame
+    struct Canvas *frame = &recorder->frame;
+    struct Canvas *previous = &recorder->previous;
+    int height = frame->height;
+    int width = frame->width;
+    if (canvas->height == height && canvas->width == width)
+    {
+        memcpy(frame->cells, canvas->cells, (size_t)height * width * sizeof(struct Cell));
+    }
+    else
+    {
+        canvas_erase(frame);
+        for (int y = 0; y < MIN(height, canvas->height); ++y)
+        {
+            memcpy(&frame->cells[y * width], &canvas->cells[y * canvas->width],
+                   (size_t)MIN(width, canvas->width) * sizeof(struct Cell));
+        }
+    }
+
+    bool keyframe = recorder->num_frames % RECORDING_KEYFRAME_INTERVAL == 0;
+    uint64_t num_runs;
+    uint8_t *runs = recorder->buffer + MAX_VARINT;
+    uint8_t *end = encode_runs(runs, frame, previous, keyframe, &num_runs);
+
+    // The run count is written just before the runs
+    uint8_t count[MAX_VARINT];
+    size_t count_size = (size_t)(put_varint(count, num_runs) - count);
+    uint8_t *begin = runs - count_size;
+    memcpy(begin, count, count_size);
+
+    struct Canvas swap = *previous;
+    *previous = *frame;
+    *frame = swap;
+
+    size_t size = (size_t)(end - begin);
+    if (fwrite(begin, 1, size, recorder->stream) != size)
+    {
+        return false;
+    }
+
+    recorder->index[2 * recorder->num_frames] = recorder->offset;
+    recorder->index[2 * recorder->num_frames + 1] = time;
+    recorder->offset += size;
+    recorder->num_frames++;
+
+    return true;
+}
+
+bool recorder_close(struct Recorder *recorder, unsigned long long end)
+{
+    bool s = true;
+    for (long i = 0; s && i < recorder->num_frames; ++i)
+    {
+        uint8_t entry[RECORDING_INDEX_SIZE];
+        put_le64(put_le64(entry, recorder->index[2 * i]), recorder->index[2 * i + 1]);
+        s = fwrite(entry, 1, sizeof(entry), recorder->stream) == sizeof(entry);
+    }
+
+    uint8_t trailer[RECORDING_TRAILER_SIZE];
+    put_le64(put_le64(put_le64(trailer, (uint64_t)recorder->num_frames), end), recorder->offset);
+    s = s && fwrite(trailer, 1, sizeof(trailer), recorder->stream) == sizeof(trailer);
+    s = fclose(recorder->stream) == 0 && s;
+
+    free_canvas(&recorder->previous);
+    free_canvas(&recorder->frame);
+    free(recorder->buffer);
+    free(recorder->index);
+    *recorder = (struct Recorder){0};
+
+    return s;
+}
+
+// Check the header, trailer and index of a recording read into memory
+static bool parse_recording(struct Recording *recording)
+{
+    const uint8_t *data = recording->data;
+    size_t size = recording->size;
+    if (size < RECORDING_HEADER_SIZE + RECORDING_TRAILER_SIZE || memcmp(data, RECORDING_MAGIC, 8) != 0 ||
+        get_le32(data + 8) != RECORDING_VERSION)
+    {
+        return false;
+    }
+
+    uint32_t height = get_le32(data + 12);
+    uint32_t width = get_le32(data + 16);
+    uint32_t interval = get_le32(data + 20);
+    if (height == 0 || width == 0 || (uint64_t)height * width > INT_MAX / MAX_ENCODED_CELL || interval == 0 ||
+        interval > INT_MAX)
+    {
+        return false;
+    }
+
+    const uint8_t *trailer = data + size - RECORDING_TRAILER_SIZE;
+    uint64_t num_frames = get_le64(trailer);
+    uint64_t end = get_le64(trailer + 8);
+    uint64_t index_offset = get_le64(trailer + 16);
+    if (num_frames == 0 ||
+        num_frames > (size - RECORDING_HEADER_SIZE - RECORDING_TRAILER_SIZE) / RECORDING_INDEX_SIZE ||
+        index_offset != size - RECORDING_TRAILER_SIZE - num_frames * RECORDING_INDEX_SIZE)
+    {
+        return false;
+    }
+
+    // Frames follow each other in order of offset and time, which seeking
+    // relies on
+    const uint8_t *index = data + index_offset;
+    uint64_t last_offset = RECORDING_HEADER_SIZE;
+    uint64_t last_time = 0;
+    for (uint64_t i = 0; i < num_frames; ++i)
+    {
+        uint64_t offset = get_le64(index + i * RECORDING_INDEX_SIZE);
+        uint64_t time = get_le64(index + i * RECORDING_INDEX_SIZE + 8);
+        if (offset < last_offset || offset > index_offset || time < last_time)
+        {
+            return false;
+        }
+        last_offset = offset;
+        last_time = time;
+    }
+    if (end < last_time)
+    {
+        return false;
+    }
+
+    recording->height = (int)height;
+    recording->width = (int)width;
+    recording->keyframe_interval = (long)interval;
+    recording->num_frames = (long)num_frames;
+    recording->end = end;
+    recording->index = index;
+    return true;
+}
+
+bool open_recording(struct Recording *recording, const char *path)
+{
+    *recording = (struct Recording){.frame = -1};
+
+    FILE *stream = fopen(path, "rb");
+    if (stream == NULL)
+    {
+        printf("Could not open recording %s\n", path);
+        return false;
+    }
+
+    long size = -1;
+    if (fseek(stream, 0, SEEK_END) == 0)
+    {
+        size = ftell(stream);
+        rewind(stream);
+    }
+    if (size <= 0)
+    {
+        printf("Could not read size of recording %s\n", path);
+        fclose(stream);
+        return false;
+    }
+
+    recording->data = malloc((size_t)size);
+    if (recording->data == NULL)
+    {
+        printf("Allocation of memory for recording failed\n");
+        fclose(stream);
+        return false;
+    }
+    recording->size = fread(recording->data, 1, (size_t)size, stream);
+    fclose(stream);
+
+    if (recording->size != (size_t)size || !parse_recording(recording))
+    {
+        printf("%s is not a recording\n", path);
+        close_recording(recording);
+        return false;
+    }
+
+    if (!create_cell_canvas(&recording->canvas, recording->height, recording->width))
+    {
+        close_recording(recording);
+        return false;
+    }
+
+    return true;
+}
+
+void close_recording(struct Recording *recording)
+{
+    free(recording->data);
+    free_canvas(&recording->canvas);
+    *recording = (struct Recording){.frame = -1};
+}
+
+static uint64_t frame_offset(const struct Recording *recording, long frame)
+{
+    if (frame == recording->num_frames)
+    {
+        return (uint64_t)(recording->index - recording->data);
+    }
+    return get_le64(recording->index + frame * RECORDING_INDEX_SIZE);
+}
+
+bool seek_recording(struct Recording *recording, long frame)
+{
+    if (frame < 0 || frame >= recording->num_frames)
+    {
+        return false;
+    }
+
+    // Frames are applied forward from the current one if no keyframe lies in
+    // between, otherwise from the keyframe, which is drawn over a blank frame
+    long keyframe = frame - frame % recording->keyframe_interval;
+    long next = recording->frame + 1;
+    if (recording->frame < keyframe || recording->frame > frame)
+    {
+        canvas_erase(&recording->canvas);
+        next = keyframe;
+    }
+
+    for (; next <= frame; ++next)
+    {
+        const uint8_t *begin = recording->data + frame_offset(recording, next);
+        const uint8_t *end = recording->data + frame_offset(recording, next + 1);
+        if (!decode_frame(begin, end, &recording->canvas))
+        {
+            recording->frame = -1;
+            return false;
+        }
+        recording->frame = next;
+    }
+
+    return true;
+}
+
+unsigned long long recording_frame_time(const struct Recording *recording, long frame)
+{
+    return get_le64(recording->index + frame * RECORDING_INDEX_SIZE + 8);
+}
+
+long recording_frame_at(const struct Recording *recording, unsigned long long time)
+{
+    // Last frame not after `time`, or the first frame if all are
+    long low = 0;
+    long high = recording->num_frames - 1;
+    while (low < high)
+    {
+        long mid = low + (high - low + 1) / 2;
+        if (recording_frame_time(recording, mid) <= time)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid - 1;
+        }
+    }
+    return low;
+}
+
+// Fit the window to the recording, centered, or to the terminal if smaller.
+// Cells outside of the window are not drawn
+static void resize_replay(WINDOW *win, const struct Recording *recording)
+{
+    // Clear the window before resizing
+    werase(win);
+    wnoutrefresh(win);
+
+    wresize(win, MIN(LINES, recording->height), MIN(COLS, recording->width));
+    win_position_center(win);
+}
+
+bool replay_recording(const struct Conf *config)
+{
+    struct Recording recording;
+    if (!open_recording(&recording, config->replay_path))
+    {
+        return false;
+    }
+
+    unsigned long long dt = (unsigned long long)(1.0 / config->fps * 1.0E6);
+    bool s = true;
+    bool corrupt = false;
+
+    if (config->headless)
+    {
+        for (int frame = 0; frame == 0 || (unsigned long long)frame * dt < recording.end; ++frame)
+        {
+            corrupt = !seek_recording(&recording, recording_frame_at(&recording, (unsigned long long)frame * dt));
+            s = !corrupt && write_canvas_frame(&recording.canvas, config->output_path, config->color, frame);
+            if (!s)
+            {
+                break;
+            }
+        }
+    }
+    else
+    {
+        setlocale(LC_ALL, ""); // Required for unicode rendering
+        catch_term_resizes();
+        ncurses_init(config->color);
+
+        // `shown` holds what the window shows, so only cells that change
+        // between the frames shown are drawn
+        WINDOW *win = newwin(0, 0, 0, 0);
+        resize_replay(win, &recording);
+        struct Canvas shown;
+        s = create_cell_canvas(&shown, recording.height, recording.width);
+
+        struct SwTimestamp start;
+        sw_gettime(&start);
+        while (s)
+        {
+            if (term_resized())
+            {
+                resize_ncurses();
+                resize_replay(win, &recording);
+                canvas_erase(&shown);
+            }
+
+            struct SwTimestamp now;
+            unsigned long long elapsed;
+            sw_gettime(&now);
+            sw_timediff_usec(now, start, &elapsed);
+            if (elapsed >= recording.end && recording.frame != -1)
+            {
+                break;
+            }
+
+            long frame = recording_frame_at(&recording, elapsed);
+            corrupt = !seek_recording(&recording, frame);
+            s = !corrupt;
+            if (!s)
+            {
+                break;
+            }
+            present_canvas(&recording.canvas, &shown, win);
+            wnoutrefresh(win);
+            doupdate();
+
+            // Exit if ESC or q is pressed
+            int ch = getch();
+            if (ch != ERR && (ch == 27 || ch == 'q' || config->quit_on_any))
+            {
+                break;
+            }
+
+            // Nothing changes until the next frame is due, but frames are
+            // never drawn faster than the frame rate
+            unsigned long long due = frame + 1 < recording.num_frames ? recording_frame_time(&recording, frame + 1)
+                                                                      : recording.end;
+            due = MAX(due, elapsed + dt);
+
+            sw_gettime(&now);
+            sw_timediff_usec(now, start, &elapsed);
+            if (elapsed < due)
+            {
+                wait_for_input(due - elapsed);
+            }
+        }
+
+        ncurses_kill();
+        free_canvas(&shown);
+    }
+
+    if (corrupt)
+    {
+        printf("ERROR: Recording '%s' is corrupt\n", config->replay_path);
+    }
+    close_recording(&recording);
+
+    return s;
+}
@@ -0,0 +1,250 @@
+#include "redraw.h"
+
+#include "core.h"
+#include "macros.h"
+#include "minor_bodies.h"
+
+#include <math.h>
+#include <stdbool.h>
+
+// Length of a sidereal day (s)
+#define SIDEREAL_DAY 86164.0905
+
+// The Moon moves against the stars at up to about 4% of the sidereal rate
+#define RATE_PADDING 1.05
+
+// Angle the sky is turned to measure how points move in cells (rad)
+#define TURN_STEP 1E-4
+
+void begin_redraw_prediction(struct RedrawPrediction *prediction, int height, int width, double latitude, float speed,
+                             double max_seconds)
+{
+    prediction->height = height;
+    prediction->width = width;
+    prediction->rate = 2.0 * M_PI / SIDEREAL_DAY * fabs(speed) * RATE_PADDING;
+    prediction->seconds = max_seconds;
+
+    // Rotations of the sky a step back in time and a step forward. The sky
+    // turns westward, clockwise about the north celestial pole (Rodrigues'
+    // rotation formula)
+    double k[3] = {0.0, cos(latitude), sin(latitude)};
+    for (int step = 0; step < 2; ++step)
+    {
+        double angle = step == 0 ? TURN_STEP : -TURN_STEP;
+        double c = cos(angle);
+        double s = sin(angle);
+        double cross[3][3] = {
+            {0.0, -k[2], k[1]},
+            {k[2], 0.0, -k[0]},
+            {-k[1], k[0], 0.0},
+        };
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 3; ++j)
+            {
+                prediction->turn[step][i][j] = (i == j ? c : 0.0) + cross[i][j] * s + k[i] * k[j] * (1.0 - c);
+            }
+        }
+    }
+}
+
+// Position in cells of a direction in rectangular horizontal coordinates, as
+// project_horizontal_to_win places it before rounding. Directions below the
+// horizon may be clipped to it, as constellation segments are
+static void project_to_cells(const struct RedrawPrediction *prediction, const double v[3], bool clip, double *row,
+                             double *col)
+{
+    double x, y;
+    if (clip && v[2] < 0.0)
+    {
+        double h = hypot(v[0], v[1]);
+        x = v[0] / h;
+        y = v[1] / h;
+    }
+    else
+    {
+        x = v[0] / (1.0 + v[2]);
+        y = v[1] / (1.0 + v[2]);
+    }
+
+    double rad_y = (prediction->height - 1) / 2.0;
+    double rad_x = (prediction->width - 1) / 2.0;
+    *row = rad_y * (1.0 - y);
+    *col = rad_x * (1.0 - x);
+}
+
+// Earliest time after now at which a coordinate moving with a constant
+// acceleration has moved by `offset`
+static double seconds_to_offset(double offset, double velocity, double acceleration)
+{
+    // Roots of acceleration / 2 t^2 + velocity t - offset, in a form that
+    // stays accurate when the acceleration is small
+    double discriminant = velocity * velocity + 2.0 * acceleration * offset;
+    if (discriminant < 0.0)
+    {
+        return INFINITY;
+    }
+
+    double q = -0.5 * (velocity + copysign(sqrt(discriminant), velocity));
+    double roots[2] = {
+        q != 0.0 ? -offset / q : INFINITY,
+        acceleration != 0.0 ? 2.0 * q / acceleration : INFINITY,
+    };
+
+    double seconds = INFINITY;
+    for (int i = 0; i < 2; ++i)
+    {
+        if (roots[i] > 0.0)
+        {
+            seconds = MIN(seconds, roots[i]);
+        }
+    }
+    return seconds;
+}
+
+// Time until a coordinate rounds to another cell
+static double seconds_to_boundary(double position, double velocity, double acceleration)
+{
+    double cell = round(position);
+    return MIN(seconds_to_offset(cell + 0.5 - position, velocity, acceleration),
+               seconds_to_offset(cell - 0.5 - position, velocity, acceleration));
+}
+
+static void turn_sky(const struct RedrawPrediction *prediction, int step, const double v[3], double turned[3])
+{
+    const double(*m)[3] = prediction->turn[step];
+    for (int i = 0; i < 3; ++i)
+    {
+        turned[i] = m[i][0] * v[0] + m[i][1] * v[1] + m[i][2] * v[2];
+    }
+}
+
+static void predict_point(struct RedrawPrediction *prediction, double azimuth, double altitude, bool clip)
+{
+    if (prediction->rate == 0.0)
+    {
+        return;
+    }
+
+    double v[3] = {
+        cos(altitude) * sin(azimuth),
+        cos(altitude) * cos(azimuth),
+        sin(altitude),
+    };
+
+    // Directions at the nadir have no position on the projection, even
+    // clipped. These are stars of culled tiles
+    if (hypot(v[0], v[1]) < TURN_STEP)
+    {
+        return;
+    }
+
+    double row, col;
+    project_to_cells(prediction, v, clip, &row, &col);
+
+    // Points rise or set no faster than the rate. Above the horizon the
+    // projection never stretches the sky, so they also move at most the rate
+    // times the radius of the projection. Most points are too far from a
+    // boundary or the horizon to change first
+    if (!clip)
+    {
+        double soonest = fabs(v[2]) / prediction->rate;
+        if (v[2] >= 0.0)
+        {
+            double rad_y = (prediction->height - 1) / 2.0;
+            double rad_x = (prediction->width - 1) / 2.0;
+            soonest = MIN(soonest, (0.5 - fabs(row - round(row))) / (rad_y * prediction->rate));
+            soonest = MIN(soonest, (0.5 - fabs(col - round(col))) / (rad_x * prediction->rate));
+        }
+        if (soonest >= prediction->seconds)
+        {
+            return;
+        }
+    }
+
+    // Points move along curves and speed up or slow down, most of all near
+    // the meridian, so velocities and accelerations are both measured from a
+    // step either way
+    double before[3], after[3];
+    turn_sky(prediction, 0, v, before);
+    turn_sky(prediction, 1, v, after);
+    double step = TURN_STEP / prediction->rate;
+
+    // Rising or setting shows or hides the point, or unclips it
+    double seconds = seconds_to_offset(-v[2], (after[2] - before[2]) / (2.0 * step),
+                                       (after[2] - 2.0 * v[2] + before[2]) / (step * step));
+
+    if (clip || v[2] >= 0.0)
+    {
+        double row_before, col_before, row_after, col_after;
+        project_to_cells(prediction, before, clip, &row_before, &col_before);
+        project_to_cells(prediction, after, clip, &row_after, &col_after);
+
+        seconds = MIN(seconds, seconds_to_boundary(row, (row_after - row_before) / (2.0 * step),
+                                                   (row_after - 2.0 * row + row_before) / (step * step)));
+        seconds = MIN(seconds, seconds_to_boundary(col, (col_after - col_before) / (2.0 * step),
+                                                   (col_after - 2.0 * col + col_before) / (step * step)));
+    }
+
+    prediction->seconds = MIN(prediction->seconds, seconds);
+}
+
+void predict_object_change(struct RedrawPrediction *prediction, double azimuth, double altitude)
+{
+    predict_point(prediction, azimuth, altitude, false);
+}
+
+void predict_stars_change(struct RedrawPrediction *prediction, const struct Star *star_table, int num_stars,
+                          const int *num_by_mag)
+{
+    for (int i = 0; i < num_stars; ++i)
+    {
+        const struct Star *star = &star_table[num_by_mag[i] - 1];
+        predict_point(prediction, star->base.azimuth, star->base.altitude, false);
+    }
+}
+
+void predict_constells_change(struct RedrawPrediction *prediction, const struct ConstellTable *constell_table,
+                              const struct Star *star_table)
+{
+    const int *ends = constell_table->ends;
+    for (unsigned int c = 0; c < constell_table->num_constells; ++c)
+    {
+        if (!constell_table->drawn[c])
+        {
+            continue;
+        }
+
+        for (unsigned int j = 2 * constell_table->offsets[c]; j < 2 * constell_table->offsets[c + 1]; j += 2)
+        {
+            const struct Star *a = &star_table[ends[j]];
+            const struct Star *b = &star_table[ends[j + 1]];
+
+            // Segments entirely below the horizon are not drawn, so only their
+            // rising matters
+            bool drawn_segment = a->base.altitude >= 0.0 || b->base.altitude >= 0.0;
+            predict_point(prediction, a->base.azimuth, a->base.altitude, drawn_segment);
+            predict_point(prediction, b->base.azimuth, b->base.altitude, drawn_segment);
+        }
+    }
+}
+
+void predict_planets_change(struct RedrawPrediction *prediction, const struct Planet *planet_table)
+{
+    for (int i = 0; i < NUM_PLANETS; ++i)
+    {
+        if (i != EARTH)
+        {
+            predict_point(prediction, planet_table[i].base.azimuth, planet_table[i].base.altitude, false);
+        }
+    }
+}
+
+void predict_minor_bodies_change(struct RedrawPrediction *prediction, const struct MinorBodies *bodies)
+{
+    for (int v = 0; v < bodies->num_visible; ++v)
+    {
+        int i = bodies->visible[v];
+        predict_point(prediction, bodies->azimuth[i], bodies->altitude[i], false);
+    }
+}
@@ -0,0 +1,464 @@
+#include "star_buffer.h"
+
+#include "arena.h"
+#include "astro.h"
+#include "coord.h"
+#include "core.h"
+#include "macros.h"
+#include "pool.h"
+#include "simd.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NUM_DOUBLE_ARRAYS 9
+
+static int tile_of(double right_ascension, double declination)
+{
+    int band = (int)((sin(declination) + 1.0) / 2.0 * STAR_TILE_BANDS);
+    band = MIN(MAX(band, 0), STAR_TILE_BANDS - 1);
+
+    double ra = fmod(right_ascension, 2 * M_PI);
+    ra = ra < 0.0 ? ra + 2 * M_PI : ra;
+    int segment = (int)(ra / (2 * M_PI) * STAR_TILE_SEGMENTS);
+    segment = MIN(MAX(segment, 0), STAR_TILE_SEGMENTS - 1);
+
+    return band * STAR_TILE_SEGMENTS + segment;
+}
+
+static void init_tile_bounds(struct StarTile *tile, int index)
+{
+    int band = index / STAR_TILE_SEGMENTS;
+    int segment = index % STAR_TILE_SEGMENTS;
+
+    double dec_low = asin(-1.0 + 2.0 * band / STAR_TILE_BANDS);
+    double dec_high = asin(MIN(-1.0 + 2.0 * (band + 1) / STAR_TILE_BANDS, 1.0));
+    double dec_center = (dec_low + dec_high) / 2;
+    double ra_center = (segment + 0.5) * 2 * M_PI / STAR_TILE_SEGMENTS;
+
+    equatorial_spherical_to_rectangular(ra_center, dec_center, &tile->center[0], &tile->center[1], &tile->center[2]);
+
+    // Any point of the tile can be reached from the center by moving along
+    // the meridian and then along a parallel, which bounds its distance
+    double max_cos = dec_low <= 0.0 && dec_high >= 0.0 ? 1.0 : MAX(cos(dec_low), cos(dec_high));
+    tile->radius = (dec_high - dec_low) / 2 + max_cos * M_PI / STAR_TILE_SEGMENTS;
+}
+
+size_t star_buffer_arena_size(int num_stars, unsigned int num_segments)
+{
+    size_t n = (size_t)num_stars;
+    return ARENA_SIZE(n * (NUM_DOUBLE_ARRAYS * sizeof(double) + sizeof(float) + sizeof(int))) +
+           ARENA_SIZE(NUM_STAR_TILES * (sizeof(struct StarTile) + sizeof(int))) + ARENA_SIZE(n * sizeof(int)) +
+           ARENA_SIZE(4 * (size_t)num_segments * sizeof(int));
+}
+
+bool generate_star_buffer(struct Arena *arena, struct StarBuffer *buffer, const struct Star *star_table,
+                          const int *num_by_mag, int num_stars)
+{
+    // One allocation holds every array. The tile of each star is only needed
+    // while sorting
+    size_t n = (size_t)num_stars;
+    double *block = arena_alloc(arena, n * (NUM_DOUBLE_ARRAYS * sizeof(double) + sizeof(float) + sizeof(int)));
+    struct StarTile *tiles = arena_alloc(arena, NUM_STAR_TILES * (sizeof(struct StarTile) + sizeof(int)));
+    size_t mark = arena->used;
+    int *star_tiles = arena_alloc(arena, n * sizeof(int));
+    if (block == NULL || tiles == NULL || star_tiles == NULL)
+    {
+        printf("Allocation of memory for star buffer failed\n");
+        return false;
+    }
+
+    buffer->num_stars = num_stars;
+    buffer->x = block + 0 * n;
+    buffer->y = block + 1 * n;
+    buffer->z = block + 2 * n;
+    buffer->dx = block + 3 * n;
+    buffer->dy = block + 4 * n;
+    buffer->dz = block + 5 * n;
+    buffer->xh = block + 6 * n;
+    buffer->yh = block + 7 * n;
+    buffer->zh = block + 8 * n;
+    buffer->magnitude = (float *)(block + NUM_DOUBLE_ARRAYS * n);
+    buffer->table_index = (int *)(buffer->magnitude + n);
+    buffer->tiles = tiles;
+    buffer->active_tiles = (int *)(tiles + NUM_STAR_TILES);
+    buffer->num_active = 0;
+    buffer->pinned = NULL;
+    buffer->pinned_tiles = NULL;
+    buffer->num_pinned = 0;
+
+    // Counting sort by tile. Stars are visited in magnitude order so that
+    // each tile stays sorted dimmest first
+    int cursor[NUM_STAR_TILES] = {0};
+    for (int i = 0; i < num_stars; ++i)
+    {
+        const struct Star *star = &star_table[num_by_mag[i] - 1];
+        star_tiles[i] = tile_of(star->right_ascension, star->declination);
+        cursor[star_tiles[i]]++;
+    }
+
+    int begin = 0;
+    for (int t = 0; t < NUM_STAR_TILES; ++t)
+    {
+        int count = cursor[t];
+        tiles[t] = (struct StarTile){
+            .begin = begin,
+            .first_visible = begin,
+            .end = begin + count,
+        };
+        init_tile_bounds(&tiles[t], t);
+        cursor[t] = begin;
+        begin += count;
+    }
+
+    for (int k = 0; k < num_stars; ++k)
+    {
+        int table_index = num_by_mag[k] - 1;
+        const struct Star *star = &star_table[table_index];
+        struct StarTile *tile = &tiles[star_tiles[k]];
+        int i = cursor[star_tiles[k]]++;
+
+        double sin_ra = sin(star->right_ascension);
+        double cos_ra = cos(star->right_ascension);
+        double sin_dec = sin(star->declination);
+        double cos_dec = cos(star->declination);
+
+        buffer->x[i] = cos_dec * cos_ra;
+        buffer->y[i] = cos_dec * sin_ra;
+        buffer->z[i] = sin_dec;
+
+        // Proper motion is linear in right ascension and declination (see
+        // calc_star_position), so the direction changes at the rate
+        // ∂p/∂α * dα/dt + ∂p/∂δ * dδ/dt. Over centuries the second order
+        // error stays below a few microradians.
+        buffer->dx[i] = -cos_dec * sin_ra * star->ra_motion - sin_dec * cos_ra * star->dec_motion;
+        buffer->dy[i] = cos_dec * cos_ra * star->ra_motion - sin_dec * sin_ra * star->dec_motion;
+        buffer->dz[i] = cos_dec * star->dec_motion;
+
+        double rate = sqrt(buffer->dx[i] * buffer->dx[i] + buffer->dy[i] * buffer->dy[i] + buffer->dz[i] * buffer->dz[i]);
+        tile->max_rate = MAX(tile->max_rate, rate);
+
+        buffer->magnitude[i] = star->magnitude;
+        buffer->table_index[i] = table_index;
+        buffer->xh[i] = buffer->yh[i] = buffer->zh[i] = 0.0;
+    }
+
+    arena_release(arena, mark);
+
+    return true;
+}
+
+// Tiles are stored in order, so binary search for the last one starting at or
+// before buffer index i
+static int tile_containing(const struct StarBuffer *buffer, int i)
+{
+    int low = 0;
+    int high = NUM_STAR_TILES - 1;
+    while (low < high)
+    {
+        int mid = low + (high - low + 1) / 2;
+        if (buffer->tiles[mid].begin <= i)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid - 1;
+        }
+    }
+    return low;
+}
+
+bool pin_constellation_stars(struct Arena *arena, struct StarBuffer *buffer,
+                             const struct ConstellTable *constell_table)
+{
+    int count = 2 * (int)constell_table->offsets[constell_table->num_constells];
+
+    int *pinned = arena_alloc(arena, 2 * (size_t)count * sizeof(int));
+    size_t mark = arena->used;
+    int *buffer_index = arena_alloc(arena, (size_t)buffer->num_stars * sizeof(int));
+    if (pinned == NULL || buffer_index == NULL)
+    {
+        printf("Allocation of memory for pinned stars failed\n");
+        return false;
+    }
+
+    int *tile_of_index = pinned + count;
+    for (int i = 0; i < buffer->num_stars; ++i)
+    {
+        buffer_index[buffer->table_index[i]] = i;
+    }
+
+    int k = 0;
+    for (int j = 0; j < count; ++j)
+    {
+        int table_index = constell_table->ends[j];
+        if (table_index < 0 || table_index >= buffer->num_stars)
+        {
+            continue;
+        }
+        pinned[k++] = buffer_index[table_index];
+    }
+
+    for (int p = 0; p < k; ++p)
+    {
+        tile_of_index[p] = tile_containing(buffer, pinned[p]);
+    }
+
+    arena_release(arena, mark);
+    buffer->pinned = pinned;
+    buffer->pinned_tiles = tile_of_index;
+    buffer->num_pinned = k;
+
+    return true;
+}
+
+int set_star_buffer_threshold(struct StarBuffer *buffer, float threshold)
+{
+    int num_dim = 0;
+
+    for (int t = 0; t < NUM_STAR_TILES; ++t)
+    {
+        struct StarTile *tile = &buffer->tiles[t];
+
+        // Magnitudes are non-increasing, find the first one <= threshold
+        int low = tile->begin;
+        int high = tile->end;
+        while (low < high)
+        {
+            int mid = low + (high - low) / 2;
+            if (buffer->magnitude[mid] > threshold)
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+
+        tile->first_visible = low;
+        num_dim += low - tile->begin;
+
+        // Newly visible stars of culled tiles have not been marked
+        tile->marked = false;
+    }
+
+    return num_dim;
+}
+
+/* Per-frame state shared by every tile
+ */
+struct StarFrame
+{
+    struct StarBuffer *buffer;
+    struct Star *star_table;
+    double years_from_epoch;
+    double m[3][3];
+};
+
+static void init_frame(struct StarFrame *frame, struct StarBuffer *buffer, double julian_date, double latitude,
+                       double longitude)
+{
+    const double J2000 = 2451545.0;
+    const double days_per_year = 365.2425;
+
+    *frame = (struct StarFrame){
+        .buffer = buffer,
+        .years_from_epoch = (julian_date - J2000) / days_per_year,
+    };
+    equatorial_to_horizontal_matrix(greenwich_mean_sidereal_time_rad(julian_date), latitude, longitude, frame->m);
+}
+
+/* Flag tiles that are entirely below the horizon and list the others that have
+ * visible stars
+ */
+static void cull_tiles(const struct StarFrame *frame)
+{
+    struct StarBuffer *buffer = frame->buffer;
+
+    // The last row of the rotation is the zenith in equatorial coordinates
+    const double *zenith = frame->m[2];
+
+    buffer->num_active = 0;
+    for (int t = 0; t < NUM_STAR_TILES; ++t)
+    {
+        struct StarTile *tile = &buffer->tiles[t];
+
+        // Stars may have drifted out of the tile since J2000
+        double radius = tile->radius + tile->max_rate * fabs(frame->years_from_epoch);
+        double cos_zenith = tile->center[0] * zenith[0] + tile->center[1] * zenith[1] + tile->center[2] * zenith[2];
+
+        // Every star is more than 90° from the zenith when the angle between
+        // the center and the zenith exceeds 90° plus the radius
+        tile->culled = radius < M_PI / 2 && cos_zenith < -sin(radius);
+
+        if (!tile->culled && tile->first_visible < tile->end)
+        {
+            buffer->active_tiles[buffer->num_active++] = t;
+        }
+    }
+}
+
+/* Give visible stars of newly culled tiles an altitude below the horizon so
+ * stale positions are never drawn. Tiles rarely change state, so this costs
+ * nothing on most frames
+ */
+static void mark_culled_tiles(struct StarBuffer *buffer, struct Star *star_table)
+{
+    for (int t = 0; t < NUM_STAR_TILES; ++t)
+    {
+        struct StarTile *tile = &buffer->tiles[t];
+
+        if (!tile->culled)
+        {
+            tile->marked = false;
+            continue;
+        }
+        if (tile->marked)
+        {
+            continue;
+        }
+
+        for (int i = tile->first_visible; i < tile->end; ++i)
+        {
+            star_table[buffer->table_index[i]].base.altitude = -M_PI / 2;
+        }
+        tile->marked = true;
+    }
+}
+
+/* Transform stars [begin, end). The SIMD loop covers whole groups of
+ * SIMD_LANES stars from `begin`, so results are reproducible as long as the
+ * same ranges are always used
+ */
+static void transform_stars(const struct StarFrame *frame, int begin, int end)
+{
+    struct StarBuffer *buffer = frame->buffer;
+    const double(*m)[3] = frame->m;
+    const double years_from_epoch = frame->years_from_epoch;
+
+    int i = begin;
+
+#if SIMD_LANES > 1
+    const vf64 t = v_set1(years_from_epoch);
+    const vf64 m00 = v_set1(m[0][0]), m01 = v_set1(m[0][1]), m02 = v_set1(m[0][2]);
+    const vf64 m10 = v_set1(m[1][0]), m11 = v_set1(m[1][1]), m12 = v_set1(m[1][2]);
+    const vf64 m20 = v_set1(m[2][0]), m21 = v_set1(m[2][1]), m22 = v_set1(m[2][2]);
+
+    for (; i + SIMD_LANES <= end; i += SIMD_LANES)
+    {
+        // Apply proper motion
+        vf64 x = v_add(v_load(&buffer->x[i]), v_mul(v_load(&buffer->dx[i]), t));
+        vf64 y = v_add(v_load(&buffer->y[i]), v_mul(v_load(&buffer->dy[i]), t));
+        vf64 z = v_add(v_load(&buffer->z[i]), v_mul(v_load(&buffer->dz[i]), t));
+
+        v_store(&buffer->xh[i], v_add(v_add(v_mul(m00, x), v_mul(m01, y)), v_mul(m02, z)));
+        v_store(&buffer->yh[i], v_add(v_add(v_mul(m10, x), v_mul(m11, y)), v_mul(m12, z)));
+        v_store(&buffer->zh[i], v_add(v_add(v_mul(m20, x), v_mul(m21, y)), v_mul(m22, z)));
+    }
+#endif
+
+    // Remainder (or everything, without SIMD)
+    for (; i < end; ++i)
+    {
+        double x = buffer->x[i] + buffer->dx[i] * years_from_epoch;
+        double y = buffer->y[i] + buffer->dy[i] * years_from_epoch;
+        double z = buffer->z[i] + buffer->dz[i] * years_from_epoch;
+
+        buffer->xh[i] = m[0][0] * x + m[0][1] * y + m[0][2] * z;
+        buffer->yh[i] = m[1][0] * x + m[1][1] * y + m[1][2] * z;
+        buffer->zh[i] = m[2][0] * x + m[2][1] * y + m[2][2] * z;
+    }
+}
+
+static void convert_stars(const struct StarBuffer *buffer, struct Star *star_table, int begin, int end)
+{
+    for (int i = begin; i < end; ++i)
+    {
+        struct Star *star = &star_table[buffer->table_index[i]];
+        horizontal_rectangular_to_spherical(buffer->xh[i], buffer->yh[i], buffer->zh[i], &star->base.azimuth,
+                                            &star->base.altitude);
+    }
+}
+
+// Pinned stars of active tiles are updated along with their tile
+static void transform_pinned(const struct StarFrame *frame)
+{
+    const struct StarBuffer *buffer = frame->buffer;
+    for (int p = 0; p < buffer->num_pinned; ++p)
+    {
+        if (buffer->tiles[buffer->pinned_tiles[p]].culled)
+        {
+            transform_stars(frame, buffer->pinned[p], buffer->pinned[p] + 1);
+        }
+    }
+}
+
+static void convert_pinned(const struct StarBuffer *buffer, struct Star *star_table)
+{
+    for (int p = 0; p < buffer->num_pinned; ++p)
+    {
+        if (buffer->tiles[buffer->pinned_tiles[p]].culled)
+        {
+            convert_stars(buffer, star_table, buffer->pinned[p], buffer->pinned[p] + 1);
+        }
+    }
+}
+
+void update_star_buffer(struct StarBuffer *buffer, double julian_date, double latitude, double longitude)
+{
+    struct StarFrame frame;
+    init_frame(&frame, buffer, julian_date, latitude, longitude);
+    cull_tiles(&frame);
+
+    for (int a = 0; a < buffer->num_active; ++a)
+    {
+        const struct StarTile *tile = &buffer->tiles[buffer->active_tiles[a]];
+        transform_stars(&frame, tile->first_visible, tile->end);
+    }
+    transform_pinned(&frame);
+}
+
+void star_buffer_to_table(struct StarBuffer *buffer, struct Star *star_table)
+{
+    mark_culled_tiles(buffer, star_table);
+
+    for (int a = 0; a < buffer->num_active; ++a)
+    {
+        const struct StarTile *tile = &buffer->tiles[buffer->active_tiles[a]];
+        convert_stars(buffer, star_table, tile->first_visible, tile->end);
+    }
+    convert_pinned(buffer, star_table);
+}
+
+static void star_tiles_task(void *context, int begin, int end)
+{
+    const struct StarFrame *frame = context;
+    const struct StarBuffer *buffer = frame->buffer;
+
+    // Whole tiles, so stars are grouped exactly as in the single-threaded path
+    for (int a = begin; a < end; ++a)
+    {
+        const struct StarTile *tile = &buffer->tiles[buffer->active_tiles[a]];
+        transform_stars(frame, tile->first_visible, tile->end);
+        convert_stars(buffer, frame->star_table, tile->first_visible, tile->end);
+    }
+}
+
+void update_stars_parallel(struct Pool *pool, struct StarBuffer *buffer, struct Star *star_table, double julian_date,
+                           double latitude, double longitude)
+{
+    struct StarFrame frame;
+    init_frame(&frame, buffer, julian_date, latitude, longitude);
+    frame.star_table = star_table;
+
+    cull_tiles(&frame);
+    mark_culled_tiles(buffer, star_table);
+
+    pool_run(pool, star_tiles_task, &frame, buffer->num_active, 1);
+
+    transform_pinned(&frame);
+    convert_pinned(buffer, star_table);
+}
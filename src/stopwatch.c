@@ -78,7 +78,7 @@ int sw_gettime(struct SwTimestamp *stamp)
     return 0;
 }
 
-int sw_timediff_usec(struct SwTimestamp end, struct SwTimestamp begin, unsigned long long *diff)
+int sw_timediff_nsec(struct SwTimestamp end, struct SwTimestamp begin, unsigned long long *diff)
 {
     *diff = 0;
 
@@ -98,7 +98,10 @@ int sw_timediff_usec(struct SwTimestamp end, struct SwTimestamp begin, unsigned
         {
             return -1; // QueryPerformanceFrequency failed
         }
-        *diff = (unsigned long long)(end.val.tick_win.QuadPart - begin.val.tick_win.QuadPart) * 1000000ULL / frequency.QuadPart;
+        // Split into whole seconds and remainder so long intervals don't overflow
+        unsigned long long ticks = (unsigned long long)(end.val.tick_win.QuadPart - begin.val.tick_win.QuadPart);
+        unsigned long long freq = (unsigned long long)frequency.QuadPart;
+        *diff = ticks / freq * 1000000000ULL + ticks % freq * 1000000000ULL / freq;
 #else
         return -1; // Unsupported on this platform
 #endif
@@ -107,7 +110,7 @@ int sw_timediff_usec(struct SwTimestamp end, struct SwTimestamp begin, unsigned
 
     case TICK_APPLE: {
 #if defined(__APPLE__) && defined(__MACH__)
-        *diff = (end.val.tick_apple - begin.val.tick_apple) / 1000ULL; // ns to us
+        *diff = end.val.tick_apple - begin.val.tick_apple;
 #else
         return -1; // Unsupported on this platform
 #endif
@@ -125,7 +128,7 @@ int sw_timediff_usec(struct SwTimestamp end, struct SwTimestamp begin, unsigned
             nsec_diff += 1000000000L; // Adjust for nanosecond underflow
         }
 
-        *diff = (unsigned long long)sec_diff * 1000000ULL + (unsigned long long)nsec_diff / 1000ULL;
+        *diff = (unsigned long long)sec_diff * 1000000000ULL + (unsigned long long)nsec_diff;
 #else
         return -1; // Unsupported on this platform
 #endif
@@ -134,8 +137,8 @@ int sw_timediff_usec(struct SwTimestamp end, struct SwTimestamp begin, unsigned
 
     case TICK_VAL: {
 #if defined(__unix__)
-        *diff = (unsigned long long)(end.val.tick_val.tv_sec - begin.val.tick_val.tv_sec) * 1000000ULL;
-        *diff += (unsigned long long)(end.val.tick_val.tv_usec - begin.val.tick_val.tv_usec);
+        *diff = (unsigned long long)(end.val.tick_val.tv_sec - begin.val.tick_val.tv_sec) * 1000000000ULL;
+        *diff += (unsigned long long)(end.val.tick_val.tv_usec - begin.val.tick_val.tv_usec) * 1000ULL;
 #else
         return -1; // Unsupported on this platform
 #endif
@@ -149,6 +152,13 @@ int sw_timediff_usec(struct SwTimestamp end, struct SwTimestamp begin, unsigned
     return 0;
 }
 
+int sw_timediff_usec(struct SwTimestamp end, struct SwTimestamp begin, unsigned long long *diff)
+{
+    int check = sw_timediff_nsec(end, begin, diff);
+    *diff /= 1000ULL;
+    return check;
+}
+
 int sw_sleep(unsigned long long microseconds)
 {
 #if defined(_WIN32)
@@ -1,13 +1,17 @@
 #include "term.h"
 
+#include "macros.h"
+#include "stopwatch.h"
+
 #include <curses.h>
 #include <math.h>
+#include <signal.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #ifdef _WIN32
-#include <stdio.h>
 #include <windows.h>
 #else
 #include <sys/ioctl.h>
@@ -174,6 +178,118 @@ float get_cell_aspect_ratio(void)
     return default_height;
 }
 
+bool output_counters(unsigned long long *bytes, unsigned long long *writes)
+{
+#ifdef __linux__
+    // Characters passed to write calls and the number of calls
+    FILE *stream = fopen("/proc/self/io", "r");
+    if (stream == NULL)
+    {
+        return false;
+    }
+
+    bool found_bytes = false;
+    bool found_writes = false;
+    char line[64];
+    while (fgets(line, sizeof(line), stream) != NULL)
+    {
+        found_bytes = found_bytes || sscanf(line, "wchar: %llu", bytes) == 1;
+        found_writes = found_writes || sscanf(line, "syscw: %llu", writes) == 1;
+    }
+    fclose(stream);
+
+    return found_bytes && found_writes;
+#else
+    (void)bytes;
+    (void)writes;
+    return false;
+#endif // __linux__
+}
+
+unsigned long long paced_frame_usec(unsigned long long dt, double frame_bytes, double bytes_per_sec)
+{
+    if (bytes_per_sec <= 0.0)
+    {
+        return dt;
+    }
+
+    double usec = frame_bytes / bytes_per_sec * 1.0E6;
+    return usec > (double)dt ? (unsigned long long)usec : dt;
+}
+
+// Longest wait for input before checking for resizes (ms)
+#define INPUT_POLL_MS 250
+
+// Set when the terminal is resized, until curses is resized to it
+static volatile bool resize_pending = false;
+#ifdef _WIN32
+// Console size on windows, where resizes are polled for
+static COORD winsize;
+#endif
+
+#ifndef _WIN32
+static void catch_winch(int sig)
+{
+    (void)sig;
+    resize_pending = true;
+}
+#endif
+
+void catch_term_resizes(void)
+{
+#ifndef _WIN32
+    signal(SIGWINCH, catch_winch);
+#endif
+}
+
+bool term_resized(void)
+{
+#ifdef _WIN32
+    resize_pending = check_console_window_resize_event(&winsize) || resize_pending;
+#endif
+    return resize_pending;
+}
+
+void resize_ncurses(void)
+{
+    resize_pending = false;
+
+    // Resize ncurses internal terminal
+#ifdef _WIN32
+    resize_term(winsize.Y, winsize.X);
+#else
+    int y;
+    int x;
+    term_size(&y, &x);
+    resize_term(y, x);
+#endif
+}
+
+void wait_for_input(unsigned long long usec)
+{
+    // Waits are short so that resizes are caught. A key pressed is left for
+    // the next frame to read
+    struct SwTimestamp begin;
+    sw_gettime(&begin);
+
+    for (unsigned long long waited = 0; waited < usec && !term_resized();)
+    {
+        int ms = (int)MIN((usec - waited + 999) / 1000, INPUT_POLL_MS);
+        timeout(ms);
+        int ch = getch();
+        timeout(0);
+        if (ch != ERR)
+        {
+            ungetch(ch);
+            return;
+        }
+
+        struct SwTimestamp now;
+        sw_gettime(&now);
+        sw_timediff_usec(now, begin, &waited);
+    }
+}
+
 #define MAX_STR_LEN 2048
 void mvwaddstr_truncate(WINDOW *win, int y, int x, const char *str)
 {
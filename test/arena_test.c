@@ -0,0 +1,89 @@
+#include "arena.h"
+#include "unity.c"
+#include "src/arena.c"
+
+#include <stdint.h>
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_arena_alloc_aligned(void)
+{
+    struct Arena arena;
+    TEST_ASSERT_TRUE(arena_create(&arena, 3 * ARENA_SIZE(10)));
+
+    char *a = arena_alloc(&arena, 10);
+    char *b = arena_alloc(&arena, 1);
+    char *c = arena_alloc(&arena, ARENA_ALIGNMENT);
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_NOT_NULL(b);
+    TEST_ASSERT_NOT_NULL(c);
+    TEST_ASSERT_EQUAL(0, (uintptr_t)a % ARENA_ALIGNMENT);
+    TEST_ASSERT_EQUAL(ARENA_ALIGNMENT, b - a);
+    TEST_ASSERT_EQUAL(ARENA_ALIGNMENT, c - b);
+
+    // Every allocation is counted, as asked for
+    TEST_ASSERT_EQUAL(3, arena.num_allocs);
+    TEST_ASSERT_EQUAL(10 + 1 + ARENA_ALIGNMENT, arena.num_bytes);
+    TEST_ASSERT_EQUAL(arena.capacity, arena.used);
+
+    arena_destroy(&arena);
+    TEST_ASSERT_NULL(arena.base);
+}
+
+void test_arena_full(void)
+{
+    struct Arena arena;
+    TEST_ASSERT_TRUE(arena_create(&arena, 100));
+    TEST_ASSERT_EQUAL(ARENA_SIZE(100), arena.capacity);
+
+    TEST_ASSERT_NOT_NULL(arena_alloc(&arena, arena.capacity - 1));
+    TEST_ASSERT_NULL(arena_alloc(&arena, 1));
+    TEST_ASSERT_NULL(arena_alloc(&arena, SIZE_MAX));
+
+    // Empty allocations always fit
+    TEST_ASSERT_NOT_NULL(arena_alloc(&arena, 0));
+    TEST_ASSERT_EQUAL(2, arena.num_allocs);
+
+    arena_destroy(&arena);
+}
+
+void test_arena_release(void)
+{
+    struct Arena arena;
+    TEST_ASSERT_TRUE(arena_create(&arena, 2 * ARENA_ALIGNMENT));
+
+    char *kept = arena_alloc(&arena, 1);
+    size_t mark = arena.used;
+    char *scratch = arena_alloc(&arena, ARENA_ALIGNMENT);
+    TEST_ASSERT_NULL(arena_alloc(&arena, 1));
+
+    // Released memory is handed out again
+    arena_release(&arena, mark);
+    TEST_ASSERT_EQUAL(mark, arena.used);
+    TEST_ASSERT_EQUAL_PTR(scratch, arena_alloc(&arena, 1));
+    TEST_ASSERT_TRUE(kept < scratch);
+
+    // Releasing to a later mark does nothing
+    arena_release(&arena, arena.capacity);
+    TEST_ASSERT_EQUAL(arena.capacity, arena.used);
+    TEST_ASSERT_EQUAL(3, arena.num_allocs);
+
+    arena_destroy(&arena);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_arena_alloc_aligned);
+    RUN_TEST(test_arena_full);
+    RUN_TEST(test_arena_release);
+
+    return UNITY_END();
+}
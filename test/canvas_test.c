@@ -0,0 +1,201 @@
+#include "canvas.h"
+#include "src/canvas.c"
+#include "src/stopwatch.c"
+#include "src/term.c"
+#include "unity.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Write a canvas to a string. The caller frees the result
+static char *canvas_to_string(const struct Canvas *canvas, bool color)
+{
+    char *buffer = NULL;
+    size_t size = 0;
+    FILE *stream = open_memstream(&buffer, &size);
+    TEST_ASSERT_NOT_NULL(stream);
+
+    TEST_ASSERT_TRUE(write_canvas(canvas, stream, color));
+    fclose(stream);
+
+    return buffer;
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_create_cell_canvas(void)
+{
+    struct Canvas canvas;
+    TEST_ASSERT_TRUE(create_cell_canvas(&canvas, 2, 3));
+
+    int height, width;
+    canvas_size(&canvas, &height, &width);
+    TEST_ASSERT_EQUAL_INT(2, height);
+    TEST_ASSERT_EQUAL_INT(3, width);
+
+    char *text = canvas_to_string(&canvas, false);
+    TEST_ASSERT_EQUAL_STRING("   \n   \n", text);
+    free(text);
+
+    free_canvas(&canvas);
+}
+
+void test_canvas_clipping(void)
+{
+    struct Canvas canvas;
+    TEST_ASSERT_TRUE(create_cell_canvas(&canvas, 2, 4));
+
+    // Drawing off the canvas is dropped instead of wrapping
+    canvas_add_ch(&canvas, -1, 0, 'a');
+    canvas_add_ch(&canvas, 0, -1, 'b');
+    canvas_add_ch(&canvas, 2, 0, 'c');
+    canvas_add_ch(&canvas, 0, 4, 'd');
+    canvas_add_str(&canvas, 0, 2, "efg");
+    canvas_add_str_truncate(&canvas, 1, -1, "hij");
+
+    TEST_ASSERT_NULL(canvas_cell(&canvas, 2, 0));
+    TEST_ASSERT_NULL(canvas_cell(&canvas, 0, -1));
+
+    char *text = canvas_to_string(&canvas, false);
+    TEST_ASSERT_EQUAL_STRING("  ef\nij  \n", text);
+    free(text);
+
+    // Runs are clipped to the row
+    canvas_add_run(&canvas, 1, 3, 4, "─");
+    canvas_add_run(&canvas, 0, -2, 3, "•");
+    canvas_add_run(&canvas, 2, 0, 4, "x");
+
+    text = canvas_to_string(&canvas, false);
+    TEST_ASSERT_EQUAL_STRING("• ef\nij ─\n", text);
+    free(text);
+
+    free_canvas(&canvas);
+}
+
+void test_canvas_utf8(void)
+{
+    struct Canvas canvas;
+    TEST_ASSERT_TRUE(create_cell_canvas(&canvas, 1, 8));
+
+    // Box drawing takes one column, emoji take two and variation selectors none
+    canvas_add_str(&canvas, 0, 0, "─●");
+    canvas_add_str(&canvas, 0, 2, "🪐");
+    canvas_add_str(&canvas, 0, 4, "☀️x");
+
+    TEST_ASSERT_EQUAL_UINT32(0x2500, canvas_cell(&canvas, 0, 0)->codepoint);
+    TEST_ASSERT_EQUAL_UINT32(0x25CF, canvas_cell(&canvas, 0, 1)->codepoint);
+    TEST_ASSERT_EQUAL_UINT32(0x1FA90, canvas_cell(&canvas, 0, 2)->codepoint);
+    TEST_ASSERT_EQUAL_UINT32(CELL_CONTINUATION, canvas_cell(&canvas, 0, 3)->codepoint);
+    TEST_ASSERT_EQUAL_UINT32(0x2600, canvas_cell(&canvas, 0, 4)->codepoint);
+    TEST_ASSERT_EQUAL_UINT32('x', canvas_cell(&canvas, 0, 5)->codepoint);
+
+    // Variation selectors are kept with the character before them
+    TEST_ASSERT_EQUAL_UINT32(0xFE0F, canvas_cell(&canvas, 0, 4)->variation);
+    TEST_ASSERT_EQUAL_UINT32(0, canvas_cell(&canvas, 0, 2)->variation);
+
+    // Continuation cells are not written, so the line keeps its width
+    char *text = canvas_to_string(&canvas, false);
+    TEST_ASSERT_EQUAL_STRING("─●🪐☀x  \n", text);
+    free(text);
+
+    free_canvas(&canvas);
+}
+
+void test_canvas_invalid_utf8(void)
+{
+    struct Canvas canvas;
+    TEST_ASSERT_TRUE(create_cell_canvas(&canvas, 1, 3));
+
+    canvas_add_str(&canvas, 0, 0, "\xff\xe2(");
+
+    TEST_ASSERT_EQUAL_UINT32(0xFFFD, canvas_cell(&canvas, 0, 0)->codepoint);
+    TEST_ASSERT_EQUAL_UINT32(0xFFFD, canvas_cell(&canvas, 0, 1)->codepoint);
+    TEST_ASSERT_EQUAL_UINT32('(', canvas_cell(&canvas, 0, 2)->codepoint);
+
+    free_canvas(&canvas);
+}
+
+void test_canvas_color(void)
+{
+    struct Canvas canvas;
+    TEST_ASSERT_TRUE(create_cell_canvas(&canvas, 1, 4));
+
+    canvas_add_ch(&canvas, 0, 0, 'a');
+    canvas_color_on(&canvas, 2);
+    canvas_add_str(&canvas, 0, 1, "bc");
+    canvas_color_off(&canvas, 2);
+    canvas_add_ch(&canvas, 0, 3, 'd');
+
+    TEST_ASSERT_EQUAL_INT(0, canvas_cell(&canvas, 0, 0)->color_pair);
+    TEST_ASSERT_EQUAL_INT(2, canvas_cell(&canvas, 0, 1)->color_pair);
+    TEST_ASSERT_EQUAL_INT(2, canvas_cell(&canvas, 0, 2)->color_pair);
+    TEST_ASSERT_EQUAL_INT(0, canvas_cell(&canvas, 0, 3)->color_pair);
+
+    char *text = canvas_to_string(&canvas, true);
+    TEST_ASSERT_EQUAL_STRING("a\x1b[31mbc\x1b[0md\n", text);
+    free(text);
+
+    // Erasing also clears colors
+    canvas_erase(&canvas);
+    TEST_ASSERT_EQUAL_INT(0, canvas_cell(&canvas, 0, 1)->color_pair);
+    TEST_ASSERT_EQUAL_UINT32(' ', canvas_cell(&canvas, 0, 1)->codepoint);
+
+    free_canvas(&canvas);
+}
+
+void test_present_canvas(void)
+{
+    struct Canvas canvas, shown;
+    TEST_ASSERT_TRUE(create_cell_canvas(&canvas, 2, 4));
+    TEST_ASSERT_TRUE(create_cell_canvas(&shown, 2, 4));
+
+    // A blank frame matches a blank window
+    TEST_ASSERT_EQUAL_INT(0, present_canvas(&canvas, &shown, NULL));
+
+    canvas_add_str(&canvas, 0, 0, "ab");
+    canvas_add_str(&canvas, 1, 1, "🪐");
+    TEST_ASSERT_EQUAL_INT(4, present_canvas(&canvas, &shown, NULL));
+    TEST_ASSERT_EQUAL_UINT32(CELL_CONTINUATION, canvas_cell(&shown, 1, 2)->codepoint);
+
+    // Redrawing the same frame changes nothing, while a new color, character
+    // or variation does
+    canvas_erase(&canvas);
+    canvas_add_str(&canvas, 0, 0, "ab");
+    canvas_add_str(&canvas, 1, 1, "🪐");
+    TEST_ASSERT_EQUAL_INT(0, present_canvas(&canvas, &shown, NULL));
+
+    canvas_color_on(&canvas, 3);
+    canvas_add_ch(&canvas, 0, 0, 'a');
+    canvas_color_off(&canvas, 3);
+    canvas_add_ch(&canvas, 0, 1, 'c');
+    canvas_add_str(&canvas, 1, 1, "🪐\xef\xb8\x8e");
+    TEST_ASSERT_EQUAL_INT(3, present_canvas(&canvas, &shown, NULL));
+
+    // Clearing moves everything back
+    canvas_erase(&canvas);
+    TEST_ASSERT_EQUAL_INT(4, present_canvas(&canvas, &shown, NULL));
+
+    free_canvas(&canvas);
+    free_canvas(&shown);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_create_cell_canvas);
+    RUN_TEST(test_canvas_clipping);
+    RUN_TEST(test_canvas_utf8);
+    RUN_TEST(test_canvas_invalid_utf8);
+    RUN_TEST(test_canvas_color);
+    RUN_TEST(test_present_canvas);
+
+    return UNITY_END();
+}
@@ -1,6 +1,9 @@
 #include "src/city.c"
+#include "src/city_hash.c"
 #include "unity.c"
 
+#include <string.h>
+
 void setUp(void)
 {
 }
@@ -12,12 +15,11 @@ void tearDown(void)
 void test_get_city(void)
 {
     // Test for a city that exists
-    CityData *city = get_city("Tunis");
+    const CityData *city = get_city("Tunis");
     TEST_ASSERT_NOT_NULL(city);
     TEST_ASSERT_EQUAL_STRING("Tunis", city->city_name);
     TEST_ASSERT_EQUAL_FLOAT(36.81897, city->latitude);
     TEST_ASSERT_EQUAL_FLOAT(10.16579, city->longitude);
-    free_city(city);
 
     // Test for another city that exists
     city = get_city("Boston");
@@ -25,7 +27,6 @@ void test_get_city(void)
     TEST_ASSERT_EQUAL_STRING("Boston", city->city_name);
     TEST_ASSERT_EQUAL_FLOAT(42.35843, city->latitude);
     TEST_ASSERT_EQUAL_FLOAT(-71.05977, city->longitude);
-    free_city(city);
 
     // Test for a city that does not exist
     city = get_city("NonexistentCity");
@@ -36,11 +37,64 @@ void test_get_city(void)
     TEST_ASSERT_NULL(city);
 }
 
+void test_get_city_normalization(void)
+{
+    // Case and surrounding whitespace are ignored
+    const CityData *city = get_city("  bOSTON\t");
+    TEST_ASSERT_NOT_NULL(city);
+    TEST_ASSERT_EQUAL_STRING("Boston", city->city_name);
+
+    // Non-ASCII characters must match exactly
+    city = get_city("a coruña");
+    TEST_ASSERT_NOT_NULL(city);
+    TEST_ASSERT_EQUAL_STRING("A Coruña", city->city_name);
+
+    // Names containing commas are quoted in the CSV
+    city = get_city("Mianzhu, Deyang, Sichuan");
+    TEST_ASSERT_NOT_NULL(city);
+    TEST_ASSERT_EQUAL_FLOAT(31.33786, city->latitude);
+
+    // Prefixes, the CSV header and overlong names are not cities
+    TEST_ASSERT_NULL(get_city("Bost"));
+    TEST_ASSERT_NULL(get_city("city_name"));
+    TEST_ASSERT_NULL(get_city(""));
+
+    char long_name[2 * MAX_CITY_NAME];
+    memset(long_name, 'a', sizeof(long_name) - 1);
+    long_name[sizeof(long_name) - 1] = '\0';
+    TEST_ASSERT_NULL(get_city(long_name));
+}
+
+void test_get_city_duplicates(void)
+{
+    // The most populous of cities sharing a name
+    const CityData *city = get_city("Barcelona");
+    TEST_ASSERT_NOT_NULL(city);
+    TEST_ASSERT_EQUAL_FLOAT(41.38879, city->latitude);
+    TEST_ASSERT_EQUAL_FLOAT(2.15899, city->longitude);
+
+    city = get_city("Birmingham");
+    TEST_ASSERT_NOT_NULL(city);
+    TEST_ASSERT_EQUAL_FLOAT(52.48142, city->latitude);
+}
+
+void test_city_index(void)
+{
+    // Every city in the table is found in its own slot
+    for (int i = 0; i < CITY_INDEX_SLOTS; ++i)
+    {
+        TEST_ASSERT_EQUAL_PTR(&city_slots[i], get_city(city_slots[i].city_name));
+    }
+}
+
 int main(void)
 {
     UNITY_BEGIN();
 
     RUN_TEST(test_get_city);
+    RUN_TEST(test_get_city_normalization);
+    RUN_TEST(test_get_city_duplicates);
+    RUN_TEST(test_city_index);
 
     return UNITY_END();
 }
@@ -45,6 +45,38 @@ void test_project_stereographic_top(void)
     TEST_ASSERT_FLOAT_WITHIN(0.01, expected_theta_polar, theta_polar);
 }
 
+// equatorial_to_horizontal_matrix
+
+void test_equatorial_to_horizontal_matrix(void)
+{
+    const double gmst = 1.234;
+    const double latitude = 42.3601 * M_PI / 180;
+    const double longitude = -71.0589 * M_PI / 180;
+
+    double m[3][3];
+    equatorial_to_horizontal_matrix(gmst, latitude, longitude, m);
+
+    for (double ra = 0.05; ra < 2 * M_PI; ra += 0.5)
+    {
+        for (double dec = -1.5; dec < 1.5; dec += 0.25)
+        {
+            double expected_az, expected_alt;
+            equatorial_to_horizontal(ra, dec, gmst, latitude, longitude, &expected_az, &expected_alt);
+
+            double x, y, z;
+            equatorial_spherical_to_rectangular(ra, dec, &x, &y, &z);
+
+            double az, alt;
+            horizontal_rectangular_to_spherical(m[0][0] * x + m[0][1] * y + m[0][2] * z,
+                                                m[1][0] * x + m[1][1] * y + m[1][2] * z,
+                                                m[2][0] * x + m[2][1] * y + m[2][2] * z, &az, &alt);
+
+            TEST_ASSERT_FLOAT_WITHIN(1E-9, expected_az, az);
+            TEST_ASSERT_FLOAT_WITHIN(1E-9, expected_alt, alt);
+        }
+    }
+}
+
 // polar_to_win
 
 void test_polar_to_win(void)
@@ -67,12 +99,88 @@ void test_polar_to_win(void)
     TEST_ASSERT_EQUAL_INT(50, col);
 }
 
+// project_horizontal_to_win
+
+void test_project_horizontal_to_win(void)
+{
+    // Directions over the sky land in the same cell as through the polar
+    // projection, for window sizes of either parity. Values within rounding
+    // error of a cell boundary may go either way
+    const int sizes[][2] = {{40, 80}, {41, 81}, {24, 79}, {97, 201}};
+    int num_compared = 0;
+
+    for (int s = 0; s < 4; ++s)
+    {
+        int height = sizes[s][0];
+        int width = sizes[s][1];
+
+        struct StereoProjection projection;
+        init_stereo_projection(&projection, height, width);
+
+        for (double azimuth = 0.0; azimuth < 2 * M_PI; azimuth += 0.0173)
+        {
+            for (double altitude = -0.2; altitude <= M_PI / 2; altitude += 0.0131)
+            {
+                double xh, yh, zh;
+                horizontal_spherical_to_rectangular(azimuth, altitude, &xh, &yh, &zh);
+
+                int row, col;
+                bool inside = project_horizontal_to_win(&projection, xh, yh, zh, &row, &col);
+
+                double theta_sphere, phi_sphere, radius, theta;
+                horizontal_to_spherical(azimuth, altitude, &theta_sphere, &phi_sphere);
+                project_stereographic_north(1.0, theta_sphere, phi_sphere, &radius, &theta);
+                TEST_ASSERT_EQUAL(radius <= 1.0, inside);
+                if (!inside)
+                {
+                    continue;
+                }
+
+                int expected_row, expected_col;
+                polar_to_win(radius, theta, height, width, &expected_row, &expected_col);
+
+                double row_d = radius * -projection.rad_y * sin(theta) + projection.rad_y;
+                double col_d = radius * projection.rad_x * cos(theta) + projection.rad_x;
+                if (fabs(fabs(row_d - floor(row_d)) - 0.5) > 1E-9)
+                {
+                    TEST_ASSERT_EQUAL_INT(expected_row, row);
+                }
+                if (fabs(fabs(col_d - floor(col_d)) - 0.5) > 1E-9)
+                {
+                    TEST_ASSERT_EQUAL_INT(expected_col, col);
+                }
+                ++num_compared;
+            }
+        }
+    }
+
+    TEST_ASSERT_GREATER_THAN_INT(10000, num_compared);
+
+    // Zenith at the center, the northern horizon at the top and the eastern
+    // horizon at the left
+    struct StereoProjection projection;
+    init_stereo_projection(&projection, 101, 201);
+    int row, col;
+    TEST_ASSERT_TRUE(project_horizontal_to_win(&projection, 0.0, 0.0, 1.0, &row, &col));
+    TEST_ASSERT_EQUAL_INT(50, row);
+    TEST_ASSERT_EQUAL_INT(100, col);
+    TEST_ASSERT_TRUE(project_horizontal_to_win(&projection, 0.0, 1.0, 0.0, &row, &col));
+    TEST_ASSERT_EQUAL_INT(0, row);
+    TEST_ASSERT_EQUAL_INT(100, col);
+    TEST_ASSERT_TRUE(project_horizontal_to_win(&projection, 1.0, 0.0, 0.0, &row, &col));
+    TEST_ASSERT_EQUAL_INT(50, row);
+    TEST_ASSERT_EQUAL_INT(0, col);
+    TEST_ASSERT_FALSE(project_horizontal_to_win(&projection, 0.0, 0.0, -1.0, &row, &col));
+}
+
 int main(void)
 {
     UNITY_BEGIN();
 
     RUN_TEST(test_project_stereographic_top);
+    RUN_TEST(test_equatorial_to_horizontal_matrix);
     RUN_TEST(test_polar_to_win);
+    RUN_TEST(test_project_horizontal_to_win);
 
     return UNITY_END();
 }
@@ -6,11 +6,14 @@
 #include "bsc5.h"
 #include "bsc5_constellations.h"
 #include "bsc5_names.h"
+#include "bsc5_tables.h"
+#include "src/arena.c"
 #include "src/astro.c"
 #include "src/bit.c"
 #include "src/coord.c"
 #include "src/core.c"
 #include "src/core_position.c"
+#include "src/ephemeris.c"
 #include "src/parse_BSC5.c"
 #include "src/strptime.c"
 #include "data/keplerian_elements.c"
@@ -21,34 +24,36 @@
 #include <string.h>
 
 // Initialize data structs
-static unsigned int num_stars, num_const;
+static unsigned int num_stars;
 
-static struct Entry *BSC5_entries;
+static struct Catalog catalog;
+static struct Arena arena;
 static struct StarName *name_table;
 static struct Star *star_table;
-struct Constell *constell_table;
+struct ConstellTable constell_table;
 static int *num_by_mag;
 struct Planet *planet_table;
 struct Moon moon_object;
 
 void setUp(void)
 {
-    parse_entries(bsc5, bsc5_len, &BSC5_entries, &num_stars);
-    generate_name_table(bsc5_names, bsc5_names_len, &name_table, num_stars);
-    generate_star_table(&star_table, BSC5_entries, name_table, num_stars);
-    star_numbers_by_magnitude(&num_by_mag, star_table, num_stars);
-    generate_constell_table(bsc5_constellations, bsc5_constellations_len, &constell_table, &num_const);
-    generate_planet_table(&planet_table, planet_elements, planet_rates, planet_extras);
+    open_catalog(&catalog, bsc5, bsc5_len);
+    arena_create(&arena, name_table_arena_size(bsc5_names_len, catalog.num_entries) +
+                             constell_table_arena_size(bsc5_constellations, bsc5_constellations_len) +
+                             star_tables_arena_size(catalog.num_entries) + star_sort_arena_size(catalog.num_entries));
+    generate_name_table(&arena, bsc5_names, bsc5_names_len, &name_table, catalog.num_entries);
+    num_stars = catalog.num_entries;
+    generate_star_table(&arena, &star_table, num_stars, &catalog, name_table, INFINITY);
+    star_numbers_by_magnitude(&arena, &num_by_mag, star_table, num_stars);
+    generate_constell_table(&arena, bsc5_constellations, bsc5_constellations_len, &constell_table);
+    generate_planet_table(&arena, &planet_table, planet_elements, planet_rates, planet_extras);
     generate_moon_object(&moon_object, &moon_elements, &moon_rates);
 }
 
 void tearDown(void)
 {
-    free_constells(constell_table, num_const);
-    free_stars(star_table, num_stars);
-    free_planets(planet_table, NUM_PLANETS);
     free_moon_object(moon_object);
-    free_star_names(name_table, num_stars);
+    arena_destroy(&arena);
 }
 
 // Tolerance for positions in radians. Planets are slightly less accurate. The moon is even less inaccurate.
@@ -107,6 +112,120 @@ void test_generate_star_table(void)
     TEST_ASSERT_FLOAT_WITHIN(S_EPSILON, 5.8, star_table[last_index].magnitude);
 }
 
+void test_generate_star_table_filtered(void)
+{
+    struct Arena bright_arena;
+    struct Star *bright_table;
+    unsigned int num_bright = count_catalog_stars(&catalog, 3.0f);
+    TEST_ASSERT_TRUE(arena_create(&bright_arena, star_tables_arena_size(num_bright)));
+    TEST_ASSERT_TRUE(generate_star_table(&bright_arena, &bright_table, num_bright, &catalog, NULL, 3.0f));
+
+    // Same stars in the same order, renumbered by position
+    unsigned int n = 0;
+    for (unsigned int i = 0; i < num_stars; ++i)
+    {
+        if (star_table[i].magnitude > 3.0f)
+        {
+            continue;
+        }
+
+        TEST_ASSERT_TRUE(n < num_bright);
+        TEST_ASSERT_EQUAL((int)n + 1, bright_table[n].catalog_number);
+        TEST_ASSERT_EQUAL_DOUBLE(star_table[i].right_ascension, bright_table[n].right_ascension);
+        TEST_ASSERT_EQUAL_DOUBLE(star_table[i].declination, bright_table[n].declination);
+        TEST_ASSERT_NULL(bright_table[n].base.label);
+        n++;
+    }
+    TEST_ASSERT_EQUAL(n, num_bright);
+
+    arena_destroy(&bright_arena);
+}
+
+// Store little endian values for building catalogs by hand
+static uint8_t *put_int32(uint8_t *p, int32_t value)
+{
+    uint32_t bits = (uint32_t)value;
+    for (int i = 0; i < 4; ++i)
+    {
+        *p++ = (uint8_t)(bits >> (8 * i));
+    }
+    return p;
+}
+
+static uint8_t *put_double(uint8_t *p, double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 8; ++i)
+    {
+        *p++ = (uint8_t)(bits >> (8 * i));
+    }
+    return p;
+}
+
+void test_map_catalog(void)
+{
+    // Three stars without catalog numbers or proper motion, two magnitudes
+    uint8_t data[28 + 3 * 22];
+    uint8_t *p = data;
+    int32_t header[7] = {0, 1, -3, 0, 0, 2, 22};
+    for (int i = 0; i < 7; ++i)
+    {
+        p = put_int32(p, header[i]);
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        p = put_double(p, 0.5 * i);
+        p = put_double(p, -0.25 * i);
+        *p++ = 'G';
+        *p++ = '2';
+        p[0] = (uint8_t)(100 * i);
+        p[1] = 0;
+        p[2] = p[3] = 0xFF; // Second magnitude is ignored
+        p += 4;
+    }
+
+    char path[] = "test_catalog.bin";
+    FILE *file = fopen(path, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    fwrite(data, 1, sizeof(data), file);
+    fclose(file);
+
+    struct Catalog mapped;
+    TEST_ASSERT_TRUE(map_catalog(&mapped, path));
+    TEST_ASSERT_EQUAL(3, mapped.num_entries);
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        struct Entry entry = catalog_entry(&mapped, i);
+        TEST_ASSERT_EQUAL_FLOAT((float)(i + 1), entry.XNO);
+        TEST_ASSERT_EQUAL_DOUBLE(0.5 * i, entry.SRA0);
+        TEST_ASSERT_EQUAL_DOUBLE(-0.25 * i, entry.SDEC0);
+        TEST_ASSERT_EQUAL_FLOAT(100.0f * i, entry.MAG);
+        TEST_ASSERT_EQUAL_DOUBLE(0.0, entry.XRPM);
+    }
+
+    struct Arena table_arena;
+    struct Star *table;
+    unsigned int num = count_catalog_stars(&mapped, 1.5f);
+    TEST_ASSERT_EQUAL(2, num);
+    TEST_ASSERT_TRUE(arena_create(&table_arena, star_tables_arena_size(num)));
+    TEST_ASSERT_TRUE(generate_star_table(&table_arena, &table, num, &mapped, NULL, 1.5f));
+    arena_destroy(&table_arena);
+
+    close_catalog(&mapped);
+
+    // Entry size that does not match the header
+    put_int32(&data[24], 32);
+    TEST_ASSERT_FALSE(open_catalog(&mapped, data, sizeof(data)));
+
+    // Truncated
+    put_int32(&data[24], 22);
+    TEST_ASSERT_FALSE(open_catalog(&mapped, data, sizeof(data) - 1));
+
+    remove(path);
+}
+
 void test_generate_name_table(void)
 {
     // Trim carriage returns so passed on windows
@@ -121,15 +240,50 @@ void test_generate_constell_table(void)
 {
     // As seen in bsc5_constellations.txt
     // FIXME: if the order of constellations in the text file changes, this will break.
-    TEST_ASSERT_NOT_NULL(constell_table);
+    TEST_ASSERT_EQUAL(88, constell_table.num_constells);
 
     // Aql constellation
-    TEST_ASSERT_EQUAL_INT(8, constell_table[0].num_segments);
+    TEST_ASSERT_EQUAL_INT(0, constell_table.offsets[0]);
+    TEST_ASSERT_EQUAL_INT(8, constell_table.offsets[1]);
+
+    // CVn constellation, by star table index
+    TEST_ASSERT_EQUAL_INT(1, constell_table.offsets[20] - constell_table.offsets[19]);
+    int expected_ends[] = {4784, 4914};
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected_ends, &constell_table.ends[2 * constell_table.offsets[19]], 2);
 
-    // CVn constellation
-    TEST_ASSERT_EQUAL_INT(1, constell_table[19].num_segments);
-    int expected_star_numbers[] = {4785, 4915};
-    TEST_ASSERT_EQUAL_INT_ARRAY(expected_star_numbers, constell_table[19].star_numbers, 2);
+    // Every figure is drawn until a threshold is set
+    for (unsigned int c = 0; c < constell_table.num_constells; ++c)
+    {
+        TEST_ASSERT_TRUE(constell_table.drawn[c]);
+    }
+}
+
+void test_set_constell_threshold(void)
+{
+    set_constell_threshold(&constell_table, star_table, num_stars, 5.0f);
+
+    int num_drawn = 0;
+    for (unsigned int c = 0; c < constell_table.num_constells; ++c)
+    {
+        bool all_visible = true;
+        for (unsigned int i = 2 * constell_table.offsets[c]; i < 2 * constell_table.offsets[c + 1]; ++i)
+        {
+            all_visible = all_visible && star_table[constell_table.ends[i]].magnitude <= 5.0f;
+        }
+        TEST_ASSERT_EQUAL(all_visible, constell_table.drawn[c]);
+        num_drawn += constell_table.drawn[c];
+    }
+    TEST_ASSERT_TRUE(0 < num_drawn && num_drawn < 88);
+
+    // Figures with stars missing from the table are never drawn
+    set_constell_threshold(&constell_table, star_table, 100, INFINITY);
+    TEST_ASSERT_FALSE(constell_table.drawn[19]);
+
+    set_constell_threshold(&constell_table, star_table, num_stars, INFINITY);
+    for (unsigned int c = 0; c < constell_table.num_constells; ++c)
+    {
+        TEST_ASSERT_TRUE(constell_table.drawn[c]);
+    }
 }
 
 void test_star_numbers_by_magnitude(void)
@@ -148,8 +302,80 @@ void test_star_numbers_by_magnitude(void)
     TEST_ASSERT_EQUAL(2491, num_by_mag[last_index]);
     TEST_ASSERT_EQUAL(2326, num_by_mag[last_index - 1]);
     TEST_ASSERT_EQUAL(5340, num_by_mag[last_index - 2]);
+}
+
+void test_table_allocations(void)
+{
+    // Each table is one allocation whatever the number of stars, names and
+    // figures: two for names, one for stars, two for the magnitude order
+    // (including the sort keys), three for constellations and one for planets
+    TEST_ASSERT_EQUAL(9, arena.num_allocs);
+
+    // The arena was sized exactly, less the sort keys that were given back
+    TEST_ASSERT_EQUAL(arena.capacity, arena.used + ARENA_SIZE(num_stars * sizeof(struct StarKey)));
+    TEST_ASSERT_TRUE(arena.num_bytes <= arena.capacity);
+
+    // Keeping fewer stars takes less space but as many allocations
+    struct Arena bright_arena;
+    struct Star *bright_table;
+    struct Planet *bright_planets;
+    int *bright_by_mag;
+    unsigned int num_bright = count_catalog_stars(&catalog, 3.0f);
+    TEST_ASSERT_TRUE(
+        arena_create(&bright_arena, star_tables_arena_size(num_bright) + star_sort_arena_size(num_bright)));
+    TEST_ASSERT_TRUE(generate_star_table(&bright_arena, &bright_table, num_bright, &catalog, NULL, 3.0f));
+    TEST_ASSERT_TRUE(star_numbers_by_magnitude(&bright_arena, &bright_by_mag, bright_table, num_bright));
+    TEST_ASSERT_TRUE(generate_planet_table(&bright_arena, &bright_planets, planet_elements, planet_rates, planet_extras));
+    TEST_ASSERT_EQUAL(4, bright_arena.num_allocs);
+    TEST_ASSERT_EQUAL(num_bright * (sizeof(struct Star) + sizeof(int) + sizeof(struct StarKey)) +
+                          NUM_PLANETS * sizeof(struct Planet),
+                      bright_arena.num_bytes);
+
+    // An arena that is too small fails instead of growing
+    TEST_ASSERT_FALSE(star_numbers_by_magnitude(&bright_arena, &bright_by_mag, bright_table, num_bright));
+
+    arena_destroy(&bright_arena);
+}
+
+void test_generated_tables(void)
+{
+    // The tables generated at build time are what startup used to build
+    TEST_ASSERT_EQUAL(num_stars, BSC5_NUM_STARS);
+    TEST_ASSERT_EQUAL(constell_table.num_constells, BSC5_NUM_CONSTELLS);
+    TEST_ASSERT_EQUAL(constell_table.offsets[BSC5_NUM_CONSTELLS], BSC5_NUM_CONSTELL_SEGMENTS);
+
+    struct Arena copy_arena;
+    struct Star *copy;
+    TEST_ASSERT_TRUE(arena_create(&copy_arena, star_tables_arena_size(BSC5_NUM_STARS)));
+    TEST_ASSERT_TRUE(copy_star_table(&copy_arena, &copy, bsc5_stars, BSC5_NUM_STARS));
+    for (unsigned int i = 0; i < num_stars; ++i)
+    {
+        const struct Star *expected = &star_table[i];
+        const struct Star *star = &copy[i];
+
+        TEST_ASSERT_EQUAL(expected->catalog_number, star->catalog_number);
+        TEST_ASSERT_EQUAL_DOUBLE(expected->right_ascension, star->right_ascension);
+        TEST_ASSERT_EQUAL_DOUBLE(expected->declination, star->declination);
+        TEST_ASSERT_EQUAL_DOUBLE(expected->ra_motion, star->ra_motion);
+        TEST_ASSERT_EQUAL_DOUBLE(expected->dec_motion, star->dec_motion);
+        TEST_ASSERT_EQUAL_FLOAT(expected->magnitude, star->magnitude);
+        TEST_ASSERT_EQUAL_CHAR(expected->base.symbol_ASCII, star->base.symbol_ASCII);
+        TEST_ASSERT_EQUAL_STRING(expected->base.symbol_unicode, star->base.symbol_unicode);
+        if (expected->base.label == NULL)
+        {
+            TEST_ASSERT_NULL(star->base.label);
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL_STRING(expected->base.label, star->base.label);
+        }
+    }
+    arena_destroy(&copy_arena);
+
+    TEST_ASSERT_EQUAL_INT_ARRAY(num_by_mag, bsc5_num_by_mag, num_stars);
 
-    free(num_by_mag);
+    TEST_ASSERT_EQUAL_UINT_ARRAY(constell_table.offsets, bsc5_constell_offsets, BSC5_NUM_CONSTELLS + 1);
+    TEST_ASSERT_EQUAL_INT_ARRAY(constell_table.ends, bsc5_constell_ends, 2 * BSC5_NUM_CONSTELL_SEGMENTS);
 }
 
 void test_update_star_positions(void)
@@ -270,9 +496,14 @@ int main(void)
     UNITY_BEGIN();
 
     RUN_TEST(test_generate_star_table);
+    RUN_TEST(test_generate_star_table_filtered);
+    RUN_TEST(test_map_catalog);
     RUN_TEST(test_generate_name_table);
     RUN_TEST(test_generate_constell_table);
+    RUN_TEST(test_set_constell_threshold);
     RUN_TEST(test_star_numbers_by_magnitude);
+    RUN_TEST(test_table_allocations);
+    RUN_TEST(test_generated_tables);
     RUN_TEST(test_update_star_positions);
     RUN_TEST(test_update_planet_positions);
     RUN_TEST(test_update_moon_position);
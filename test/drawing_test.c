@@ -1,5 +1,8 @@
 #include "src/bit.c"
+#include "src/canvas.c"
 #include "src/drawing.c"
+#include "src/stopwatch.c"
+#include "src/term.c"
 #include "unity.c"
 
 #include <curses.h>
@@ -49,6 +52,23 @@ int compare_arrays(const char array1[MAX_WINDOW_HEIGHT][MAX_WINDOW_WIDTH],
     return 1;
 }
 
+// Draw a line on a canvas the size of a window and present it to the window
+void draw_to_window(WINDOW *win, void (*draw)(struct Canvas *, int, int, int, int), int ya, int xa, int yb, int xb)
+{
+    int height, width;
+    getmaxyx(win, height, width);
+
+    struct Canvas canvas, shown;
+    TEST_ASSERT_TRUE(create_cell_canvas(&canvas, height, width));
+    TEST_ASSERT_TRUE(create_cell_canvas(&shown, height, width));
+
+    draw(&canvas, ya, xa, yb, xb);
+    present_canvas(&canvas, &shown, win);
+
+    free_canvas(&canvas);
+    free_canvas(&shown);
+}
+
 // -----------------------------------------------------------------------------
 // ASCII Diagonal
 // -----------------------------------------------------------------------------
@@ -74,7 +94,7 @@ void test_diagonal_ascii_10x10(void)
     char actual[MAX_WINDOW_HEIGHT][MAX_WINDOW_WIDTH];
 
     // Draw the line
-    draw_line_ASCII(win, 0, 0, 9, 9);
+    draw_to_window(win, draw_line_ASCII, 0, 0, 9, 9);
 
     // Read window content into an array
     read_window_to_array(win, actual, 10, 10);
@@ -112,7 +132,7 @@ void test_diagonal_ascii_opposite_10x10(void)
     char actual[MAX_WINDOW_HEIGHT][MAX_WINDOW_WIDTH];
 
     // Draw the line (opposite diagonal)
-    draw_line_ASCII(win, 9, 0, 0, 9);
+    draw_to_window(win, draw_line_ASCII, 9, 0, 0, 9);
 
     // Read window content into an ASCII array
     read_window_to_array(win, actual, 10, 10);
@@ -151,7 +171,7 @@ void test_vertical_ascii_11x11(void)
     char actual[MAX_WINDOW_HEIGHT][MAX_WINDOW_WIDTH];
 
     // Draw the line
-    draw_line_ASCII(win, 0, 5, 10, 5);
+    draw_to_window(win, draw_line_ASCII, 0, 5, 10, 5);
 
     // Read window content into an ASCII array
     read_window_to_array(win, actual, 11, 11);
@@ -190,7 +210,7 @@ void test_horizontal_ascii_11x11(void)
     char actual[MAX_WINDOW_HEIGHT][MAX_WINDOW_WIDTH];
 
     // Draw the line
-    draw_line_ASCII(win, 5, 0, 5, 10);
+    draw_to_window(win, draw_line_ASCII, 5, 0, 5, 10);
 
     // Read window content into an ASCII array
     read_window_to_array(win, actual, 11, 11);
@@ -261,7 +281,7 @@ void test_diagonal_smooth_10x10(void)
     wchar_t actual[MAX_WINDOW_HEIGHT][MAX_WINDOW_WIDTH];
 
     // Draw the line
-    draw_line_smooth(win, 0, 0, 9, 9);
+    draw_to_window(win, draw_line_smooth, 0, 0, 9, 9);
 
     // Read window content into a wide-character array
     read_window_to_wide_array(win, actual, 10, 10);
@@ -299,7 +319,7 @@ void test_diagonal_smooth_opposite_10x10(void)
     wchar_t actual[MAX_WINDOW_HEIGHT][MAX_WINDOW_WIDTH];
 
     // Draw the line (opposite diagonal)
-    draw_line_smooth(win, 9, 0, 0, 9);
+    draw_to_window(win, draw_line_smooth, 9, 0, 0, 9);
 
     // Read window content into a wide-character array
     read_window_to_wide_array(win, actual, 10, 10);
@@ -338,7 +358,7 @@ void test_vertical_smooth_11x11(void)
     wchar_t actual[MAX_WINDOW_HEIGHT][MAX_WINDOW_WIDTH];
 
     // Draw the line
-    draw_line_smooth(win, 0, 5, 10, 5);
+    draw_to_window(win, draw_line_smooth, 0, 5, 10, 5);
 
     // Read window content into a wide-character array
     read_window_to_wide_array(win, actual, 11, 11);
@@ -377,7 +397,7 @@ void test_horizontal_smooth_11x11(void)
     wchar_t actual[MAX_WINDOW_HEIGHT][MAX_WINDOW_WIDTH];
 
     // Draw the line
-    draw_line_smooth(win, 5, 0, 5, 10);
+    draw_to_window(win, draw_line_smooth, 5, 0, 5, 10);
 
     // Read window content into a wide-character array
     read_window_to_wide_array(win, actual, 11, 11);
@@ -390,6 +410,118 @@ void test_horizontal_smooth_11x11(void)
     delwin(win);
 }
 
+// -----------------------------------------------------------------------------
+// In-memory Canvas
+// -----------------------------------------------------------------------------
+
+// Draw a line on an in-memory canvas and read it back into a wide-character array
+void draw_cells_to_wide_array(void (*draw)(struct Canvas *, int, int, int, int), int ya, int xa, int yb, int xb,
+                              wchar_t array[MAX_WINDOW_HEIGHT][MAX_WINDOW_WIDTH], int height, int width)
+{
+    struct Canvas canvas;
+    TEST_ASSERT_TRUE(create_cell_canvas(&canvas, height, width));
+
+    draw(&canvas, ya, xa, yb, xb);
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            array[y][x] = (wchar_t)canvas_cell(&canvas, y, x)->codepoint;
+        }
+        array[y][width] = L'\0';
+    }
+
+    free_canvas(&canvas);
+}
+
+void test_ascii_lines_cells(void)
+{
+    // Lines drawn in memory match the ones drawn by ncurses
+    const struct
+    {
+        int ya, xa, yb, xb, size;
+        const char (*expected)[MAX_WINDOW_WIDTH];
+    } cases[] = {
+        {0, 0, 9, 9, 10, diagonal_ascii_10x10},
+        {9, 0, 0, 9, 10, diagonal_ascii_opposite_10x10},
+        {0, 5, 10, 5, 11, vertical_ascii_11x11},
+        {5, 0, 5, 10, 11, horizontal_ascii_11x11},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i)
+    {
+        wchar_t actual[MAX_WINDOW_HEIGHT][MAX_WINDOW_WIDTH];
+        draw_cells_to_wide_array(draw_line_ASCII, cases[i].ya, cases[i].xa, cases[i].yb, cases[i].xb, actual,
+                                 cases[i].size, cases[i].size);
+
+        for (int y = 0; y < cases[i].size; y++)
+        {
+            for (int x = 0; x < cases[i].size; x++)
+            {
+                TEST_ASSERT_EQUAL_INT(cases[i].expected[y][x], actual[y][x]);
+            }
+        }
+    }
+}
+
+void test_smooth_lines_cells(void)
+{
+    const struct
+    {
+        int ya, xa, yb, xb, size;
+        const wchar_t (*expected)[MAX_WINDOW_WIDTH];
+    } cases[] = {
+        {0, 0, 9, 9, 10, diagonal_smooth_10x10},
+        {9, 0, 0, 9, 10, diagonal_smooth_opposite_10x10},
+        {0, 5, 10, 5, 11, vertical_smooth_11x11},
+        {5, 0, 5, 10, 11, horizontal_smooth_11x11},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i)
+    {
+        wchar_t actual[MAX_WINDOW_HEIGHT][MAX_WINDOW_WIDTH];
+        draw_cells_to_wide_array(draw_line_smooth, cases[i].ya, cases[i].xa, cases[i].yb, cases[i].xb, actual,
+                                 cases[i].size, cases[i].size);
+
+        const wchar_t(*const_actual)[MAX_WINDOW_WIDTH] = (const wchar_t(*)[MAX_WINDOW_WIDTH])actual;
+        TEST_ASSERT_TRUE(compare_wide_arrays(const_actual, cases[i].expected, cases[i].size, cases[i].size));
+    }
+}
+
+void test_clipped_lines_cells(void)
+{
+    // Lines running off the canvas are clipped to the cells drawn on a larger
+    // one, including the steps of shallow ASCII lines skipped before the edge
+    void (*draws[])(struct Canvas *, int, int, int, int) = {draw_line_ASCII, draw_line_smooth, draw_line_dotted};
+    const int lines[][4] = {
+        {-5, -7, 14, 12}, {12, -3, -4, 8}, {3, -9, 6, 15}, {-2, 4, 13, 5}, {7, 11, 1, -6}, {-3, -3, -3, 5},
+    };
+    const int margin = 10;
+    const int size = 10;
+
+    for (size_t i = 0; i < sizeof(draws) / sizeof(draws[0]); ++i)
+    {
+        for (size_t j = 0; j < sizeof(lines) / sizeof(lines[0]); ++j)
+        {
+            const int *line = lines[j];
+            wchar_t clipped[MAX_WINDOW_HEIGHT][MAX_WINDOW_WIDTH];
+            wchar_t whole[MAX_WINDOW_HEIGHT][MAX_WINDOW_WIDTH];
+            draw_cells_to_wide_array(draws[i], line[0], line[1], line[2], line[3], clipped, size, size);
+            draw_cells_to_wide_array(draws[i], line[0] + margin, line[1] + margin, line[2] + margin,
+                                     line[3] + margin, whole, size + 2 * margin, size + 2 * margin);
+
+            for (int y = 0; y < size; y++)
+            {
+                for (int x = 0; x < size; x++)
+                {
+                    TEST_ASSERT_EQUAL_INT(whole[y + margin][x + margin], clipped[y][x]);
+                }
+            }
+        }
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Unity
 // -----------------------------------------------------------------------------
@@ -444,5 +576,9 @@ int main(void)
     RUN_TEST(test_vertical_smooth_11x11);
     RUN_TEST(test_horizontal_smooth_11x11);
 
+    RUN_TEST(test_ascii_lines_cells);
+    RUN_TEST(test_smooth_lines_cells);
+    RUN_TEST(test_clipped_lines_cells);
+
     return UNITY_END();
 }
@@ -0,0 +1,157 @@
+/* Check the Chebyshev ephemeris cache against the Keplerian model it is fitted
+ * to
+ */
+
+#define UNITY_INCLUDE_DOUBLE
+#include "ephemeris.h"
+#include "src/arena.c"
+#include "src/astro.c"
+#include "src/bit.c"
+#include "src/coord.c"
+#include "src/core.c"
+#include "src/core_position.c"
+#include "src/ephemeris.c"
+#include "src/parse_BSC5.c"
+#include "data/keplerian_elements.c"
+#include "unity.c"
+
+#include <math.h>
+
+// Fitting error relative to the distance of the body. The Keplerian model
+// itself is only good to about an arcminute
+#define FIT_EPSILON 1E-6
+
+static struct Arena arena;
+static struct Planet *planet_table;
+static struct Moon moon_object;
+static struct Ephemeris ephemeris;
+
+void setUp(void)
+{
+    arena_create(&arena, ARENA_SIZE(NUM_PLANETS * sizeof(struct Planet)));
+    generate_planet_table(&arena, &planet_table, planet_elements, planet_rates, planet_extras);
+    generate_moon_object(&moon_object, &moon_elements, &moon_rates);
+    init_ephemeris(&ephemeris);
+}
+
+void tearDown(void)
+{
+    arena_destroy(&arena);
+    free_moon_object(moon_object);
+}
+
+static double relative_error(const double exact[3], const double approx[3])
+{
+    double dx = exact[0] - approx[0];
+    double dy = exact[1] - approx[1];
+    double dz = exact[2] - approx[2];
+    double norm = sqrt(exact[0] * exact[0] + exact[1] * exact[1] + exact[2] * exact[2]);
+    return sqrt(dx * dx + dy * dy + dz * dz) / norm;
+}
+
+void test_ephemeris_accuracy(void)
+{
+    // Two queries per date so every window is fitted. Covers dates before
+    // J2000, where window indices are negative
+    for (double julian_date = 2415020.0; julian_date < 2488070.0; julian_date += 7.3)
+    {
+        for (int i = SUN; i < NUM_PLANETS; ++i)
+        {
+            if (i == EARTH)
+            {
+                continue;
+            }
+
+            struct Body body = {.planet_table = planet_table, .planet = i};
+            double exact[3], approx[3];
+            body_geo(&body, julian_date, &exact[0], &exact[1], &exact[2]);
+            ephemeris_planet_geo(&ephemeris, planet_table, i, julian_date, &approx[0], &approx[1], &approx[2]);
+            ephemeris_planet_geo(&ephemeris, planet_table, i, julian_date, &approx[0], &approx[1], &approx[2]);
+
+            TEST_ASSERT_TRUE(ephemeris.bodies[i].fitted);
+            TEST_ASSERT_DOUBLE_WITHIN(FIT_EPSILON, 0.0, relative_error(exact, approx));
+        }
+
+        double exact[3], approx[3];
+        calc_moon_geo_ICRF(&moon_elements, &moon_rates, julian_date, &exact[0], &exact[1], &exact[2]);
+        ephemeris_moon_geo(&ephemeris, &moon_object, julian_date, &approx[0], &approx[1], &approx[2]);
+        ephemeris_moon_geo(&ephemeris, &moon_object, julian_date, &approx[0], &approx[1], &approx[2]);
+
+        TEST_ASSERT_DOUBLE_WITHIN(FIT_EPSILON, 0.0, relative_error(exact, approx));
+    }
+}
+
+void test_ephemeris_fits_lazily(void)
+{
+    double julian_date = 2459146.0;
+    double exact[3], approx[3];
+    calc_moon_geo_ICRF(&moon_elements, &moon_rates, julian_date, &exact[0], &exact[1], &exact[2]);
+
+    // The first query in a window is computed directly
+    ephemeris_moon_geo(&ephemeris, &moon_object, julian_date, &approx[0], &approx[1], &approx[2]);
+    TEST_ASSERT_FALSE(ephemeris.bodies[EPHEMERIS_MOON].fitted);
+    TEST_ASSERT_EQUAL_DOUBLE(exact[0], approx[0]);
+
+    // The second fits the window
+    ephemeris_moon_geo(&ephemeris, &moon_object, julian_date + 0.01, &approx[0], &approx[1], &approx[2]);
+    TEST_ASSERT_TRUE(ephemeris.bodies[EPHEMERIS_MOON].fitted);
+    long index = ephemeris.bodies[EPHEMERIS_MOON].index;
+
+    // Time moving faster than a window per query never refits
+    for (int i = 1; i <= 100; ++i)
+    {
+        ephemeris_moon_geo(&ephemeris, &moon_object, julian_date + i * 3 * EPHEMERIS_MOON_DAYS, &approx[0], &approx[1],
+                           &approx[2]);
+        TEST_ASSERT_EQUAL(index, ephemeris.bodies[EPHEMERIS_MOON].index);
+    }
+}
+
+void test_update_positions_cached(void)
+{
+    // Boston, MA in radians
+    double latitude = 42.3601 * M_PI / 180;
+    double longitude = -71.0589 * M_PI / 180;
+
+    struct Planet *cached_table;
+    struct Arena cached_arena;
+    arena_create(&cached_arena, ARENA_SIZE(NUM_PLANETS * sizeof(struct Planet)));
+    generate_planet_table(&cached_arena, &cached_table, planet_elements, planet_rates, planet_extras);
+    struct Moon cached_moon = moon_object;
+
+    // Frames a minute apart, crossing several windows
+    for (int frame = 0; frame < 200000; frame += 97)
+    {
+        double julian_date = 2459146.0 + frame / 1440.0;
+
+        update_planet_positions(planet_table, julian_date, latitude, longitude);
+        update_planet_positions_cached(&ephemeris, cached_table, julian_date, latitude, longitude);
+        for (int i = SUN; i < NUM_PLANETS; ++i)
+        {
+            if (i == EARTH)
+            {
+                continue;
+            }
+            TEST_ASSERT_DOUBLE_WITHIN(FIT_EPSILON, planet_table[i].base.altitude, cached_table[i].base.altitude);
+            TEST_ASSERT_DOUBLE_WITHIN(FIT_EPSILON, 0.0,
+                                      sin(planet_table[i].base.azimuth - cached_table[i].base.azimuth));
+        }
+
+        update_moon_position(&moon_object, julian_date, latitude, longitude);
+        update_moon_position_cached(&ephemeris, &cached_moon, julian_date, latitude, longitude);
+        TEST_ASSERT_DOUBLE_WITHIN(FIT_EPSILON, moon_object.base.altitude, cached_moon.base.altitude);
+        TEST_ASSERT_DOUBLE_WITHIN(FIT_EPSILON, 0.0, sin(moon_object.base.azimuth - cached_moon.base.azimuth));
+    }
+
+    arena_destroy(&cached_arena);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_ephemeris_accuracy);
+    RUN_TEST(test_ephemeris_fits_lazily);
+    RUN_TEST(test_update_positions_cached);
+
+    return UNITY_END();
+}
@@ -0,0 +1,326 @@
+/* Check rise, set and transit times against altitudes sampled minute by minute
+ */
+
+#define UNITY_INCLUDE_DOUBLE
+#include "events.h"
+#include "src/arena.c"
+#include "src/astro.c"
+#include "src/bit.c"
+#include "src/coord.c"
+#include "src/core.c"
+#include "src/core_position.c"
+#include "src/ephemeris.c"
+#include "src/events.c"
+#include "src/export.c"
+#include "src/parse_BSC5.c"
+#include "src/pool.c"
+#include "data/keplerian_elements.c"
+#include "unity.c"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_STARS 12
+#define MAX_TEST_EVENTS 64
+
+// Boston, MA in radians
+static const double latitude = 42.3601 * M_PI / 180;
+static const double longitude = -71.0589 * M_PI / 180;
+
+// 2024-03-20T00:00:00Z, around the equinox
+static const double start = 2460389.5;
+
+static struct Star star_table[NUM_STARS];
+static struct Arena arena;
+static struct Planet *planet_table;
+static struct Moon moon_object;
+
+void setUp(void)
+{
+    arena_create(&arena, ARENA_SIZE(NUM_PLANETS * sizeof(struct Planet)));
+    generate_planet_table(&arena, &planet_table, planet_elements, planet_rates, planet_extras);
+    generate_moon_object(&moon_object, &moon_elements, &moon_rates);
+
+    // Declinations from near the south pole to near the north pole, with a
+    // pair either side of the limit of circumpolar stars
+    for (int i = 0; i < NUM_STARS; ++i)
+    {
+        star_table[i] = (struct Star){
+            .catalog_number = i + 1,
+            .right_ascension = i * 0.55,
+            .declination = -1.4 + 2.8 * i / (NUM_STARS - 1),
+            .ra_motion = 1E-6,
+            .dec_motion = -1E-6,
+        };
+    }
+    star_table[NUM_STARS - 2].declination = M_PI / 2 - latitude - 1E-4;
+    star_table[NUM_STARS - 1].declination = M_PI / 2 - latitude + 1E-4;
+}
+
+void tearDown(void)
+{
+    arena_destroy(&arena);
+    free_moon_object(moon_object);
+}
+
+static double star_altitude(const struct Star *star, double julian_date)
+{
+    double right_ascension, declination, azimuth, altitude;
+    calc_star_position(star->right_ascension, star->ra_motion, star->declination, star->dec_motion, julian_date,
+                       &right_ascension, &declination);
+    equatorial_to_horizontal(right_ascension, declination, greenwich_mean_sidereal_time_rad(julian_date), latitude,
+                             longitude, &azimuth, &altitude);
+    return altitude;
+}
+
+void test_star_events(void)
+{
+    const double minute = 1.0 / (24.0 * 60.0);
+    const double end = start + 3.0;
+
+    for (int i = 0; i < NUM_STARS; ++i)
+    {
+        const struct Star *star = &star_table[i];
+        struct SkyEvent events[MAX_TEST_EVENTS];
+        int num_events = find_star_events(star, start, end, latitude, longitude, events, MAX_TEST_EVENTS);
+        TEST_ASSERT_LESS_OR_EQUAL_INT(max_events_between(start, end), num_events);
+
+        // Every crossing of the horizon between samples is found, in order
+        int e = 0;
+        double previous = star_altitude(star, start);
+        for (double t = start + minute; t <= end; t += minute)
+        {
+            double altitude = star_altitude(star, t);
+            if ((previous < 0.0) != (altitude < 0.0))
+            {
+                while (e < num_events && events[e].type == EVENT_TRANSIT)
+                {
+                    ++e;
+                }
+                TEST_ASSERT_LESS_THAN_INT(num_events, e);
+                TEST_ASSERT_EQUAL_INT(altitude < 0.0 ? EVENT_SET : EVENT_RISE, events[e].type);
+                TEST_ASSERT_DOUBLE_WITHIN(minute, t - minute / 2, events[e].julian_date);
+                TEST_ASSERT_DOUBLE_WITHIN(1E-5, 0.0, events[e].altitude);
+                ++e;
+            }
+            previous = altitude;
+        }
+
+        int num_transits = 0;
+        for (int j = 0; j < num_events; ++j)
+        {
+            if (j > 0)
+            {
+                TEST_ASSERT_TRUE(events[j - 1].julian_date <= events[j].julian_date);
+            }
+            if (events[j].type != EVENT_TRANSIT)
+            {
+                continue;
+            }
+
+            // Stars transit due south of Boston, or north above the pole, at
+            // their highest altitude
+            ++num_transits;
+            double right_ascension, declination;
+            calc_star_position(star->right_ascension, star->ra_motion, star->declination, star->dec_motion,
+                               events[j].julian_date, &right_ascension, &declination);
+            TEST_ASSERT_DOUBLE_WITHIN(1E-6, M_PI / 2 - fabs(latitude - declination), events[j].altitude);
+            double azimuth = declination < latitude ? M_PI : 0.0;
+            TEST_ASSERT_DOUBLE_WITHIN(1E-4, 0.0, remainder(events[j].azimuth - azimuth, 2 * M_PI));
+        }
+        TEST_ASSERT_TRUE(num_transits == 3 || num_transits == 4);
+    }
+}
+
+void test_circumpolar_stars(void)
+{
+    struct SkyEvent events[MAX_TEST_EVENTS];
+
+    // Just north of the limit the star never sets, just south of it the star
+    // sets and rises again close to north once a day
+    int num_events = find_star_events(&star_table[NUM_STARS - 1], start, start + 2.0, latitude, longitude, events,
+                                      MAX_TEST_EVENTS);
+    TEST_ASSERT_NULL(first_event(events, num_events, EVENT_RISE));
+    TEST_ASSERT_NULL(first_event(events, num_events, EVENT_SET));
+    TEST_ASSERT_NOT_NULL(first_event(events, num_events, EVENT_TRANSIT));
+
+    num_events = find_star_events(&star_table[NUM_STARS - 2], start, start + 2.0, latitude, longitude, events,
+                                  MAX_TEST_EVENTS);
+    const struct SkyEvent *set = first_event(events, num_events, EVENT_SET);
+    const struct SkyEvent *rise = first_event(events, num_events, EVENT_RISE);
+    TEST_ASSERT_NOT_NULL(set);
+    TEST_ASSERT_NOT_NULL(rise);
+    TEST_ASSERT_DOUBLE_WITHIN(2.0 * M_PI / 180, 0.0, remainder(set->azimuth, 2 * M_PI));
+    TEST_ASSERT_DOUBLE_WITHIN(2.0 * M_PI / 180, 0.0, remainder(rise->azimuth, 2 * M_PI));
+}
+
+void test_sun_and_moon_events(void)
+{
+    struct SkyEvent events[MAX_TEST_EVENTS];
+    int num_events =
+        find_planet_events(planet_table, SUN, start, start + 1.0, latitude, longitude, events, MAX_TEST_EVENTS);
+
+    // At the equinox the Sun rises due east and sets due west, about twelve
+    // hours later, with noon between
+    const struct SkyEvent *rise = first_event(events, num_events, EVENT_RISE);
+    const struct SkyEvent *transit = first_event(events, num_events, EVENT_TRANSIT);
+    const struct SkyEvent *set = first_event(events, num_events, EVENT_SET);
+    TEST_ASSERT_NOT_NULL(rise);
+    TEST_ASSERT_NOT_NULL(transit);
+    TEST_ASSERT_NOT_NULL(set);
+    TEST_ASSERT_DOUBLE_WITHIN(1.0 * M_PI / 180, M_PI / 2, rise->azimuth);
+    TEST_ASSERT_DOUBLE_WITHIN(1.0 * M_PI / 180, 3 * M_PI / 2, set->azimuth);
+    TEST_ASSERT_DOUBLE_WITHIN(10.0 / (24 * 60), 0.5, set->julian_date - rise->julian_date);
+    TEST_ASSERT_DOUBLE_WITHIN(5.0 / (24 * 60), (rise->julian_date + set->julian_date) / 2, transit->julian_date);
+    TEST_ASSERT_DOUBLE_WITHIN(1.0 * M_PI / 180, M_PI / 2 - latitude, transit->altitude);
+
+    // The Moon transits about 50 minutes later each day
+    num_events = find_moon_events(&moon_object, start, start + 3.0, latitude, longitude, events, MAX_TEST_EVENTS);
+    double transits[3];
+    int num_transits = 0;
+    for (int i = 0; i < num_events; ++i)
+    {
+        if (events[i].type == EVENT_TRANSIT)
+        {
+            TEST_ASSERT_LESS_THAN_INT(3, num_transits);
+            transits[num_transits++] = events[i].julian_date;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(3, num_transits);
+    TEST_ASSERT_DOUBLE_WITHIN(0.02, 1.035, transits[1] - transits[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(0.02, 1.035, transits[2] - transits[1]);
+}
+
+// List events to a temporary file and read it back. The caller frees the
+// contents
+static char *list_to_memory(int num_threads, const int *star_numbers, int num_stars, double end)
+{
+    struct Pool pool;
+    TEST_ASSERT_TRUE(pool_create(&pool, num_threads));
+
+    FILE *stream = tmpfile();
+    TEST_ASSERT_NOT_NULL(stream);
+    TEST_ASSERT_TRUE(list_events(stream, &pool, star_table, star_numbers, num_stars, planet_table, &moon_object, start,
+                                 end, latitude, longitude));
+    pool_destroy(&pool);
+
+    size_t length = (size_t)ftell(stream);
+    rewind(stream);
+    char *contents = malloc(length + 1);
+    TEST_ASSERT_EQUAL_size_t(length, fread(contents, 1, length, stream));
+    contents[length] = '\0';
+    fclose(stream);
+
+    return contents;
+}
+
+void test_list_events(void)
+{
+    // Given out of order, over windows of a week and a partial one
+    int star_numbers[NUM_STARS];
+    for (int i = 0; i < NUM_STARS; ++i)
+    {
+        star_numbers[i] = NUM_STARS - i;
+    }
+    const double end = start + 10.5;
+
+    char *one = list_to_memory(1, star_numbers, NUM_STARS, end);
+    char *many = list_to_memory(3, star_numbers, NUM_STARS, end);
+    TEST_ASSERT_EQUAL_STRING(one, many);
+
+    char *line = strtok(one, "\n");
+    TEST_ASSERT_EQUAL_STRING("time,object,event,azimuth,altitude", line);
+
+    // Rows are in order of time, and each star has the events found over the
+    // whole range at once
+    int star_rows[NUM_STARS + 1] = {0};
+    int sun_rises = 0;
+    char previous[32] = "";
+    while ((line = strtok(NULL, "\n")) != NULL)
+    {
+        char time[32], object[16], type[16];
+        double azimuth, altitude;
+        TEST_ASSERT_EQUAL_INT(5, sscanf(line, "%31[^,],%15[^,],%15[^,],%lf,%lf", time, object, type, &azimuth,
+                                        &altitude));
+        TEST_ASSERT_EQUAL_INT(20, strlen(time));
+        TEST_ASSERT_TRUE(strcmp(previous, time) <= 0);
+        strcpy(previous, time);
+        TEST_ASSERT_TRUE(azimuth >= 0.0 && azimuth < 360.0);
+
+        if (strcmp(object, "Sun") == 0)
+        {
+            sun_rises += strcmp(type, "rise") == 0;
+        }
+        else if (strcmp(object, "Moon") != 0 && atoi(object) > 0)
+        {
+            ++star_rows[atoi(object)];
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(11, sun_rises);
+
+    for (int n = 1; n <= NUM_STARS; ++n)
+    {
+        struct SkyEvent events[MAX_TEST_EVENTS];
+        int num_events =
+            find_star_events(&star_table[n - 1], start, end, latitude, longitude, events, MAX_TEST_EVENTS);
+        TEST_ASSERT_EQUAL_INT(num_events, star_rows[n]);
+    }
+
+    free(one);
+    free(many);
+}
+
+void test_format_utc_time(void)
+{
+    char out[32];
+    *format_utc_time(out, 2460389.5) = '\0';
+    TEST_ASSERT_EQUAL_STRING("2024-03-20T00:00:00Z", out);
+    *format_utc_time(out, 2451544.5 + 59.6 / 86400) = '\0';
+    TEST_ASSERT_EQUAL_STRING("2000-01-01T00:01:00Z", out);
+    *format_utc_time(out, 2440587.5 - 1.0 / 86400) = '\0';
+    TEST_ASSERT_EQUAL_STRING("1969-12-31T23:59:59Z", out);
+    *format_utc_time(out, 2460370.0) = '\0';
+    TEST_ASSERT_EQUAL_STRING("2024-02-29T12:00:00Z", out);
+}
+
+void test_next_events(void)
+{
+    struct NextEvents next = {0};
+    char sun[32], moon[32];
+    describe_next_events(&next, planet_table, &moon_object, start, latitude, longitude, sun, moon, sizeof(sun));
+
+    struct SkyEvent events[MAX_TEST_EVENTS];
+    int num_events =
+        find_planet_events(planet_table, SUN, start, start + 2.0, latitude, longitude, events, MAX_TEST_EVENTS);
+    TEST_ASSERT_EQUAL_DOUBLE(first_event(events, num_events, EVENT_RISE)->julian_date, next.sun_rise);
+    TEST_ASSERT_EQUAL_DOUBLE(first_event(events, num_events, EVENT_SET)->julian_date, next.sun_set);
+    TEST_ASSERT_TRUE(next.expires > start && next.expires <= next.sun_rise);
+    TEST_ASSERT_EQUAL(strlen("rise hh:mm, set hh:mm"), strlen(sun));
+    TEST_ASSERT_EQUAL(strlen("rise hh:mm, set hh:mm"), strlen(moon));
+
+    // Events are kept until the first of them passes or time runs backwards
+    double found_at = next.found_at;
+    describe_next_events(&next, planet_table, &moon_object, next.expires - 1E-3, latitude, longitude, sun, moon,
+                         sizeof(sun));
+    TEST_ASSERT_EQUAL_DOUBLE(found_at, next.found_at);
+    describe_next_events(&next, planet_table, &moon_object, next.expires, latitude, longitude, sun, moon, sizeof(sun));
+    TEST_ASSERT_TRUE(next.found_at > found_at);
+    describe_next_events(&next, planet_table, &moon_object, start, latitude, longitude, sun, moon, sizeof(sun));
+    TEST_ASSERT_EQUAL_DOUBLE(start, next.found_at);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_star_events);
+    RUN_TEST(test_circumpolar_stars);
+    RUN_TEST(test_sun_and_moon_events);
+    RUN_TEST(test_list_events);
+    RUN_TEST(test_format_utc_time);
+    RUN_TEST(test_next_events);
+
+    return UNITY_END();
+}
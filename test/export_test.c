@@ -0,0 +1,228 @@
+/* Check exported positions against the position updates they come from
+ */
+
+#define UNITY_INCLUDE_DOUBLE
+#include "export.h"
+#include "src/arena.c"
+#include "src/astro.c"
+#include "src/bit.c"
+#include "src/coord.c"
+#include "src/core.c"
+#include "src/core_position.c"
+#include "src/ephemeris.c"
+#include "src/export.c"
+#include "src/parse_BSC5.c"
+#include "src/pool.c"
+#include "data/keplerian_elements.c"
+#include "unity.c"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_STARS 4
+
+// Boston, MA in radians
+static const double latitude = 42.3601 * M_PI / 180;
+static const double longitude = -71.0589 * M_PI / 180;
+
+static struct Star star_table[NUM_STARS];
+static struct Arena arena;
+static struct Planet *planet_table;
+static struct Moon moon_object;
+
+// Stars 2 and 4 are exported, given out of order
+static const int star_numbers[] = {4, 2};
+
+static const struct ExportRange range = {
+    .start = 2460310.5,
+    .step = 1.0 / 24.0,
+    .num_epochs = 50,
+};
+
+void setUp(void)
+{
+    arena_create(&arena, ARENA_SIZE(NUM_PLANETS * sizeof(struct Planet)));
+    generate_planet_table(&arena, &planet_table, planet_elements, planet_rates, planet_extras);
+    generate_moon_object(&moon_object, &moon_elements, &moon_rates);
+
+    for (int i = 0; i < NUM_STARS; ++i)
+    {
+        star_table[i] = (struct Star){
+            .catalog_number = i + 1,
+            .right_ascension = i * 1.5,
+            .declination = 0.3 * i - 0.5,
+            .ra_motion = 1E-6,
+            .dec_motion = -1E-6,
+        };
+    }
+}
+
+void tearDown(void)
+{
+    arena_destroy(&arena);
+    free_moon_object(moon_object);
+}
+
+// Export to a temporary file and read it back. The caller frees the contents
+static char *export_to_memory(enum ExportFormat format, int num_threads, const struct ExportRange *range,
+                              size_t *length)
+{
+    struct Pool pool;
+    TEST_ASSERT_TRUE(pool_create(&pool, num_threads));
+
+    FILE *stream = tmpfile();
+    TEST_ASSERT_NOT_NULL(stream);
+    TEST_ASSERT_TRUE(export_positions(stream, format, &pool, star_table, star_numbers, 2, planet_table, &moon_object,
+                                      range, latitude, longitude));
+    pool_destroy(&pool);
+
+    *length = (size_t)ftell(stream);
+    rewind(stream);
+    char *contents = malloc(*length + 1);
+    TEST_ASSERT_EQUAL_size_t(*length, fread(contents, 1, *length, stream));
+    contents[*length] = '\0';
+    fclose(stream);
+
+    return contents;
+}
+
+void test_format_fixed(void)
+{
+    char out[32];
+    *format_fixed(out, 2460310.5, 6) = '\0';
+    TEST_ASSERT_EQUAL_STRING("2460310.500000", out);
+    *format_fixed(out, 12.34567, 4) = '\0';
+    TEST_ASSERT_EQUAL_STRING("12.3457", out);
+    *format_fixed(out, -0.99996, 4) = '\0';
+    TEST_ASSERT_EQUAL_STRING("-1.0000", out);
+
+    // No negative zero
+    *format_fixed(out, -0.00004, 4) = '\0';
+    TEST_ASSERT_EQUAL_STRING("0.0000", out);
+}
+
+void test_export_csv(void)
+{
+    size_t length;
+    char *csv = export_to_memory(EXPORT_CSV, 1, &range, &length);
+
+    char *line = strtok(csv, "\n");
+    TEST_ASSERT_EQUAL_STRING("julian_date,object,azimuth,altitude", line);
+
+    // Rows follow the epochs and objects in order, at the positions the
+    // updates give
+    struct Star stars[2] = {star_table[1], star_table[3]};
+    const char *bodies[] = {"Sun", "Mercury", "Venus", "Mars", "Jupiter", "Saturn", "Uranus", "Neptune", "Moon"};
+    int num_rows = 0;
+    for (long epoch = 0; epoch < range.num_epochs; ++epoch)
+    {
+        double julian_date = range.start + range.step * epoch;
+        update_star_positions(stars, 2, julian_date, latitude, longitude);
+        update_planet_positions(planet_table, julian_date, latitude, longitude);
+        update_moon_position(&moon_object, julian_date, latitude, longitude);
+
+        for (int i = 0; i < NUM_BODIES + 2; ++i)
+        {
+            line = strtok(NULL, "\n");
+            TEST_ASSERT_NOT_NULL(line);
+            ++num_rows;
+
+            char object[16];
+            double date, azimuth, altitude;
+            TEST_ASSERT_EQUAL_INT(4, sscanf(line, "%lf,%15[^,],%lf,%lf", &date, object, &azimuth, &altitude));
+            TEST_ASSERT_DOUBLE_WITHIN(1E-6, julian_date, date);
+
+            const struct ObjectBase *base;
+            if (i < NUM_BODIES)
+            {
+                TEST_ASSERT_EQUAL_STRING(bodies[i], object);
+                base = i == NUM_BODIES - 1 ? &moon_object.base : &planet_table[i < EARTH ? i : i + 1].base;
+            }
+            else
+            {
+                TEST_ASSERT_EQUAL_INT(i == NUM_BODIES ? 2 : 4, atoi(object));
+                base = &stars[i - NUM_BODIES].base;
+            }
+            TEST_ASSERT_DOUBLE_WITHIN(1E-4, base->azimuth * TO_DEG, azimuth);
+            TEST_ASSERT_DOUBLE_WITHIN(1E-4, base->altitude * TO_DEG, altitude);
+        }
+    }
+    TEST_ASSERT_NULL(strtok(NULL, "\n"));
+    TEST_ASSERT_EQUAL_INT(range.num_epochs * (NUM_BODIES + 2), num_rows);
+
+    free(csv);
+}
+
+void test_export_binary(void)
+{
+    size_t length;
+    char *data = export_to_memory(EXPORT_BINARY, 1, &range, &length);
+
+    int num_objects = NUM_BODIES + 2;
+    TEST_ASSERT_EQUAL_size_t(EXPORT_HEADER_SIZE + 4 * num_objects + range.num_epochs * num_objects * EXPORT_RECORD_SIZE,
+                             length);
+    TEST_ASSERT_EQUAL_MEMORY(EXPORT_MAGIC, data, 8);
+
+    // Decoded by hand, so the layout does not depend on the host
+    const unsigned char *bytes = (const unsigned char *)data;
+    uint32_t objects_field = bytes[12] | bytes[13] << 8 | bytes[14] << 16 | (uint32_t)bytes[15] << 24;
+    TEST_ASSERT_EQUAL_UINT32(num_objects, objects_field);
+
+    int32_t numbers[NUM_BODIES + 2];
+    for (int i = 0; i < num_objects; ++i)
+    {
+        const unsigned char *b = bytes + EXPORT_HEADER_SIZE + 4 * i;
+        numbers[i] = (int32_t)(b[0] | b[1] << 8 | b[2] << 16 | (uint32_t)b[3] << 24);
+    }
+    TEST_ASSERT_EQUAL_INT32(-1 - SUN, numbers[0]);
+    TEST_ASSERT_EQUAL_INT32(-1 - MARS, numbers[3]);
+    TEST_ASSERT_EQUAL_INT32(-1 - NUM_PLANETS, numbers[NUM_BODIES - 1]);
+    TEST_ASSERT_EQUAL_INT32(2, numbers[NUM_BODIES]);
+    TEST_ASSERT_EQUAL_INT32(4, numbers[NUM_BODIES + 1]);
+
+    // Altitude of the Moon at the last epoch
+    update_moon_position(&moon_object, range.start + range.step * (range.num_epochs - 1), latitude, longitude);
+    size_t offset = length - (size_t)(num_objects - (NUM_BODIES - 1)) * EXPORT_RECORD_SIZE + 4;
+    const unsigned char *b = bytes + offset;
+    uint32_t bits = b[0] | b[1] << 8 | b[2] << 16 | (uint32_t)b[3] << 24;
+    float altitude;
+    memcpy(&altitude, &bits, sizeof(altitude));
+    TEST_ASSERT_DOUBLE_WITHIN(1E-4, moon_object.base.altitude * TO_DEG, altitude);
+
+    free(data);
+}
+
+void test_export_threads(void)
+{
+    // Splitting epochs across threads changes nothing in the output, over
+    // enough epochs that each thread formats several batches
+    struct ExportRange long_range = range;
+    long_range.num_epochs = 10000;
+
+    for (int format = EXPORT_CSV; format <= EXPORT_BINARY; ++format)
+    {
+        size_t length_one, length_many;
+        char *one = export_to_memory(format, 1, &long_range, &length_one);
+        char *many = export_to_memory(format, 3, &long_range, &length_many);
+
+        TEST_ASSERT_EQUAL_size_t(length_one, length_many);
+        TEST_ASSERT_EQUAL_MEMORY(one, many, length_one);
+
+        free(one);
+        free(many);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_format_fixed);
+    RUN_TEST(test_export_csv);
+    RUN_TEST(test_export_binary);
+    RUN_TEST(test_export_threads);
+
+    return UNITY_END();
+}
@@ -0,0 +1,105 @@
+#include "frame_stats.h"
+#include "src/frame_stats.c"
+#include "src/stopwatch.c"
+#include "unity.c"
+
+#include <string.h>
+
+static struct Histogram histogram;
+
+void setUp(void)
+{
+    memset(&histogram, 0, sizeof(histogram));
+}
+
+void tearDown(void)
+{
+}
+
+void test_bucket_bounds(void)
+{
+    // Every value falls in a bucket whose bounds contain it, and buckets are
+    // contiguous and increasing
+    unsigned long long values[] = {0, 1, 15, 16, 17, 31, 32, 33, 1000, 16666, 1000000, 1ULL << 40, ~0ULL};
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+    {
+        int index = bucket_index(values[i]);
+        TEST_ASSERT_TRUE(index >= 0 && index < STATS_BUCKETS);
+        TEST_ASSERT_TRUE(values[i] <= bucket_upper(index));
+        if (index > 0)
+        {
+            TEST_ASSERT_TRUE(values[i] > bucket_upper(index - 1));
+        }
+    }
+
+    for (int i = 1; i < bucket_index(~0ULL); ++i)
+    {
+        TEST_ASSERT_EQUAL_INT(i, bucket_index(bucket_upper(i - 1) + 1));
+    }
+}
+
+void test_window_percentiles(void)
+{
+    struct Percentiles p = histogram_window_percentiles(&histogram);
+    TEST_ASSERT_EQUAL_UINT64(0, p.max);
+
+    // 1..100 in shuffled order
+    for (int i = 0; i < 100; ++i)
+    {
+        histogram_add(&histogram, (i * 37) % 100 + 1);
+    }
+
+    p = histogram_window_percentiles(&histogram);
+    TEST_ASSERT_EQUAL_UINT64(50, p.p50);
+    TEST_ASSERT_EQUAL_UINT64(95, p.p95);
+    TEST_ASSERT_EQUAL_UINT64(99, p.p99);
+    TEST_ASSERT_EQUAL_UINT64(100, p.max);
+}
+
+void test_window_rolls(void)
+{
+    // Old samples leave the window but stay in the histogram
+    histogram_add(&histogram, 1000000);
+    for (int i = 0; i < STATS_WINDOW; ++i)
+    {
+        histogram_add(&histogram, 10);
+    }
+
+    struct Percentiles window = histogram_window_percentiles(&histogram);
+    TEST_ASSERT_EQUAL_UINT64(10, window.p99);
+    TEST_ASSERT_EQUAL_UINT64(10, window.max);
+
+    struct Percentiles all = histogram_percentiles(&histogram);
+    TEST_ASSERT_EQUAL_UINT64(10, all.p50);
+    TEST_ASSERT_EQUAL_UINT64(10, all.p99);
+    TEST_ASSERT_EQUAL_UINT64(1000000, all.max);
+    TEST_ASSERT_EQUAL_UINT64(STATS_WINDOW + 1, histogram.count);
+}
+
+void test_histogram_percentiles(void)
+{
+    for (unsigned long long i = 1; i <= 1000; ++i)
+    {
+        histogram_add(&histogram, i * 100);
+    }
+
+    // Bucket bounds are within 12.5% of the exact percentiles
+    struct Percentiles p = histogram_percentiles(&histogram);
+    TEST_ASSERT_UINT64_WITHIN(50000 / 8, 50000, p.p50);
+    TEST_ASSERT_UINT64_WITHIN(95000 / 8, 95000, p.p95);
+    TEST_ASSERT_UINT64_WITHIN(99000 / 8, 99000, p.p99);
+    TEST_ASSERT_TRUE(p.p50 >= 50000 && p.p95 >= 95000 && p.p99 >= 99000);
+    TEST_ASSERT_EQUAL_UINT64(100000, p.max);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_bucket_bounds);
+    RUN_TEST(test_window_percentiles);
+    RUN_TEST(test_window_rolls);
+    RUN_TEST(test_histogram_percentiles);
+
+    return UNITY_END();
+}
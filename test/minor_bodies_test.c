@@ -0,0 +1,308 @@
+/* Check minor body parsing, the batched Kepler solver and brightness culling
+ */
+
+#define UNITY_INCLUDE_DOUBLE
+#include "minor_bodies.h"
+#include "src/arena.c"
+#include "src/astro.c"
+#include "src/bit.c"
+#include "src/coord.c"
+#include "src/core.c"
+#include "src/minor_bodies.c"
+#include "src/parse_BSC5.c"
+#include "data/keplerian_elements.c"
+#include "unity.c"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static const char *ceres = "00001    3.34  0.15 K239D  60.07966   73.42179   80.25496   10.58688  0.0789126  0.21411523   "
+                           "2.7672963  0 E2023-A6  7330 123 1801-2023 0.65 M-v 30k MPCLINUX   0000  (1) Ceres          "
+                           "         20230321";
+static const char *vesta = "00004    3.25  0.32 K239D 169.35183  151.53712  103.70232    7.14406  0.0893686  0.27161211   "
+                           "2.3617550  0 E2023-A6  7594 112 1821-2023 0.60 M-p 18k MPCLINUX   0000  (4) Vesta          "
+                           "         20230321";
+static const char *halley = "0001P         1986 02  9.4589  0.574310  0.967142  111.8657   58.8601  162.2422  20230209   "
+                            "5.5  4.0  1P/Halley";
+
+static struct Arena arena;
+static struct Planet *planet_table;
+
+void setUp(void)
+{
+    arena_create(&arena, ARENA_SIZE(NUM_PLANETS * sizeof(struct Planet)));
+    generate_planet_table(&arena, &planet_table, planet_elements, planet_rates, planet_extras);
+}
+
+void tearDown(void)
+{
+    arena_destroy(&arena);
+}
+
+void test_parse_minor_body(void)
+{
+    struct MinorBody body;
+
+    TEST_ASSERT_TRUE(parse_minor_body(ceres, &body));
+    TEST_ASSERT_FALSE(body.comet);
+    TEST_ASSERT_EQUAL_STRING("(1) Ceres", body.name);
+    TEST_ASSERT_EQUAL_FLOAT(3.34f, body.abs_magnitude);
+    TEST_ASSERT_EQUAL_FLOAT(0.15f, body.slope);
+    TEST_ASSERT_EQUAL_DOUBLE(2460200.5, body.epoch); // 2023-09-13
+    TEST_ASSERT_EQUAL_DOUBLE(60.07966, body.mean_anomaly);
+    TEST_ASSERT_EQUAL_DOUBLE(10.58688, body.inclination);
+    TEST_ASSERT_EQUAL_DOUBLE(0.0789126, body.eccentricity);
+    TEST_ASSERT_EQUAL_DOUBLE(0.21411523, body.mean_motion);
+    TEST_ASSERT_EQUAL_DOUBLE(2.7672963, body.semi_major);
+
+    TEST_ASSERT_TRUE(parse_minor_body(halley, &body));
+    TEST_ASSERT_TRUE(body.comet);
+    TEST_ASSERT_EQUAL_STRING("1P/Halley", body.name);
+    TEST_ASSERT_DOUBLE_WITHIN(1E-6, 2446470.9589, body.epoch); // Perihelion
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, body.mean_anomaly);
+    TEST_ASSERT_DOUBLE_WITHIN(1E-6, 0.574310 / (1.0 - 0.967142), body.semi_major);
+
+    // Kepler's third law, with the period in years
+    TEST_ASSERT_DOUBLE_WITHIN(0.1, pow(body.semi_major, 1.5), 360.0 / body.mean_motion / 365.25);
+
+    // Header lines, hyperbolic orbits and bodies without an absolute magnitude
+    TEST_ASSERT_FALSE(parse_minor_body("MINOR PLANET CENTER ORBIT DATABASE (MPCORB)", &body));
+    TEST_ASSERT_FALSE(parse_minor_body("", &body));
+    TEST_ASSERT_FALSE(parse_minor_body("    C         2017 09  9.4886  0.255240  1.199252  241.6845   24.5997  122.6778"
+                                       "  20230209  19.2  4.0  C/2017 U1",
+                                       &body));
+
+    char blank_magnitude[256];
+    snprintf(blank_magnitude, sizeof(blank_magnitude), "%s", ceres);
+    memset(blank_magnitude + 8, ' ', 5);
+    TEST_ASSERT_FALSE(parse_minor_body(blank_magnitude, &body));
+}
+
+// Rectangular horizontal coordinates of a body from the scalar planet model
+static void reference_position(const struct MinorBody *body, double julian_date, double m[3][3], double out[3])
+{
+    double M = fmod(body->mean_anomaly + body->mean_motion * (julian_date - body->epoch), 360.0);
+    M = M > 180.0 ? M - 360.0 : (M < -180.0 ? M + 360.0 : M);
+
+    struct KepElems elements = {
+        .a = body->semi_major,
+        .e = body->eccentricity,
+        .I = body->inclination,
+        .M = M,
+        .w = body->arg_perihelion,
+        .O = body->node,
+    };
+    struct KepRates rates = {0};
+
+    double x, y, z, xe, ye, ze;
+    calc_planet_helio_ICRF(&elements, &rates, NULL, julian_date, &x, &y, &z);
+    calc_planet_helio_ICRF(planet_table[EARTH].elements, planet_table[EARTH].rates, planet_table[EARTH].extras,
+                           julian_date, &xe, &ye, &ze);
+    x -= xe;
+    y -= ye;
+    z -= ze;
+
+    out[0] = m[0][0] * x + m[0][1] * y + m[0][2] * z;
+    out[1] = m[1][0] * x + m[1][1] * y + m[1][2] * z;
+    out[2] = m[2][0] * x + m[2][1] * y + m[2][2] * z;
+}
+
+void test_propagation(void)
+{
+    // Enough bodies for the SIMD loop and its remainder
+    enum
+    {
+        NUM_BODIES = 11
+    };
+    struct MinorBody elements[NUM_BODIES];
+    for (int i = 0; i < NUM_BODIES; ++i)
+    {
+        elements[i] = (struct MinorBody){
+            .epoch = 2460200.5 - 400.0 * i,
+            .mean_anomaly = 33.0 * i - 170.0,
+            .semi_major = 1.2 + 0.4 * i,
+            .eccentricity = 0.065 * i,
+            .inclination = 3.0 + 9.0 * i,
+            .arg_perihelion = 31.0 * i,
+            .node = 350.0 - 23.0 * i,
+            .abs_magnitude = (float)i,
+        };
+        elements[i].mean_motion = GAUSSIAN_MEAN_MOTION / pow(elements[i].semi_major, 1.5);
+        snprintf(elements[i].name, MINOR_BODY_NAME, "%d", i);
+    }
+
+    struct MinorBodies bodies;
+    TEST_ASSERT_TRUE(generate_minor_bodies(&bodies, elements, NUM_BODIES));
+
+    double latitude = 0.7, longitude = -1.2;
+    for (double julian_date = 2440000.5; julian_date < 2480000.5; julian_date += 997.3)
+    {
+        update_minor_bodies(&bodies, planet_table, julian_date, latitude, longitude);
+
+        double m[3][3];
+        equatorial_to_horizontal_matrix(greenwich_mean_sidereal_time_rad(julian_date), latitude, longitude, m);
+
+        for (int i = 0; i < NUM_BODIES; ++i)
+        {
+            double expected[3];
+            reference_position(&elements[atoi(bodies.names[i])], julian_date, m, expected);
+
+            double distance = sqrt(expected[0] * expected[0] + expected[1] * expected[1] + expected[2] * expected[2]);
+            TEST_ASSERT_DOUBLE_WITHIN(1E-7 * distance, expected[0], bodies.xh[i]);
+            TEST_ASSERT_DOUBLE_WITHIN(1E-7 * distance, expected[1], bodies.yh[i]);
+            TEST_ASSERT_DOUBLE_WITHIN(1E-7 * distance, expected[2], bodies.zh[i]);
+        }
+    }
+
+    free_minor_bodies(&bodies);
+}
+
+// Eccentric anomaly by bisection, which converges for any eccentricity
+static double bisect_kepler(double M, double e)
+{
+    double low = -M_PI, high = M_PI;
+    for (int i = 0; i < 200; ++i)
+    {
+        double mid = (low + high) / 2;
+        if (mid - e * sin(mid) < M)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return (low + high) / 2;
+}
+
+void test_kepler_eccentricities(void)
+{
+    enum
+    {
+        NUM_BODIES = 4001
+    };
+    // Groups of bodies share an eccentricity, so every iteration count is used
+    const double eccentricities[] = {0.0, 0.1, 0.5, 0.8, 0.9, 0.95, 0.99, 0.999, 0.9999};
+    const int num_eccentricities = sizeof(eccentricities) / sizeof(eccentricities[0]);
+
+    struct MinorBody *elements = calloc(NUM_BODIES, sizeof(struct MinorBody));
+    for (int i = 0; i < NUM_BODIES; ++i)
+    {
+        // Mean anomalies across a whole orbit, many close to perihelion
+        double fraction = (double)i / (NUM_BODIES - 1) * 2.0 - 1.0;
+        elements[i] = (struct MinorBody){
+            .epoch = 2451545.0,
+            .mean_anomaly = 180.0 * fraction * fraction * fraction,
+            .semi_major = 3.0,
+            .eccentricity = eccentricities[i / 8 % num_eccentricities],
+            .inclination = 20.0,
+            .arg_perihelion = 40.0,
+            .node = 60.0,
+        };
+    }
+
+    struct MinorBodies bodies;
+    TEST_ASSERT_TRUE(generate_minor_bodies(&bodies, elements, NUM_BODIES));
+    update_minor_bodies(&bodies, planet_table, 2451545.0, 0.0, 0.0);
+
+    for (int i = 0; i < NUM_BODIES; ++i)
+    {
+        double e = bodies.eccentricity[i];
+        double E = bisect_kepler(bodies.mean_anomaly[i], e);
+        double r = bodies.semi_major[i] * (1.0 - e * cos(E));
+        TEST_ASSERT_DOUBLE_WITHIN(1E-9, r, bodies.r[i]);
+    }
+
+    free_minor_bodies(&bodies);
+    free(elements);
+}
+
+void test_threshold(void)
+{
+    struct MinorBody elements[4];
+    TEST_ASSERT_TRUE(parse_minor_body(ceres, &elements[0]));
+    TEST_ASSERT_TRUE(parse_minor_body(vesta, &elements[1]));
+    TEST_ASSERT_TRUE(parse_minor_body(halley, &elements[2]));
+
+    // A faint main belt asteroid
+    elements[3] = elements[0];
+    elements[3].abs_magnitude = 18.0f;
+    snprintf(elements[3].name, MINOR_BODY_NAME, "Faint");
+
+    struct MinorBodies bodies;
+    TEST_ASSERT_TRUE(generate_minor_bodies(&bodies, elements, 4));
+
+    // Halley crosses the Earth's orbit, so it could be arbitrarily bright
+    TEST_ASSERT_EQUAL_STRING("1P/Halley", bodies.names[0]);
+    TEST_ASSERT_EQUAL_STRING("Faint", bodies.names[3]);
+    for (int i = 1; i < 4; ++i)
+    {
+        TEST_ASSERT_TRUE(bodies.peak_magnitude[i - 1] <= bodies.peak_magnitude[i]);
+    }
+
+    TEST_ASSERT_EQUAL(3, set_minor_body_threshold(&bodies, 10.0f));
+    TEST_ASSERT_EQUAL(1, set_minor_body_threshold(&bodies, -30.0f));
+    TEST_ASSERT_EQUAL(4, set_minor_body_threshold(&bodies, INFINITY));
+    set_minor_body_threshold(&bodies, 10.0f);
+
+    int ceres_visible = 0;
+    for (double julian_date = 2460200.5; julian_date < 2460202.5; julian_date += 0.125)
+    {
+        update_minor_bodies(&bodies, planet_table, julian_date, 0.7, -1.2);
+
+        for (int v = 0; v < bodies.num_visible; ++v)
+        {
+            int i = bodies.visible[v];
+            TEST_ASSERT_TRUE(i < bodies.num_candidates);
+            TEST_ASSERT_TRUE(bodies.altitude[i] > 0.0);
+            TEST_ASSERT_TRUE(bodies.magnitude[i] <= 10.0f);
+            TEST_ASSERT_TRUE(bodies.magnitude[i] >= bodies.peak_magnitude[i]);
+
+            if (strcmp(bodies.names[i], "(1) Ceres") == 0)
+            {
+                // Ceres ranges from 6.6 to 9.3
+                TEST_ASSERT_FLOAT_WITHIN(1.5f, 8.0f, bodies.magnitude[i]);
+                ceres_visible++;
+            }
+        }
+    }
+    TEST_ASSERT_TRUE(ceres_visible > 0);
+
+    free_minor_bodies(&bodies);
+}
+
+void test_load_minor_bodies(void)
+{
+    char path[] = "test_minor_bodies.txt";
+    FILE *file = fopen(path, "w");
+    TEST_ASSERT_NOT_NULL(file);
+    fprintf(file, "MINOR PLANET CENTER ORBIT DATABASE (MPCORB)\n\n");
+    fprintf(file, "----------------------------------------------------\n");
+    fprintf(file, "%s\r\n%s\n%s\n", ceres, vesta, halley);
+    fclose(file);
+
+    struct MinorBodies bodies;
+    TEST_ASSERT_TRUE(load_minor_bodies(&bodies, path));
+    TEST_ASSERT_EQUAL(3, bodies.num_bodies);
+    TEST_ASSERT_EQUAL(3, bodies.num_candidates);
+    free_minor_bodies(&bodies);
+
+    remove(path);
+
+    TEST_ASSERT_FALSE(load_minor_bodies(&bodies, path));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_parse_minor_body);
+    RUN_TEST(test_propagation);
+    RUN_TEST(test_kepler_eccentricities);
+    RUN_TEST(test_threshold);
+    RUN_TEST(test_load_minor_bodies);
+
+    return UNITY_END();
+}
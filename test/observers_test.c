@@ -0,0 +1,333 @@
+/* Check positions for many observers against the single observer conversion
+ */
+
+#define UNITY_INCLUDE_DOUBLE
+#include "observers.h"
+#include "src/arena.c"
+#include "src/astro.c"
+#include "src/bit.c"
+#include "src/city.c"
+#include "src/city_hash.c"
+#include "src/coord.c"
+#include "src/core.c"
+#include "src/core_position.c"
+#include "src/ephemeris.c"
+#include "src/export.c"
+#include "src/observers.c"
+#include "src/parse_BSC5.c"
+#include "src/pool.c"
+#include "data/keplerian_elements.c"
+#include "unity.c"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_STARS 3
+
+static const double julian_date = 2460310.5;
+
+static struct Star star_table[NUM_STARS];
+static struct Arena arena;
+static struct Planet *planet_table;
+static struct Moon moon_object;
+
+void setUp(void)
+{
+    arena_create(&arena, ARENA_SIZE(NUM_PLANETS * sizeof(struct Planet)));
+    generate_planet_table(&arena, &planet_table, planet_elements, planet_rates, planet_extras);
+    generate_moon_object(&moon_object, &moon_elements, &moon_rates);
+
+    static const char *labels[NUM_STARS] = {"Sirius", NULL, "Vega"};
+    for (int i = 0; i < NUM_STARS; ++i)
+    {
+        star_table[i] = (struct Star){
+            .base.label = labels[i],
+            .catalog_number = 10 * (i + 1),
+            .right_ascension = i * 2.1,
+            .declination = 0.4 * i - 0.3,
+            .ra_motion = 1E-6,
+            .dec_motion = -1E-6,
+        };
+    }
+}
+
+void tearDown(void)
+{
+    arena_destroy(&arena);
+    free_moon_object(moon_object);
+}
+
+static void write_file(const char *path, const char *contents)
+{
+    FILE *file = fopen(path, "w");
+    TEST_ASSERT_NOT_NULL(file);
+    fputs(contents, file);
+    fclose(file);
+}
+
+void test_observe_cities(void)
+{
+    struct Observers observers;
+    TEST_ASSERT_TRUE(load_city_observers(&observers));
+
+    int num_cities;
+    get_cities(&num_cities);
+    TEST_ASSERT_EQUAL(num_cities, observers.num_observers);
+
+    int n = observers.num_observers;
+    for (int i = 1; i < n; ++i)
+    {
+        TEST_ASSERT_TRUE(strcmp(observers.names[i - 1], observers.names[i]) <= 0);
+    }
+
+    double *azimuth = malloc(n * sizeof(double));
+    double *altitude = malloc(n * sizeof(double));
+
+    // Include the poles, where azimuths wrap
+    const double directions[][2] = {{0.0, 0.0}, {1.3, -0.7}, {4.0, 0.4}, {5.9, M_PI / 2}, {2.5, -M_PI / 2}};
+    const double gmst = 1.234;
+    for (size_t d = 0; d < sizeof(directions) / sizeof(directions[0]); ++d)
+    {
+        // An odd start exercises the remainder of the SIMD loop at both ends
+        observe_object(&observers, 3, n, directions[d][0], directions[d][1], gmst, azimuth, altitude);
+
+        for (int i = 3; i < n; ++i)
+        {
+            double expected_azimuth, expected_altitude;
+            equatorial_to_horizontal(directions[d][0], directions[d][1], gmst, observers.latitude[i],
+                                     observers.longitude[i], &expected_azimuth, &expected_altitude);
+
+            TEST_ASSERT_DOUBLE_WITHIN(1E-9, expected_altitude, altitude[i - 3]);
+            TEST_ASSERT_TRUE(azimuth[i - 3] >= 0.0 && azimuth[i - 3] <= 2 * M_PI);
+
+            // Azimuth is meaningless straight up or down
+            if (cos(expected_altitude) > 1E-6)
+            {
+                double difference = remainder(azimuth[i - 3] - expected_azimuth, 2 * M_PI);
+                TEST_ASSERT_DOUBLE_WITHIN(1E-9, 0.0, difference);
+            }
+        }
+    }
+
+    free(azimuth);
+    free(altitude);
+    free_observers(&observers);
+}
+
+void test_load_observers(void)
+{
+    char path[] = "test_observers.csv";
+    struct Observers observers;
+
+    // Columns named by a header, as data/cities.csv
+    write_file(path, "city_name,population,latitude,longitude\n"
+                     "\"Mianzhu, Deyang, Sichuan\",510000,31.33786,104.22057\r\n"
+                     "\n"
+                     "# A comment\n"
+                     "Boston,650000,42.35843,-71.05977\n");
+    TEST_ASSERT_TRUE(load_observers(&observers, path));
+    TEST_ASSERT_EQUAL(2, observers.num_observers);
+    TEST_ASSERT_EQUAL_STRING("Mianzhu, Deyang, Sichuan", observers.names[0]);
+    TEST_ASSERT_EQUAL_STRING("Boston", observers.names[1]);
+    TEST_ASSERT_DOUBLE_WITHIN(1E-12, 42.35843 * M_PI / 180, observers.latitude[1]);
+    TEST_ASSERT_DOUBLE_WITHIN(1E-12, -71.05977 * M_PI / 180, observers.longitude[1]);
+    free_observers(&observers);
+
+    // Names and coordinates, or coordinates alone
+    write_file(path, "Site A, 10.5, -20.25\nSite \"\"B\"\",-33,151\n");
+    TEST_ASSERT_TRUE(load_observers(&observers, path));
+    TEST_ASSERT_EQUAL(2, observers.num_observers);
+    TEST_ASSERT_EQUAL_STRING("Site A", observers.names[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(1E-12, -20.25 * M_PI / 180, observers.longitude[0]);
+    TEST_ASSERT_EQUAL_STRING("Site \"\"B\"\"", observers.names[1]);
+    free_observers(&observers);
+
+    write_file(path, "10,20\n-30,40\n50,60\n");
+    TEST_ASSERT_TRUE(load_observers(&observers, path));
+    TEST_ASSERT_EQUAL(3, observers.num_observers);
+    TEST_ASSERT_EQUAL_STRING("", observers.names[2]);
+    TEST_ASSERT_DOUBLE_WITHIN(1E-12, 50 * M_PI / 180, observers.latitude[2]);
+    free_observers(&observers);
+
+    // Latitudes out of range, missing columns and empty files are rejected
+    write_file(path, "Nowhere,95,0\n");
+    TEST_ASSERT_FALSE(load_observers(&observers, path));
+    write_file(path, "name,latitude,longitude\nSomewhere,10\n");
+    TEST_ASSERT_FALSE(load_observers(&observers, path));
+    write_file(path, "name,latitude,longitude\n");
+    TEST_ASSERT_FALSE(load_observers(&observers, path));
+
+    remove(path);
+    TEST_ASSERT_FALSE(load_observers(&observers, path));
+}
+
+void test_select_objects(void)
+{
+    struct ObservedObject *objects;
+    int num_objects;
+
+    // The Sun, planets and Moon by default, as update_planet_positions and
+    // update_moon_position find them
+    TEST_ASSERT_TRUE(select_observed_objects(NULL, star_table, NUM_STARS, planet_table, &moon_object, julian_date,
+                                             &objects, &num_objects));
+    TEST_ASSERT_EQUAL(NUM_PLANETS, num_objects);
+    TEST_ASSERT_EQUAL_STRING("Sun", objects[0].name);
+    TEST_ASSERT_EQUAL_STRING("Mars", objects[EARTH].name);
+    TEST_ASSERT_EQUAL_STRING("Moon", objects[NUM_PLANETS - 1].name);
+
+    const double latitude = 0.7, longitude = -1.2;
+    double gmst = greenwich_mean_sidereal_time_rad(julian_date);
+    update_planet_positions(planet_table, julian_date, latitude, longitude);
+    update_moon_position(&moon_object, julian_date, latitude, longitude);
+    for (int i = 0; i < num_objects; ++i)
+    {
+        const struct ObjectBase *base =
+            i < NUM_PLANETS - 1 ? &planet_table[i < EARTH ? i : i + 1].base : &moon_object.base;
+
+        double azimuth, altitude;
+        equatorial_to_horizontal(objects[i].right_ascension, objects[i].declination, gmst, latitude, longitude,
+                                 &azimuth, &altitude);
+        TEST_ASSERT_DOUBLE_WITHIN(1E-9, base->azimuth, azimuth);
+        TEST_ASSERT_DOUBLE_WITHIN(1E-9, base->altitude, altitude);
+    }
+    free(objects);
+
+    // Names ignore case and stars are found by number or name
+    TEST_ASSERT_TRUE(select_observed_objects(" saturn,MOON, 20 ,vega", star_table, NUM_STARS, planet_table,
+                                             &moon_object, julian_date, &objects, &num_objects));
+    TEST_ASSERT_EQUAL(4, num_objects);
+    TEST_ASSERT_EQUAL_STRING("Saturn", objects[0].name);
+    TEST_ASSERT_EQUAL_STRING("Moon", objects[1].name);
+    TEST_ASSERT_EQUAL_STRING("20", objects[2].name);
+    TEST_ASSERT_EQUAL_STRING("30", objects[3].name);
+
+    double right_ascension, declination;
+    calc_star_position(star_table[2].right_ascension, star_table[2].ra_motion, star_table[2].declination,
+                       star_table[2].dec_motion, julian_date, &right_ascension, &declination);
+    TEST_ASSERT_EQUAL_DOUBLE(right_ascension, objects[3].right_ascension);
+    TEST_ASSERT_EQUAL_DOUBLE(declination, objects[3].declination);
+    free(objects);
+
+    // The Earth isn't observed from itself
+    TEST_ASSERT_FALSE(select_observed_objects("Mars,Earth", star_table, NUM_STARS, planet_table, &moon_object,
+                                              julian_date, &objects, &num_objects));
+    TEST_ASSERT_FALSE(select_observed_objects("Pluto", star_table, NUM_STARS, planet_table, &moon_object,
+                                              julian_date, &objects, &num_objects));
+    TEST_ASSERT_FALSE(select_observed_objects("11", star_table, NUM_STARS, planet_table, &moon_object, julian_date,
+                                              &objects, &num_objects));
+}
+
+// Write positions to a temporary file and read them back. The caller frees the
+// contents
+static char *write_to_memory(const struct Observers *observers, const struct ObservedObject *objects,
+                             int num_objects, double min_altitude)
+{
+    FILE *stream = tmpfile();
+    TEST_ASSERT_NOT_NULL(stream);
+    TEST_ASSERT_TRUE(write_observed_positions(stream, observers, objects, num_objects, julian_date, min_altitude));
+
+    size_t length = (size_t)ftell(stream);
+    rewind(stream);
+    char *contents = malloc(length + 1);
+    TEST_ASSERT_EQUAL_size_t(length, fread(contents, 1, length, stream));
+    contents[length] = '\0';
+    fclose(stream);
+
+    return contents;
+}
+
+void test_write_observed_positions(void)
+{
+    struct Observers observers;
+    TEST_ASSERT_TRUE(load_city_observers(&observers));
+
+    struct ObservedObject *objects;
+    int num_objects;
+    TEST_ASSERT_TRUE(select_observed_objects("Sun,Saturn,10", star_table, NUM_STARS, planet_table, &moon_object,
+                                             julian_date, &objects, &num_objects));
+
+    // Every position, in order of observer and then of object
+    char *contents = write_to_memory(&observers, objects, num_objects, -INFINITY);
+    double gmst = greenwich_mean_sidereal_time_rad(julian_date);
+
+    char *line = strtok(contents, "\n");
+    TEST_ASSERT_EQUAL_STRING("observer,latitude,longitude,object,azimuth,altitude", line);
+
+    int num_rows = 0;
+    for (line = strtok(NULL, "\n"); line != NULL; line = strtok(NULL, "\n"), ++num_rows)
+    {
+        int i = num_rows / num_objects;
+        int j = num_rows % num_objects;
+
+        // Names with commas are quoted
+        const char *name = observers.names[i];
+        size_t length = strlen(name);
+        const char *fields = line;
+        if (strchr(name, ',') != NULL)
+        {
+            TEST_ASSERT_EQUAL_CHAR('"', *fields++);
+            TEST_ASSERT_EQUAL_MEMORY(name, fields, length);
+            fields += length + 1;
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL_MEMORY(name, fields, length);
+            fields += length;
+        }
+
+        double latitude, longitude, azimuth, altitude;
+        char object[MAX_OBJECT_NAME];
+        TEST_ASSERT_EQUAL(5, sscanf(fields, ",%lf,%lf,%15[^,],%lf,%lf", &latitude, &longitude, object, &azimuth,
+                                    &altitude));
+        TEST_ASSERT_DOUBLE_WITHIN(6E-6, observers.latitude[i] * 180 / M_PI, latitude);
+        TEST_ASSERT_DOUBLE_WITHIN(6E-6, observers.longitude[i] * 180 / M_PI, longitude);
+        TEST_ASSERT_EQUAL_STRING(objects[j].name, object);
+
+        double expected_azimuth, expected_altitude;
+        equatorial_to_horizontal(objects[j].right_ascension, objects[j].declination, gmst, observers.latitude[i],
+                                 observers.longitude[i], &expected_azimuth, &expected_altitude);
+        TEST_ASSERT_DOUBLE_WITHIN(6E-5, expected_altitude * 180 / M_PI, altitude);
+        TEST_ASSERT_DOUBLE_WITHIN(6E-5, 0.0, remainder(azimuth - expected_azimuth * 180 / M_PI, 360.0));
+        TEST_ASSERT_TRUE(azimuth >= 0.0 && azimuth < 360.0);
+    }
+    TEST_ASSERT_EQUAL(observers.num_observers * num_objects, num_rows);
+    free(contents);
+
+    // Only positions above an altitude
+    const double min_altitude = 20 * M_PI / 180;
+    int expected_rows = 0;
+    for (int i = 0; i < observers.num_observers; ++i)
+    {
+        double azimuth, altitude;
+        observe_object(&observers, i, i + 1, objects[1].right_ascension, objects[1].declination, gmst, &azimuth,
+                       &altitude);
+        expected_rows += altitude >= min_altitude;
+    }
+    TEST_ASSERT_TRUE(expected_rows > 0 && expected_rows < observers.num_observers);
+
+    contents = write_to_memory(&observers, &objects[1], 1, min_altitude);
+    int num_lines = 0;
+    for (line = strtok(contents, "\n"); line != NULL; line = strtok(NULL, "\n"))
+    {
+        ++num_lines;
+    }
+    TEST_ASSERT_EQUAL(expected_rows + 1, num_lines);
+    free(contents);
+
+    free(objects);
+    free_observers(&observers);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_observe_cities);
+    RUN_TEST(test_load_observers);
+    RUN_TEST(test_select_objects);
+    RUN_TEST(test_write_observed_positions);
+
+    return UNITY_END();
+}
@@ -0,0 +1,105 @@
+#include "pool.h"
+#include "unity.c"
+#include "src/pool.c"
+
+#include <string.h>
+
+#define MAX_COUNT 1000
+
+static int visits[MAX_COUNT];
+static int misaligned;
+
+struct Job
+{
+    int grain;
+};
+
+static void mark_task(void *context, int begin, int end)
+{
+    const struct Job *job = context;
+
+    if (begin % job->grain != 0)
+    {
+        __atomic_add_fetch(&misaligned, 1, __ATOMIC_RELAXED);
+    }
+
+    // Ranges are disjoint, so no synchronization is needed
+    for (int i = begin; i < end; ++i)
+    {
+        visits[i]++;
+    }
+}
+
+static void check_run(struct Pool *pool, int count, int grain)
+{
+    memset(visits, 0, sizeof(visits));
+    misaligned = 0;
+
+    struct Job job = {.grain = grain};
+    pool_run(pool, mark_task, &job, count, grain);
+
+    TEST_ASSERT_EQUAL_INT(0, misaligned);
+    for (int i = 0; i < count; ++i)
+    {
+        TEST_ASSERT_EQUAL_INT(1, visits[i]);
+    }
+    for (int i = count; i < MAX_COUNT; ++i)
+    {
+        TEST_ASSERT_EQUAL_INT(0, visits[i]);
+    }
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_pool_covers_every_item(void)
+{
+    int thread_counts[] = {1, 2, 3, 8};
+    int counts[] = {0, 1, 3, 4, 7, 100, 999, MAX_COUNT};
+    int grains[] = {1, 2, 4};
+
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t)
+    {
+        struct Pool pool;
+        TEST_ASSERT_TRUE(pool_create(&pool, thread_counts[t]));
+
+        for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c)
+        {
+            for (size_t g = 0; g < sizeof(grains) / sizeof(grains[0]); ++g)
+            {
+                check_run(&pool, counts[c], grains[g]);
+            }
+        }
+
+        pool_destroy(&pool);
+    }
+}
+
+void test_pool_reuse(void)
+{
+    // Workers stay parked between jobs and pick up every new one
+    struct Pool pool;
+    TEST_ASSERT_TRUE(pool_create(&pool, 4));
+
+    for (int frame = 0; frame < 500; ++frame)
+    {
+        check_run(&pool, MAX_COUNT, 4);
+    }
+
+    pool_destroy(&pool);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_pool_covers_every_item);
+    RUN_TEST(test_pool_reuse);
+
+    return UNITY_END();
+}
@@ -0,0 +1,284 @@
+#include "canvas.h"
+#include "recording.h"
+#include "src/canvas.c"
+#include "src/recording.c"
+#include "src/stopwatch.c"
+#include "src/term.c"
+#include "unity.c"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define HEIGHT 12
+#define WIDTH 30
+#define NUM_FRAMES (2 * RECORDING_KEYFRAME_INTERVAL + 100)
+#define FRAME_TIME 1000
+
+static const char path[] = "test_recording.rec";
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    remove(path);
+}
+
+// Frame n of a session: a star moving across the canvas, a colored trail and
+// a wide character with a variation selector
+static void draw_frame(struct Canvas *canvas, int n)
+{
+    canvas_erase(canvas);
+    canvas_add_str(canvas, n % HEIGHT, (3 * n) % WIDTH, "★");
+    canvas_color_on(canvas, 1 + n / 100 % 8);
+    canvas_add_run(canvas, HEIGHT - 1, 0, n % WIDTH, "-");
+    canvas_color_off(canvas, 1 + n / 100 % 8);
+    canvas_add_str(canvas, 2, 5, n % 2 == 0 ? "🪐" : "☀️");
+}
+
+static void assert_frame(const struct Canvas *canvas, int n)
+{
+    struct Canvas expected;
+    TEST_ASSERT_TRUE(create_cell_canvas(&expected, HEIGHT, WIDTH));
+    draw_frame(&expected, n);
+
+    TEST_ASSERT_EQUAL(HEIGHT, canvas->height);
+    TEST_ASSERT_EQUAL(WIDTH, canvas->width);
+    TEST_ASSERT_EQUAL_MEMORY(expected.cells, canvas->cells, sizeof(struct Cell) * HEIGHT * WIDTH);
+
+    free_canvas(&expected);
+}
+
+static void record_session(void)
+{
+    struct Canvas canvas;
+    struct Recorder recorder;
+    TEST_ASSERT_TRUE(create_cell_canvas(&canvas, HEIGHT, WIDTH));
+    TEST_ASSERT_TRUE(recorder_open(&recorder, path, HEIGHT, WIDTH));
+    for (int n = 0; n < NUM_FRAMES; ++n)
+    {
+        draw_frame(&canvas, n);
+        TEST_ASSERT_TRUE(record_frame(&recorder, &canvas, (unsigned long long)n * FRAME_TIME));
+    }
+    TEST_ASSERT_TRUE(recorder_close(&recorder, NUM_FRAMES * FRAME_TIME));
+    free_canvas(&canvas);
+}
+
+void test_varint(void)
+{
+    const uint64_t values[] = {0, 1, 127, 128, 300, UINT32_MAX, UINT64_MAX};
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+    {
+        uint8_t buffer[MAX_VARINT];
+        uint8_t *end = put_varint(buffer, values[i]);
+        TEST_ASSERT_TRUE(end - buffer <= MAX_VARINT);
+
+        const uint8_t *in = buffer;
+        uint64_t value;
+        TEST_ASSERT_TRUE(get_varint(&in, end, &value));
+        TEST_ASSERT_TRUE(values[i] == value);
+        TEST_ASSERT_EQUAL_PTR(end, in);
+
+        // Truncated
+        in = buffer;
+        TEST_ASSERT_FALSE(get_varint(&in, end - 1, &value));
+    }
+}
+
+void test_replay_in_order(void)
+{
+    record_session();
+
+    struct Recording recording;
+    TEST_ASSERT_TRUE(open_recording(&recording, path));
+    TEST_ASSERT_EQUAL(NUM_FRAMES, recording.num_frames);
+    TEST_ASSERT_EQUAL(RECORDING_KEYFRAME_INTERVAL, recording.keyframe_interval);
+    TEST_ASSERT_TRUE(recording.end == NUM_FRAMES * FRAME_TIME);
+
+    for (int n = 0; n < NUM_FRAMES; ++n)
+    {
+        TEST_ASSERT_TRUE(seek_recording(&recording, n));
+        TEST_ASSERT_EQUAL(n, recording.frame);
+        assert_frame(&recording.canvas, n);
+    }
+
+    close_recording(&recording);
+}
+
+void test_replay_seek(void)
+{
+    record_session();
+
+    struct Recording recording;
+    TEST_ASSERT_TRUE(open_recording(&recording, path));
+
+    // Backwards, across keyframes and onto them
+    const long frames[] = {NUM_FRAMES - 1, 3, 2, RECORDING_KEYFRAME_INTERVAL - 1, RECORDING_KEYFRAME_INTERVAL,
+                           2 * RECORDING_KEYFRAME_INTERVAL + 1, 0, 0};
+    for (size_t i = 0; i < sizeof(frames) / sizeof(frames[0]); ++i)
+    {
+        TEST_ASSERT_TRUE(seek_recording(&recording, frames[i]));
+        assert_frame(&recording.canvas, (int)frames[i]);
+    }
+
+    TEST_ASSERT_FALSE(seek_recording(&recording, -1));
+    TEST_ASSERT_FALSE(seek_recording(&recording, NUM_FRAMES));
+
+    // Frames are found by the time they are shown
+    TEST_ASSERT_EQUAL(0, recording_frame_at(&recording, 0));
+    TEST_ASSERT_EQUAL(0, recording_frame_at(&recording, FRAME_TIME - 1));
+    TEST_ASSERT_EQUAL(1, recording_frame_at(&recording, FRAME_TIME));
+    TEST_ASSERT_EQUAL(250, recording_frame_at(&recording, 250 * FRAME_TIME + 500));
+    TEST_ASSERT_EQUAL(NUM_FRAMES - 1, recording_frame_at(&recording, UINT64_MAX));
+    TEST_ASSERT_TRUE(recording_frame_time(&recording, 7) == 7 * FRAME_TIME);
+
+    close_recording(&recording);
+}
+
+void test_record_deltas(void)
+{
+    record_session();
+
+    struct Recording recording;
+    TEST_ASSERT_TRUE(open_recording(&recording, path));
+
+    // A delta holds the few cells that changed, a keyframe the cells that are
+    // not blank. Both are far smaller than the cells of a frame
+    uint64_t delta = frame_offset(&recording, 2) - frame_offset(&recording, 1);
+    uint64_t keyframe = frame_offset(&recording, RECORDING_KEYFRAME_INTERVAL + 1) -
+                        frame_offset(&recording, RECORDING_KEYFRAME_INTERVAL);
+    TEST_ASSERT_TRUE(delta < 32);
+    TEST_ASSERT_TRUE(keyframe < 32);
+    TEST_ASSERT_TRUE(recording.size < NUM_FRAMES * 64);
+
+    close_recording(&recording);
+
+    // Frames that do not change take a byte
+    struct Canvas canvas;
+    struct Recorder recorder;
+    TEST_ASSERT_TRUE(create_cell_canvas(&canvas, HEIGHT, WIDTH));
+    TEST_ASSERT_TRUE(recorder_open(&recorder, path, HEIGHT, WIDTH));
+    draw_frame(&canvas, 0);
+    TEST_ASSERT_TRUE(record_frame(&recorder, &canvas, 0));
+    TEST_ASSERT_TRUE(record_frame(&recorder, &canvas, FRAME_TIME));
+    uint64_t first = recorder.index[2];
+    TEST_ASSERT_TRUE(record_frame(&recorder, &canvas, 2 * FRAME_TIME));
+    TEST_ASSERT_TRUE(recorder.index[4] - first == 1);
+    TEST_ASSERT_TRUE(recorder_close(&recorder, 3 * FRAME_TIME));
+    free_canvas(&canvas);
+}
+
+void test_record_resized_canvas(void)
+{
+    struct Canvas small, large;
+    TEST_ASSERT_TRUE(create_cell_canvas(&small, HEIGHT / 2, WIDTH / 2));
+    TEST_ASSERT_TRUE(create_cell_canvas(&large, 2 * HEIGHT, 2 * WIDTH));
+    canvas_add_ch(&small, 1, 1, 's');
+    canvas_add_ch(&large, 1, 2, 'l');
+    canvas_add_ch(&large, HEIGHT, 0, 'x');
+
+    struct Recorder recorder;
+    TEST_ASSERT_TRUE(recorder_open(&recorder, path, HEIGHT, WIDTH));
+    TEST_ASSERT_TRUE(record_frame(&recorder, &small, 0));
+    TEST_ASSERT_TRUE(record_frame(&recorder, &large, FRAME_TIME));
+    TEST_ASSERT_TRUE(recorder_close(&recorder, 2 * FRAME_TIME));
+
+    // Cells outside of the canvas are blank, cells outside of the recording
+    // are dropped
+    struct Recording recording;
+    TEST_ASSERT_TRUE(open_recording(&recording, path));
+    TEST_ASSERT_TRUE(seek_recording(&recording, 0));
+    TEST_ASSERT_EQUAL('s', canvas_cell(&recording.canvas, 1, 1)->codepoint);
+    TEST_ASSERT_EQUAL(' ', canvas_cell(&recording.canvas, 1, WIDTH - 1)->codepoint);
+    TEST_ASSERT_TRUE(seek_recording(&recording, 1));
+    TEST_ASSERT_EQUAL(' ', canvas_cell(&recording.canvas, 1, 1)->codepoint);
+    TEST_ASSERT_EQUAL('l', canvas_cell(&recording.canvas, 1, 2)->codepoint);
+    close_recording(&recording);
+
+    free_canvas(&small);
+    free_canvas(&large);
+}
+
+void test_open_invalid_recording(void)
+{
+    struct Recording recording;
+    TEST_ASSERT_FALSE(open_recording(&recording, path));
+
+    record_session();
+    FILE *file = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL(file);
+    static uint8_t data[1 << 16];
+    size_t size = fread(data, 1, sizeof(data), file);
+    fclose(file);
+    TEST_ASSERT_TRUE(size < sizeof(data));
+
+    // Truncated, with a bad magic number, and with a frame that runs past the
+    // end of the canvas
+    const struct
+    {
+        size_t size;
+        size_t at;
+        uint8_t byte;
+    } cases[] = {
+        {size - 1, 0, 'A'},
+        {size, 0, 'X'},
+        {size, RECORDING_HEADER_SIZE + 2, 0x7F},
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i)
+    {
+        uint8_t saved = data[cases[i].at];
+        data[cases[i].at] = cases[i].byte;
+        file = fopen(path, "wb");
+        TEST_ASSERT_NOT_NULL(file);
+        fwrite(data, 1, cases[i].size, file);
+        fclose(file);
+        data[cases[i].at] = saved;
+
+        if (open_recording(&recording, path))
+        {
+            TEST_ASSERT_FALSE(seek_recording(&recording, 0));
+            close_recording(&recording);
+        }
+    }
+
+    // A trailer with more frames than the file has room for, and an index
+    // that would be before the start of the file
+    uint8_t crafted[RECORDING_HEADER_SIZE + RECORDING_TRAILER_SIZE] = RECORDING_MAGIC;
+    const uint32_t header[] = {RECORDING_VERSION, HEIGHT, WIDTH, RECORDING_KEYFRAME_INTERVAL};
+    const uint64_t trailer[] = {3, 0, UINT64_MAX - RECORDING_TRAILER_SIZE + 1};
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int b = 0; b < 4; ++b)
+        {
+            crafted[8 + 4 * i + b] = (uint8_t)(header[i] >> (8 * b));
+        }
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        for (int b = 0; b < 8; ++b)
+        {
+            crafted[RECORDING_HEADER_SIZE + 8 * i + b] = (uint8_t)(trailer[i] >> (8 * b));
+        }
+    }
+    file = fopen(path, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    fwrite(crafted, 1, sizeof(crafted), file);
+    fclose(file);
+    TEST_ASSERT_FALSE(open_recording(&recording, path));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_varint);
+    RUN_TEST(test_replay_in_order);
+    RUN_TEST(test_replay_seek);
+    RUN_TEST(test_record_deltas);
+    RUN_TEST(test_record_resized_canvas);
+    RUN_TEST(test_open_invalid_recording);
+
+    return UNITY_END();
+}
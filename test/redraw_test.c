@@ -0,0 +1,163 @@
+/* Check predicted redraws against positions updated at the predicted times
+ */
+
+#define UNITY_INCLUDE_DOUBLE
+#include "redraw.h"
+#include "src/arena.c"
+#include "src/astro.c"
+#include "src/bit.c"
+#include "src/coord.c"
+#include "src/core.c"
+#include "src/core_position.c"
+#include "src/ephemeris.c"
+#include "src/parse_BSC5.c"
+#include "src/redraw.c"
+#include "unity.c"
+
+#include <math.h>
+
+#define HEIGHT 40
+#define WIDTH 80
+
+// Boston, MA in radians
+static const double latitude = 42.3601 * M_PI / 180;
+static const double longitude = -71.0589 * M_PI / 180;
+static const double julian_date = 2459146.0;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+// Cell a star is drawn in, or -1 when it is below the horizon
+static int star_cell(struct Star *star, double date)
+{
+    update_star_positions(star, 1, date, latitude, longitude);
+    if (star->base.altitude < 0.0)
+    {
+        return -1;
+    }
+
+    double theta_sphere, phi_sphere, radius, theta;
+    horizontal_to_spherical(star->base.azimuth, star->base.altitude, &theta_sphere, &phi_sphere);
+    project_stereographic_north(1.0, theta_sphere, phi_sphere, &radius, &theta);
+
+    int row, col;
+    polar_to_win(radius, theta, HEIGHT, WIDTH, &row, &col);
+    return row * WIDTH + col;
+}
+
+void test_boundary(void)
+{
+    TEST_ASSERT_EQUAL_DOUBLE(0.5, seconds_to_boundary(3.0, 1.0, 0.0));
+    TEST_ASSERT_EQUAL_DOUBLE(0.25, seconds_to_boundary(3.0, -2.0, 0.0));
+    TEST_ASSERT_EQUAL_DOUBLE(0.1, seconds_to_boundary(3.4, 1.0, 0.0));
+    TEST_ASSERT_EQUAL_DOUBLE(0.9, seconds_to_boundary(3.4, -1.0, 0.0));
+    TEST_ASSERT_EQUAL_DOUBLE(INFINITY, seconds_to_boundary(3.4, 0.0, 0.0));
+
+    // Starting at rest, and turning back before reaching a boundary
+    TEST_ASSERT_DOUBLE_WITHIN(1E-12, 1.0, seconds_to_boundary(3.0, 0.0, 1.0));
+    TEST_ASSERT_DOUBLE_WITHIN(1E-12, (1.0 + sqrt(8.0)) / 5.0, seconds_to_boundary(3.2, 1.0, -5.0));
+}
+
+void test_predicted_changes(void)
+{
+    const double max_seconds = 600.0;
+    int num_predicted = 0;
+    int num_tight = 0;
+
+    // Stars over the whole sky. None changes cell before its predicted time.
+    // Those that are not capped nearly all change soon after, but paths curve
+    // so some predictions are early
+    for (int ra = 0; ra < 360; ra += 7)
+    {
+        for (int dec = -85; dec <= 85; dec += 5)
+        {
+            struct Star star = {
+                .right_ascension = ra * M_PI / 180,
+                .declination = dec * M_PI / 180,
+            };
+            int cell = star_cell(&star, julian_date);
+
+            struct RedrawPrediction prediction;
+            begin_redraw_prediction(&prediction, HEIGHT, WIDTH, latitude, 1.0f, max_seconds);
+            predict_object_change(&prediction, star.base.azimuth, star.base.altitude);
+
+            double days = prediction.seconds / 86400.0;
+            TEST_ASSERT_EQUAL_INT(cell, star_cell(&star, julian_date + days * 0.95));
+            if (prediction.seconds < max_seconds)
+            {
+                num_tight += cell != star_cell(&star, julian_date + days * 1.2);
+                ++num_predicted;
+            }
+        }
+    }
+
+    TEST_ASSERT_GREATER_THAN_INT(100, num_predicted);
+    TEST_ASSERT_GREATER_THAN_INT(num_predicted * 95 / 100, num_tight);
+}
+
+void test_earliest_change(void)
+{
+    // Points that cannot change first are skipped, without changing the
+    // prediction
+    struct RedrawPrediction all;
+    begin_redraw_prediction(&all, HEIGHT, WIDTH, latitude, 1.0f, INFINITY);
+    double earliest = INFINITY;
+
+    for (int ra = 0; ra < 360; ra += 3)
+    {
+        for (int dec = -88; dec <= 88; dec += 4)
+        {
+            struct Star star = {
+                .right_ascension = ra * M_PI / 180,
+                .declination = dec * M_PI / 180,
+            };
+            update_star_positions(&star, 1, julian_date, latitude, longitude);
+
+            struct RedrawPrediction one;
+            begin_redraw_prediction(&one, HEIGHT, WIDTH, latitude, 1.0f, INFINITY);
+            predict_object_change(&one, star.base.azimuth, star.base.altitude);
+            predict_object_change(&all, star.base.azimuth, star.base.altitude);
+            earliest = MIN(earliest, one.seconds);
+        }
+    }
+
+    TEST_ASSERT_EQUAL_DOUBLE(earliest, all.seconds);
+}
+
+void test_speed_and_size(void)
+{
+    // An object a little above the eastern horizon
+    double azimuth = M_PI / 2;
+    double altitude = 0.1;
+
+    struct RedrawPrediction slow, fast, large, still;
+    begin_redraw_prediction(&slow, HEIGHT, WIDTH, latitude, 1.0f, INFINITY);
+    begin_redraw_prediction(&fast, HEIGHT, WIDTH, latitude, 60.0f, INFINITY);
+    begin_redraw_prediction(&large, HEIGHT * 4, WIDTH * 4, latitude, 1.0f, INFINITY);
+    begin_redraw_prediction(&still, HEIGHT, WIDTH, latitude, 0.0f, 10.0);
+    predict_object_change(&slow, azimuth, altitude);
+    predict_object_change(&fast, azimuth, altitude);
+    predict_object_change(&large, azimuth, altitude);
+    predict_object_change(&still, azimuth, altitude);
+
+    TEST_ASSERT_DOUBLE_WITHIN(slow.seconds * 1E-6, slow.seconds / 60.0, fast.seconds);
+    TEST_ASSERT_TRUE(large.seconds < slow.seconds);
+    TEST_ASSERT_EQUAL_DOUBLE(10.0, still.seconds);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_boundary);
+    RUN_TEST(test_predicted_changes);
+    RUN_TEST(test_earliest_change);
+    RUN_TEST(test_speed_and_size);
+
+    return UNITY_END();
+}
@@ -0,0 +1,294 @@
+/* Check the vectorized star kernel against the scalar update_star_positions
+ */
+
+#define UNITY_INCLUDE_DOUBLE
+#include "bsc5.h"
+#include "bsc5_constellations.h"
+#include "bsc5_names.h"
+#include "bsc5_tables.h"
+#include "src/arena.c"
+#include "src/astro.c"
+#include "src/bit.c"
+#include "src/coord.c"
+#include "src/core.c"
+#include "src/core_position.c"
+#include "src/ephemeris.c"
+#include "src/parse_BSC5.c"
+#include "src/pool.c"
+#include "src/star_buffer.c"
+#include "src/strptime.c"
+#include "macros.h"
+#include "unity.c"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static unsigned int num_stars;
+static struct Catalog catalog;
+static struct Arena arena;
+static struct StarName *name_table;
+static struct Star *star_table;
+static struct ConstellTable constell_table;
+static int *num_by_mag;
+static struct StarBuffer star_buffer;
+
+void setUp(void)
+{
+    open_catalog(&catalog, bsc5, bsc5_len);
+    arena_create(&arena, name_table_arena_size(bsc5_names_len, catalog.num_entries) +
+                             constell_table_arena_size(bsc5_constellations, bsc5_constellations_len) +
+                             star_tables_arena_size(catalog.num_entries) + star_sort_arena_size(catalog.num_entries) +
+                             star_buffer_arena_size(catalog.num_entries, BSC5_NUM_CONSTELL_SEGMENTS));
+    generate_name_table(&arena, bsc5_names, bsc5_names_len, &name_table, catalog.num_entries);
+    num_stars = catalog.num_entries;
+    generate_star_table(&arena, &star_table, num_stars, &catalog, name_table, INFINITY);
+    star_numbers_by_magnitude(&arena, &num_by_mag, star_table, num_stars);
+    generate_constell_table(&arena, bsc5_constellations, bsc5_constellations_len, &constell_table);
+    generate_star_buffer(&arena, &star_buffer, star_table, num_by_mag, num_stars);
+}
+
+void tearDown(void)
+{
+    arena_destroy(&arena);
+}
+
+// The buffer applies proper motion to first order, so allow a little slack
+// for the fastest moving stars decades from J2000
+#define EPSILON 1E-6
+
+// Difference between two angles, accounting for wrap around
+static double angle_diff(double a, double b)
+{
+    double d = fmod(fabs(a - b), 2.0 * M_PI);
+    return d > M_PI ? 2.0 * M_PI - d : d;
+}
+
+static void check_against_scalar(double julian_date, double latitude, double longitude)
+{
+    update_star_positions(star_table, num_stars, julian_date, latitude, longitude);
+    struct Star *expected = malloc(num_stars * sizeof(struct Star));
+    memcpy(expected, star_table, num_stars * sizeof(struct Star));
+
+    update_star_buffer(&star_buffer, julian_date, latitude, longitude);
+    star_buffer_to_table(&star_buffer, star_table);
+
+    for (unsigned int i = 0; i < num_stars; ++i)
+    {
+        // Stars of culled tiles only need to stay below the horizon
+        if (expected[i].base.altitude < EPSILON)
+        {
+            TEST_ASSERT_TRUE(star_table[i].base.altitude < EPSILON);
+            continue;
+        }
+
+        // Azimuth is ill-conditioned near the zenith
+        if (expected[i].base.altitude < M_PI / 2 - 1E-3)
+        {
+            TEST_ASSERT_DOUBLE_WITHIN(EPSILON, 0.0, angle_diff(expected[i].base.azimuth, star_table[i].base.azimuth));
+        }
+        TEST_ASSERT_DOUBLE_WITHIN(EPSILON, expected[i].base.altitude, star_table[i].base.altitude);
+    }
+
+    free(expected);
+}
+
+void test_update_star_buffer_boston(void)
+{
+    // 2020 October 23 12:00:00.0 UT1, Boston, MA
+    check_against_scalar(2459146.0, 42.3601 * M_PI / 180, -71.0589 * M_PI / 180);
+}
+
+void test_update_star_buffer_extremes(void)
+{
+    // Poles, equator, and dates far from J2000
+    check_against_scalar(2451545.0, M_PI / 2, 0.0);
+    check_against_scalar(2440000.5, -M_PI / 2, M_PI);
+    check_against_scalar(2470000.25, 0.0, -M_PI);
+}
+
+void test_star_buffer_unit_vectors(void)
+{
+    // Rotation preserves length
+    update_star_buffer(&star_buffer, 2459146.0, 0.5, 0.5);
+
+    for (int a = 0; a < star_buffer.num_active; ++a)
+    {
+        const struct StarTile *tile = &star_buffer.tiles[star_buffer.active_tiles[a]];
+        for (int i = tile->first_visible; i < tile->end; ++i)
+        {
+            double xh = star_buffer.xh[i], yh = star_buffer.yh[i], zh = star_buffer.zh[i];
+            TEST_ASSERT_DOUBLE_WITHIN(EPSILON, 1.0, sqrt(xh * xh + yh * yh + zh * zh));
+        }
+    }
+}
+
+void test_star_buffer_to_table_threshold(void)
+{
+    // Stars dimmer than the threshold are left alone
+    for (unsigned int i = 0; i < num_stars; ++i)
+    {
+        star_table[i].base.azimuth = -1.0;
+    }
+
+    int first_visible = set_star_buffer_threshold(&star_buffer, 3.0f);
+    update_star_buffer(&star_buffer, 2459146.0, 0.5, 0.5);
+    star_buffer_to_table(&star_buffer, star_table);
+
+    // The visible stars are exactly the tail of num_by_mag
+    for (unsigned int i = 0; i < num_stars; ++i)
+    {
+        float magnitude = star_table[num_by_mag[i] - 1].magnitude;
+        TEST_ASSERT_EQUAL((int)i >= first_visible, magnitude <= 3.0f);
+    }
+
+    for (unsigned int i = 0; i < num_stars; ++i)
+    {
+        if (star_table[i].magnitude > 3.0f)
+        {
+            TEST_ASSERT_EQUAL_DOUBLE(-1.0, star_table[i].base.azimuth);
+        }
+        else
+        {
+            // Converted, or marked below the horizon with its tile
+            TEST_ASSERT_TRUE(star_table[i].base.azimuth >= 0.0 || star_table[i].base.altitude == -M_PI / 2);
+        }
+    }
+}
+
+void test_star_tiles(void)
+{
+    // Tiles partition the buffer and every star is inside its tile's cone
+    int expected_begin = 0;
+    for (int t = 0; t < NUM_STAR_TILES; ++t)
+    {
+        const struct StarTile *tile = &star_buffer.tiles[t];
+        TEST_ASSERT_EQUAL_INT(expected_begin, tile->begin);
+        expected_begin = tile->end;
+
+        for (int i = tile->begin; i < tile->end; ++i)
+        {
+            double cos_angle = tile->center[0] * star_buffer.x[i] + tile->center[1] * star_buffer.y[i] +
+                               tile->center[2] * star_buffer.z[i];
+            TEST_ASSERT_TRUE(acos(fmin(cos_angle, 1.0)) <= tile->radius);
+
+            // Dimmest first
+            if (i > tile->begin)
+            {
+                TEST_ASSERT_TRUE(star_buffer.magnitude[i - 1] >= star_buffer.magnitude[i]);
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL_INT((int)num_stars, expected_begin);
+
+    // Close to half the sky is below the horizon
+    update_star_buffer(&star_buffer, 2459146.0, 0.7, 0.0);
+
+    int culled = 0;
+    for (int t = 0; t < NUM_STAR_TILES; ++t)
+    {
+        culled += star_buffer.tiles[t].culled;
+    }
+    TEST_ASSERT_TRUE(culled > NUM_STAR_TILES / 3);
+}
+
+void test_pin_constellation_stars(void)
+{
+    // Constellation stars are updated even in culled tiles
+    TEST_ASSERT_TRUE(pin_constellation_stars(&arena, &star_buffer, &constell_table));
+
+    const double julian_date = 2459146.0, latitude = 0.7, longitude = 0.0;
+
+    update_star_positions(star_table, num_stars, julian_date, latitude, longitude);
+    struct Star *expected = malloc(num_stars * sizeof(struct Star));
+    memcpy(expected, star_table, num_stars * sizeof(struct Star));
+
+    update_star_buffer(&star_buffer, julian_date, latitude, longitude);
+    star_buffer_to_table(&star_buffer, star_table);
+
+    for (unsigned int j = 0; j < 2 * constell_table.offsets[constell_table.num_constells]; ++j)
+    {
+        int i = constell_table.ends[j];
+        TEST_ASSERT_DOUBLE_WITHIN(EPSILON, expected[i].base.altitude, star_table[i].base.altitude);
+    }
+
+    free(expected);
+}
+
+void test_update_stars_parallel(void)
+{
+    // Threaded updates must match the single-threaded path exactly
+    struct Star *expected = malloc(num_stars * sizeof(struct Star));
+
+    pin_constellation_stars(&arena, &star_buffer, &constell_table);
+
+    int thread_counts[] = {1, 2, 3, 7};
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t)
+    {
+        struct Pool pool;
+        TEST_ASSERT_TRUE(pool_create(&pool, thread_counts[t]));
+
+        // Odd thresholds leave the visible range unaligned with the SIMD width
+        set_star_buffer_threshold(&star_buffer, 4.7f + 0.1f * t);
+
+        for (double jd = 2440000.5; jd < 2470000.0; jd += 2999.7)
+        {
+            update_star_buffer(&star_buffer, jd, 0.7, -1.2);
+            star_buffer_to_table(&star_buffer, star_table);
+            memcpy(expected, star_table, num_stars * sizeof(struct Star));
+
+            update_stars_parallel(&pool, &star_buffer, star_table, jd, 0.7, -1.2);
+            TEST_ASSERT_EQUAL_MEMORY(expected, star_table, num_stars * sizeof(struct Star));
+        }
+
+        pool_destroy(&pool);
+    }
+
+    free(expected);
+}
+
+void test_simd_math(void)
+{
+#if SIMD_LANES > 1
+    double in[SIMD_LANES], out_sin[SIMD_LANES], out_cos[SIMD_LANES], out_atan[SIMD_LANES];
+
+    for (double angle = -M_PI; angle <= M_PI; angle += 0.001)
+    {
+        for (int l = 0; l < SIMD_LANES; ++l)
+        {
+            in[l] = angle + l * 1E-4;
+        }
+
+        vf64 s, c;
+        v_sincos(v_load(in), &s, &c);
+        v_store(out_sin, s);
+        v_store(out_cos, c);
+        v_store(out_atan, v_atan2(s, c));
+
+        for (int l = 0; l < SIMD_LANES; ++l)
+        {
+            TEST_ASSERT_DOUBLE_WITHIN(1E-14, sin(in[l]), out_sin[l]);
+            TEST_ASSERT_DOUBLE_WITHIN(1E-14, cos(in[l]), out_cos[l]);
+            TEST_ASSERT_DOUBLE_WITHIN(1E-14, atan2(out_sin[l], out_cos[l]), out_atan[l]);
+        }
+    }
+#else
+    TEST_IGNORE_MESSAGE("SIMD not available");
+#endif
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_update_star_buffer_boston);
+    RUN_TEST(test_update_star_buffer_extremes);
+    RUN_TEST(test_star_buffer_unit_vectors);
+    RUN_TEST(test_star_buffer_to_table_threshold);
+    RUN_TEST(test_star_tiles);
+    RUN_TEST(test_pin_constellation_stars);
+    RUN_TEST(test_update_stars_parallel);
+    RUN_TEST(test_simd_math);
+
+    return UNITY_END();
+}
@@ -55,6 +55,22 @@ void test_sw_timediff_usec_should_calculate_difference(void)
     TEST_ASSERT_NOT_EQUAL(0, diff);
 }
 
+void test_sw_timediff_nsec_should_match_usec(void)
+{
+    struct SwTimestamp start, end;
+    unsigned long long nsec, usec;
+
+    TEST_ASSERT_EQUAL(0, sw_gettime(&start));
+    sw_sleep(1000);
+    TEST_ASSERT_EQUAL(0, sw_gettime(&end));
+
+    TEST_ASSERT_EQUAL(0, sw_timediff_nsec(end, start, &nsec));
+    TEST_ASSERT_EQUAL(0, sw_timediff_usec(end, start, &usec));
+
+    TEST_ASSERT_NOT_EQUAL(0, nsec);
+    TEST_ASSERT_EQUAL_UINT64(usec, nsec / 1000ULL);
+}
+
 void test_sw_sleep_should_pause_execution(void)
 {
     struct SwTimestamp start, end;
@@ -78,6 +94,7 @@ int main(void)
 
     RUN_TEST(test_sw_gettime_should_return_success);
     RUN_TEST(test_sw_timediff_usec_should_calculate_difference);
+    RUN_TEST(test_sw_timediff_nsec_should_match_usec);
     RUN_TEST(test_sw_sleep_should_pause_execution);
 
     return UNITY_END();
@@ -0,0 +1,57 @@
+#include "term.h"
+#include "src/stopwatch.c"
+#include "src/term.c"
+#include "unity.c"
+
+#include <stdio.h>
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_output_counters(void)
+{
+    unsigned long long bytes, writes;
+    if (!output_counters(&bytes, &writes))
+    {
+        TEST_IGNORE_MESSAGE("Output is not counted on this system");
+    }
+
+    // Every byte passed to write is counted, with the call
+    FILE *stream = fopen("/dev/null", "w");
+    TEST_ASSERT_NOT_NULL(stream);
+    char buffer[1000] = {0};
+    setvbuf(stream, NULL, _IONBF, 0);
+    fwrite(buffer, 1, sizeof(buffer), stream);
+    fclose(stream);
+
+    unsigned long long after_bytes, after_writes;
+    TEST_ASSERT_TRUE(output_counters(&after_bytes, &after_writes));
+    TEST_ASSERT_TRUE(after_bytes - bytes >= sizeof(buffer));
+    TEST_ASSERT_TRUE(after_writes - writes >= 1);
+}
+
+void test_paced_frame_usec(void)
+{
+    // 24 fps without a budget, or with frames within it
+    TEST_ASSERT_EQUAL_UINT64(41666, paced_frame_usec(41666, 5000.0, 0.0));
+    TEST_ASSERT_EQUAL_UINT64(41666, paced_frame_usec(41666, 5000.0, 1.0E6));
+
+    // Frames of 5 kB over 10 kB/s are sent twice a second
+    TEST_ASSERT_EQUAL_UINT64(500000, paced_frame_usec(41666, 5000.0, 10000.0));
+    TEST_ASSERT_EQUAL_UINT64(41666, paced_frame_usec(41666, 0.0, 10000.0));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_output_counters);
+    RUN_TEST(test_paced_frame_usec);
+
+    return UNITY_END();
+}